@@ -239,6 +239,31 @@ sx_status_t fx_logical_port_get(fx_handle_t handle, uint32_t label_port, sx_port
  */
 sx_status_t fx_table_entry_add(fx_handle_t handle, const fx_table_id_t table_id, const fx_action_id_t action_id, fx_key_list_t keys, fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr);
 sx_status_t fx_table_entry_remove(fx_handle_t handle, const fx_table_id_t table_id, sx_acl_rule_offset_t offset);
+/**
+ * @brief These functions add/remove several entries of a table, the rules are written
+ *      with a single SDK call. If the SDK call fails, the rules are retried one by one.
+ *      Supported devices: Spectrum.
+ *
+ * @param[in] handle          - handle to api calls
+ * @param[in] table_id        - ID (enum) of the table type
+ * @param[in] entry_count     - number of entries
+ * @param[in] action_ids      - action of each entry
+ * @param[in] keys            - byte array of keys of each entry
+ * @param[in] params          - byte array of parameters of each entry
+ * @param[in,out] offsets     - offset of each entry in the acl table (assigned for exact match tables)
+ * @param[out] entry_statuses - status of each entry
+ *
+ * @return sx_status_t:
+ * @return SX_STATUS_SUCCESS - All the entries are added/removed
+ * @return SX_STATUS_ERROR - Some of the entries failed, see entry_statuses
+ * @return SX_STATUS_PARAM_ERROR - Input parameters error
+ * @return SX_STATUS_NO_MEMORY - Memory allocation failed
+ */
+sx_status_t fx_table_entries_add(fx_handle_t handle, const fx_table_id_t table_id, uint32_t entry_count,
+        const fx_action_id_t *action_ids, const fx_key_list_t *keys, const fx_param_list_t *params,
+        sx_acl_rule_offset_t *offsets, sx_status_t *entry_statuses);
+sx_status_t fx_table_entries_remove(fx_handle_t handle, const fx_table_id_t table_id, uint32_t entry_count,
+        sx_acl_rule_offset_t *offsets, sx_status_t *entry_statuses);
 sx_status_t fx_table_entry_default_set(fx_handle_t handle, const fx_table_id_t table_id, const fx_action_id_t action_id, fx_param_list_t params);
 sx_status_t fx_table_entry_get(fx_handle_t handle, const fx_table_id_t table_id, sx_acl_rule_offset_t offset, fx_action_id_t *action_id, fx_key_list_t *keys, fx_param_list_t *params);
 sx_status_t fx_table_entry_count_get(fx_handle_t handle, const fx_table_id_t table_id, uint32_t *entry_count);
@@ -23,20 +23,27 @@ extern "C"{
 #endif
 
 
-#define BITVEC_LEN 12
-#define MAX_RANGE_ENTRIES 12 // The maximal number of supported range entries - currenly 12 (limited by action ids, TODO can be more for multi range with same action)
+#define BITVEC_LEN 12 // number of metadata bits, ranges that share an action id share a bit
+#define MAX_RANGE_ENTRIES 0xFFFF // The maximal number of range entries - limited by the sx_acl_rule_offset_t handle
 #define RANGE_WDT 32 // 32 bit is the maximal range type supported
+#define MAX_SEGMENT_ACL_RULES (2 * (RANGE_WDT - 1)) // worst case number of prefixes that cover an interval
 
 
 typedef uint8_t fx_range_action_id_t; // in [0,11] - the bit in the metadata that will be set upon range match
 
-typedef struct fx_comperator_ll_node_t{
-	uint32_t comparison_value; // the value for the range cut. Currentl only samller then is implemented.
-	uint8_t  num_of_acl_rules; // number of acl rules needed to implement the comperator.
-	uint32_t num_of_range_rules; // number of range rules that uses this comperator. if 0, node can be deleted.
-	uint16_t action_bitvec;	// bit vector values that will be set if  key is between this node comparison value and the next node.
-	struct fx_comperator_ll_node_t* next;
-} fx_comperator_ll_node_t;
+/* The key space is cut by the range bounds to disjoint segments, kept sorted by start value.
+ * Since segments do not overlap, the acl rules of a segment can sit at any offset of the region
+ * and a range change only rewrites the rules of the segments it touches.
+ */
+typedef struct fx_range_segment_t{
+	uint32_t start; // the segment covers [start, start of next segment)
+	uint32_t num_of_range_bounds; // number of range entries starting or ending at start. if 0, segment is merged to the previous one.
+	uint32_t action_refcnt[BITVEC_LEN]; // number of range entries of each action id that cover the segment.
+	uint16_t action_bitvec;	// bit vector values that will be set if key is in the segment.
+	boolean_t dirty; // acl rules of the segment should be rewritten.
+	uint8_t  num_of_acl_rules; // number of acl rules programmed for the segment.
+	sx_acl_rule_offset_t acl_offsets[MAX_SEGMENT_ACL_RULES];
+} fx_range_segment_t;
 
 typedef struct fx_range_entry_t{
 	uint32_t start;
@@ -48,10 +55,20 @@ typedef struct fx_range_entry_t{
 }fx_range_entry_t;
 
 typedef struct fx_range_table_t {
-	// TODO add default action? currently 12'd0.
-	fx_comperator_ll_node_t* comperator_ll_start;
-	fx_comperator_ll_node_t* backup_comperator_ll_start; // each range change/add/remove that will fail, will use this list to revert configuration.
-	fx_range_entry_t range_entries_list[MAX_RANGE_ENTRIES];
+	// TODO add default action? currently 12'd0, keys out of all ranges hit no rule.
+	fx_range_segment_t* segments; // sorted by start, segments[0].start is always 0.
+	uint32_t segments_count;
+	uint32_t segments_size;
+	fx_range_entry_t* range_entries_list;
+	uint32_t range_entries_size;
+	uint32_t dirty_segments_count;
+	sx_acl_rule_offset_t* released_offsets; // offsets of rewritten segments, still programmed in the ASIC.
+	uint32_t released_offsets_count;
+	sx_acl_rule_offset_t* free_offsets; // offsets that are not programmed and can be reused.
+	uint32_t free_offsets_count;
+	uint32_t offsets_size; // size of released_offsets and free_offsets.
+	uint32_t next_offset; // high water mark of used offsets.
+	uint32_t region_size; // number of offsets in the acl region of the table.
 }fx_range_table_t;
 
 
@@ -60,17 +77,22 @@ typedef struct fx_range_table_t {
 void print_bits(uint32_t x,uint32_t n);
 void print_bits_w_mask(uint32_t x,uint32_t m);
 uint8_t fx_count_set_bits(uint32_t n);
-uint32_t fx_range_count_acl_rules(fx_comperator_ll_node_t* comperator_ll_node);
-fx_comperator_ll_node_t* fx_range_cfg_comperator(uint32_t comperator_value, uint32_t num_of_range_rules, uint16_t action_bitvec, fx_comperator_ll_node_t* next);
-void fx_range_delete_ll(fx_comperator_ll_node_t** node);
-sx_status_t fx_range_copy_ll(fx_comperator_ll_node_t* orig_node, fx_comperator_ll_node_t** copy_node);
-void fx_range_update_action_bitvec(fx_range_table_t* range_table);
-void fx_get_key_mask_recursive(uint32_t comperator_value, uint8_t bit_indx, uint8_t rule_indx,uint32_t* acl_key_list, uint32_t* acl_mask_list);
-sx_status_t fx_range_add_comperator(fx_range_table_t* range_table, uint32_t comparison_value);
-sx_status_t fx_range_remove_comperator(fx_range_table_t* range_table, uint32_t comparison_value);
+uint8_t fx_range_segment_prefixes(uint32_t lo, uint64_t hi, uint32_t key_list[], uint32_t mask_list[]);
+sx_status_t fx_range_add_bound(fx_range_table_t* range_table, uint32_t value);
+void fx_range_remove_bound(fx_range_table_t* range_table, uint32_t value);
+void fx_range_update_action_bitvec(fx_range_table_t* range_table, uint32_t start, uint32_t end, fx_range_action_id_t action_id, boolean_t is_add);
+
+/* Range table API.
+ * After adding or removing ranges, only the acl rules of changed segments are compiled:
+ *   fx_range_get_rules_list_count() / fx_range_compile_rules() - rules to set,
+ *   fx_range_get_removed_rules_count() / fx_range_compile_removed_rules() - offsets to delete.
+ * The rules to set should be written before the offsets are deleted.
+ */
 uint32_t fx_range_get_rules_list_count(fx_range_table_t* range_table);
 sx_status_t fx_range_compile_rules(fx_range_table_t* range_table, fx_key_list_t keys[],fx_param_list_t action_params[], sx_acl_rule_offset_t offsets_list[],uint32_t rule_cnt);
-sx_status_t fx_range_init_table(fx_range_table_t** range_table);
+uint32_t fx_range_get_removed_rules_count(fx_range_table_t* range_table);
+sx_status_t fx_range_compile_removed_rules(fx_range_table_t* range_table, sx_acl_rule_offset_t offsets_list[], uint32_t rule_cnt);
+sx_status_t fx_range_init_table(fx_range_table_t** range_table, uint32_t region_size);
 sx_status_t fx_add_range_entry(fx_range_table_t* range_table, uint32_t start,uint32_t end, fx_range_action_id_t action_id,sx_acl_rule_offset_t* range_entry_handle);
 sx_status_t fx_remove_range_entry(fx_range_table_t* range_table, sx_acl_rule_offset_t range_entry_handle);
 sx_status_t fx_range_deinit_table(fx_range_table_t* range_table);
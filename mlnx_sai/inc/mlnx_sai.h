@@ -155,6 +155,7 @@ int msync(void *addr, size_t length, int flags);
 
 extern sx_api_handle_t            gh_sdk;
 extern sai_service_method_table_t g_mlnx_services;
+extern sai_switch_profile_id_t    g_profile_id;
 extern rm_resources_t             g_resource_limits;
 extern sx_log_cb_t                sai_log_cb;
 
@@ -222,7 +223,8 @@ extern const sai_bmtor_api_t            mlnx_bmtor_api;
 #define DEFAULT_TRAP_GROUP_ID           0
 #define RECV_ATTRIBS_NUM                3
 #define FDB_NOTIF_ATTRIBS_NUM           3
-#define FDB_OR_ROUTE_SAVED_ACTIONS_NUM  100
+/* Slots in the saved actions hash table, must be a power of 2. Up to 7/8 of the slots are used */
+#define FDB_OR_ROUTE_SAVED_ACTIONS_NUM  (32 * 1024)
 
 #define SAI_INVALID_STP_INSTANCE (SX_MSTP_INST_ID_MAX + 1)
 
@@ -281,25 +283,60 @@ typedef enum {
     MLNX_SHM_RM_ARRAY_TYPE_MIN,
     MLNX_SHM_RM_ARRAY_TYPE_RIF = MLNX_SHM_RM_ARRAY_TYPE_MIN,
     MLNX_SHM_RM_ARRAY_TYPE_BRIDGE,
-    MLNX_SHM_RM_ARRAY_TYPE_MAX = MLNX_SHM_RM_ARRAY_TYPE_BRIDGE,
+    MLNX_SHM_RM_ARRAY_TYPE_NHG_SHADOW,
+    MLNX_SHM_RM_ARRAY_TYPE_NEIGH_SHADOW,
+    MLNX_SHM_RM_ARRAY_TYPE_MAX = MLNX_SHM_RM_ARRAY_TYPE_NEIGH_SHADOW,
     MLNX_SHM_RM_ARRAY_TYPE_SIZE
 } mlnx_shm_rm_array_type_t;
 typedef sai_status_t (*mlnx_shm_rm_size_get_fn)(_Out_ size_t *size);
 typedef bool (*mlnx_shm_rm_array_cmp_fn)(_In_ const void *elem, _In_ const void *data);
+/* Links between elements are stored as indexes, so the arrays stay valid when mapped at a different address */
+#define MLNX_SHM_RM_ARRAY_LINK_NONE (UINT32_MAX)
 typedef struct _mlnx_shm_rm_array_info_t {
-    size_t elem_size;
-    size_t elem_count; /* initialized via elem_count_fn()*/
-    size_t offset_to_head;
+    size_t   elem_size;
+    size_t   elem_count; /* initialized via elem_count_fn()*/
+    size_t   offset_to_head;
+    uint32_t free_head; /* first element of the free list */
+    size_t   key_bucket_count; /* 0 if array has no key index */
+    size_t   offset_to_key_buckets;
 } mlnx_shm_rm_array_info_t;
 typedef struct _mlnx_shm_rm_array_init_info_t {
     size_t                  elem_size;
     mlnx_shm_rm_size_get_fn elem_count_fn;
     size_t                  elem_count; /* initialized via elem_count_fn()*/
+    bool                    key_index; /* maintain a hash index for mlnx_shm_rm_array_find_by_key() */
 } mlnx_shm_rm_array_init_info_t;
+/* Reverse index sx_port_log_id_t -> DB index. Open addressing hash, log_port 0 (CPU port) marks a free slot */
+typedef struct _mlnx_log_port_map_entry_t {
+    sx_port_log_id_t log_port;
+    uint32_t         idx;
+} mlnx_log_port_map_entry_t;
+
+/* Sizes must be a power of 2 and leave enough free slots for ports_db and bridge_ports_db */
+#define MLNX_PORT_LOG_MAP_SIZE        (1024)
+#define MLNX_BRIDGE_PORT_LOG_MAP_SIZE (256 * 1024)
+
+sai_status_t mlnx_log_port_map_set(_Inout_ mlnx_log_port_map_entry_t *map,
+                                   _In_ uint32_t                      size,
+                                   _In_ sx_port_log_id_t              log_port,
+                                   _In_ uint32_t                      idx);
+sai_status_t mlnx_log_port_map_get(_In_ const mlnx_log_port_map_entry_t *map,
+                                   _In_ uint32_t                         size,
+                                   _In_ sx_port_log_id_t                 log_port,
+                                   _Out_ uint32_t                       *idx);
+void mlnx_log_port_map_del(_Inout_ mlnx_log_port_map_entry_t *map,
+                           _In_ uint32_t                      size,
+                           _In_ sx_port_log_id_t              log_port,
+                           _In_ uint32_t                      idx);
+
 typedef uint16_t mlnx_shm_array_canary_t;
 typedef struct _mlnx_shm_array_t {
     bool                    is_used;
     mlnx_shm_array_canary_t canary;
+    bool                    is_keyed;
+    uint32_t                free_next;
+    uint32_t                key_next;
+    uint64_t                key;
 } mlnx_shm_array_hdr_t;
 
 PACKED(struct _mlnx_shm_rm_array_idx_t {
@@ -324,6 +361,11 @@ sai_status_t mlnx_shm_rm_array_find(_In_ mlnx_shm_rm_array_type_t  type,
                                     _In_ const void               *data,
                                     _Out_ mlnx_shm_rm_array_idx_t *idx,
                                     _Out_ void                   **elem);
+sai_status_t mlnx_shm_rm_array_key_set(_In_ mlnx_shm_rm_array_idx_t idx, _In_ uint64_t key);
+sai_status_t mlnx_shm_rm_array_find_by_key(_In_ mlnx_shm_rm_array_type_t  type,
+                                           _In_ uint64_t                  key,
+                                           _Out_ mlnx_shm_rm_array_idx_t *idx,
+                                           _Out_ void                   **elem);
 sai_status_t mlnx_shm_rm_array_idx_to_ptr(_In_ mlnx_shm_rm_array_idx_t idx, _Out_ void                   **elem);
 uint32_t mlnx_shm_rm_array_size_get(_In_ mlnx_shm_rm_array_type_t type);
 
@@ -429,6 +471,39 @@ typedef struct _mlnx_rif_db_t {
 
 sai_status_t mlnx_bmtor_rif_event_add(_In_ sx_router_interface_t sx_rif);
 sai_status_t mlnx_bmtor_rif_event_del(_In_ sx_router_interface_t sx_rif);
+sai_status_t mlnx_create_table_bitmap_classification_entries(_In_ sai_object_id_t          switch_id,
+                                                             _In_ uint32_t                 object_count,
+                                                             _In_ const uint32_t          *attr_count,
+                                                             _In_ const sai_attribute_t  **attr_list,
+                                                             _In_ sai_bulk_op_error_mode_t mode,
+                                                             _Out_ sai_object_id_t        *object_id,
+                                                             _Out_ sai_status_t           *object_statuses);
+sai_status_t mlnx_remove_table_bitmap_classification_entries(_In_ uint32_t                 object_count,
+                                                             _In_ const sai_object_id_t   *object_id,
+                                                             _In_ sai_bulk_op_error_mode_t mode,
+                                                             _Out_ sai_status_t           *object_statuses);
+sai_status_t mlnx_create_table_bitmap_router_entries(_In_ sai_object_id_t          switch_id,
+                                                     _In_ uint32_t                 object_count,
+                                                     _In_ const uint32_t          *attr_count,
+                                                     _In_ const sai_attribute_t  **attr_list,
+                                                     _In_ sai_bulk_op_error_mode_t mode,
+                                                     _Out_ sai_object_id_t        *object_id,
+                                                     _Out_ sai_status_t           *object_statuses);
+sai_status_t mlnx_remove_table_bitmap_router_entries(_In_ uint32_t                 object_count,
+                                                     _In_ const sai_object_id_t   *object_id,
+                                                     _In_ sai_bulk_op_error_mode_t mode,
+                                                     _Out_ sai_status_t           *object_statuses);
+sai_status_t mlnx_create_table_meta_tunnel_entries(_In_ sai_object_id_t          switch_id,
+                                                   _In_ uint32_t                 object_count,
+                                                   _In_ const uint32_t          *attr_count,
+                                                   _In_ const sai_attribute_t  **attr_list,
+                                                   _In_ sai_bulk_op_error_mode_t mode,
+                                                   _Out_ sai_object_id_t        *object_id,
+                                                   _Out_ sai_status_t           *object_statuses);
+sai_status_t mlnx_remove_table_meta_tunnel_entries(_In_ uint32_t                 object_count,
+                                                   _In_ const sai_object_id_t   *object_id,
+                                                   _In_ sai_bulk_op_error_mode_t mode,
+                                                   _Out_ sai_status_t           *object_statuses);
 
 /* This DB structure is for the special type of router interface - bridge router interface,
  * if in case it will be needed to store any kind of RIF in the DB then it is better to rename
@@ -469,8 +544,14 @@ typedef struct _mlnx_fdb_cache_t {
     sx_ip_addr_t               endpoint_ip;
     bool                       fdb_cache_set;
 } mlnx_fdb_cache_t;
+typedef struct _mlnx_acl_counter_cache_t {
+    uint64_t bytes;
+    uint64_t packets;
+    bool     counter_cache_set;
+} mlnx_acl_counter_cache_t;
 typedef union {
-    mlnx_fdb_cache_t fdb_cache;
+    mlnx_fdb_cache_t         fdb_cache;
+    mlnx_acl_counter_cache_t acl_counter_cache;
 } vendor_cache_t;
 typedef sai_status_t (*sai_attribute_get_fn)(_In_ const sai_object_key_t *key, _Inout_ sai_attribute_value_t *value,
                                              _In_ uint32_t attr_index, _Inout_ vendor_cache_t *cache, void *arg);
@@ -584,6 +665,8 @@ sai_status_t check_port_type_attr(const sai_object_id_t *ports,
                                   attr_port_type_check_t check,
                                   sai_attr_id_t          attr_id,
                                   uint32_t               idx);
+sai_status_t mlnx_attr_dispatch_tables_init(void);
+void mlnx_attr_dispatch_tables_deinit(void);
 sai_status_t check_attribs_metadata(_In_ uint32_t                            attr_count,
                                     _In_ const sai_attribute_t              *attr_list,
                                     _In_ sai_object_type_t                   object_type,
@@ -628,6 +711,7 @@ sai_status_t mlnx_bulk_statuses_print(_In_ const char         *object_type_str,
                                       _In_ const sai_status_t *object_statuses,
                                       _In_ uint32_t            object_count,
                                       _In_ sai_common_api_t    api);
+uint64_t mlnx_time_us_get(void);
 sai_status_t mlnx_sai_query_attribute_capability_impl(_In_ sai_object_id_t         switch_id,
                                                       _In_ sai_object_type_t       object_type,
                                                       _In_ sai_attr_id_t           attr_id,
@@ -668,6 +752,71 @@ sai_status_t mlnx_translate_sai_router_action_to_sdk(sai_int32_t         action,
 sai_status_t mlnx_translate_sdk_router_action_to_sai(sx_router_action_t router_action, sai_int32_t *sai_action);
 sai_status_t mlnx_translate_sai_stats_mode_to_sdk(sai_stats_mode_t sai_mode, sx_access_cmd_t *sdk_mode);
 
+/*
+ * Bulk statistics read, in the spirit of SAI bulk_object_get_stats.
+ * Counters are returned as object_count rows of number_of_counters values.
+ * Returns SAI_STATUS_FAILURE if reading some object failed, object_statuses tell which.
+ */
+typedef sai_status_t (*mlnx_stats_bulk_get_fn)(_In_ uint32_t               object_count,
+                                               _In_ const sai_object_id_t *object_ids,
+                                               _In_ uint32_t               number_of_counters,
+                                               _In_ const sai_stat_id_t   *counter_ids,
+                                               _In_ sai_stats_mode_t       mode,
+                                               _Out_ sai_status_t         *object_statuses,
+                                               _Out_ uint64_t             *counters);
+
+typedef struct _mlnx_stats_bulk_timing_t {
+    uint64_t polls;
+    uint64_t objects;
+    uint64_t last_us; /* wall time of the last poll */
+    uint64_t max_us;
+    uint64_t total_us;
+} mlnx_stats_bulk_timing_t;
+
+sai_status_t mlnx_stats_bulk_params_check(_In_ uint32_t               object_count,
+                                          _In_ const sai_object_id_t *object_ids,
+                                          _In_ uint32_t               number_of_counters,
+                                          _In_ const sai_stat_id_t   *counter_ids,
+                                          _In_ const sai_status_t    *object_statuses,
+                                          _In_ const uint64_t        *counters);
+sai_status_t mlnx_bulk_object_get_stats(_In_ sai_object_type_t      object_type,
+                                        _In_ uint32_t               object_count,
+                                        _In_ const sai_object_id_t *object_ids,
+                                        _In_ uint32_t               number_of_counters,
+                                        _In_ const sai_stat_id_t   *counter_ids,
+                                        _In_ sai_stats_mode_t       mode,
+                                        _Out_ sai_status_t         *object_statuses,
+                                        _Out_ uint64_t             *counters);
+bool mlnx_stats_bulk_timing_get(_In_ sai_object_type_t object_type, _Out_ mlnx_stats_bulk_timing_t *timing);
+sai_status_t mlnx_get_queues_stats_bulk(_In_ uint32_t               object_count,
+                                        _In_ const sai_object_id_t *queue_ids,
+                                        _In_ uint32_t               number_of_counters,
+                                        _In_ const sai_stat_id_t   *counter_ids,
+                                        _In_ sai_stats_mode_t       mode,
+                                        _Out_ sai_status_t         *object_statuses,
+                                        _Out_ uint64_t             *counters);
+sai_status_t mlnx_get_ingress_priority_groups_stats_bulk(_In_ uint32_t               object_count,
+                                                         _In_ const sai_object_id_t *pg_ids,
+                                                         _In_ uint32_t               number_of_counters,
+                                                         _In_ const sai_stat_id_t   *counter_ids,
+                                                         _In_ sai_stats_mode_t       mode,
+                                                         _Out_ sai_status_t         *object_statuses,
+                                                         _Out_ uint64_t             *counters);
+sai_status_t mlnx_get_buffer_pools_stats_bulk(_In_ uint32_t               object_count,
+                                              _In_ const sai_object_id_t *pool_ids,
+                                              _In_ uint32_t               number_of_counters,
+                                              _In_ const sai_stat_id_t   *counter_ids,
+                                              _In_ sai_stats_mode_t       mode,
+                                              _Out_ sai_status_t         *object_statuses,
+                                              _Out_ uint64_t             *counters);
+sai_status_t mlnx_get_router_interfaces_stats_bulk(_In_ uint32_t               object_count,
+                                                   _In_ const sai_object_id_t *rif_ids,
+                                                   _In_ uint32_t               number_of_counters,
+                                                   _In_ const sai_stat_id_t   *counter_ids,
+                                                   _In_ sai_stats_mode_t       mode,
+                                                   _Out_ sai_status_t         *object_statuses,
+                                                   _Out_ uint64_t             *counters);
+
 sai_status_t mlnx_translate_sai_action_to_sdk(sai_int32_t                  action,
                                               sx_fdb_uc_mac_addr_params_t *mac_entry,
                                               uint32_t                     param_index);
@@ -810,6 +959,29 @@ static inline uint32_t array_bit_test(const uint32_t *bit_array, uint32_t bit)
     return ((bit_array[bit / 32] & (1 << (bit % 32))) != 0);
 }
 
+/* Returns the first set bit >= bit, or bits_count if there is none. Zero words are skipped as a whole */
+static inline uint32_t array_bit_next(const uint32_t *bit_array, uint32_t bits_count, uint32_t bit)
+{
+    uint32_t word_idx = bit / 32;
+    uint32_t word;
+
+    if (bit >= bits_count) {
+        return bits_count;
+    }
+
+    word = bit_array[word_idx] & (~0U << (bit % 32));
+    while (0 == word) {
+        if (++word_idx * 32 >= bits_count) {
+            return bits_count;
+        }
+        word = bit_array[word_idx];
+    }
+
+    bit = word_idx * 32 + __builtin_ctz(word);
+
+    return (bit < bits_count) ? bit : bits_count;
+}
+
 sai_status_t mlnx_fdb_route_action_save(_In_ sai_object_type_t   type,
                                         _In_ const void         *entry,
                                         _In_ sai_packet_action_t action);
@@ -817,6 +989,55 @@ void mlnx_fdb_route_action_clear(_In_ sai_object_type_t type, _In_ const void
 void mlnx_fdb_route_action_fetch(_In_ sai_object_type_t type,
                                  _In_ const void       *entry,
                                  _Out_ void            *entry_action);
+
+typedef struct _mlnx_route_shadow_stats_t {
+    uint32_t vrf_count;
+    uint32_t route_count;
+    uint32_t node_count;
+    uint64_t mem_bytes;
+} mlnx_route_shadow_stats_t;
+typedef void (*mlnx_route_shadow_iter_cb_t)(_In_ sx_router_id_t            vrid,
+                                            _In_ const sx_ip_prefix_t     *ip_prefix,
+                                            _In_ const sx_uc_route_data_t *route_data,
+                                            _In_ void                     *arg);
+
+bool mlnx_route_shadow_exists(_In_ sx_router_id_t vrid, _In_ const sx_ip_prefix_t *ip_prefix);
+void mlnx_route_shadow_foreach(_In_ mlnx_route_shadow_iter_cb_t cb, _In_ void *arg);
+void mlnx_route_shadow_stats_get(_In_ sx_router_id_t vrid, _Out_ mlnx_route_shadow_stats_t *stats);
+void mlnx_route_shadow_total_stats_get(_Out_ mlnx_route_shadow_stats_t *stats);
+void mlnx_route_shadow_vrf_flush(_In_ sx_router_id_t vrid);
+void mlnx_route_shadow_deinit(void);
+
+/* Number of next hop groups with a shadow, the other groups are updated in SDK directly */
+#define MLNX_NHG_SHADOW_SIZE (1024)
+
+/* Shadow of a next hop group ECMP container, see mlnx_sai_nexthopgroup.c */
+typedef struct _mlnx_nhg_shadow_t {
+    mlnx_shm_array_hdr_t array_hdr;
+    sx_ecmp_id_t         sx_ecmp_id;
+    bool                 is_bound;
+    bool                 is_dirty;
+    uint32_t             next_hop_count;
+    sx_next_hop_t        next_hops[ECMP_MAX_PATHS];
+    /* Next hop ecmp id of every member, SX_ROUTER_ECMP_ID_INVALID for the members loaded from SDK */
+    sx_ecmp_id_t         nhop_ids[ECMP_MAX_PATHS];
+} mlnx_nhg_shadow_t;
+
+sai_status_t mlnx_next_hop_group_shadow_flush(_In_ sx_ecmp_id_t sx_ecmp_id);
+void mlnx_next_hop_group_shadow_deinit(void);
+
+/* Number of neighbors with a shadow, the other neighbors are read from SDK */
+#define MLNX_NEIGH_SHADOW_SIZE (16 * 1024)
+
+/* Shadow of a neighbor entry, see mlnx_sai_neighbor.c */
+typedef struct _mlnx_neigh_shadow_t {
+    mlnx_shm_array_hdr_t  array_hdr;
+    sx_router_interface_t rif;
+    sx_ip_addr_t          ip_addr;
+    sx_neigh_data_t       neigh_data;
+} mlnx_neigh_shadow_t;
+
+void mlnx_neighbor_shadow_rif_flush(_In_ sx_router_interface_t sx_rif);
 typedef enum _mlnx_acl_bind_point_type_t {
     MLNX_ACL_BIND_POINT_TYPE_INGRESS_DEFAULT,
     MLNX_ACL_BIND_POINT_TYPE_EGRESS_DEFAULT,
@@ -842,6 +1063,7 @@ typedef struct _acl_index_t {
 
 sai_status_t mlnx_acl_init(void);
 sai_status_t mlnx_acl_deinit(void);
+sai_status_t mlnx_acl_connect(void);
 sai_status_t mlnx_acl_disconnect(void);
 sai_status_t mlnx_acl_bind_point_set(_In_ const sai_object_key_t      *key,
                                      _In_ const sai_attribute_value_t *value,
@@ -866,6 +1088,45 @@ sai_status_t mlnx_acl_bind_point_get(_In_ const sai_object_key_t   *key,
 uint32_t mlnx_acl_action_types_count_get(void);
 sai_status_t mlnx_acl_stage_action_types_get(_In_ sai_acl_stage_t stage, _Out_ sai_s32_list_t *list);
 sai_status_t mlnx_acl_db_free_entries_get(_In_ sai_object_type_t resource_type, _Out_ uint32_t         *free_entries);
+
+typedef struct _mlnx_acl_psort_move_stats_t {
+    uint64_t passes;               /* pSort insertions and optimization passes which moved rules */
+    uint64_t rules_moved;
+    uint64_t block_moves;          /* SDK rule block move calls */
+    uint64_t max_pass_rules;
+    uint64_t max_pass_block_moves;
+} mlnx_acl_psort_move_stats_t;
+
+void mlnx_acl_psort_move_stats_get(_Out_ mlnx_acl_psort_move_stats_t *stats);
+
+typedef struct _mlnx_acl_psort_opt_stats_t {
+    uint64_t requests;             /* table optimization requests */
+    uint64_t coalesced;            /* requests for a table which is already queued */
+    uint64_t rounds;               /* quiet periods after which the queued tables were optimized */
+    uint64_t tables_optimized;
+    uint64_t quiet_period_ms;      /* current adaptive quiet period */
+    uint64_t last_latency_ms;      /* from the first request for a table until the table is optimized */
+    uint64_t max_latency_ms;
+    uint64_t total_latency_ms;
+    uint64_t max_duration_ms;      /* single table optimization */
+    uint64_t total_duration_ms;
+} mlnx_acl_psort_opt_stats_t;
+#define SAI_KEY_ACL_COUNTERS_SNAPSHOT_MS "SAI_ACL_COUNTERS_SNAPSHOT_MS"
+
+typedef struct _mlnx_acl_counter_stats_t {
+    uint64_t reads;          /* counters read, one per counter of a bulk read */
+    uint64_t sdk_reads;      /* SDK flow counter reads, background refresh included */
+    uint64_t snapshot_hits;  /* counters served from the snapshot */
+    uint64_t snapshot_ms;    /* background refresh period, 0 - snapshot is disabled */
+    uint64_t snapshot_count; /* counters refreshed in the background */
+} mlnx_acl_counter_stats_t;
+
+sai_status_t mlnx_acl_counters_get(_In_ uint32_t               object_count,
+                                   _In_ const sai_object_id_t *counter_ids,
+                                   _Out_opt_ uint64_t         *packets,
+                                   _Out_opt_ uint64_t         *bytes,
+                                   _Out_ sai_status_t         *object_statuses);
+void mlnx_acl_counter_stats_get(_Out_ mlnx_acl_counter_stats_t *stats);
 #define acl_global_lock()   cl_plock_excl_acquire(&g_sai_acl_db_ptr->acl_settings_tbl->lock)
 #define acl_global_unlock() cl_plock_release(&g_sai_acl_db_ptr->acl_settings_tbl->lock)
 
@@ -897,9 +1158,25 @@ sai_status_t mlnx_translate_sdk_trap_to_sai(_In_ sx_trap_id_t             sdk_tr
                                             _Out_ sai_hostif_trap_type_t *trap_id,
                                             _Out_ const char            **trap_name,
                                             _Out_ mlnx_trap_type_t       *trap_type);
+sai_status_t mlnx_translate_sdk_trap_to_sai_oid(_In_ sx_trap_id_t       sdk_trap_id,
+                                                _Out_ sai_object_id_t *trap_oid,
+                                                _Out_ const char     **trap_name);
 sai_status_t mlnx_translate_sai_trap_to_sdk(_In_ sai_object_id_t  trap_oid,
                                             _Out_ sx_trap_id_t   *sx_trap_id);
 
+typedef struct _mlnx_hostif_rx_packet_t {
+    void           *buffer;
+    sai_size_t      buffer_size; /* [in] allocated buffer size. [out] packet size, or required size on overflow */
+    sai_object_id_t trap_oid;
+    sai_object_id_t port_oid;
+    sai_object_id_t lag_oid;
+    sai_status_t    status;
+} mlnx_hostif_rx_packet_t;
+
+sai_status_t mlnx_recv_hostif_packet_batch(_In_ sai_object_id_t             hif_id,
+                                           _Inout_ mlnx_hostif_rx_packet_t *packets,
+                                           _Inout_ uint32_t                *count);
+
 #define MAX_SDK_TRAPS_PER_SAI_TRAP 6
 typedef struct _mlnx_trap_info_t {
     sai_hostif_trap_type_t trap_id;
@@ -1184,6 +1461,8 @@ sx_mstp_inst_id_t mlnx_vlan_stp_id_get(sai_vlan_id_t vlan_id);
 
 void mlnx_vlan_port_set(uint16_t vid, mlnx_bridge_port_t *port, bool is_set);
 bool mlnx_vlan_port_is_set(uint16_t vid, const mlnx_bridge_port_t *port);
+uint32_t mlnx_vlan_port_next(uint16_t vid, uint32_t port_idx);
+uint32_t mlnx_port_vlan_next(const mlnx_bridge_port_t *port, uint32_t vid);
 sai_status_t mlnx_vlan_sai_tagging_to_sx(_In_ sai_vlan_tagging_mode_t      mode,
                                          _Out_ sx_untagged_member_state_t *tagging,
                                          _Out_ sx_untagged_prio_state_t   *prio_tagging);
@@ -1279,10 +1558,16 @@ sai_status_t mlnx_wred_port_queue_db_clear(_In_ mlnx_port_config_t *port);
         if (port->is_present)
 
 #define mlnx_vlan_ports_foreach(vid, port, idx) \
-    for (idx = 0; \
+    for (idx = mlnx_vlan_port_next(vid, 0); \
          (idx < MAX_BRIDGE_1Q_PORTS) && \
-         (port = &g_sai_db_ptr->bridge_ports_db[idx]); idx++) \
-        if (port->is_present && mlnx_vlan_port_is_set(vid, port))
+         (port = &g_sai_db_ptr->bridge_ports_db[idx]); idx = mlnx_vlan_port_next(vid, idx + 1)) \
+        if (port->is_present)
+
+/* VLANs of the .1Q bridge port, in the ascending order */
+#define mlnx_port_vlans_foreach(port, vid) \
+    for (vid = mlnx_port_vlan_next(port, SXD_VID_MIN); \
+         vid <= SXD_VID_MAX; \
+         vid = mlnx_port_vlan_next(port, vid + 1))
 
 typedef struct _mlnx_trap_t {
     sai_packet_action_t action;
@@ -1388,6 +1673,7 @@ typedef struct _mlnx_udf_db_t {
 #define ACL_GROUP_MEMBER_PRIO_MAX UINT16_MAX
 #define ACL_SX_TABLES_NUMBER      (g_resource_limits.acl_regions_max)
 #define ACL_TABLE_DB_SIZE         ACL_SX_TABLES_NUMBER
+#define ACL_PSORT_OPT_RING_SIZE   ACL_TABLE_DB_SIZE
 
 #define ACL_SEQ_GROUP_SIZE   ACL_SX_TABLES_NUMBER
 #define ACL_PAR_GROUP_SIZE   (g_resource_limits.acl_groups_size_max)
@@ -1447,6 +1733,7 @@ typedef struct _acl_table_db_t {
     bool     is_used;
     bool     is_lock_inited;
     uint32_t queued;
+    uint64_t queued_ms;
     /* Valid only when group_references > 0 */
     sai_acl_table_group_type_t group_type;
     uint32_t                   group_references;
@@ -1458,6 +1745,8 @@ typedef struct _acl_table_db_t {
     bool                       is_dynamic_sized;
     uint32_t                   created_entry_count;
     psort_handle_t             psort_handle;
+    /* Free offsets between the first and the last rule after the last pSort optimization */
+    uint32_t                   psort_holes;
     cl_plock_t                 lock;
     sai_acl_range_type_t       range_types[SAI_ACL_RANGE_TYPE_COUNT];
     uint32_t                   range_type_count;
@@ -1511,11 +1800,63 @@ typedef struct _acl_def_rule_mc_container_t {
     sx_mc_container_id_t mc_container;
 } acl_def_rule_mc_container_t;
 
+typedef enum acl_rpc_type_t {
+    ACL_RPC_TERMINATE_THREAD,
+    ACL_RPC_TABLE_INIT,
+    ACL_RPC_TABLE_DELETE,
+    ACL_RPC_ENTRY_OFFSET_GET,
+    ACL_RPC_ENTRY_OFFSET_DEL
+} acl_rpc_type_t;
+PACKED(struct _acl_rpc_args_t {
+           bool table_is_dynamic;
+           uint32_t table_id;
+           uint32_t size;
+           uint32_t entry_id;
+           uint32_t entry_prio;
+           sx_acl_rule_offset_t entry_offset;
+       }, );
+typedef struct _acl_rpc_args_t acl_rpc_args_t;
+PACKED(struct _acl_rpc_info_t {
+           acl_rpc_type_t type;
+           acl_rpc_args_t args;
+           sai_status_t status;
+       }, );
+typedef struct _acl_rpc_info_t acl_rpc_info_t;
+
+#define ACL_RPC_SHM_SLOT_COUNT        8
+#define ACL_RPC_SHM_CALL_TIMEOUT_USEC (10 * 1000000)
+
+typedef enum _acl_rpc_shm_slot_state_t {
+    ACL_RPC_SHM_SLOT_FREE,
+    ACL_RPC_SHM_SLOT_BUSY,
+    ACL_RPC_SHM_SLOT_REQUEST,
+    ACL_RPC_SHM_SLOT_HANDLING,
+    ACL_RPC_SHM_SLOT_RESPONSE,
+    ACL_RPC_SHM_SLOT_ABANDONED /* the client timed out while handled, the server frees the slot */
+} acl_rpc_shm_slot_state_t;
+
+typedef struct _acl_rpc_shm_slot_t {
+    uint32_t       state; /* acl_rpc_shm_slot_state_t, futex word of the client */
+    acl_rpc_info_t info;
+} acl_rpc_shm_slot_t;
+
+/* RPC to the init process over the ACL shared memory, the socket is used when it's not available */
+typedef struct _acl_rpc_shm_t {
+    bool               is_ready;
+    uint32_t           requests; /* futex word of the RPC shm thread */
+    uint64_t           shm_calls;
+    uint64_t           shm_total_us;
+    uint64_t           socket_calls;
+    uint64_t           socket_total_us;
+    acl_rpc_shm_slot_t slots[ACL_RPC_SHM_SLOT_COUNT];
+} acl_rpc_shm_t;
+
 typedef struct _acl_setting_tbl_t {
     bool       lazy_initialized;
     cl_plock_t lock;
 #ifndef _WIN32
     pthread_cond_t  psort_thread_init_cond;
+    pthread_cond_t  psort_thread_work_cond;
     pthread_cond_t  rpc_thread_init_cond;
     pthread_mutex_t cond_mutex;
 #endif
@@ -1530,6 +1871,11 @@ typedef struct _acl_setting_tbl_t {
     acl_def_rule_mc_container_t def_mc_container;
     uint32_t                    entry_db_first_free_index;
     uint32_t                    entry_db_indexes_allocated;
+    uint64_t                    psort_opt_ring_head;
+    uint64_t                    psort_opt_ring_tail;
+    uint64_t                    psort_opt_last_request_ms;
+    mlnx_acl_psort_opt_stats_t  psort_opt_stats;
+    acl_rpc_shm_t               rpc_shm;
 } acl_setting_tbl_t;
 
 typedef struct _acl_bind_point_target_data_t {
@@ -1602,6 +1948,7 @@ typedef struct _mlnx_acl_db_t {
     acl_table_db_t       *acl_table_db;
     acl_entry_db_t       *acl_entry_db;
     acl_setting_tbl_t    *acl_settings_tbl;
+    uint64_t             *acl_psort_opt_ring;
     acl_pbs_map_entry_t  *acl_pbs_map_db;
     acl_bind_points_db_t *acl_bind_points;
     acl_group_db_t       *acl_groups_db;
@@ -1744,8 +2091,14 @@ typedef struct _mlnx_samplepacket_t {
 #define MLNX_TUNNEL_MAP_MAX           10
 #define MLNX_TUNNEL_MAP_ENTRY_INVALID 0
 #define MLNX_TUNNEL_MAP_ENTRY_MIN     1
-/* SONiC requires 8000 tunnel map entries */
-#define MLNX_TUNNEL_MAP_ENTRY_MAX     8001
+/* SONiC requires 8000 tunnel map entries. Beyond that, every bridge and VLAN can be mapped to a VNI in both
+ * directions, plus the ECN entries (at most 16 keys) of every tunnel map */
+#define MLNX_TUNNEL_MAP_ENTRY_MIN_CNT 8000
+#define MLNX_TUNNEL_MAP_ENTRY_ECN_MAX (MLNX_TUNNEL_MAP_MAX * 16)
+#define MLNX_TUNNEL_MAP_ENTRY_MAX                                                                 \
+    (MLNX_TUNNEL_MAP_ENTRY_MIN +                                                                  \
+     MAX(MLNX_TUNNEL_MAP_ENTRY_MIN_CNT,                                                           \
+         2 * (g_resource_limits.bridge_num_max + SXD_VID_MAX) + MLNX_TUNNEL_MAP_ENTRY_ECN_MAX))
 #define MLNX_TUNNEL_TO_TUNNEL_MAP_MAX 1000
 #define MAX_IPINIP_TUNNEL             256 
 #define MAX_VXLAN_TUNNEL              1
@@ -1810,11 +2163,23 @@ typedef struct _tunnel_map_entry_t {
     sai_object_id_t       bridge_id_key;
     sai_object_id_t       bridge_id_value;
     uint32_t              prev_tunnel_map_entry_idx;
+    /* free entries are chained by next_tunnel_map_entry_idx as well */
     uint32_t              next_tunnel_map_entry_idx;
+    /* chains in the key and pair hash indexes */
+    uint32_t              key_hash_next_idx;
+    uint32_t              pair_hash_next_idx;
     /* only used for bridge to vni and vni to bridge type */
     tunnel_map_entry_pair_info_t pair_per_vxlan_array[MAX_VXLAN_TUNNEL];
 } mlnx_tunnel_map_entry_t;
 
+/* Both hash indexes have MLNX_TUNNEL_MAP_ENTRY_MAX buckets holding the head entry idx of the chain.
+ * The key index is keyed by (tunnel map, map key), the pair index by (VNI, bridge) of the
+ * VNI to bridge and bridge to VNI entries */
+typedef struct _mlnx_tunnel_map_entry_index_t {
+    uint32_t free_head_idx;
+    uint32_t free_cnt;
+} mlnx_tunnel_map_entry_index_t;
+
 typedef enum _nve_tunnel_type_t {
     NVE_8021Q_TUNNEL,
     NVE_8021D_TUNNEL,
@@ -1827,11 +2192,15 @@ typedef struct sai_tunnel_db {
     mlnx_tunnel_entry_t     *tunnel_entry_db;
     mlnx_tunnel_map_t       *tunnel_map_db;
     mlnx_tunnel_map_entry_t *tunnel_map_entry_db;
+    mlnx_tunnel_map_entry_index_t *tunnel_map_entry_index;
+    uint32_t                *tunnel_map_entry_key_hash;
+    uint32_t                *tunnel_map_entry_pair_hash;
 } sai_tunnel_db_t;
 
 extern sai_tunnel_db_t *g_sai_tunnel_db_ptr;
 extern uint32_t         g_sai_tunnel_db_size;
 
+/* type is SAI_OBJECT_TYPE_NULL for a free slot */
 typedef struct _fdb_action_t {
     sai_object_type_t type;
     union {
@@ -1841,6 +2210,7 @@ typedef struct _fdb_action_t {
     sai_packet_action_t action;
 } fdb_or_route_action_t;
 
+/* Open addressing (linear probing) hash table keyed by type + fdb/route entry */
 typedef struct _fdb_actions_db_t {
     fdb_or_route_action_t actions[FDB_OR_ROUTE_SAVED_ACTIONS_NUM];
     uint32_t              count;
@@ -1929,21 +2299,25 @@ typedef enum mlnx_platform_type {
 } mlnx_platform_type_t;
 
 typedef struct sai_db {
-    cl_plock_t         p_lock;
-    sx_mac_addr_t      base_mac_addr;
-    char               dev_mac[18];
-    uint32_t           ports_number;
-    uint32_t           ports_configured;
-    mlnx_port_config_t ports_db[MAX_PORTS_DB * 2];
-    mlnx_bridge_port_t bridge_ports_db[MAX_BRIDGE_PORTS];
-    uint32_t           non_1q_bports_created; /* to optimize mlnx_bridge_non1q_port_foreach */
-    mlnx_bridge_rif_t  bridge_rifs_db[MAX_BRIDGE_RIFS];
-    mlnx_vlan_db_t     vlans_db[SXD_VID_MAX];
-    sai_netdev_t       hostif_db[MAX_HOSTIFS];
-    sai_object_id_t    default_trap_group;
-    sai_object_id_t    default_vrid;
-    sx_user_channel_t  callback_channel;
-    bool               trap_group_valid[MAX_TRAP_GROUPS];
+    cl_plock_t                        p_lock;
+    sx_mac_addr_t                     base_mac_addr;
+    char                              dev_mac[18];
+    uint32_t                          ports_number;
+    uint32_t                          ports_configured;
+    mlnx_port_config_t                ports_db[MAX_PORTS_DB * 2];
+    mlnx_log_port_map_entry_t         ports_log_map[MLNX_PORT_LOG_MAP_SIZE];
+    mlnx_bridge_port_t                bridge_ports_db[MAX_BRIDGE_PORTS];
+    mlnx_log_port_map_entry_t         bridge_ports_log_map[MLNX_BRIDGE_PORT_LOG_MAP_SIZE];
+    uint32_t                          non_1q_bports_created; /* to optimize mlnx_bridge_non1q_port_foreach */
+    mlnx_bridge_rif_t                 bridge_rifs_db[MAX_BRIDGE_RIFS];
+    mlnx_vlan_db_t                    vlans_db[SXD_VID_MAX];
+    /* Transposed vlans_db[].ports_map - VLANs (bit per vid) of every .1Q bridge port */
+    uint32_t                          bridge_port_vlans_map[MAX_BRIDGE_1Q_PORTS][MLNX_U32BITARRAY_SIZE(MAX_VLANS)];
+    sai_netdev_t                      hostif_db[MAX_HOSTIFS];
+    sai_object_id_t                   default_trap_group;
+    sai_object_id_t                   default_vrid;
+    sx_user_channel_t                 callback_channel;
+    bool                              trap_group_valid[MAX_TRAP_GROUPS];
     /* index is according to index in mlnx_traps_info */
     mlnx_trap_t                       traps_db[SXD_TRAP_ID_ACL_MAX];
     mlnx_qos_map_t                    qos_maps_db[MAX_QOS_MAPS_DB];
@@ -1983,6 +2357,10 @@ typedef struct sai_db {
     bool                              g_fx_initialized;
     mlnx_mirror_vlan_t                erspan_vlan_header[SPAN_SESSION_MAX];
     mlnx_l2mc_group_t                 l2mc_groups[MLNX_L2MC_GROUP_DB_SIZE];
+    /* Guards the next hop group, neighbor and route shadows, taken after any other DB lock */
+    cl_plock_t                        shadow_lock;
+    /* Bumped on every route change in SDK, a process drops its route shadow when it doesn't match */
+    uint64_t                          route_shadow_generation;
     mlnx_shm_rm_array_info_t          array_info[MLNX_SHM_RM_ARRAY_TYPE_SIZE];
 } sai_db_t;
 
@@ -2041,6 +2419,21 @@ void init_buffer_resource_limits();
      mlnx_sai_get_buffer_resource_limits()->num_port_pg_buff       \
     )
 
+#define BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE                  \
+    (BUFFER_DB_PER_PORT_PROFILE_INDEX_ARRAY_SIZE +              \
+     mlnx_sai_get_buffer_resource_limits()->num_port_queue_buff \
+    )
+
+/*
+ *  One port buffer (ingress/egress pool buffer, PG or queue) in the reverse reference index.
+ *  next/prev are (slot index + 1), 0 terminates the list, so zeroed memory is an empty index.
+ */
+typedef struct _mlnx_sai_buffer_ref_slot_t {
+    uint32_t profile;
+    uint32_t next;
+    uint32_t prev;
+} mlnx_sai_buffer_ref_slot_t;
+
 typedef struct _sai_buffer_db_t {
     /*
      *  Base pointer to the memory map containing all SAI buffer db data
@@ -2078,6 +2471,18 @@ typedef struct _sai_buffer_db_t {
      */
     uint32_t* port_buffer_data;
 
+    /*
+     *  Reverse reference index - buffer profile to the port buffers using it.
+     *  buffer_profile_refs[mlnx_sai_get_buffer_profile_number()] holds the head of the list for every profile
+     *  (slot index + 1, 0 for no references).
+     *  buffer_ref_slots[BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE * MAX_PORTS] has a slot for every port buffer:
+     *   slots of g_sai_db_ptr->ports_db[ii] start at ii * BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE and are
+     *   ordered ingress pools, egress pools, PGs, queues.
+     *  The lists are sorted by slot index, so the references of one port are adjacent.
+     */
+    uint32_t                  * buffer_profile_refs;
+    mlnx_sai_buffer_ref_slot_t* buffer_ref_slots;
+
     /*
      *  pool_allocation[1 + user ingress pools + user egress pools]
      *  When SAI starts up it will load current buffer configuration into SAI buffer infrastructure,
@@ -2102,6 +2507,12 @@ sai_status_t mlnx_sai_get_port_buffer_index_array(uint32_t
 
 uint32_t mlnx_sai_get_buffer_profile_number();
 
+void mlnx_sai_buffer_profile_ref_set(uint32_t                       db_port_ind,
+                                     port_buffer_index_array_type_t buff_type,
+                                     uint32_t                       ind,
+                                     uint32_t                       db_buffer_profile_index);
+void mlnx_sai_buffer_port_refs_reset(uint32_t db_port_ind);
+
 extern sai_buffer_db_t *g_sai_buffer_db_ptr;
 extern uint32_t         g_sai_buffer_db_size;
 
@@ -2111,6 +2522,9 @@ extern uint32_t         g_sai_buffer_db_size;
 #define sai_db_unlock()     cl_plock_release(&g_sai_db_ptr->p_lock)
 #define sai_db_sync()       msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC)
 
+#define sai_shadow_db_lock()   cl_plock_excl_acquire(&g_sai_db_ptr->shadow_lock)
+#define sai_shadow_db_unlock() cl_plock_release(&g_sai_db_ptr->shadow_lock)
+
 #define sai_qos_db_read_lock()  sai_db_read_lock()
 #define sai_qos_db_write_lock() sai_db_write_lock()
 #define sai_qos_db_unlock()     sai_db_unlock()
@@ -2141,6 +2555,26 @@ sai_status_t mlnx_port_idx_by_log_id(sx_port_log_id_t log_port_id, uint32_t *ind
 sai_status_t mlnx_port_idx_by_obj_id(sai_object_id_t obj_id, uint32_t *index);
 /* DB read lock is needed */
 uint32_t mlnx_port_idx_get(const mlnx_port_config_t *port);
+/* DB write lock is needed */
+void mlnx_port_logical_set(mlnx_port_config_t *port, sx_port_log_id_t log_id);
+
+#define SAI_KEY_PORT_STATS_CACHE_MS "SAI_PORT_STATS_CACHE_MS"
+
+typedef struct _mlnx_port_cntr_stats_t {
+    uint64_t polls;      /* port reads served, one per port of a bulk read */
+    uint64_t sdk_calls;  /* SDK counter group reads */
+    uint64_t cache_hits; /* counter groups served from the snapshot */
+    uint64_t max_age_ms;
+} mlnx_port_cntr_stats_t;
+
+sai_status_t mlnx_get_ports_stats_bulk(_In_ uint32_t               object_count,
+                                       _In_ const sai_object_id_t *port_ids,
+                                       _In_ uint32_t               number_of_counters,
+                                       _In_ const sai_stat_id_t   *counter_ids,
+                                       _In_ sai_stats_mode_t       mode,
+                                       _Out_ sai_status_t         *object_statuses,
+                                       _Out_ uint64_t             *counters);
+void mlnx_port_cntr_stats_get(_Out_ mlnx_port_cntr_stats_t *stats);
 
 /* DB read lock is needed */
 sai_status_t mlnx_port_add(mlnx_port_config_t *port);
@@ -2313,6 +2747,9 @@ sai_status_t mlnx_translate_sdk_tunnel_id_to_sai_tunnel_id(_In_ const sx_tunnel_
                                                            _Out_ sai_object_id_t    *sai_tunnel_id);
 sai_status_t mlnx_parsing_depth_increase(void);
 
+/* called once on the newly created tunnel DB */
+void mlnx_tunnel_map_entry_db_init(void);
+
 /* caller needs to guard this function with lock */
 sai_status_t mlnx_get_sai_tunnel_db_idx(_In_ sai_object_id_t sai_tunnel_id, _Out_ uint32_t *tunnel_db_idx);
 
@@ -2324,6 +2761,25 @@ sai_status_t mlnx_acl_cb_table_init(void);
 
 sai_status_t mlnx_sai_tunnel_to_sx_tunnel_id(_In_ sai_object_id_t  sai_tunnel_id,
                                                     _Out_ sx_tunnel_id_t *sx_tunnel_id);
+
+typedef enum _mlnx_event_channel_t {
+    MLNX_EVENT_CHANNEL_PORT,
+    MLNX_EVENT_CHANNEL_FDB,
+    MLNX_EVENT_CHANNEL_PACKET,
+    MLNX_EVENT_CHANNEL_COUNT
+} mlnx_event_channel_t;
+typedef struct _mlnx_event_channel_stats_t {
+    uint64_t enqueued;
+    uint64_t processed;
+    uint64_t dropped;
+    uint32_t depth;
+    uint32_t depth_max;
+    uint64_t latency_total_us; /* time from receive to handling */
+    uint64_t latency_max_us;
+} mlnx_event_channel_stats_t;
+
+void mlnx_switch_event_channel_stats_get(_In_ mlnx_event_channel_t        channel,
+                                         _Out_ mlnx_event_channel_stats_t *stats);
 #define LINE_LENGTH 120
 
 void SAI_dump_acl(_In_ FILE *file);
@@ -2336,6 +2792,7 @@ void SAI_dump_policer(_In_ FILE *file);
 void SAI_dump_port(_In_ FILE *file);
 void SAI_dump_qosmaps(_In_ FILE *file);
 void SAI_dump_queue(_In_ FILE *file);
+void SAI_dump_route(_In_ FILE *file);
 void SAI_dump_samplepacket(_In_ FILE *file);
 void SAI_dump_scheduler(_In_ FILE *file);
 void SAI_dump_stp(_In_ FILE *file);
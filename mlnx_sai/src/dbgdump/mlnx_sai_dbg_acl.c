@@ -209,6 +209,7 @@ static void SAI_dump_acl_table_print(_In_ FILE *file, _In_ acl_table_db_t *acl_t
         {"is dynamic sized",  16, PARAM_UINT8_E,   &curr_acl_table_db.is_dynamic_sized},
         {"created entry cnt", 16, PARAM_UINT32_E, &curr_acl_table_db.created_entry_count},
         {"psort handle",      16, PARAM_UINT32_E, &curr_acl_table_db.psort_handle},
+        {"psort holes",       16, PARAM_UINT32_E, &curr_acl_table_db.psort_holes},
         {"range type count",  16, PARAM_UINT32_E, &curr_acl_table_db.range_type_count},
         {"bind type count",   16, PARAM_UINT32_E, &curr_acl_table_db.bind_point_types.count},
         {"wrap group created", 16, PARAM_UINT8_E,   &curr_acl_table_db.wrapping_group.created},
@@ -382,6 +383,104 @@ static void SAI_dump_acl_settings_tbl_print(_In_ FILE *file, _In_ acl_setting_tb
     dbg_utils_print_table_data_line(file, acl_settings_clmns);
 }
 
+static void SAI_dump_acl_psort_move_stats_print(_In_ FILE *file)
+{
+    mlnx_acl_psort_move_stats_t stats;
+    uint64_t                    avg_rules = 0, avg_block_moves = 0;
+
+    mlnx_acl_psort_move_stats_get(&stats);
+
+    if (stats.passes) {
+        avg_rules       = stats.rules_moved / stats.passes;
+        avg_block_moves = stats.block_moves / stats.passes;
+    }
+
+    dbg_utils_print_general_header(file, "ACL pSort rule moves");
+
+    dbg_utils_print_field(file, "passes", &stats.passes, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "rules moved", &stats.rules_moved, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "sdk block moves", &stats.block_moves, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "avg rules per pass", &avg_rules, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "avg sdk calls per pass", &avg_block_moves, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "max rules per pass", &stats.max_pass_rules, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "max sdk calls per pass", &stats.max_pass_block_moves, PARAM_UINT64_E);
+    dbg_utils_print(file, "\n");
+}
+
+static void SAI_dump_acl_psort_opt_stats_print(_In_ FILE *file, _In_ const acl_setting_tbl_t *acl_setting_tbl)
+{
+    mlnx_acl_psort_opt_stats_t stats;
+    uint64_t                   avg_latency = 0, avg_duration = 0;
+
+    assert(NULL != acl_setting_tbl);
+
+    stats = acl_setting_tbl->psort_opt_stats;
+
+    if (stats.tables_optimized) {
+        avg_latency  = stats.total_latency_ms / stats.tables_optimized;
+        avg_duration = stats.total_duration_ms / stats.tables_optimized;
+    }
+
+    dbg_utils_print_general_header(file, "ACL pSort optimization");
+
+    dbg_utils_print_field(file, "requests", &stats.requests, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "coalesced requests", &stats.coalesced, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "rounds", &stats.rounds, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "tables optimized", &stats.tables_optimized, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "quiet period ms", &stats.quiet_period_ms, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "last latency ms", &stats.last_latency_ms, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "avg latency ms", &avg_latency, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "max latency ms", &stats.max_latency_ms, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "avg duration ms", &avg_duration, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "max duration ms", &stats.max_duration_ms, PARAM_UINT64_E);
+    dbg_utils_print(file, "\n");
+}
+
+static void SAI_dump_acl_rpc_stats_print(_In_ FILE *file, _In_ const acl_setting_tbl_t *acl_setting_tbl)
+{
+    uint64_t shm_calls, shm_avg_us = 0, socket_calls, socket_avg_us = 0;
+    uint32_t is_ready;
+
+    assert(NULL != acl_setting_tbl);
+
+    is_ready     = acl_setting_tbl->rpc_shm.is_ready;
+    shm_calls    = acl_setting_tbl->rpc_shm.shm_calls;
+    socket_calls = acl_setting_tbl->rpc_shm.socket_calls;
+
+    if (shm_calls) {
+        shm_avg_us = acl_setting_tbl->rpc_shm.shm_total_us / shm_calls;
+    }
+
+    if (socket_calls) {
+        socket_avg_us = acl_setting_tbl->rpc_shm.socket_total_us / socket_calls;
+    }
+
+    dbg_utils_print_general_header(file, "ACL RPC");
+
+    dbg_utils_print_field(file, "shm ready", &is_ready, PARAM_UINT32_E);
+    dbg_utils_print_field(file, "shm calls", &shm_calls, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "shm avg us", &shm_avg_us, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "socket calls", &socket_calls, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "socket avg us", &socket_avg_us, PARAM_UINT64_E);
+    dbg_utils_print(file, "\n");
+}
+
+static void SAI_dump_acl_counter_stats_print(_In_ FILE *file)
+{
+    mlnx_acl_counter_stats_t stats;
+
+    mlnx_acl_counter_stats_get(&stats);
+
+    dbg_utils_print_general_header(file, "ACL counters");
+
+    dbg_utils_print_field(file, "snapshot period (ms)", &stats.snapshot_ms, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "snapshot counters", &stats.snapshot_count, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "counter reads", &stats.reads, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "sdk reads", &stats.sdk_reads, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "snapshot hits", &stats.snapshot_hits, PARAM_UINT64_E);
+    dbg_utils_print(file, "\n");
+}
+
 static void SAI_dump_acl_pbs_entry_type_get(_In_ mlnx_acl_pbs_map_idx_t pbs_index, _Out_ char          *type)
 {
     if (ACL_PBS_MAP_FLOOD_PBS_INDEX == pbs_index) {
@@ -775,6 +874,10 @@ void SAI_dump_acl(_In_ FILE *file)
     SAI_dump_acl_table_print(file, acl_table_db);
     SAI_dump_acl_entry_print(file, acl_entry_db);
     SAI_dump_acl_settings_tbl_print(file, acl_settings_tbl);
+    SAI_dump_acl_psort_move_stats_print(file);
+    SAI_dump_acl_psort_opt_stats_print(file, acl_settings_tbl);
+    SAI_dump_acl_rpc_stats_print(file, acl_settings_tbl);
+    SAI_dump_acl_counter_stats_print(file);
     SAI_dump_acl_pbs_map_db_print(file, acl_pbs_map_db);
     SAI_dump_acl_bind_points_print(file, acl_bind_points);
     SAI_dump_acl_groups_db_print(file, acl_group_db, acl_group_bound_to, acl_group_number);
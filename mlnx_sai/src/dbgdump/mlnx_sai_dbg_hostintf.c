@@ -277,6 +277,43 @@ static void SAI_dump_trap_mirror_discard_db(_In_ FILE             *file,
     }
 }
 
+static void SAI_dump_event_channels_print(_In_ FILE *file)
+{
+    static const char * const  channel_names[MLNX_EVENT_CHANNEL_COUNT] = {
+        [MLNX_EVENT_CHANNEL_PORT]   = "port state",
+        [MLNX_EVENT_CHANNEL_FDB]    = "fdb",
+        [MLNX_EVENT_CHANNEL_PACKET] = "packet rx",
+    };
+    mlnx_event_channel_stats_t stats;
+    mlnx_event_channel_t       channel;
+    char                       name[LINE_LENGTH];
+    uint64_t                   latency_avg_us = 0;
+    dbg_utils_table_columns_t  event_clmns[]  = {
+        {"channel",          11, PARAM_STRING_E, name},
+        {"enqueued",         16, PARAM_UINT64_E, &stats.enqueued},
+        {"processed",        16, PARAM_UINT64_E, &stats.processed},
+        {"dropped",          16, PARAM_UINT64_E, &stats.dropped},
+        {"depth",            7,  PARAM_UINT32_E, &stats.depth},
+        {"max depth",        9,  PARAM_UINT32_E, &stats.depth_max},
+        {"avg latency (us)", 16, PARAM_UINT64_E, &latency_avg_us},
+        {"max latency (us)", 16, PARAM_UINT64_E, &stats.latency_max_us},
+        {NULL,               0,  0,              NULL}
+    };
+
+    dbg_utils_print_secondary_header(file, "Event channels");
+
+    dbg_utils_print_table_headline(file, event_clmns);
+
+    for (channel = 0; channel < MLNX_EVENT_CHANNEL_COUNT; channel++) {
+        mlnx_switch_event_channel_stats_get(channel, &stats);
+
+        strcpy(name, channel_names[channel]);
+        latency_avg_us = stats.processed ? stats.latency_total_us / stats.processed : 0;
+
+        dbg_utils_print_table_data_line(file, event_clmns);
+    }
+}
+
 void SAI_dump_hostintf(_In_ FILE *file)
 {
     sai_object_id_t  default_trap_group = 0;
@@ -310,6 +347,7 @@ void SAI_dump_hostintf(_In_ FILE *file)
                                     &trap_mirror_discard_wred_db,
                                     &trap_mirror_discard_router_db);
     SAI_dump_hostif_db_print(file, hostif_db);
+    SAI_dump_event_channels_print(file);
 
     free(traps_db);
 }
@@ -59,6 +59,61 @@ static void SAI_dump_ports_configured_print(_In_ FILE *file, _In_ uint32_t *port
     dbg_utils_print(file, "\n");
 }
 
+static void SAI_dump_port_cntr_stats_print(_In_ FILE *file)
+{
+    mlnx_port_cntr_stats_t stats;
+
+    mlnx_port_cntr_stats_get(&stats);
+
+    dbg_utils_print_general_header(file, "Port counters cache");
+
+    dbg_utils_print_field(file, "max age (ms)", &stats.max_age_ms, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "port reads", &stats.polls, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "sdk calls", &stats.sdk_calls, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "cache hits", &stats.cache_hits, PARAM_UINT64_E);
+    dbg_utils_print(file, "\n");
+}
+
+static void SAI_dump_stats_bulk_timing_print(_In_ FILE *file)
+{
+    static const sai_object_type_t types[] = {
+        SAI_OBJECT_TYPE_PORT,
+        SAI_OBJECT_TYPE_QUEUE,
+        SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP,
+        SAI_OBJECT_TYPE_BUFFER_POOL,
+        SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+    };
+    mlnx_stats_bulk_timing_t  timing;
+    char                      type_str[LINE_LENGTH];
+    uint64_t                  avg_us = 0;
+    uint32_t                  ii;
+    dbg_utils_table_columns_t timing_clmns[] = {
+        {"object type",    24, PARAM_STRING_E, type_str},
+        {"polls",          12, PARAM_UINT64_E, &timing.polls},
+        {"objects",        12, PARAM_UINT64_E, &timing.objects},
+        {"last poll (us)", 14, PARAM_UINT64_E, &timing.last_us},
+        {"max poll (us)",  14, PARAM_UINT64_E, &timing.max_us},
+        {"avg poll (us)",  14, PARAM_UINT64_E, &avg_us},
+        {NULL,             0,  0,              NULL}
+    };
+
+    dbg_utils_print_general_header(file, "Bulk stats poll time");
+
+    dbg_utils_print_table_headline(file, timing_clmns);
+
+    for (ii = 0; ii < sizeof(types) / sizeof(types[0]); ii++) {
+        if (!mlnx_stats_bulk_timing_get(types[ii], &timing)) {
+            continue;
+        }
+
+        strncpy(type_str, SAI_TYPE_STR(types[ii]), LINE_LENGTH - 1);
+        type_str[LINE_LENGTH - 1] = '\0';
+        avg_us                    = timing.polls ? timing.total_us / timing.polls : 0;
+
+        dbg_utils_print_table_data_line(file, timing_clmns);
+    }
+}
+
 static void SAI_dump_port_breakoutmode_enum_to_str(_In_ mlnx_port_breakout_capability_t mode, _Out_ char *str)
 {
     assert(NULL != str);
@@ -254,6 +309,8 @@ void SAI_dump_port(_In_ FILE *file)
     SAI_dump_ports_number_print(file, &ports_number);
     SAI_dump_ports_configured_print(file, &ports_configured);
     SAI_dump_port_print(file, mlnx_port_config);
+    SAI_dump_port_cntr_stats_print(file);
+    SAI_dump_stats_bulk_timing_print(file);
 
     free(mlnx_port_config);
 }
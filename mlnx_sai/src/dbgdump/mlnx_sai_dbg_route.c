@@ -0,0 +1,76 @@
+/*
+ *  Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "mlnx_sai.h"
+#include <sx/utils/dbg_utils.h>
+#include "assert.h"
+
+static void SAI_dump_route_shadow_total_print(_In_ FILE *file)
+{
+    mlnx_route_shadow_stats_t stats;
+    uint64_t                  bytes_per_route;
+
+    mlnx_route_shadow_total_stats_get(&stats);
+
+    bytes_per_route = stats.route_count ? stats.mem_bytes / stats.route_count : 0;
+
+    dbg_utils_print_general_header(file, "Route shadow");
+
+    dbg_utils_print_field(file, "vrf count", &stats.vrf_count, PARAM_UINT32_E);
+    dbg_utils_print_field(file, "route count", &stats.route_count, PARAM_UINT32_E);
+    dbg_utils_print_field(file, "node count", &stats.node_count, PARAM_UINT32_E);
+    dbg_utils_print_field(file, "memory bytes", &stats.mem_bytes, PARAM_UINT64_E);
+    dbg_utils_print_field(file, "bytes per route", &bytes_per_route, PARAM_UINT64_E);
+    dbg_utils_print(file, "\n");
+}
+
+static void SAI_dump_route_shadow_vrf_print(_In_ FILE *file)
+{
+    mlnx_route_shadow_stats_t stats;
+    uint32_t                  vrid            = 0;
+    uint64_t                  bytes_per_route = 0;
+    dbg_utils_table_columns_t vrf_clmns[]     = {
+        {"vrid",            11, PARAM_UINT32_E, &vrid},
+        {"routes",          11, PARAM_UINT32_E, &stats.route_count},
+        {"nodes",           11, PARAM_UINT32_E, &stats.node_count},
+        {"memory bytes",    16, PARAM_UINT64_E, &stats.mem_bytes},
+        {"bytes per route", 16, PARAM_UINT64_E, &bytes_per_route},
+        {NULL,              0,  0,              NULL}
+    };
+
+    dbg_utils_print_secondary_header(file, "Route shadow per VRF");
+
+    dbg_utils_print_table_headline(file, vrf_clmns);
+
+    for (vrid = 0; vrid < g_resource_limits.router_vrid_max; vrid++) {
+        mlnx_route_shadow_stats_get((sx_router_id_t)vrid, &stats);
+        if (0 == stats.vrf_count) {
+            continue;
+        }
+
+        bytes_per_route = stats.route_count ? stats.mem_bytes / stats.route_count : 0;
+        dbg_utils_print_table_data_line(file, vrf_clmns);
+    }
+}
+
+void SAI_dump_route(_In_ FILE *file)
+{
+    dbg_utils_print_module_header(file, "SAI Route");
+
+    SAI_dump_route_shadow_total_print(file);
+    SAI_dump_route_shadow_vrf_print(file);
+}
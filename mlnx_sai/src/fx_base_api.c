@@ -68,6 +68,14 @@ static sx_verbosity_level_t LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNIN
 typedef sx_port_log_id_t port_handle_type;
 typedef sx_router_interface_t rif_handle_type;
 
+/* see key_index_* */
+typedef struct fx_key_index {
+    uint32_t                bucket_count;
+    uint32_t               *buckets;   /* offset + 1, 0 - empty */
+    uint32_t               *hashes;    /* per offset */
+    fx_bytearray_t         *keys;      /* per offset, serialized match key, NULL - not indexed */
+}fx_key_index;
+
 typedef struct acl_table {
     fx_table_id_t     table_id;
     sx_acl_size_t           table_size;
@@ -83,6 +91,7 @@ typedef struct acl_table {
     sx_acl_rule_offset_t    default_entry_offset;
     char                    table_name[MAX_TABLE_NAME_LEN];
     fx_range_table_t*       range_table; /* Used for Range match type and future extensions */
+    fx_key_index            key_index;   /* match key -> offset, for fx_table_entry_offset_find */
 }acl_table;
 
 typedef struct fx_custom_params {
@@ -129,6 +138,12 @@ typedef sx_status_t fx_table_x_entry_add (fx_handle_t handle,
         fx_key_list_t keys,
         fx_param_list_t params,
         sx_acl_rule_offset_t* offset_ptr);
+typedef sx_status_t fx_table_x_entry_prepare (fx_handle_t handle,
+        fx_action_id_t action_id,
+        fx_key_list_t keys,
+        fx_param_list_t params,
+        sx_acl_rule_offset_t* offset_ptr,
+        sx_flex_acl_flex_rule_t *rule);
 // per table remove needed only for range tables
 typedef sx_status_t fx_table_x_entry_remove (fx_handle_t handle,
         uint8_t offset);
@@ -169,6 +184,8 @@ fx_binding_update_pipe_x *fx_binding_update_pipe_x_fn[4] = {NULL, binding_update
 
 fx_table_x_entry_add  add_table_entry_control_in_rif_table_bitmap_classification, add_table_entry_control_in_rif_table_bitmap_router, add_table_entry_control_out_rif_table_l3_vxlan;
 fx_table_x_entry_add * fx_table_x_entry_add_fn[3] = {add_table_entry_control_in_rif_table_bitmap_classification, add_table_entry_control_in_rif_table_bitmap_router, add_table_entry_control_out_rif_table_l3_vxlan};
+fx_table_x_entry_prepare  prepare_table_entry_control_in_rif_table_bitmap_classification, prepare_table_entry_control_in_rif_table_bitmap_router, prepare_table_entry_control_out_rif_table_l3_vxlan;
+fx_table_x_entry_prepare * fx_table_x_entry_prepare_fn[3] = {prepare_table_entry_control_in_rif_table_bitmap_classification, prepare_table_entry_control_in_rif_table_bitmap_router, prepare_table_entry_control_out_rif_table_l3_vxlan};
 fx_table_x_default_entry_set  fx_control_in_rif_table_bitmap_classification_default_entry_set, fx_control_in_rif_table_bitmap_router_default_entry_set, fx_control_out_rif_table_l3_vxlan_default_entry_set;
 fx_table_x_default_entry_set * fx_table_x_default_entry_set_fn[3] = {fx_control_in_rif_table_bitmap_classification_default_entry_set, fx_control_in_rif_table_bitmap_router_default_entry_set, fx_control_out_rif_table_l3_vxlan_default_entry_set};
 fx_table_x_init_keys  fx_init_key_list_control_in_rif_table_bitmap_classification, fx_init_key_list_control_in_rif_table_bitmap_router, fx_init_key_list_control_out_rif_table_l3_vxlan;
@@ -282,6 +299,143 @@ create_acl_p4_key(fx_handle_t handle, struct acl_table * acl_table, struct fx_cu
     return rc;
 }
 
+/*
+ * Software index of the table rules by match key, used by fx_table_entry_offset_find
+ * instead of reading all the rules back from hardware.
+ * The key is the concatenation of (key index, len, data) of the keys that have data, NULL key data
+ * is don't care. Buckets are open addressing with linear probing and hold offset + 1, 0 - empty.
+ */
+static uint32_t key_index_hash(const fx_bytearray_t *blob) {
+    uint32_t hash = 2166136261u;
+    for (size_t i=0; i<blob->len; i++) {
+        hash = (hash ^ blob->data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static sx_status_t key_index_serialize(fx_key_list_t keys, fx_bytearray_t *blob) {
+    size_t len = 0;
+    for (size_t y=0; y<keys.len; y++) {
+        if (keys.keys[y].key.data != NULL) {
+            len += 2 * sizeof(uint32_t) + keys.keys[y].key.len;
+        }
+    }
+    blob->data = (uint8_t*) malloc(len ? len : 1);
+    if (blob->data == NULL) {
+        return SX_STATUS_NO_MEMORY;
+    }
+    blob->len = 0;
+    for (size_t y=0; y<keys.len; y++) {
+        if (keys.keys[y].key.data != NULL) {
+            /* the key index tells apart key lists that differ only in which keys are don't care */
+            uint32_t key_idx = (uint32_t)y;
+            uint32_t key_len = keys.keys[y].key.len;
+            memcpy(blob->data + blob->len, &key_idx, sizeof(key_idx));
+            blob->len += sizeof(key_idx);
+            memcpy(blob->data + blob->len, &key_len, sizeof(key_len));
+            blob->len += sizeof(key_len);
+            memcpy(blob->data + blob->len, keys.keys[y].key.data, key_len);
+            blob->len += key_len;
+        }
+    }
+    return SX_STATUS_SUCCESS;
+}
+
+static void key_index_free(struct acl_table *table) {
+    fx_key_index *index = &table->key_index;
+    if (index->keys) {
+        for (uint32_t i=0; i<table->table_size; i++) {
+            free(index->keys[i].data);
+        }
+    }
+    free(index->keys);
+    free(index->hashes);
+    free(index->buckets);
+    memset(index, 0, sizeof(*index));
+}
+
+static void key_index_alloc(struct acl_table *table) {
+    fx_key_index *index = &table->key_index;
+    memset(index, 0, sizeof(*index));
+    index->bucket_count = 1;
+    while (index->bucket_count < 2 * table->table_size) {
+        index->bucket_count <<= 1;
+    }
+    index->buckets = (uint32_t*) calloc(index->bucket_count, sizeof(uint32_t));
+    index->hashes = (uint32_t*) calloc(table->table_size, sizeof(uint32_t));
+    index->keys = (fx_bytearray_t*) calloc(table->table_size, sizeof(fx_bytearray_t));
+    if (!index->buckets || !index->hashes || !index->keys) {
+        SYSLOGF(SX_LOG_ERROR, "Failed to allocate key index of table %s, offset find reads rules from hardware\n",
+                table->table_name);
+        key_index_free(table);
+    }
+}
+
+static void key_index_remove(struct acl_table *table, sx_acl_rule_offset_t offset) {
+    fx_key_index *index = &table->key_index;
+    if (!index->buckets || offset >= table->table_size || index->keys[offset].data == NULL) {
+        return;
+    }
+    uint32_t mask = index->bucket_count - 1;
+    uint32_t hole = index->hashes[offset] & mask;
+    while (index->buckets[hole] != (uint32_t)offset + 1) {
+        hole = (hole + 1) & mask;
+    }
+    /* backward shift, so that lookups don't need tombstones */
+    for (uint32_t next = (hole + 1) & mask; index->buckets[next] != 0; next = (next + 1) & mask) {
+        uint32_t home = index->hashes[index->buckets[next] - 1] & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            index->buckets[hole] = index->buckets[next];
+            hole = next;
+        }
+    }
+    index->buckets[hole] = 0;
+    free(index->keys[offset].data);
+    index->keys[offset].data = NULL;
+    index->keys[offset].len = 0;
+}
+
+static void key_index_insert(struct acl_table *table, fx_key_list_t keys, sx_acl_rule_offset_t offset) {
+    fx_key_index *index = &table->key_index;
+    if (!index->buckets || offset >= table->table_size) {
+        return;
+    }
+    key_index_remove(table, offset);
+    if (key_index_serialize(keys, &index->keys[offset])) {
+        SYSLOGF(SX_LOG_ERROR, "Failed to index rule at offset %d of table %s, offset find reads rules from hardware\n",
+                offset, table->table_name);
+        key_index_free(table);
+        return;
+    }
+    uint32_t mask = index->bucket_count - 1;
+    uint32_t bucket;
+    index->hashes[offset] = key_index_hash(&index->keys[offset]);
+    for (bucket = index->hashes[offset] & mask; index->buckets[bucket] != 0; bucket = (bucket + 1) & mask) {
+    }
+    index->buckets[bucket] = (uint32_t)offset + 1;
+}
+
+static sx_status_t key_index_find(struct acl_table *table, fx_key_list_t keys, sx_acl_rule_offset_t* offset) {
+    fx_key_index *index = &table->key_index;
+    fx_bytearray_t blob;
+    sx_status_t rc = key_index_serialize(keys, &blob);
+    if (rc) return rc;
+    uint32_t mask = index->bucket_count - 1;
+    uint32_t hash = key_index_hash(&blob);
+    rc = SX_STATUS_ENTRY_NOT_FOUND;
+    for (uint32_t bucket = hash & mask; index->buckets[bucket] != 0; bucket = (bucket + 1) & mask) {
+        uint32_t i = index->buckets[bucket] - 1;
+        if (index->hashes[i] == hash && index->keys[i].len == blob.len &&
+            0 == memcmp(index->keys[i].data, blob.data, blob.len)) {
+            *offset = i;
+            rc = SX_STATUS_SUCCESS;
+            break;
+        }
+    }
+    free(blob.data);
+    return rc;
+}
+
 /* Create ACL region */
 sx_status_t create_acl_table(fx_handle_t handle,struct acl_table * acl_table)
 {
@@ -323,6 +477,7 @@ sx_status_t create_acl_table(fx_handle_t handle,struct acl_table * acl_table)
     acl_table->rule_counters = (sx_flow_counter_id_t*) malloc(sizeof(sx_flow_counter_id_t)*acl_table->table_size);
 
     alloc_bitmap(&acl_table->valid_offsets, acl_table->table_size);
+    key_index_alloc(acl_table);
 
     acl_table->default_entry_offset = acl_table->table_size - 1;
     return SX_STATUS_SUCCESS;
@@ -516,6 +671,7 @@ int delete_acl(fx_handle_t handle,struct acl_table *acl_table)
   sx_status_t           rc2 = SX_STATUS_SUCCESS;
   free_bitmap(acl_table->valid_offsets);
   acl_table->valid_offsets = 0;
+  key_index_free(acl_table);
   free(acl_table->rule_counters);
   acl_table->rule_counters = 0;
   sx_acl_region_group_t acl_region_group = {
@@ -548,12 +704,8 @@ int delete_acl(fx_handle_t handle,struct acl_table *acl_table)
    return rc1 ? rc1 : rc2;
 }
 
-int remove_table_entry(fx_handle_t handle, struct acl_table *acl_table, sx_acl_rule_offset_t offset) {
-    sx_status_t rc1 = SX_STATUS_SUCCESS;
-    rc1 = sx_api_acl_flex_rules_set(handle->sdk_handle, SX_ACCESS_CMD_DELETE, acl_table->region_id, &offset, NULL, 1);
-    if (rc1) {
-        SYSLOGF(SX_LOG_ERROR, "ERROR: failed to remove rule at offset %d: [%s]\n", offset, SX_STATUS_MSG(rc1));
-    }
+/* private function to release the counter, offset and key index of a removed rule */
+sx_status_t remove_table_entry_internal(fx_handle_t handle, struct acl_table *acl_table, sx_acl_rule_offset_t offset) {
     sx_status_t rc2 = SX_STATUS_SUCCESS;
     if (0 != acl_table->rule_counters) {
         rc2 = sx_api_flow_counter_clear_set(handle->sdk_handle, acl_table->rule_counters[offset]);
@@ -564,6 +716,17 @@ int remove_table_entry(fx_handle_t handle, struct acl_table *acl_table, sx_acl_r
     if (0 != acl_table->valid_offsets) {
         reset_bitmap(acl_table->valid_offsets, offset);
     }
+    key_index_remove(acl_table, offset);
+    return rc2;
+}
+
+int remove_table_entry(fx_handle_t handle, struct acl_table *acl_table, sx_acl_rule_offset_t offset) {
+    sx_status_t rc1 = SX_STATUS_SUCCESS;
+    rc1 = sx_api_acl_flex_rules_set(handle->sdk_handle, SX_ACCESS_CMD_DELETE, acl_table->region_id, &offset, NULL, 1);
+    if (rc1) {
+        SYSLOGF(SX_LOG_ERROR, "ERROR: failed to remove rule at offset %d: [%s]\n", offset, SX_STATUS_MSG(rc1));
+    }
+    sx_status_t rc2 = remove_table_entry_internal(handle, acl_table, offset);
     return rc1 ? rc1 : rc2;
 }
 
@@ -789,15 +952,20 @@ sx_status_t delete_p4_table(fx_handle_t handle, struct acl_table *table, struct
 }
 
 /* private function to get offsets */
-void get_exact_offset_internal(struct acl_table *table, sx_acl_rule_offset_t *offset_ptr) {
+sx_status_t get_exact_offset_internal(struct acl_table *table, sx_acl_rule_offset_t *offset_ptr) {
     for (uint32_t i=0; i<table->table_size; i++) {
+        /* skip the fully used bitmap bytes */
+        if (i % CHAR_BIT == 0 && table->valid_offsets[i / CHAR_BIT] == UCHAR_MAX) {
+          i += CHAR_BIT - 1;
+          continue;
+        }
         if (get_bitmap(table->valid_offsets, i) == 0) {
           *offset_ptr = i;
-          return;
+          return SX_STATUS_SUCCESS;
         }
     }
     SYSLOGF(SX_LOG_ERROR, "exact match table %s is full\n", table->table_name);
-    return;
+    return SX_STATUS_NO_RESOURCES;
 }
 
 /* private function to set the acl, for all table types */
@@ -1000,7 +1168,11 @@ sx_status_t fx_table_entry_add(fx_handle_t handle, const fx_table_id_t table_id,
   sx_status_t rc = get_table_index_from_id (handle, table_id, &table_index);
   if (rc) return rc;
   // TODO action enum to id 
-  return((*fx_table_x_entry_add_fn[table_index])(handle, action_id, keys, params, offset_ptr) );
+  rc = (*fx_table_x_entry_add_fn[table_index])(handle, action_id, keys, params, offset_ptr);
+  if (rc == SX_STATUS_SUCCESS && handle->acl_tables[table_index].range_table == NULL) {
+    key_index_insert(&handle->acl_tables[table_index], keys, *offset_ptr);
+  }
+  return rc;
 }
 
 sx_status_t fx_table_entry_remove(fx_handle_t handle, const fx_table_id_t table_id, sx_acl_rule_offset_t offset){
@@ -1022,6 +1194,140 @@ sx_status_t fx_table_entry_remove(fx_handle_t handle, const fx_table_id_t table_
   }
 }
 
+/* add several entries of a table with one multi-rule SDK call */
+sx_status_t fx_table_entries_add(fx_handle_t handle, const fx_table_id_t table_id, uint32_t entry_count,
+        const fx_action_id_t *action_ids, const fx_key_list_t *keys, const fx_param_list_t *params,
+        sx_acl_rule_offset_t *offsets, sx_status_t *entry_statuses){
+  int table_index;
+  sx_status_t rc = get_table_index_from_id (handle, table_id, &table_index);
+  if (rc) return rc;
+  if (!action_ids || !keys || !params || !offsets || !entry_statuses) return SX_STATUS_PARAM_NULL;
+  struct acl_table *table = &handle->acl_tables[table_index];
+  if (table->range_table != NULL) {
+    SYSLOGF(SX_LOG_ERROR, "ERROR: fx_table_entries_add table_id: %d, range tables are not supported.\n", table_id);
+    return SX_STATUS_PARAM_ERROR;
+  }
+  if (entry_count == 0) return SX_STATUS_SUCCESS;
+
+  sx_flex_acl_flex_rule_t *rules = (sx_flex_acl_flex_rule_t*) calloc(entry_count, sizeof(sx_flex_acl_flex_rule_t));
+  sx_acl_rule_offset_t *rule_offsets = (sx_acl_rule_offset_t*) calloc(entry_count, sizeof(sx_acl_rule_offset_t));
+  uint32_t *rule_entries = (uint32_t*) calloc(entry_count, sizeof(uint32_t));
+  bool *rule_is_new = (bool*) calloc(entry_count, sizeof(bool));
+  if (!rules || !rule_offsets || !rule_entries || !rule_is_new) {
+    rc = SX_STATUS_NO_MEMORY;
+    goto out;
+  }
+
+  /* build the rules, the offsets are reserved in the bitmap so that the next exact offset is a new one */
+  uint32_t rules_count = 0;
+  for (uint32_t i=0; i<entry_count; i++) {
+    entry_statuses[i] = (*fx_table_x_entry_prepare_fn[table_index])(handle, action_ids[i], keys[i], params[i],
+                                                                   &offsets[i], &rules[rules_count]);
+    if (entry_statuses[i]) {
+      SYSLOGF(SX_LOG_ERROR, "ERROR: failed to build rule of entry %u: [%s]\n", i, SX_STATUS_MSG(entry_statuses[i]));
+      continue;
+    }
+    rule_is_new[rules_count] = (get_bitmap(table->valid_offsets, offsets[i]) == 0);
+    set_bitmap(table->valid_offsets, offsets[i]);
+    rule_offsets[rules_count] = offsets[i];
+    rule_entries[rules_count] = i;
+    rules_count++;
+  }
+
+  if (rules_count > 0) {
+    rc = sx_api_acl_flex_rules_set(handle->sdk_handle, SX_ACCESS_CMD_SET, table->region_id, rule_offsets, rules,
+                                   rules_count);
+    if (rc) {
+      SYSLOGF(SX_LOG_NOTICE, "Failed to insert %u rules at once [%s], inserting one by one\n", rules_count,
+              SX_STATUS_MSG(rc));
+    }
+    for (uint32_t j=0; j<rules_count; j++) {
+      uint32_t i = rule_entries[j];
+      if (rc) {
+        entry_statuses[i] = sx_api_acl_flex_rules_set(handle->sdk_handle, SX_ACCESS_CMD_SET, table->region_id,
+                                                      &rule_offsets[j], &rules[j], 1);
+        if (entry_statuses[i]) {
+          SYSLOGF(SX_LOG_ERROR, "ERROR %d: [%s] Failed to insert rule at offset %d\n", entry_statuses[i],
+                  SX_STATUS_MSG(entry_statuses[i]), rule_offsets[j]);
+        }
+      }
+      else {
+        entry_statuses[i] = SX_STATUS_SUCCESS;
+      }
+      if (entry_statuses[i] == SX_STATUS_SUCCESS) {
+        key_index_insert(table, keys[i], rule_offsets[j]);
+      }
+      else if (rule_is_new[j]) {
+        reset_bitmap(table->valid_offsets, rule_offsets[j]);
+      }
+      sx_lib_flex_acl_rule_deinit(&rules[j]);
+    }
+    SYSLOGF(SX_LOG_DEBUG, "Inserted %u rules to table %s\n", rules_count, table->table_name);
+  }
+
+  rc = SX_STATUS_SUCCESS;
+  for (uint32_t i=0; i<entry_count; i++) {
+    if (entry_statuses[i]) {
+      rc = SX_STATUS_ERROR;
+      break;
+    }
+  }
+
+out:
+  free(rule_is_new);
+  free(rule_entries);
+  free(rule_offsets);
+  free(rules);
+  return rc;
+}
+
+/* remove several entries of a table with one multi-rule SDK call */
+sx_status_t fx_table_entries_remove(fx_handle_t handle, const fx_table_id_t table_id, uint32_t entry_count,
+        sx_acl_rule_offset_t *offsets, sx_status_t *entry_statuses){
+  int table_index;
+  sx_status_t rc = get_table_index_from_id (handle, table_id, &table_index);
+  if (rc) return rc;
+  if (!offsets || !entry_statuses) return SX_STATUS_PARAM_NULL;
+  struct acl_table *table = &handle->acl_tables[table_index];
+  if (table->range_table != NULL) {
+    SYSLOGF(SX_LOG_ERROR, "ERROR: fx_table_entries_remove table_id: %d, range tables are not supported.\n", table_id);
+    return SX_STATUS_PARAM_ERROR;
+  }
+  if (entry_count == 0) return SX_STATUS_SUCCESS;
+
+  rc = sx_api_acl_flex_rules_set(handle->sdk_handle, SX_ACCESS_CMD_DELETE, table->region_id, offsets, NULL,
+                                 entry_count);
+  if (rc) {
+    SYSLOGF(SX_LOG_NOTICE, "Failed to remove %u rules at once [%s], removing one by one\n", entry_count,
+            SX_STATUS_MSG(rc));
+  }
+  for (uint32_t i=0; i<entry_count; i++) {
+    if (rc) {
+      entry_statuses[i] = sx_api_acl_flex_rules_set(handle->sdk_handle, SX_ACCESS_CMD_DELETE, table->region_id,
+                                                    &offsets[i], NULL, 1);
+      /* the failed batch call may have deleted some of the rules before it stopped */
+      if (entry_statuses[i] == SX_STATUS_ENTRY_NOT_FOUND) {
+        entry_statuses[i] = SX_STATUS_SUCCESS;
+      }
+      if (entry_statuses[i]) {
+        SYSLOGF(SX_LOG_ERROR, "ERROR: failed to remove rule at offset %d: [%s]\n", offsets[i],
+                SX_STATUS_MSG(entry_statuses[i]));
+        continue;
+      }
+    }
+    entry_statuses[i] = remove_table_entry_internal(handle, table, offsets[i]);
+  }
+
+  rc = SX_STATUS_SUCCESS;
+  for (uint32_t i=0; i<entry_count; i++) {
+    if (entry_statuses[i]) {
+      rc = SX_STATUS_ERROR;
+      break;
+    }
+  }
+  return rc;
+}
+
 sx_status_t fx_bytearray_data_put(fx_bytearray_t *out, const void *in, size_t size)
 {
     if (!out) return SX_STATUS_PARAM_NULL;
@@ -1229,13 +1535,10 @@ sx_status_t fx_table_entry_count_get(fx_handle_t handle, const fx_table_id_t tab
     return rc;
 }
 
-/* find the rule that matches the keys, if caller does not know the offset */
-sx_status_t fx_table_entry_offset_find(fx_handle_t handle, const fx_table_id_t table_id, fx_key_list_t keys,
-        sx_acl_rule_offset_t* offset) {
-    int table_index;
-    sx_status_t rc = get_table_index_from_id (handle, table_id, &table_index);
-    if (rc) return rc;
-    struct acl_table *table = &handle->acl_tables[table_index];
+/* find the rule that matches the keys by reading all the table rules from hardware */
+static sx_status_t fx_table_entry_offset_find_hw(fx_handle_t handle, const fx_table_id_t table_id,
+        struct acl_table *table, fx_key_list_t keys, sx_acl_rule_offset_t* offset) {
+    sx_status_t rc = SX_STATUS_SUCCESS;
     sx_acl_rule_offset_t offsets[table->table_size];
     uint32_t rules_count = 0;
     for (uint32_t i=0; i<table->table_size; i++) {
@@ -1322,6 +1625,26 @@ sx_status_t fx_table_entry_offset_find(fx_handle_t handle, const fx_table_id_t t
     return rc;
 }
 
+/* find the rule that matches the keys, if caller does not know the offset */
+sx_status_t fx_table_entry_offset_find(fx_handle_t handle, const fx_table_id_t table_id, fx_key_list_t keys,
+        sx_acl_rule_offset_t* offset) {
+    int table_index;
+    sx_status_t rc = get_table_index_from_id (handle, table_id, &table_index);
+    if (rc) return rc;
+    struct acl_table *table = &handle->acl_tables[table_index];
+    if (table->range_table == NULL && table->key_index.buckets != NULL) {
+        rc = key_index_find(table, keys, offset);
+        if (rc == SX_STATUS_SUCCESS) {
+            SYSLOGF(SX_LOG_DEBUG, "FOUND Rule offset %i\n", *offset);
+        }
+        else if (rc == SX_STATUS_ENTRY_NOT_FOUND) {
+            SYSLOGF(SX_LOG_ERROR,"Failed to find modify key in table %s\n", table->table_name);
+        }
+        return rc;
+    }
+    return fx_table_entry_offset_find_hw(handle, table_id, table, keys, offset);
+}
+
 sx_status_t fx_table_entry_default_set(fx_handle_t handle, const fx_table_id_t table_id, const fx_action_id_t action_id, fx_param_list_t params){
     int table_index;
   sx_status_t rc = get_table_index_from_id (handle, table_id, &table_index);
@@ -1684,7 +2007,7 @@ void fx_deinit_key_list_control_in_rif_table_bitmap_classification(fx_key_list_t
     }
 }
 
-sx_status_t add_table_entry_control_in_rif_table_bitmap_classification_internal(fx_handle_t handle,struct acl_table *table, sx_flex_acl_flex_rule_t *rule, fx_key_list_t keys,fx_param_list_t params, fx_action_id_t action_id, sx_acl_rule_offset_t* offset_ptr)
+sx_status_t build_table_entry_control_in_rif_table_bitmap_classification(fx_handle_t handle,struct acl_table *table, sx_flex_acl_flex_rule_t *rule, fx_key_list_t keys,fx_param_list_t params, fx_action_id_t action_id, sx_acl_rule_offset_t* offset_ptr)
 {
   int sdk_action_count;
   sx_status_t rc = get_sdk_action_num_from_id(action_id,&sdk_action_count);
@@ -1708,24 +2031,32 @@ sx_status_t add_table_entry_control_in_rif_table_bitmap_classification_internal(
   /* TABLE ENTRY KEYS END */
   // init action
   set_action_list(handle, action_id, params, table, offset_ptr, rule );
-  rc = add_acl_rule_internal(handle, rule, offset_ptr, table);
-  sx_lib_flex_acl_rule_deinit(rule);
-  return rc;
+  return SX_STATUS_SUCCESS;
 }
 
-/* API for the CLI app - This can be made to be more user friendly */
-sx_status_t add_table_entry_control_in_rif_table_bitmap_classification(fx_handle_t handle, fx_action_id_t action_id, fx_key_list_t keys,fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr){
+/* build the rule of a new entry, the rule is initialized on success */
+sx_status_t prepare_table_entry_control_in_rif_table_bitmap_classification(fx_handle_t handle, fx_action_id_t action_id, fx_key_list_t keys,fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr, sx_flex_acl_flex_rule_t *rule){
   const int table_index = 0; // 0 is replaced by macro
   struct acl_table *table = &handle->acl_tables[table_index];
   /* EXACT OFFSET START */
-  get_exact_offset_internal(table, offset_ptr);
+  sx_status_t rc = get_exact_offset_internal(table, offset_ptr);
+  if (rc) return rc;
   /* EXACT OFFSET END */
-  sx_status_t           rc = SX_STATUS_SUCCESS;
-  sx_flex_acl_flex_rule_t  rule;
   rc = check_input_lengths_control_in_rif_table_bitmap_classification(keys, params, action_id);
   if (rc) return rc;
   /* Convert keys and mask from user friendly format to machine friendly here */
-  rc = add_table_entry_control_in_rif_table_bitmap_classification_internal(handle,table,&rule,keys,params,action_id, offset_ptr);
+  return build_table_entry_control_in_rif_table_bitmap_classification(handle,table,rule,keys,params,action_id, offset_ptr);
+}
+
+/* API for the CLI app - This can be made to be more user friendly */
+sx_status_t add_table_entry_control_in_rif_table_bitmap_classification(fx_handle_t handle, fx_action_id_t action_id, fx_key_list_t keys,fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr){
+  const int table_index = 0; // 0 is replaced by macro
+  struct acl_table *table = &handle->acl_tables[table_index];
+  sx_flex_acl_flex_rule_t  rule;
+  sx_status_t rc = prepare_table_entry_control_in_rif_table_bitmap_classification(handle, action_id, keys, params, offset_ptr, &rule);
+  if (rc) return rc;
+  rc = add_acl_rule_internal(handle, &rule, offset_ptr, table);
+  sx_lib_flex_acl_rule_deinit(&rule);
   return rc;
 }
 
@@ -1885,7 +2216,7 @@ void fx_deinit_key_list_control_in_rif_table_bitmap_router(fx_key_list_t key_lis
     }
 }
 
-sx_status_t add_table_entry_control_in_rif_table_bitmap_router_internal(fx_handle_t handle,struct acl_table *table, sx_flex_acl_flex_rule_t *rule, fx_key_list_t keys,fx_param_list_t params, fx_action_id_t action_id, sx_acl_rule_offset_t* offset_ptr)
+sx_status_t build_table_entry_control_in_rif_table_bitmap_router(fx_handle_t handle,struct acl_table *table, sx_flex_acl_flex_rule_t *rule, fx_key_list_t keys,fx_param_list_t params, fx_action_id_t action_id, sx_acl_rule_offset_t* offset_ptr)
 {
   int sdk_action_count;
   sx_status_t rc = get_sdk_action_num_from_id(action_id,&sdk_action_count);
@@ -1920,13 +2251,11 @@ sx_status_t add_table_entry_control_in_rif_table_bitmap_router_internal(fx_handl
   /* TABLE ENTRY KEYS END */
   // init action
   set_action_list(handle, action_id, params, table, offset_ptr, rule );
-  rc = add_acl_rule_internal(handle, rule, offset_ptr, table);
-  sx_lib_flex_acl_rule_deinit(rule);
-  return rc;
+  return SX_STATUS_SUCCESS;
 }
 
-/* API for the CLI app - This can be made to be more user friendly */
-sx_status_t add_table_entry_control_in_rif_table_bitmap_router(fx_handle_t handle, fx_action_id_t action_id, fx_key_list_t keys,fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr){
+/* build the rule of a new entry, the rule is initialized on success */
+sx_status_t prepare_table_entry_control_in_rif_table_bitmap_router(fx_handle_t handle, fx_action_id_t action_id, fx_key_list_t keys,fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr, sx_flex_acl_flex_rule_t *rule){
   const int table_index = 1; // 1 is replaced by macro
   struct acl_table *table = &handle->acl_tables[table_index];
   /* EXACT OFFSET START */
@@ -1935,11 +2264,21 @@ sx_status_t add_table_entry_control_in_rif_table_bitmap_router(fx_handle_t handl
     return SX_STATUS_PARAM_ERROR;  }
   /* EXACT OFFSET END */
   sx_status_t           rc = SX_STATUS_SUCCESS;
-  sx_flex_acl_flex_rule_t  rule;
   rc = check_input_lengths_control_in_rif_table_bitmap_router(keys, params, action_id);
   if (rc) return rc;
   /* Convert keys and mask from user friendly format to machine friendly here */
-  rc = add_table_entry_control_in_rif_table_bitmap_router_internal(handle,table,&rule,keys,params,action_id, offset_ptr);
+  return build_table_entry_control_in_rif_table_bitmap_router(handle,table,rule,keys,params,action_id, offset_ptr);
+}
+
+/* API for the CLI app - This can be made to be more user friendly */
+sx_status_t add_table_entry_control_in_rif_table_bitmap_router(fx_handle_t handle, fx_action_id_t action_id, fx_key_list_t keys,fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr){
+  const int table_index = 1; // 1 is replaced by macro
+  struct acl_table *table = &handle->acl_tables[table_index];
+  sx_flex_acl_flex_rule_t  rule;
+  sx_status_t rc = prepare_table_entry_control_in_rif_table_bitmap_router(handle, action_id, keys, params, offset_ptr, &rule);
+  if (rc) return rc;
+  rc = add_acl_rule_internal(handle, &rule, offset_ptr, table);
+  sx_lib_flex_acl_rule_deinit(&rule);
   return rc;
 }
 
@@ -2076,7 +2415,7 @@ void fx_deinit_key_list_control_out_rif_table_l3_vxlan(fx_key_list_t key_lists[]
     }
 }
 
-sx_status_t add_table_entry_control_out_rif_table_l3_vxlan_internal(fx_handle_t handle,struct acl_table *table, sx_flex_acl_flex_rule_t *rule, fx_key_list_t keys,fx_param_list_t params, fx_action_id_t action_id, sx_acl_rule_offset_t* offset_ptr)
+sx_status_t build_table_entry_control_out_rif_table_l3_vxlan(fx_handle_t handle,struct acl_table *table, sx_flex_acl_flex_rule_t *rule, fx_key_list_t keys,fx_param_list_t params, fx_action_id_t action_id, sx_acl_rule_offset_t* offset_ptr)
 {
   int sdk_action_count;
   sx_status_t rc = get_sdk_action_num_from_id(action_id,&sdk_action_count);
@@ -2101,24 +2440,32 @@ sx_status_t add_table_entry_control_out_rif_table_l3_vxlan_internal(fx_handle_t
   /* TABLE ENTRY KEYS END */
   // init action
   set_action_list(handle, action_id, params, table, offset_ptr, rule );
-  rc = add_acl_rule_internal(handle, rule, offset_ptr, table);
-  sx_lib_flex_acl_rule_deinit(rule);
-  return rc;
+  return SX_STATUS_SUCCESS;
 }
 
-/* API for the CLI app - This can be made to be more user friendly */
-sx_status_t add_table_entry_control_out_rif_table_l3_vxlan(fx_handle_t handle, fx_action_id_t action_id, fx_key_list_t keys,fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr){
+/* build the rule of a new entry, the rule is initialized on success */
+sx_status_t prepare_table_entry_control_out_rif_table_l3_vxlan(fx_handle_t handle, fx_action_id_t action_id, fx_key_list_t keys,fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr, sx_flex_acl_flex_rule_t *rule){
   const int table_index = 2; // 2 is replaced by macro
   struct acl_table *table = &handle->acl_tables[table_index];
   /* EXACT OFFSET START */
-  get_exact_offset_internal(table, offset_ptr);
+  sx_status_t rc = get_exact_offset_internal(table, offset_ptr);
+  if (rc) return rc;
   /* EXACT OFFSET END */
-  sx_status_t           rc = SX_STATUS_SUCCESS;
-  sx_flex_acl_flex_rule_t  rule;
   rc = check_input_lengths_control_out_rif_table_l3_vxlan(keys, params, action_id);
   if (rc) return rc;
   /* Convert keys and mask from user friendly format to machine friendly here */
-  rc = add_table_entry_control_out_rif_table_l3_vxlan_internal(handle,table,&rule,keys,params,action_id, offset_ptr);
+  return build_table_entry_control_out_rif_table_l3_vxlan(handle,table,rule,keys,params,action_id, offset_ptr);
+}
+
+/* API for the CLI app - This can be made to be more user friendly */
+sx_status_t add_table_entry_control_out_rif_table_l3_vxlan(fx_handle_t handle, fx_action_id_t action_id, fx_key_list_t keys,fx_param_list_t params, sx_acl_rule_offset_t* offset_ptr){
+  const int table_index = 2; // 2 is replaced by macro
+  struct acl_table *table = &handle->acl_tables[table_index];
+  sx_flex_acl_flex_rule_t  rule;
+  sx_status_t rc = prepare_table_entry_control_out_rif_table_l3_vxlan(handle, action_id, keys, params, offset_ptr, &rule);
+  if (rc) return rc;
+  rc = add_acl_rule_internal(handle, &rule, offset_ptr, table);
+  sx_lib_flex_acl_rule_deinit(&rule);
   return rc;
 }
 
@@ -0,0 +1,161 @@
+/*
+ * fx_base_api_test.c
+ *
+ * Unit test of the flex table key index used by fx_table_entry_offset_find.
+ * The index is internal to fx_base_api.c, so the file is included here.
+ *
+ */
+
+#include "fx_base_api.c"
+
+#define ASSERT_TRUE(x, fmt, ...)                                \
+    if (!(x)) {                                                 \
+        fprintf(stderr,                                         \
+                "ASSERT TRUE FAILED(%s:%d): %s: " fmt "\n",     \
+                __func__, __LINE__, #x, ##__VA_ARGS__);         \
+        exit(1); }
+
+#define TEST_TABLE_SIZE 1024
+#define TEST_ITERATIONS 200000
+#define TEST_NO_KEY     (-1)
+
+static void test_table_init(struct acl_table *table) {
+    memset(table, 0, sizeof(*table));
+    table->table_size = TEST_TABLE_SIZE;
+    strncpy(table->table_name, "test", sizeof(table->table_name) - 1);
+    key_index_alloc(table);
+    ASSERT_TRUE(table->key_index.buckets != NULL, "");
+}
+
+/* a key list of a don't care key and a 4 byte key */
+static void test_key_list_set(fx_key_list_t *keys, fx_key_t key_array[2], uint32_t *value) {
+    memset(key_array, 0, 2 * sizeof(fx_key_t));
+    key_array[1].key.data = (uint8_t*) value;
+    key_array[1].key.len = sizeof(*value);
+    keys->keys = key_array;
+    keys->len = 2;
+}
+
+/* the index is checked against a plain array of the key of each offset, rule keys are unique */
+static void test_key_index_random(void) {
+    static int64_t model[TEST_TABLE_SIZE];
+    struct acl_table table;
+    fx_key_t key_array[2];
+    fx_key_list_t keys;
+    sx_acl_rule_offset_t offset, found;
+    uint32_t value;
+    int64_t expected;
+    sx_status_t rc;
+
+    srand(1);
+    test_table_init(&table);
+    test_key_list_set(&keys, key_array, &value);
+    for (uint32_t i=0; i<TEST_TABLE_SIZE; i++) {
+        model[i] = TEST_NO_KEY;
+    }
+
+    for (uint32_t iter=0; iter<TEST_ITERATIONS; iter++) {
+        offset = rand() % TEST_TABLE_SIZE;
+        value = rand() % (3 * TEST_TABLE_SIZE);
+        expected = TEST_NO_KEY;
+        for (uint32_t i=0; i<TEST_TABLE_SIZE; i++) {
+            if (model[i] == value) {
+                expected = i;
+                break;
+            }
+        }
+
+        switch (rand() % 3) {
+        case 0:
+            key_index_remove(&table, offset);
+            model[offset] = TEST_NO_KEY;
+            break;
+
+        case 1:
+            if (expected != TEST_NO_KEY) {
+                break;
+            }
+            key_index_insert(&table, keys, offset);
+            model[offset] = value;
+            break;
+
+        default:
+            rc = key_index_find(&table, keys, &found);
+            if (expected == TEST_NO_KEY) {
+                ASSERT_TRUE(rc == SX_STATUS_ENTRY_NOT_FOUND, "value %u found at %u", value, found);
+            } else {
+                ASSERT_TRUE(rc == SX_STATUS_SUCCESS, "value %u", value);
+                ASSERT_TRUE(found == expected, "value %u found at %u, expected %ld", value, found, (long)expected);
+            }
+            break;
+        }
+    }
+
+    key_index_free(&table);
+}
+
+/* the same key data in another key of the list is another match key */
+static void test_key_index_key_position(void) {
+    struct acl_table table;
+    fx_key_t key_array[2];
+    fx_key_list_t keys = { key_array, 2 };
+    sx_acl_rule_offset_t found;
+    uint32_t value = 5;
+
+    test_table_init(&table);
+
+    memset(key_array, 0, sizeof(key_array));
+    key_array[0].key.data = (uint8_t*) &value;
+    key_array[0].key.len = sizeof(value);
+    key_index_insert(&table, keys, 7);
+
+    memset(key_array, 0, sizeof(key_array));
+    key_array[1].key.data = (uint8_t*) &value;
+    key_array[1].key.len = sizeof(value);
+    ASSERT_TRUE(key_index_find(&table, keys, &found) == SX_STATUS_ENTRY_NOT_FOUND, "found at %u", found);
+    key_index_insert(&table, keys, 9);
+    ASSERT_TRUE(key_index_find(&table, keys, &found) == SX_STATUS_SUCCESS && found == 9, "");
+
+    memset(key_array, 0, sizeof(key_array));
+    key_array[0].key.data = (uint8_t*) &value;
+    key_array[0].key.len = sizeof(value);
+    ASSERT_TRUE(key_index_find(&table, keys, &found) == SX_STATUS_SUCCESS && found == 7, "");
+
+    key_index_free(&table);
+}
+
+/* a rule set again at the same offset drops its old key */
+static void test_key_index_reinsert(void) {
+    struct acl_table table;
+    fx_key_t key_array[2];
+    fx_key_list_t keys;
+    sx_acl_rule_offset_t found;
+    uint32_t value;
+
+    test_table_init(&table);
+    test_key_list_set(&keys, key_array, &value);
+
+    value = 1;
+    key_index_insert(&table, keys, 3);
+    value = 2;
+    key_index_insert(&table, keys, 3);
+    ASSERT_TRUE(key_index_find(&table, keys, &found) == SX_STATUS_SUCCESS && found == 3, "");
+    value = 1;
+    ASSERT_TRUE(key_index_find(&table, keys, &found) == SX_STATUS_ENTRY_NOT_FOUND, "found at %u", found);
+
+    /* offsets out of the table are not indexed */
+    key_index_insert(&table, keys, TEST_TABLE_SIZE);
+    ASSERT_TRUE(key_index_find(&table, keys, &found) == SX_STATUS_ENTRY_NOT_FOUND, "found at %u", found);
+
+    key_index_free(&table);
+}
+
+int main(void) {
+    test_key_index_key_position();
+    test_key_index_reinsert();
+    test_key_index_random();
+
+    printf("fx_base_api_test: passed\n");
+
+    return 0;
+}
@@ -7,8 +7,8 @@
 //#include <fx_base_api.h>
 
 /**
-* @brief Flex range func for internal use. will devide each comperator to a series of tcam rules.
-* In general, each bigger (smaller) comperator costs the number of '0' ('1') in the binary representation of the coperator value.
+* @brief Flex range func for internal use. will devide the key space to disjoint segments and each segment to a series of tcam rules.
+* A segment [lo, hi) costs the number of aligned prefixes that cover it, segments with no range (action bitvec 0) cost nothing.
 *
 * TODO add polarity (comperator for bigger/smaller then).
 */
@@ -44,428 +44,338 @@ uint8_t fx_count_set_bits(uint32_t n){
 }
 
 
-/** @brief counts how many rules it will take to implement the range rules for all rules in the linked list */
-uint32_t fx_range_count_acl_rules(fx_comperator_ll_node_t* comperator_ll_node){
-	uint32_t rule_count=0;
-	while(comperator_ll_node != NULL){
-		//printf(">%u",comperator_ll_node->comparison_value);
-		printf("rule_count, com value %u, acl rules count %u \n", comperator_ll_node->comparison_value ,comperator_ll_node->num_of_acl_rules);
-		rule_count += comperator_ll_node->num_of_acl_rules;
-		comperator_ll_node = comperator_ll_node->next;
-	}
-	return rule_count;
-}
-
-
-
-/** @brief creates a new node in the comperator link list and configures all needed ASIC rules for it.
-* return NULL upon unsuccessful operation.
+/** @brief covers [lo, hi) with aligned prefixes, hi is up to 2^32.
+* Example [5, 12) is covered by {0101 , 011x , 10xx}
+* returns the number of prefixes, at most MAX_SEGMENT_ACL_RULES.
 */
-fx_comperator_ll_node_t* fx_range_cfg_comperator(uint32_t comperator_value, uint32_t num_of_range_rules, uint16_t action_bitvec, fx_comperator_ll_node_t* next){
-	//TODO protect malloc
-	// TODO return sx_status. it's ugly now!!
-	// printf("fx_range_cfg_comperator, comperator_value: %u.\n",comperator_value);
-	fx_comperator_ll_node_t* node = (fx_comperator_ll_node_t*) malloc (sizeof(fx_comperator_ll_node_t));
-	if (node == NULL){
-		printf("Error in: fx_range_cfg_comperator cannot create new ll node, returning.\n");
-		return node;
-	} 
-	node->comparison_value = comperator_value;
-	node->num_of_range_rules = num_of_range_rules;
-	node->action_bitvec = action_bitvec;
-	node->next = next;
-
-	// TODO ugly:
-	switch(comperator_value){
-		case 0:
-			node->num_of_acl_rules = 0; break;
-		case -1:
-			node->num_of_acl_rules = 1; break;
-		default:
-			node->num_of_acl_rules = fx_count_set_bits(comperator_value);
+uint8_t fx_range_segment_prefixes(uint32_t lo, uint64_t hi, uint32_t key_list[], uint32_t mask_list[]){
+	uint8_t count = 0;
+	uint64_t cur = lo;
+	while (cur < hi){
+		// largest aligned block starting at cur that does not pass hi
+		uint8_t block_bits = 0;
+		while ((block_bits < RANGE_WDT) && ((cur & ((1ULL << (block_bits + 1)) - 1)) == 0) &&
+			   (cur + (1ULL << (block_bits + 1)) <= hi)){
+			block_bits++;
+		}
+		key_list[count] = (uint32_t) cur;
+		mask_list[count] = (block_bits == RANGE_WDT) ? 0 : (0xffffffff << block_bits);
+		count++;
+		cur += (1ULL << block_bits);
 	}
-	// printf("fx_range_cfg_comperator success, num of acl rules: %u.\n",node->num_of_acl_rules);
-	return node;
+	return count;
 }
 
-/** @brief recursive delete link list from given node */
-void fx_range_delete_ll(fx_comperator_ll_node_t** node){
-	// printf("fx_range_delete_ll entered\n");
-	if(*node==NULL) {
-		// printf("fx_range_delete_ll reached NULL pointer\n");
-		return;
+/** @brief returns the index of the last segment that starts at or before value */
+static uint32_t fx_range_find_segment(fx_range_table_t* range_table, uint32_t value){
+	uint32_t lo = 0; // segments[0].start is 0
+	uint32_t hi = range_table->segments_count;
+	while (hi - lo > 1){
+		uint32_t mid = lo + (hi - lo) / 2;
+		if (range_table->segments[mid].start <= value)
+			lo = mid;
+		else
+			hi = mid;
 	}
-	fx_range_delete_ll(&(*node)->next);
-	// printf("fx_range_delete_ll>> deleting ll node value: %u, num_of_acl_rules: %u.\n",node->comparison_value,node->num_of_acl_rules);
-	free(*node);
-	*node = NULL;
-	return;
+	return lo;
 }
 
-/** @brief backup range link list
-*/
-sx_status_t fx_range_copy_ll(fx_comperator_ll_node_t* orig_node, fx_comperator_ll_node_t** copy_node){
-	// printf("fx_range_copy_ll>>");
-	if (orig_node==NULL){
-		// printf("ll end, deleting backup ll end.\n");
-		fx_range_delete_ll(copy_node); 
-		return SX_STATUS_SUCCESS;
-	}
-	else if (*copy_node == NULL){
-		// printf(" creating new node, value: %u.\n", orig_node->comparison_value);
-		*copy_node = fx_range_cfg_comperator(orig_node->comparison_value,orig_node->num_of_range_rules,orig_node->action_bitvec,NULL);
-		if (!*copy_node) {
-			// printf("Error: fx_range_copy_ll >> failed to allocate memroy for new node\n");
-			return (SX_STATUS_NO_MEMORY);
-		}
-		return fx_range_copy_ll(orig_node->next,&(*copy_node)->next);
-	}
-	else{
-		// printf(" modifing exsiting node, value: %u.\n", orig_node->comparison_value);
-		(*copy_node)->comparison_value   = orig_node->comparison_value ;
-		(*copy_node)->num_of_range_rules = orig_node->num_of_range_rules;
-		(*copy_node)->num_of_acl_rules   = orig_node->num_of_acl_rules;
-		(*copy_node)->action_bitvec     = orig_node->action_bitvec;
-		return fx_range_copy_ll(orig_node->next,&(*copy_node)->next);
+/** @brief releases the acl rules of a segment, they stay in the ASIC until compiled rules overwrite or delete them. */
+static void fx_range_release_segment_rules(fx_range_table_t* range_table, fx_range_segment_t* segment){
+	for (uint8_t i=0; i<segment->num_of_acl_rules; i++){
+		range_table->released_offsets[range_table->released_offsets_count++] = segment->acl_offsets[i];
 	}
+	segment->num_of_acl_rules = 0;
 }
 
+static void fx_range_mark_dirty(fx_range_table_t* range_table, fx_range_segment_t* segment){
+	if (segment->dirty) return;
+	segment->dirty = true;
+	range_table->dirty_segments_count++;
+	fx_range_release_segment_rules(range_table, segment);
+}
 
-/** @ brief sets all relevant action vector bits in each linked list node according the tables range rules and thier action id's */
-void fx_range_update_action_bitvec(fx_range_table_t* range_table){
-	// printf("fx_range_update_action_bitvec>>\n");
-	// TODO can save time by updating a single rule entry at a time.
-
-	// clear all action bitvec
-	fx_comperator_ll_node_t* ll_node = range_table->comperator_ll_start;
-	while (ll_node != NULL){
-		ll_node->action_bitvec = 0;
-		ll_node = ll_node->next;			
-	}
-
-	// printf("fx_range_update_action_bitvec>>finished initialisation.\n");
-	// set bit in bitvect for each comperator in range bounds.
-	fx_range_action_id_t range_action_id;
-	uint32_t range_start;
-	uint32_t range_end;
-	for (uint8_t i=0; i<MAX_RANGE_ENTRIES ; i++){
-		// printf("fx_range_update_action_bitvec>>rule %u\n.",i);
-		ll_node = range_table->comperator_ll_start;
-		range_action_id =	range_table->range_entries_list[i].action_id;
-		range_start	 = 	range_table->range_entries_list[i].start;
-		range_end 	 = 	range_table->range_entries_list[i].end;
-		if (range_table->range_entries_list[i].valid){
-			while (ll_node != NULL){
-				if ( (ll_node->comparison_value > range_start) &&
-					 (ll_node->comparison_value <=  range_end)){
-					ll_node->action_bitvec |=  (1<<range_action_id); // set bit
-				}
-				ll_node = ll_node->next;
-			}
-		}
+/** @brief makes sure count more segments can be added without failing in the middle of a change */
+static sx_status_t fx_range_reserve_segments(fx_range_table_t* range_table, uint32_t count){
+	if (range_table->segments_count + count <= range_table->segments_size) return SX_STATUS_SUCCESS;
+	uint32_t size = range_table->segments_size * 2;
+	while (size < range_table->segments_count + count) size *= 2;
+	fx_range_segment_t* segments = (fx_range_segment_t*) realloc(range_table->segments, size * sizeof(fx_range_segment_t));
+	if (segments == NULL){
+		printf("ERROR: in fx_range_reserve_segments, no memory for %u segments\n", size);
+		return SX_STATUS_NO_MEMORY;
 	}
+	range_table->segments = segments;
+	range_table->segments_size = size;
+	return SX_STATUS_SUCCESS;
 }
 
-/** @brief creates needed {keys,masks} for all acl rules needed to implement a comperator
-* Example smaller than 4'b1011, acl match are  {0xxx , 100x , 1010}
-*/
-void fx_get_range_key_mask(uint32_t comperator_value, fx_key_list_t keys[], uint32_t rule_offset){
-    for (int bit_indx = 31; bit_indx>=0; bit_indx--) {
-        if (comperator_value & (1<<bit_indx)){
-            keys[rule_offset].keys[0].key.len = 4; //TODO: should be taken from p4
-            keys[rule_offset].keys[0].mask.len = 4; //TODO: should be taken from p4
-            uint32_t key_value = (comperator_value ^ (1<<(bit_indx)));
-            uint32_t mask_value = (0xffffffff << bit_indx);
-            memcpy(keys[rule_offset].keys[0].key.data, &key_value, keys[rule_offset].keys[0].key.len); // current bit becomes 0
-            memcpy(keys[rule_offset].keys[0].mask.data, &mask_value, keys[rule_offset].keys[0].mask.len); // all zeros after current bit
-            rule_offset+=1;
-        }
-    }
+/** @brief makes sure the offset pools can hold count offsets */
+static sx_status_t fx_range_reserve_offsets(fx_range_table_t* range_table, uint32_t count){
+	if (count <= range_table->offsets_size) return SX_STATUS_SUCCESS;
+	uint32_t size = range_table->offsets_size ? range_table->offsets_size * 2 : 64;
+	while (size < count) size *= 2;
+	sx_acl_rule_offset_t* released = (sx_acl_rule_offset_t*) realloc(range_table->released_offsets, size * sizeof(sx_acl_rule_offset_t));
+	if (released == NULL) return SX_STATUS_NO_MEMORY;
+	range_table->released_offsets = released;
+	sx_acl_rule_offset_t* free_offsets = (sx_acl_rule_offset_t*) realloc(range_table->free_offsets, size * sizeof(sx_acl_rule_offset_t));
+	if (free_offsets == NULL) return SX_STATUS_NO_MEMORY;
+	range_table->free_offsets = free_offsets;
+	range_table->offsets_size = size;
+	return SX_STATUS_SUCCESS;
 }
 
-
-/** @brief recursively scans linked list and if needed adds node for new copmerator. if comerator exsits, the function increase the node range rules count by 1.
+/** @brief adds a range bound. if there is no segment starting at value, the segment containing value is split.
+* Segments must be reserved by the caller.
 */
-sx_status_t fx_range_add_comperator(fx_range_table_t* range_table, uint32_t comparison_value){
-	// printf("fx_range_add_comperator>> value: %d.\n",comparison_value);
-	
-	// handle head change or empty list: (should never get here if default entry is set);
-
-	if( (range_table->comperator_ll_start == NULL) || (range_table->comperator_ll_start->comparison_value > comparison_value)){
-		// printf("fx_range_add_comperator>> changing head.\n");
-		fx_comperator_ll_node_t* new_node = fx_range_cfg_comperator(comparison_value, 1, 0 , range_table->comperator_ll_start);
-		if (new_node == NULL){
-			return SX_STATUS_NO_MEMORY;
-		}
-		else{
-			range_table->comperator_ll_start = new_node;
-			return SX_STATUS_SUCCESS;
-		}
-	}
-	else if (range_table->comperator_ll_start->comparison_value == comparison_value){
-		range_table->comperator_ll_start->num_of_range_rules += 1;
+sx_status_t fx_range_add_bound(fx_range_table_t* range_table, uint32_t value){
+	uint32_t i = fx_range_find_segment(range_table, value);
+	fx_range_segment_t* segment = &range_table->segments[i];
+	if (segment->start == value){
+		segment->num_of_range_bounds += 1;
 		return SX_STATUS_SUCCESS;
 	}
-
-	fx_comperator_ll_node_t* next = range_table->comperator_ll_start->next;
-	fx_comperator_ll_node_t* current = range_table->comperator_ll_start;
-
-	while (next != NULL){
-		// Desired value exsists.
-		if (next->comparison_value == comparison_value) {
-			// printf("fx_range_add_comperator>> comparison value exsits. not adding new comperator.\n");
-			next->num_of_range_rules += 1;
-			// printf("fx_range_add_comperator>> done.\n");
-			return SX_STATUS_SUCCESS;
-		}
-		// add new node before node
-		else if (next->comparison_value > comparison_value) {
-			// printf("fx_range_add_comperator>> adding new comperator before comperator %u.\n",next->comparison_value);
-			fx_comperator_ll_node_t* new_node = fx_range_cfg_comperator(comparison_value, 1, 0 , next);
-			if(new_node==NULL){
-				return SX_STATUS_NO_MEMORY;
-			}
-			else{
-				current->next = new_node;
-				// printf("fx_range_add_comperator>> done.\n");
-				return SX_STATUS_SUCCESS;
-			}
-		}
-		current = current->next;
-		next = next->next;
-	}
-	// add in list end
-	printf("ERROR: fx_range_add_comperator>> adding compertor in list end. NO DEFAULT VALUE???.\n");
-	current->next = fx_range_cfg_comperator(comparison_value, 1, 0 , NULL);
-	if(current->next==NULL){
+	if (range_table->segments_count == range_table->segments_size){
 		return SX_STATUS_NO_MEMORY;
 	}
-	else{
-		// printf("fx_range_add_comperator>> done.\n");
-		return SX_STATUS_SUCCESS;
+	// the split segment covers less keys
+	if (segment->action_bitvec != 0){
+		fx_range_mark_dirty(range_table, segment);
 	}
+	memmove(&range_table->segments[i+2], &range_table->segments[i+1], (range_table->segments_count - i - 1) * sizeof(fx_range_segment_t));
+	range_table->segments_count++;
+	fx_range_segment_t* new_segment = &range_table->segments[i+1];
+	*new_segment = range_table->segments[i];
+	new_segment->start = value;
+	new_segment->num_of_range_bounds = 1;
+	new_segment->dirty = false;
+	new_segment->num_of_acl_rules = 0;
+	if (new_segment->action_bitvec != 0){
+		fx_range_mark_dirty(range_table, new_segment);
+	}
+	return SX_STATUS_SUCCESS;
 }
 
-/** @brief scans linked list and reduces the node's range rules count by 1. if count reached 0, the function deletes comperator node
+/** @brief removes a range bound. if no range starts or ends at value any more, the segment is merged to the previous one.
+* Both segments are covered by the same ranges, so the merged segment keeps the action bitvec.
 */
-sx_status_t fx_range_remove_comperator(fx_range_table_t* range_table, uint32_t comparison_value){
-	// printf("fx_range_remove_comperator>> value %u.\n",comparison_value);
-	// reduce nume_of_range_rules from node by 1. if num == 0 remove node.
-
-	fx_comperator_ll_node_t* current = range_table->comperator_ll_start;
-	if ((current == NULL) || (current->comparison_value>comparison_value)){
-		// printf("fx_range_remove_comperator>> value not found, node value %u\n",current?current->comparison_value:0);
-		return SX_STATUS_PARAM_ERROR;
+void fx_range_remove_bound(fx_range_table_t* range_table, uint32_t value){
+	uint32_t i = fx_range_find_segment(range_table, value);
+	fx_range_segment_t* segment = &range_table->segments[i];
+	segment->num_of_range_bounds -= 1;
+	if ((segment->num_of_range_bounds != 0) || (i == 0)) return;
+
+	fx_range_release_segment_rules(range_table, segment);
+	if (segment->dirty){
+		range_table->dirty_segments_count--;
 	}
-	fx_comperator_ll_node_t* next = range_table->comperator_ll_start->next;
-	if(current->comparison_value==comparison_value){
-		// remove ll head
-		// printf("fx_range_remove_comperator>> removing from ll head\n");
-		current->num_of_range_rules -= 1;
-		if(current->num_of_range_rules == 0){
-			range_table->comperator_ll_start = next;
-			free(current);
-		}
-		return SX_STATUS_SUCCESS;
+	// the previous segment covers more keys
+	if (range_table->segments[i-1].action_bitvec != 0){
+		fx_range_mark_dirty(range_table, &range_table->segments[i-1]);
 	}
+	memmove(&range_table->segments[i], &range_table->segments[i+1], (range_table->segments_count - i - 1) * sizeof(fx_range_segment_t));
+	range_table->segments_count--;
+}
 
-	while (current->comparison_value <= comparison_value){
-		// end of ll or ll is empty
-		if ((next == NULL) || (next->comparison_value > comparison_value)){
-			// printf("fx_range_remove_comperator>> value not found\n");
-			return SX_STATUS_PARAM_ERROR;
+/** @brief sets (clears) the action bit of a range in all segments it covers. only segments whose bitvec changed are recompiled. */
+void fx_range_update_action_bitvec(fx_range_table_t* range_table, uint32_t start, uint32_t end, fx_range_action_id_t action_id, boolean_t is_add){
+	for (uint32_t i = fx_range_find_segment(range_table, start); i<range_table->segments_count; i++){
+		fx_range_segment_t* segment = &range_table->segments[i];
+		if (segment->start >= end) break;
+		if (segment->start < start) continue;
+		if (is_add){
+			segment->action_refcnt[action_id] += 1;
 		}
-		// Desired value exsists.
-		else if (next->comparison_value == comparison_value) {
-			next->num_of_range_rules -= 1;
-			if(next->num_of_range_rules == 0){
-				// printf("fx_range_remove_comperator %u, num of range rules is 0\n.",next->comparison_value);
-				current->next = next->next;
-				free(next);
-			}
-			return SX_STATUS_SUCCESS;
+		else{
+			segment->action_refcnt[action_id] -= 1;
 		}
-		else { //(node->comparison_value < comparison_value){
-			// printf("fx_range_remove_comperator>> node value %u, continue to next node\n",current->comparison_value);
-			current = next;
-			next = next->next;
+		uint16_t action_bitvec = segment->action_bitvec & ~(1<<action_id);
+		if (segment->action_refcnt[action_id] != 0){
+			action_bitvec |= (1<<action_id); // set bit
+		}
+		if (action_bitvec != segment->action_bitvec){
+			fx_range_mark_dirty(range_table, segment);
+			segment->action_bitvec = action_bitvec;
 		}
 	}
-	// shoud not reach here
-	printf("ERROR: fx_range_remove_comperator>> in search, comparison value: %u\n",comparison_value);
-	return SX_STATUS_ERROR;
 }
 
+/** @brief number of acl rules that should be set to apply the last range changes */
 uint32_t fx_range_get_rules_list_count(fx_range_table_t* range_table){
-	// TODO if we count on default entry, we can use only new list length.
-	uint32_t rule_list_len_old = fx_range_count_acl_rules(range_table->backup_comperator_ll_start);
-	uint32_t rule_list_len_new = fx_range_count_acl_rules(range_table->comperator_ll_start);
-	return (rule_list_len_old > rule_list_len_new) ? rule_list_len_old : rule_list_len_new ;	
+	uint32_t key_list[MAX_SEGMENT_ACL_RULES];
+	uint32_t mask_list[MAX_SEGMENT_ACL_RULES];
+	uint32_t rule_count = 0;
+	if (range_table->dirty_segments_count == 0) return 0;
+	for (uint32_t i=0; i<range_table->segments_count; i++){
+		fx_range_segment_t* segment = &range_table->segments[i];
+		if (!segment->dirty || segment->action_bitvec == 0) continue;
+		uint64_t end = (i+1 < range_table->segments_count) ? range_table->segments[i+1].start : (1ULL << RANGE_WDT);
+		rule_count += fx_range_segment_prefixes(segment->start, end, key_list, mask_list);
+	}
+	return rule_count;
 }
 
-
-/* @brief */
+/* @brief fills the acl rules of the segments changed since the last compile.
+* Rules of released offsets are overwritten first, the offsets that were not reused are returned by fx_range_compile_removed_rules.
+*/
 sx_status_t fx_range_compile_rules(fx_range_table_t* range_table, fx_key_list_t keys[],fx_param_list_t action_params[], sx_acl_rule_offset_t offsets_list[],uint32_t rule_cnt){
-	// currently replace ALL rules!! TODO make more efficient
-	// check current amount of valid rules
-	// printf("backup_ll: ");
-	uint32_t rule_list_len_old = fx_range_count_acl_rules(range_table->backup_comperator_ll_start);
-	// printf("\nnew_ll   : ");
-	uint32_t rule_list_len_new = fx_range_count_acl_rules(range_table->comperator_ll_start);
-	// printf("\n");
-	// printf("rules count: old: %u. new: %u\n",rule_list_len_old,rule_list_len_new);
-	uint32_t rule_list_len = (rule_list_len_old > rule_list_len_new) ? rule_list_len_old : rule_list_len_new ;
+	uint32_t key_list[MAX_SEGMENT_ACL_RULES];
+	uint32_t mask_list[MAX_SEGMENT_ACL_RULES];
+	uint32_t rule_list_len = fx_range_get_rules_list_count(range_table);
 	if (rule_cnt != rule_list_len){
-		printf("Error in fx_range_config_rules, rules_list size mismatch, %d : %d\n",rule_cnt,rule_list_len ); // TODO maybe malloc the keys and rules here?
+		printf("Error in fx_range_compile_rules, rules_list size mismatch, %d : %d\n",rule_cnt,rule_list_len );
 		return SX_STATUS_NO_MEMORY;
 	}
-	printf("fx_range_insert_range_rules>> num of new rules: %u\n",rule_list_len_new);
-
-	/* if  number of ASIC rules > number of new rules, add non valid rules at the end. TODO: can just add default rule in the end!!!*/
-	// if (rule_list_len_old > rule_list_len_new){
-	// 	printf("fx_range_insert_range_rules>> padding with %u non valid rules\n",rule_list_len_old-rule_list_len_new);
-	// 	for (uint32_t offset=rule_list_len_new ; offset<rule_list_len_old ; offset++){
-	// 		rules_list[offset].valid=0;
-	// 	}	
-	// }
-
-	// create rules list from link list
-	uint32_t offset =0;
-	fx_comperator_ll_node_t* node = range_table->comperator_ll_start;
-
-	while(node !=NULL){
-		// printf("fx_range_insert_range_rules>> creating key,mask for value: %u\n",node->comparison_value);
-		if(node->comparison_value != -1){
-			fx_get_range_key_mask(node->comparison_value, keys, offset);
-		}
-		else{
-			memset(keys[offset].keys[0].key.data, 0, keys[offset].keys[0].key.len);
-			memset(keys[offset].keys[0].mask.data, 0, keys[offset].keys[0].mask.len);
-		}
-		// TODO pref: can do without copying.
-		for (uint32_t i = offset; i<(offset+node->num_of_acl_rules);i++){
-			// printf("adding range %u, comp_rule %u, action_bitvec %u\n",i,i-offset,node->action_bitvec);
-			action_params[i].params[0].data = (uint8_t*) &node->action_bitvec;
-			action_params[i].params[0].len = 2;
-			offsets_list[i] = i;
+	// make sure the offsets that are not in the pools are avaliable
+	uint32_t pooled = range_table->released_offsets_count + range_table->free_offsets_count;
+	uint32_t new_offsets = (rule_list_len > pooled) ? rule_list_len - pooled : 0;
+	if (range_table->next_offset + new_offsets > range_table->region_size){
+		printf("ERROR in fx_range_compile_rules, no more acl offsets avaliable\n");
+		return SX_STATUS_NO_RESOURCES;
+	}
+	sx_status_t rc = fx_range_reserve_offsets(range_table, range_table->next_offset + new_offsets);
+	if (rc) return rc;
+
+	uint32_t offset = 0;
+	for (uint32_t i=0; i<range_table->segments_count && range_table->dirty_segments_count; i++){
+		fx_range_segment_t* segment = &range_table->segments[i];
+		if (!segment->dirty) continue;
+		segment->dirty = false;
+		range_table->dirty_segments_count--;
+		if (segment->action_bitvec == 0) continue;
+		uint64_t end = (i+1 < range_table->segments_count) ? range_table->segments[i+1].start : (1ULL << RANGE_WDT);
+		segment->num_of_acl_rules = fx_range_segment_prefixes(segment->start, end, key_list, mask_list);
+		for (uint8_t j=0; j<segment->num_of_acl_rules; j++){
+			sx_acl_rule_offset_t acl_offset;
+			if (range_table->released_offsets_count){
+				acl_offset = range_table->released_offsets[--range_table->released_offsets_count];
+			}
+			else if (range_table->free_offsets_count){
+				acl_offset = range_table->free_offsets[--range_table->free_offsets_count];
+			}
+			else{
+				acl_offset = range_table->next_offset++;
+			}
+			segment->acl_offsets[j] = acl_offset;
+			keys[offset].keys[0].key.len = 4; //TODO: should be taken from p4
+			keys[offset].keys[0].mask.len = 4; //TODO: should be taken from p4
+			memcpy(keys[offset].keys[0].key.data, &key_list[j], keys[offset].keys[0].key.len);
+			memcpy(keys[offset].keys[0].mask.data, &mask_list[j], keys[offset].keys[0].mask.len);
+			action_params[offset].params[0].data = (uint8_t*) &segment->action_bitvec;
+			action_params[offset].params[0].len = 2;
+			offsets_list[offset] = acl_offset;
+			offset++;
 		}
-		offset += node->num_of_acl_rules;
-		node = node->next;
 	}
-	// printf("fx_range_insert_range_rules>> created rules list.\n");
 	return(SX_STATUS_SUCCESS);
-	// return 0;
 }
 
-sx_status_t fx_add_range_entry(fx_range_table_t* range_table,uint32_t start,uint32_t end, fx_range_action_id_t action_id,sx_acl_rule_offset_t* range_entry_handle){
-	// find avaliable range index (TODO if range entry == action_id, can use action id as index)
-	// range_entry_handle = (uint8_t*) malloc(sizeof(uint8_t));
-	// if(*range_entry_handle==NULL){ return SX_STATUS_NO_MEMORY;}
-	sx_status_t rc;
-	for (uint8_t i=0; i<MAX_RANGE_ENTRIES ; i++){
-		if (range_table->range_entries_list[i].valid)
-			continue;
-		else{
-			*range_entry_handle = i;
-			printf("fx_add_range_entry>> add range entry, using handle %d, %u.\n",i, *range_entry_handle);
-			range_table->range_entries_list[i].start=start;
-			range_table->range_entries_list[i].end = end;
-			range_table->range_entries_list[i].action_id = action_id;
-			if (start!=0){
-				rc = fx_range_add_comperator(range_table,start);
-				if (rc) {
-					//revert comperators link list
-					printf("Error in: fx_add_range_entry, using backup rules. new range was not added.\n");
-					fx_range_copy_ll(range_table->backup_comperator_ll_start, &range_table->comperator_ll_start);
-					return (rc);
-				}
-				// printf("fx_add_range_entry>> added comperator %u.\n",start);
-			}
-			sx_status_t rc = fx_range_add_comperator(range_table,end);
-			if (rc) {
-				//revert comperators link list
-				printf("ERROR in fx_add_range_entry, using backup rules. new range was not added.\n");
-				fx_range_copy_ll(range_table->backup_comperator_ll_start, &range_table->comperator_ll_start);
-				return (rc);
-			}
-			// printf("fx_add_range_entry>> added comperator %u.\n",end);
+/** @brief number of acl rules that should be deleted to apply the last range changes */
+uint32_t fx_range_get_removed_rules_count(fx_range_table_t* range_table){
+	return range_table->released_offsets_count;
+}
 
-			range_table->range_entries_list[i].valid=true;
-			fx_range_update_action_bitvec(range_table);
-			//backup ll
-			fx_range_copy_ll(range_table->comperator_ll_start, &range_table->backup_comperator_ll_start);
-			return SX_STATUS_SUCCESS;
-		}
+/* @brief fills the offsets of the acl rules to delete, the offsets can be reused by the next compile */
+sx_status_t fx_range_compile_removed_rules(fx_range_table_t* range_table, sx_acl_rule_offset_t offsets_list[], uint32_t rule_cnt){
+	if (rule_cnt != range_table->released_offsets_count){
+		printf("Error in fx_range_compile_removed_rules, rules_list size mismatch, %d : %d\n",rule_cnt,range_table->released_offsets_count);
+		return SX_STATUS_NO_MEMORY;
+	}
+	for (uint32_t i=0; i<rule_cnt; i++){
+		offsets_list[i] = range_table->released_offsets[i];
+		range_table->free_offsets[range_table->free_offsets_count++] = range_table->released_offsets[i];
 	}
-	// no avaliable range entry.
-	printf("ERROR in fx_add_range_entry, no more range rules avaliable\n");
-	return SX_STATUS_NO_MEMORY; //no more avaliable entries (TODO currently limited to 12 entries)
+	range_table->released_offsets_count = 0;
+	return(SX_STATUS_SUCCESS);
 }
 
-sx_status_t fx_remove_range_entry(fx_range_table_t* range_table,sx_acl_rule_offset_t range_entry_handle){
-	printf("fx_remove_range_entry>> range entry handle %u.\n",range_entry_handle);
-	if(!range_table->range_entries_list[range_entry_handle].valid){
-		printf("Error: in fx_remove_range_entry, requested to remove invalid entry\n");
+sx_status_t fx_add_range_entry(fx_range_table_t* range_table,uint32_t start,uint32_t end, fx_range_action_id_t action_id,sx_acl_rule_offset_t* range_entry_handle){
+	if ((action_id >= BITVEC_LEN) || (start > end)){
+		printf("ERROR in fx_add_range_entry, invalid range [%u, %u) action %u\n", start, end, action_id);
 		return SX_STATUS_PARAM_ERROR;
 	}
-	uint32_t start = range_table->range_entries_list[range_entry_handle].start;
-	uint32_t end = range_table->range_entries_list[range_entry_handle].end;
-	sx_status_t rc;
-	if (start!=0){
-		rc = fx_range_remove_comperator(range_table,start);
-		if (rc) {
-			//revert comperators link list
-			printf("Error in: fx_remove_range_entry, using backup rules. range was not removed.\n");
-			fx_range_copy_ll(range_table->backup_comperator_ll_start, &range_table->comperator_ll_start);
-			return (rc);
-		}
+	// find avaliable range index
+	uint32_t i;
+	for (i=0; i<range_table->range_entries_size ; i++){
+		if (!range_table->range_entries_list[i].valid) break;
 	}
-	rc = fx_range_remove_comperator(range_table,end);
-	if (rc) {
-		//revert comperators link list
-		printf("Error in: fx_remove_range_entry, using backup rules. range was not removed.\n");
-		fx_range_copy_ll(range_table->backup_comperator_ll_start, &range_table->comperator_ll_start);
-		return (rc);
+	if (i == range_table->range_entries_size){
+		if (range_table->range_entries_size >= MAX_RANGE_ENTRIES){
+			printf("ERROR in fx_add_range_entry, no more range rules avaliable\n");
+			return SX_STATUS_NO_RESOURCES;
+		}
+		uint32_t size = range_table->range_entries_size * 2;
+		if (size > MAX_RANGE_ENTRIES) size = MAX_RANGE_ENTRIES;
+		fx_range_entry_t* entries = (fx_range_entry_t*) realloc(range_table->range_entries_list, size * sizeof(fx_range_entry_t));
+		if (entries == NULL){
+			return SX_STATUS_NO_MEMORY;
+		}
+		memset(&entries[range_table->range_entries_size], 0, (size - range_table->range_entries_size) * sizeof(fx_range_entry_t));
+		range_table->range_entries_list = entries;
+		range_table->range_entries_size = size;
 	}
-	printf("fx_remove_range_entry>> removed 2 comperators.\n");
-	range_table->range_entries_list[range_entry_handle].valid = 0;
-	fx_range_update_action_bitvec(range_table);
-			
-	//creates rule list and replaces the ASIC rules.
-	//rc = fx_range_insert_range_rules(range_table);
+	// reserve the split segments up front, so no change has to be reverted.
+	sx_status_t rc = fx_range_reserve_segments(range_table, 2);
+	if (rc) return rc;
+
+	*range_entry_handle = i;
+	range_table->range_entries_list[i].start = start;
+	range_table->range_entries_list[i].end = end;
+	range_table->range_entries_list[i].action_id = action_id;
+	fx_range_add_bound(range_table, start);
+	fx_range_add_bound(range_table, end);
+	fx_range_update_action_bitvec(range_table, start, end, action_id, true);
+	range_table->range_entries_list[i].valid = true;
+	return SX_STATUS_SUCCESS;
+}
 
-	//backup ll
-	fx_range_copy_ll(range_table->comperator_ll_start, &range_table->backup_comperator_ll_start);
+sx_status_t fx_remove_range_entry(fx_range_table_t* range_table,sx_acl_rule_offset_t range_entry_handle){
+	if((range_entry_handle >= range_table->range_entries_size) || !range_table->range_entries_list[range_entry_handle].valid){
+		printf("Error: in fx_remove_range_entry, requested to remove invalid entry %u\n", range_entry_handle);
+		return SX_STATUS_PARAM_ERROR;
+	}
+	fx_range_entry_t* entry = &range_table->range_entries_list[range_entry_handle];
+	fx_range_update_action_bitvec(range_table, entry->start, entry->end, entry->action_id, false);
+	fx_range_remove_bound(range_table, entry->end);
+	fx_range_remove_bound(range_table, entry->start);
+	entry->valid = false;
 	return SX_STATUS_SUCCESS;
 }
 
 
-/** @brief initialize needed structs for table with range match*/
-sx_status_t fx_range_init_table(fx_range_table_t** range_table){
-	(*range_table) = malloc(sizeof(fx_range_table_t));
+/** @brief initialize needed structs for table with range match, region_size is the size of the table acl region*/
+sx_status_t fx_range_init_table(fx_range_table_t** range_table, uint32_t region_size){
+	if (region_size > MAX_RANGE_ENTRIES + 1){
+		printf("ERROR: in fx_range_init_table region size %u exceeds the acl offset range\n", region_size);
+		return SX_STATUS_PARAM_ERROR;
+	}
+	(*range_table) = calloc(1, sizeof(fx_range_table_t));
 	if ((*range_table) == NULL){
 		printf("ERROR: in fx_range_init_table No memory to create key list\n");
 	return SX_STATUS_NO_MEMORY;
-	} 
-	// TODO - add comerator instead? create default rule with default action (12'd0)
-	(*range_table)->comperator_ll_start= fx_range_cfg_comperator(-1, 1, 0 , NULL);
-	(*range_table)->backup_comperator_ll_start=NULL;
-	for (uint8_t i=0; i<MAX_RANGE_ENTRIES ; i++)
-		(*range_table)->range_entries_list[i].valid = false;
+	}
+	// a single segment with default action (12'd0) covers all keys.
+	(*range_table)->segments = calloc(16, sizeof(fx_range_segment_t));
+	(*range_table)->range_entries_list = calloc(16, sizeof(fx_range_entry_t));
+	if (((*range_table)->segments == NULL) || ((*range_table)->range_entries_list == NULL)){
+		printf("ERROR: in fx_range_init_table No memory to create key list\n");
+		fx_range_deinit_table(*range_table);
+		*range_table = NULL;
+		return SX_STATUS_NO_MEMORY;
+	}
+	(*range_table)->segments_size = 16;
+	(*range_table)->segments_count = 1;
+	(*range_table)->range_entries_size = 16;
+	(*range_table)->region_size = region_size;
 	return (SX_STATUS_SUCCESS);
 }
 
 /** @brief deinitialize structs for table with range match*/
 sx_status_t fx_range_deinit_table(fx_range_table_t* range_table){
-	// TODO - add comerator instead? create default rule with default action (12'd0)
-	for (uint8_t i=0; i<MAX_RANGE_ENTRIES ; i++){
-		if (range_table->range_entries_list[i].valid ){
-			fx_remove_range_entry(range_table,i);
-		}
-	}
-
-	fx_range_delete_ll(&range_table->backup_comperator_ll_start);
-	fx_range_delete_ll(&range_table->comperator_ll_start);
+	free(range_table->free_offsets);
+	free(range_table->released_offsets);
+	free(range_table->range_entries_list);
+	free(range_table->segments);
 	free(range_table);
 	return (SX_STATUS_SUCCESS);
 }
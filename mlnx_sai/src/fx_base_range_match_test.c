@@ -0,0 +1,307 @@
+/*
+ * fx_base_range_match_test.c
+ *
+ * Unit test of the range match compiler. The compiled acl rules are applied to a software TCAM,
+ * keys are looked up in it and compared with the ranges that were added.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fx_base_range_match.h"
+
+#define ASSERT_TRUE(x, fmt, ...)                                \
+    if (!(x)) {                                                 \
+        fprintf(stderr,                                         \
+                "ASSERT TRUE FAILED(%s:%d): %s: " fmt "\n",     \
+                __func__, __LINE__, #x, ##__VA_ARGS__);         \
+        exit(1); }
+
+#define TEST_REGION_SIZE   4096
+#define TEST_MAX_RANGES    64
+#define TEST_KEY_SPACE     4096
+#define TEST_ITERATIONS    2000
+#define TEST_LOOKUPS       32
+
+typedef struct test_tcam_rule_t {
+    boolean_t valid;
+    uint32_t  key;
+    uint32_t  mask;
+    uint16_t  action_bitvec;
+} test_tcam_rule_t;
+
+typedef struct test_range_t {
+    boolean_t            valid;
+    uint32_t             start;
+    uint32_t             end;
+    fx_range_action_id_t action_id;
+} test_range_t;
+
+static test_tcam_rule_t tcam[TEST_REGION_SIZE];
+static test_range_t     ranges[TEST_MAX_RANGES];
+
+/* segments are disjoint, so a key hits at most one rule */
+static uint16_t tcam_lookup(uint32_t key)
+{
+    uint16_t action_bitvec = 0;
+    int      hits = 0;
+
+    for (uint32_t i = 0; i < TEST_REGION_SIZE; i++) {
+        if (tcam[i].valid && ((key & tcam[i].mask) == tcam[i].key)) {
+            action_bitvec = tcam[i].action_bitvec;
+            hits++;
+        }
+    }
+    ASSERT_TRUE(hits <= 1, "key %u hits %d rules", key, hits);
+
+    return action_bitvec;
+}
+
+static uint16_t ranges_lookup(uint32_t key)
+{
+    uint16_t action_bitvec = 0;
+
+    for (uint32_t i = 0; i < TEST_MAX_RANGES; i++) {
+        if (ranges[i].valid && (key >= ranges[i].start) && (key < ranges[i].end)) {
+            action_bitvec |= 1 << ranges[i].action_id;
+        }
+    }
+
+    return action_bitvec;
+}
+
+static uint32_t tcam_rules_count(void)
+{
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < TEST_REGION_SIZE; i++) {
+        count += tcam[i].valid;
+    }
+
+    return count;
+}
+
+/* the way the rules are written by the table code: rules to set first, then the released offsets are deleted */
+static void tcam_apply(fx_range_table_t* range_table)
+{
+    uint32_t              rule_cnt = fx_range_get_rules_list_count(range_table);
+    uint32_t              removed_cnt;
+    fx_key_t             *key_array = calloc(rule_cnt + 1, sizeof(fx_key_t));
+    uint32_t             *key_data = calloc(rule_cnt + 1, sizeof(uint32_t));
+    uint32_t             *mask_data = calloc(rule_cnt + 1, sizeof(uint32_t));
+    fx_param_t           *param_array = calloc(rule_cnt + 1, sizeof(fx_param_t));
+    fx_key_list_t        *keys = calloc(rule_cnt + 1, sizeof(fx_key_list_t));
+    fx_param_list_t      *action_params = calloc(rule_cnt + 1, sizeof(fx_param_list_t));
+    sx_acl_rule_offset_t *offsets = calloc(rule_cnt + 1, sizeof(sx_acl_rule_offset_t));
+
+    ASSERT_TRUE(key_array && key_data && mask_data && param_array && keys && action_params && offsets, "no memory");
+
+    for (uint32_t i = 0; i < rule_cnt; i++) {
+        key_array[i].key.data = (uint8_t*) &key_data[i];
+        key_array[i].mask.data = (uint8_t*) &mask_data[i];
+        keys[i].keys = &key_array[i];
+        keys[i].len = 1;
+        action_params[i].params = &param_array[i];
+        action_params[i].len = 1;
+    }
+
+    ASSERT_TRUE(fx_range_compile_rules(range_table, keys, action_params, offsets, rule_cnt) == SX_STATUS_SUCCESS, "");
+
+    for (uint32_t i = 0; i < rule_cnt; i++) {
+        ASSERT_TRUE(offsets[i] < TEST_REGION_SIZE, "offset %u", offsets[i]);
+        ASSERT_TRUE(param_array[i].len == 2, "");
+        tcam[offsets[i]].valid = true;
+        memcpy(&tcam[offsets[i]].key, key_array[i].key.data, sizeof(uint32_t));
+        memcpy(&tcam[offsets[i]].mask, key_array[i].mask.data, sizeof(uint32_t));
+        memcpy(&tcam[offsets[i]].action_bitvec, param_array[i].data, sizeof(uint16_t));
+        ASSERT_TRUE(tcam[offsets[i]].action_bitvec != 0, "rule of a segment with no range at %u", offsets[i]);
+    }
+
+    free(offsets);
+    removed_cnt = fx_range_get_removed_rules_count(range_table);
+    offsets = calloc(removed_cnt + 1, sizeof(sx_acl_rule_offset_t));
+    ASSERT_TRUE(offsets, "no memory");
+
+    ASSERT_TRUE(fx_range_compile_removed_rules(range_table, offsets, removed_cnt) == SX_STATUS_SUCCESS, "");
+    for (uint32_t i = 0; i < removed_cnt; i++) {
+        ASSERT_TRUE(tcam[offsets[i]].valid, "offset %u is not programmed", offsets[i]);
+        tcam[offsets[i]].valid = false;
+    }
+
+    free(offsets);
+    free(action_params);
+    free(keys);
+    free(param_array);
+    free(mask_data);
+    free(key_data);
+    free(key_array);
+}
+
+static void check_lookups(void)
+{
+    uint32_t key;
+
+    for (uint32_t i = 0; i < TEST_LOOKUPS; i++) {
+        if (i == 0) {
+            key = 0;
+        } else if (i == 1) {
+            key = 0xFFFFFFFF;
+        } else if (i < 4) {
+            key = (uint32_t) rand() * 2 + (rand() & 1);
+        } else {
+            key = rand() % (TEST_KEY_SPACE + 256);
+        }
+        ASSERT_TRUE(tcam_lookup(key) == ranges_lookup(key), "key %u", key);
+    }
+}
+
+static void test_range_match_random(unsigned int seed)
+{
+    fx_range_table_t    *range_table;
+    sx_acl_rule_offset_t handle;
+    uint32_t             start, end, i;
+    fx_range_action_id_t action_id;
+
+    srand(seed);
+    memset(tcam, 0, sizeof(tcam));
+    memset(ranges, 0, sizeof(ranges));
+
+    ASSERT_TRUE(fx_range_init_table(&range_table, TEST_REGION_SIZE) == SX_STATUS_SUCCESS, "");
+
+    for (uint32_t iter = 0; iter < TEST_ITERATIONS; iter++) {
+        i = rand() % TEST_MAX_RANGES;
+        if (!ranges[i].valid) {
+            start = rand() % TEST_KEY_SPACE;
+            end = start + rand() % 256;
+            if (rand() % 20 == 0) {
+                end = 0xFFFFFFFF;
+            }
+            action_id = rand() % BITVEC_LEN;
+            ASSERT_TRUE(fx_add_range_entry(range_table, start, end, action_id, &handle) == SX_STATUS_SUCCESS, "");
+            ASSERT_TRUE(handle < TEST_MAX_RANGES, "handle %u", handle);
+            ASSERT_TRUE(!ranges[handle].valid, "handle %u is in use", handle);
+            ranges[handle].valid = true;
+            ranges[handle].start = start;
+            ranges[handle].end = end;
+            ranges[handle].action_id = action_id;
+        } else {
+            ASSERT_TRUE(fx_remove_range_entry(range_table, i) == SX_STATUS_SUCCESS, "");
+            ranges[i].valid = false;
+        }
+
+        tcam_apply(range_table);
+        check_lookups();
+    }
+
+    for (i = 0; i < TEST_MAX_RANGES; i++) {
+        if (ranges[i].valid) {
+            ASSERT_TRUE(fx_remove_range_entry(range_table, i) == SX_STATUS_SUCCESS, "");
+            ranges[i].valid = false;
+        }
+    }
+    tcam_apply(range_table);
+
+    ASSERT_TRUE(range_table->segments_count == 1, "%u segments left", range_table->segments_count);
+    ASSERT_TRUE(tcam_rules_count() == 0, "%u rules left", tcam_rules_count());
+
+    fx_range_deinit_table(range_table);
+}
+
+/* a range change rewrites only the rules of the segments it touches */
+static void test_range_match_incremental(void)
+{
+    fx_range_table_t    *range_table;
+    sx_acl_rule_offset_t handle;
+
+    memset(tcam, 0, sizeof(tcam));
+
+    ASSERT_TRUE(fx_range_init_table(&range_table, TEST_REGION_SIZE) == SX_STATUS_SUCCESS, "");
+
+    for (uint32_t i = 0; i < 16; i++) {
+        ASSERT_TRUE(fx_add_range_entry(range_table, i * 100, i * 100 + 10, i % BITVEC_LEN, &handle) == 0, "");
+    }
+    tcam_apply(range_table);
+
+    /* [1000, 1010) is an aligned prefix pair: [1000, 1008) and [1008, 1010) */
+    ASSERT_TRUE(fx_add_range_entry(range_table, 1000, 1010, 0, &handle) == SX_STATUS_SUCCESS, "");
+    ASSERT_TRUE(fx_range_get_rules_list_count(range_table) == 2, "%u rules",
+                fx_range_get_rules_list_count(range_table));
+    tcam_apply(range_table);
+
+    ASSERT_TRUE(fx_remove_range_entry(range_table, handle) == SX_STATUS_SUCCESS, "");
+    ASSERT_TRUE(fx_range_get_rules_list_count(range_table) == 2, "%u rules",
+                fx_range_get_rules_list_count(range_table));
+    tcam_apply(range_table);
+    ASSERT_TRUE(tcam_lookup(1005) == 1 << (10 % BITVEC_LEN), "");
+
+    fx_range_deinit_table(range_table);
+}
+
+static void test_range_match_params(void)
+{
+    fx_range_table_t    *range_table;
+    sx_acl_rule_offset_t handle;
+
+    ASSERT_TRUE(fx_range_init_table(&range_table, MAX_RANGE_ENTRIES + 2) == SX_STATUS_PARAM_ERROR, "");
+    ASSERT_TRUE(fx_range_init_table(&range_table, TEST_REGION_SIZE) == SX_STATUS_SUCCESS, "");
+
+    ASSERT_TRUE(fx_add_range_entry(range_table, 5, 3, 0, &handle) == SX_STATUS_PARAM_ERROR, "");
+    ASSERT_TRUE(fx_add_range_entry(range_table, 1, 3, BITVEC_LEN, &handle) == SX_STATUS_PARAM_ERROR, "");
+    ASSERT_TRUE(fx_remove_range_entry(range_table, 0) == SX_STATUS_PARAM_ERROR, "");
+    ASSERT_TRUE(fx_range_get_rules_list_count(range_table) == 0, "");
+
+    fx_range_deinit_table(range_table);
+}
+
+/* rules that do not fit the region are not compiled */
+static void test_range_match_region_full(void)
+{
+    fx_range_table_t    *range_table;
+    sx_acl_rule_offset_t handle;
+    fx_key_t             key_array[64];
+    uint32_t             key_data[64], mask_data[64];
+    fx_param_t           param_array[64];
+    fx_key_list_t        keys[64];
+    fx_param_list_t      action_params[64];
+    sx_acl_rule_offset_t offsets[64];
+    uint32_t             rule_cnt;
+
+    for (uint32_t i = 0; i < 64; i++) {
+        key_array[i].key.data = (uint8_t*) &key_data[i];
+        key_array[i].mask.data = (uint8_t*) &mask_data[i];
+        keys[i].keys = &key_array[i];
+        action_params[i].params = &param_array[i];
+    }
+
+    ASSERT_TRUE(fx_range_init_table(&range_table, 8) == SX_STATUS_SUCCESS, "");
+
+    ASSERT_TRUE(fx_add_range_entry(range_table, 1, 2, 0, &handle) == SX_STATUS_SUCCESS, "");
+    rule_cnt = fx_range_get_rules_list_count(range_table);
+    ASSERT_TRUE(rule_cnt <= 8, "%u rules", rule_cnt);
+    ASSERT_TRUE(fx_range_compile_rules(range_table, keys, action_params, offsets, rule_cnt) == SX_STATUS_SUCCESS, "");
+
+    ASSERT_TRUE(fx_add_range_entry(range_table, 3, 0x7FFFFFFF, 1, &handle) == SX_STATUS_SUCCESS, "");
+    rule_cnt = fx_range_get_rules_list_count(range_table);
+    ASSERT_TRUE(rule_cnt > 8, "%u rules", rule_cnt);
+    ASSERT_TRUE(fx_range_compile_rules(range_table, keys, action_params, offsets, rule_cnt) == SX_STATUS_NO_RESOURCES,
+                "");
+
+    fx_range_deinit_table(range_table);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int seed = (argc > 1) ? (unsigned int) atoi(argv[1]) : 1;
+
+    test_range_match_params();
+    test_range_match_incremental();
+    test_range_match_region_full();
+    for (unsigned int i = 0; i < 4; i++) {
+        test_range_match_random(seed + i);
+    }
+
+    printf("fx_base_range_match_test: passed\n");
+
+    return 0;
+}
@@ -20,8 +20,9 @@
 #include "mlnx_sai.h"
 #include "assert.h"
 #ifndef _WIN32
-#include <mqueue.h>
 #include <sys/un.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
 #endif
 #include <errno.h>
 #include <sys/types.h>
@@ -53,17 +54,18 @@
 #define PSORT_ALMOST_FULL_PERC_DYN     90
 #define PSORT_ALMOST_EMPTY_PERC_DYN    33
 
-#define ACL_QUEUE_INVALID_HANDLE   ((mqd_t)-1)
-#define ACL_QUEUE_NAME             "/sai_acl_queue"
-#define ACL_QUEUE_TIMEOUT          2
-#define ACL_QUEUE_SIZE             3
-#define ACL_QUEUE_MSG_SIZE         sizeof(uint32_t)
-#define ACL_QUEUE_DEF_MSG_PRIO     0
-#define ACL_QUEUE_UNBLOCK_MSG_PRIO 31
+#define ACL_RULE_MOVE_PLAN_INIT_SIZE 64
+
+#define ACL_PSORT_OPT_QUIET_MIN_MS 50
+#define ACL_PSORT_OPT_QUIET_MAX_MS 2000
+#define ACL_PSORT_OPT_MAX_DELAY_MS 10000
 #define ACL_PSORT_OPT_MAX_TIME_MS  2000
-#define ACL_QUEUE_UNBLOCK_MSG      0xFFFFFFFF
+#define ACL_PSORT_OPT_WORKERS_NUM  3 /* including pSort background thread */
 #define ACL_MAX_FLEX_KEY_COUNT     (SAI_ACL_ENTRY_ATTR_FIELD_END - SAI_ACL_ENTRY_ATTR_FIELD_START + 1)
 
+#define ACL_COUNTER_SNAPSHOT_SIZE         (16 * 1024) /* power of 2, half of it is used at most */
+#define ACL_COUNTER_SNAPSHOT_IDLE_PERIODS 16          /* counter is dropped from the snapshot when not read */
+
 #define ACL_PBS_MAP_FLOOD_INDEX 64
 #define ACL_PBS_MAP_EMPTY_KEY   0
 
@@ -226,29 +228,54 @@ typedef struct _mlnx_acl_sai_multiple_key_field_info_t {
     sx_acl_key_t         *key_list;
     mlnx_acl_field_type_t field_type;
 } mlnx_acl_multi_key_field_info_t;
-typedef enum acl_rpc_type_t {
-    ACL_RPC_TERMINATE_THREAD,
-    ACL_RPC_TABLE_INIT,
-    ACL_RPC_TABLE_DELETE,
-    ACL_RPC_ENTRY_OFFSET_GET,
-    ACL_RPC_ENTRY_OFFSET_DEL
-} acl_rpc_type_t;
-PACKED(struct _acl_rpc_args_t {
-           bool table_is_dynamic;
-           uint32_t table_id;
-           uint32_t size;
-           uint32_t entry_id;
-           uint32_t entry_prio;
-           sx_acl_rule_offset_t entry_offset;
-       }, );
-typedef struct _acl_rpc_args_t acl_rpc_args_t;
-PACKED(struct _acl_rpc_info_t {
-           acl_rpc_type_t type;
-           acl_rpc_args_t args;
-           sai_status_t status;
-       }, );
-typedef struct _acl_rpc_info_t acl_rpc_info_t;
 typedef uint32_t               mlnx_acl_port_db_refs_t[MAX_PORTS_DB * 2];
+typedef struct _mlnx_acl_rule_move_t {
+    uint32_t             entry_index;
+    sx_acl_rule_offset_t old_offset;
+    sx_acl_rule_offset_t new_offset;
+} mlnx_acl_rule_move_t;
+/* pSort shifts collected during one insertion or one optimization pass of a table */
+typedef struct _mlnx_acl_rule_move_plan_t {
+    bool                  is_active;
+    mlnx_acl_rule_move_t *moves;
+    uint32_t              count;
+    uint32_t              size;
+} mlnx_acl_rule_move_plan_t;
+/* Last values of a polled ACL counter, see mlnx_acl_counter_read() */
+typedef struct _mlnx_acl_counter_snapshot_t {
+    bool                 is_used;
+    sx_flow_counter_id_t sx_counter_id;
+    uint64_t             packets;
+    uint64_t             bytes;
+    uint64_t             timestamp_us; /* last SDK read, 0 - not read yet */
+    uint64_t             polled_us;    /* last client read */
+} mlnx_acl_counter_snapshot_t;
+/* Tables taken from the optimization ring, shared by pSort background thread and the workers */
+typedef struct _mlnx_acl_psort_opt_batch_t {
+    uint32_t *tables;
+    uint64_t *queued_ms;
+    uint32_t  count;
+    uint32_t  next;
+    uint32_t  done;
+    uint64_t  generation;
+    bool      stop;
+} mlnx_acl_psort_opt_batch_t;
+typedef struct _mlnx_acl_entry_create_data_t {
+    uint32_t                table_index;
+    uint32_t                entry_index;
+    uint32_t                sx_prio;
+    sx_acl_rule_offset_t    offset;
+    sx_flex_acl_flex_rule_t rule;
+    sx_flow_counter_id_t    sx_counter_id;
+    bool                    counter_byte_flag;
+    bool                    counter_packet_flag;
+    mlnx_acl_pbs_info_t     pbs_info;
+    sx_mc_container_id_t    sx_mc_container_rx;
+    sx_mc_container_id_t    sx_mc_container_tx;
+    sx_mc_container_id_t    sx_mc_container_egress_block;
+    bool                    is_offset_allocated;
+    bool                    is_sx_rule_set;
+} mlnx_acl_entry_create_data_t;
 
 static const acl_bind_point_type_list_t default_bind_point_type_list =
 {.count = 3,
@@ -258,14 +285,35 @@ static const acl_bind_point_type_list_t default_bind_point_type_list =
 };
 static sx_verbosity_level_t LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNING;
 static cl_thread_t psort_thread;
+static cl_thread_t psort_opt_workers[ACL_PSORT_OPT_WORKERS_NUM - 1];
 static cl_thread_t rpc_thread;
+static cl_thread_t rpc_shm_thread;
 #ifndef _WIN32
 static pthread_key_t      pthread_sx_handle_key;
-static mqd_t              psort_opt_queue_client = ACL_QUEUE_INVALID_HANDLE;
 static struct sockaddr_un rpc_sv_sockaddr;
+static pthread_mutex_t    psort_opt_batch_lock      = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t     psort_opt_batch_work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t     psort_opt_batch_done_cond = PTHREAD_COND_INITIALIZER;
 #endif
+static mlnx_acl_psort_opt_batch_t psort_opt_batch;
 static int  rpc_cl_socket   = -1;
 static bool is_init_process = false;
+static mlnx_acl_rule_move_plan_t  *acl_rule_move_plans = NULL;
+static mlnx_acl_psort_move_stats_t acl_psort_move_stats;
+static mlnx_acl_counter_snapshot_t *acl_counter_snapshots = NULL;
+static uint32_t                     acl_counter_snapshot_count;
+static uint64_t                     acl_counter_snapshot_period_ms;
+static volatile bool                acl_counter_snapshot_stop;
+static bool                         acl_counter_snapshot_started;
+static mlnx_acl_counter_stats_t     acl_counter_stats;
+static cl_thread_t                  acl_counter_snapshot_thread;
+#ifndef _WIN32
+static pthread_mutex_t acl_counter_snapshot_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  acl_counter_snapshot_cond;
+#endif
+#ifndef _WIN32
+static pthread_mutex_t acl_psort_move_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
 #define MLNX_ACL_ACTION_LIST_COMMON_DEF    \
     SAI_ACL_ACTION_TYPE_PACKET_ACTION,     \
     SAI_ACL_ACTION_TYPE_COUNTER,           \
@@ -760,6 +808,12 @@ static sai_status_t mlnx_acl_flex_rule_delete(_In_ uint32_t                 acl_
                                               _In_ sx_acl_rule_offset_t     sx_acl_rule_offset);
 static sai_status_t mlnx_acl_sx_rule_mc_containers_remove(_In_ sx_flex_acl_flex_rule_t *sx_rule);
 static sai_status_t mlnx_delete_acl_entry_data(_In_ uint32_t table_index, _In_ uint32_t entry_index);
+static sai_status_t mlnx_delete_acl_entry_data_start(_In_ uint32_t                  table_index,
+                                                     _In_ uint32_t                  entry_index,
+                                                     _Out_ sx_flex_acl_flex_rule_t *sx_flex_rule);
+static sai_status_t mlnx_delete_acl_entry_data_finish(_In_ uint32_t                 table_index,
+                                                      _In_ uint32_t                 entry_index,
+                                                      _In_ sx_flex_acl_flex_rule_t *sx_flex_rule);
 static sx_utils_status_t psort_notification_func(_In_ psort_notification_type_e notif_type,
                                                  _In_ void                     *data,
                                                  _In_ void                     *cookie);
@@ -767,19 +821,34 @@ static sai_status_t create_rpc_server(_Inout_ int *s);
 static sai_status_t create_rpc_client(_Inout_ int *s, _Inout_ struct sockaddr_un *sv_sockaddr);
 static sai_status_t create_rpc_socket(_Inout_ int *s, _Inout_opt_ struct sockaddr_un *sockaddr, _In_ bool is_server);
 static sai_status_t mlnx_acl_rpc_call(_Inout_ acl_rpc_info_t *rpc_info);
+static sai_status_t mlnx_acl_rpc_socket_call(_Inout_ acl_rpc_info_t *rpc_info);
+static bool mlnx_acl_rpc_shm_is_ready(void);
+static acl_rpc_shm_slot_t* mlnx_acl_rpc_shm_slot_claim(_In_ bool wait);
+static void mlnx_acl_rpc_shm_slot_release(_Inout_ acl_rpc_shm_slot_t *slot);
+static sai_status_t mlnx_acl_rpc_shm_slot_call(_Inout_ acl_rpc_shm_slot_t *slot);
+static void mlnx_acl_rpc_stats_update(_In_ bool is_shm, _In_ uint64_t start_us);
+static void mlnx_acl_counter_snapshot_init(void);
+static void mlnx_acl_counter_snapshot_close(void);
+#ifndef _WIN32
+static void mlnx_acl_futex_wake(_In_ uint32_t *addr, _In_ int count);
+#endif
 static sai_status_t mlnx_acl_lazy_init(void);
 static sai_status_t acl_psort_background_close(void);
 static sai_status_t mlnx_acl_rpc_thread_close(void);
 static sai_status_t mlnx_acl_rpc_client_close(void);
-static sai_status_t mlnx_acl_psort_opt_queue_create(void);
-static sai_status_t mlnx_acl_psort_opt_queue_client_create(void);
-static sai_status_t mlnx_acl_psort_opt_queue_client_close(void);
 static sai_status_t mlnx_acl_psort_thread_wake(void);
+static void mlnx_acl_psort_opt_workers_close(void);
 static void mlnx_acl_table_locks_deinit(void);
 static void psort_background_thread(void *arg);
+static void psort_opt_worker_thread(void *arg);
 static void mlnx_acl_rpc_thread(void *arg);
+static void mlnx_acl_rpc_shm_thread(void *arg);
 static sai_status_t mlnx_acl_sx_rule_offset_update(_In_ const psort_shift_param_t *shift_param,
                                                    _In_ uint32_t                   acl_table_index);
+static void mlnx_acl_rule_move_plan_begin(_In_ uint32_t acl_table_index);
+static bool mlnx_acl_rule_move_plan_is_active(_In_ uint32_t acl_table_index);
+static sai_status_t mlnx_acl_rule_move_plan_commit(_In_ uint32_t acl_table_index);
+static void mlnx_acl_rule_move_plans_free(void);
 static sai_status_t mlnx_acl_table_init(_In_ uint32_t table_db_idx, _In_ bool is_table_dynamic, _In_ uint32_t size);
 static sai_status_t mlnx_acl_table_deinit(_In_ uint32_t table_db_idx);
 static sai_status_t mlnx_acl_entry_offset_get(_In_ uint32_t                 table_db_idx,
@@ -817,6 +886,8 @@ static sai_status_t mlnx_acl_counter_oid_create(_In_ sx_flow_counter_id_t sx_cou
                                                 _Out_ sai_object_id_t    *counter_oid);
 static sai_status_t mlnx_acl_counter_oid_to_sx(_In_ sai_object_id_t        counter_oid,
                                                _Out_ sx_flow_counter_id_t *sx_counter_id);
+static sai_status_t mlnx_acl_counter_resolve(_In_ sai_object_id_t        counter_oid,
+                                             _Out_ sx_flow_counter_id_t *sx_counter_id);
 static sai_status_t mlnx_acl_counter_oid_data_get(_In_ sai_object_id_t        counter_oid,
                                                   _Out_ sx_flow_counter_id_t *sx_counter_id,
                                                   _Out_ bool                 *byte_counter_flag,
@@ -2296,6 +2367,8 @@ sai_status_t mlnx_acl_deinit(void)
 
     SX_LOG_ENTER();
 
+    mlnx_acl_counter_snapshot_close();
+
     status = mlnx_acl_rpc_thread_close();
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to close ACL RPC thread\n");
@@ -2332,16 +2405,22 @@ sai_status_t mlnx_acl_deinit(void)
     return status;
 }
 
+sai_status_t mlnx_acl_connect(void)
+{
+    SX_LOG_DBG("Initializing ACL on switch connect\n");
+
+    mlnx_acl_counter_snapshot_init();
+
+    return SAI_STATUS_SUCCESS;
+}
+
 sai_status_t mlnx_acl_disconnect(void)
 {
     sai_status_t status;
 
     SX_LOG_DBG("Deinitializing ACL on swictch disconnect\n");
 
-    status = mlnx_acl_psort_opt_queue_client_close();
-    if (SAI_ERR(status)) {
-        return status;
-    }
+    mlnx_acl_counter_snapshot_close();
 
     status = mlnx_acl_rpc_client_close();
     if (SAI_ERR(status)) {
@@ -2370,8 +2449,8 @@ static sai_status_t mlnx_acl_lazy_init(void)
     /* Wake up RPC thread */
     acl_cond_mutex_lock();
     sai_acl_db->acl_settings_tbl->rpc_thread_start_flag = true;
-    if (0 != pthread_cond_signal(&sai_acl_db->acl_settings_tbl->rpc_thread_init_cond)) {
-        SX_LOG_ERR("Failed to signal condition variable to wake up ACL RPC thread\n");
+    if (0 != pthread_cond_broadcast(&sai_acl_db->acl_settings_tbl->rpc_thread_init_cond)) {
+        SX_LOG_ERR("Failed to signal condition variable to wake up ACL RPC threads\n");
         acl_cond_mutex_unlock();
         return SAI_STATUS_FAILURE;
     }
@@ -2385,26 +2464,14 @@ static sai_status_t mlnx_acl_lazy_init(void)
 
 static sai_status_t mlnx_acl_psort_thread_unblock(void)
 {
-    sai_status_t   status;
-    const uint32_t unblock_msg = ACL_QUEUE_UNBLOCK_MSG;
-
-    status = mlnx_acl_psort_opt_queue_client_create();
-    if (SAI_ERR(status)) {
-        return status;
-    }
-
 #ifndef _WIN32
-    if (-1 ==
-        mq_send(psort_opt_queue_client, (const char*)&unblock_msg, sizeof(unblock_msg), ACL_QUEUE_UNBLOCK_MSG_PRIO)) {
-        if (EAGAIN == errno) {
-            /* Not an issue. If queue is full it's going to get unblocked anyway */
-            SX_LOG_NTC("Failed to send unblock message to pSort queue - queue is full\n");
-            return SAI_STATUS_SUCCESS;
-        }
-
-        SX_LOG_ERR("Failed to send unblock msg to pSort queue - %s\n", strerror(errno));
+    acl_cond_mutex_lock();
+    if (0 != pthread_cond_broadcast(&sai_acl_db->acl_settings_tbl->psort_thread_work_cond)) {
+        SX_LOG_ERR("Failed to signal condition var to unblock ACL psort thread\n");
+        acl_cond_mutex_unlock();
         return SAI_STATUS_FAILURE;
     }
+    acl_cond_mutex_unlock();
 #endif /* _WIN32 */
 
     return SAI_STATUS_SUCCESS;
@@ -2443,10 +2510,17 @@ static sai_status_t acl_psort_background_close(void)
 
     cl_thread_destroy(&psort_thread);
 
+    mlnx_acl_psort_opt_workers_close();
+
     if (0 != pthread_cond_destroy(&sai_acl_db->acl_settings_tbl->psort_thread_init_cond)) {
         SX_LOG_ERR("Failed to destroy cond variable\n");
         return SAI_STATUS_FAILURE;
     }
+
+    if (0 != pthread_cond_destroy(&sai_acl_db->acl_settings_tbl->psort_thread_work_cond)) {
+        SX_LOG_ERR("Failed to destroy cond variable\n");
+        return SAI_STATUS_FAILURE;
+    }
 #endif
 
     return SAI_STATUS_SUCCESS;
@@ -2463,17 +2537,23 @@ static sai_status_t mlnx_acl_rpc_thread_close(void)
         sai_acl_db->acl_settings_tbl->rpc_thread_stop_flag = true;
         acl_cond_mutex_lock();
         sai_acl_db->acl_settings_tbl->rpc_thread_start_flag = true;
-        if (0 != pthread_cond_signal(&sai_acl_db->acl_settings_tbl->rpc_thread_init_cond)) {
-            SX_LOG_ERR("Failed to signal condition var to wake up RPC thread\n");
+        if (0 != pthread_cond_broadcast(&sai_acl_db->acl_settings_tbl->rpc_thread_init_cond)) {
+            SX_LOG_ERR("Failed to signal condition var to wake up RPC threads\n");
             status = SAI_STATUS_FAILURE;
         }
         acl_cond_mutex_unlock();
     } else {
         rpc_info.type = ACL_RPC_TERMINATE_THREAD;
-        status        = mlnx_acl_rpc_call(&rpc_info);
+        status        = mlnx_acl_rpc_socket_call(&rpc_info);
+
+        sai_acl_db->acl_settings_tbl->rpc_thread_stop_flag = true;
+        __atomic_store_n(&sai_acl_db->acl_settings_tbl->rpc_shm.is_ready, false, __ATOMIC_RELEASE);
+        __atomic_fetch_add(&sai_acl_db->acl_settings_tbl->rpc_shm.requests, 1, __ATOMIC_SEQ_CST);
+        mlnx_acl_futex_wake(&sai_acl_db->acl_settings_tbl->rpc_shm.requests, 1);
     }
 
     cl_thread_destroy(&rpc_thread);
+    cl_thread_destroy(&rpc_shm_thread);
 
     if (0 != pthread_cond_destroy(&sai_acl_db->acl_settings_tbl->rpc_thread_init_cond)) {
         SX_LOG_ERR("Failed to destroy cond variable\n");
@@ -8842,29 +8922,78 @@ static sai_status_t mlnx_acl_range_attr_get(_In_ const sai_object_key_t   *key,
     return status;
 }
 
+static void mlnx_acl_entry_create_data_init(_Out_ mlnx_acl_entry_create_data_t *entry_data)
+{
+    memset(entry_data, 0, sizeof(*entry_data));
+
+    entry_data->table_index                  = ACL_INVALID_DB_INDEX;
+    entry_data->entry_index                  = ACL_INVALID_DB_INDEX;
+    entry_data->rule                         = MLNX_ACL_SX_FLEX_RULE_EMPTY;
+    entry_data->sx_counter_id                = SX_FLOW_COUNTER_ID_INVALID;
+    entry_data->pbs_info                     = MLNX_ACL_PBS_INFO_INVALID;
+    entry_data->sx_mc_container_rx           = SX_MC_CONTAINER_ID_INVALID;
+    entry_data->sx_mc_container_tx           = SX_MC_CONTAINER_ID_INVALID;
+    entry_data->sx_mc_container_egress_block = SX_MC_CONTAINER_ID_INVALID;
+}
+
+static sai_status_t mlnx_acl_entry_create_attrs_check(_In_ uint32_t               attr_count,
+                                                      _In_ const sai_attribute_t *attr_list,
+                                                      _Out_ uint32_t             *acl_table_index,
+                                                      _Out_ uint32_t             *sx_rule_prio)
+{
+    sai_status_t                 status;
+    const sai_attribute_value_t *table_id, *priority;
+    uint32_t                     table_id_index, priority_index;
+    char                         list_str[MAX_LIST_VALUE_STR_LEN];
+
+    if (SAI_STATUS_SUCCESS !=
+        (status =
+             check_attribs_metadata(attr_count, attr_list, SAI_OBJECT_TYPE_ACL_ENTRY, acl_entry_vendor_attribs,
+                                    SAI_COMMON_API_CREATE))) {
+        SX_LOG_ERR("Failed attribs check\n");
+        return status;
+    }
+    sai_attr_list_to_str(attr_count, attr_list, SAI_OBJECT_TYPE_ACL_ENTRY, MAX_LIST_VALUE_STR_LEN, list_str);
+    SX_LOG_NTC("Create ACL Entry, %s\n", list_str);
+
+    status = find_attrib_in_list(attr_count, attr_list, SAI_ACL_ENTRY_ATTR_TABLE_ID, &table_id, &table_id_index);
+    assert(SAI_STATUS_SUCCESS == status);
+
+    status = extract_acl_table_index(table_id->oid, acl_table_index);
+    if (SAI_STATUS_SUCCESS != status) {
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS ==
+        find_attrib_in_list(attr_count, attr_list, SAI_ACL_ENTRY_ATTR_PRIORITY, &priority, &priority_index)) {
+        if (!ACL_SAI_ENTRY_PRIO_CHECK_RANGE(priority->u32)) {
+            SX_LOG_ERR("Priority %u is out of range (%u,%u)\n",
+                       priority->u32,
+                       ACL_SAI_ENTRY_MIN_PRIO,
+                       ACL_SAI_ENTRY_MAX_PRIO);
+            return SAI_STATUS_INVALID_ATTR_VALUE_0 + priority_index;
+        }
+
+        *sx_rule_prio = ACL_SAI_ENTRY_PRIO_TO_SX(priority->u32);
+    } else {
+        *sx_rule_prio = ACL_SAI_ENTRY_PRIO_TO_SX(ACL_DEFAULT_ENTRY_PRIO);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /*
- * Routine Description:
- *   Create an ACL Entry
- *
- * Arguments:
- *  [out] acl_entry_id -  acl entry/rule id
- *  [in] attr_count - number of attributes
- *  [in] attr_list - array of attributes
- *
- * Return Values:
- *    SAI_STATUS_SUCCESS on success
- *    Failure status code on error
+ * Translates the entry attributes to sx flex rule.
+ * On success, entry_data owns the rule, mc containers and pbs info.
+ * Table lock is needed.
  */
-
-sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
-                                   _In_ sai_object_id_t        switch_id,
-                                   _In_ uint32_t               attr_count,
-                                   _In_ const sai_attribute_t *attr_list)
+static sai_status_t mlnx_acl_entry_create_prepare(_In_ uint32_t                         attr_count,
+                                                  _In_ const sai_attribute_t           *attr_list,
+                                                  _Inout_ mlnx_acl_entry_create_data_t *entry_data)
 {
     sai_status_t                 status;
     sx_flex_acl_flex_rule_t      flex_acl_rule = MLNX_ACL_SX_FLEX_RULE_EMPTY;
     sx_acl_pbs_id_t              pbs_id        = 0;
-    sx_acl_rule_offset_t         sx_acl_rule_offset;
     sx_ip_addr_t                 ipaddr_data, ipaddr_mask;
     sx_flex_acl_key_desc_t      *sx_key_descs                 = NULL;
     sx_mc_container_id_t         sx_mc_container_rx           = SX_MC_CONTAINER_ID_INVALID;
@@ -8875,7 +9004,7 @@ sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
     sai_ip_address_t             ip_address_data, ip_address_mask;
     sai_packet_action_t          packet_action_type;
     sai_object_id_t              counter_oid = SAI_NULL_OBJECT_ID;
-    const sai_attribute_value_t *table_id, *priority;
+    const sai_attribute_value_t *table_id;
     const sai_attribute_value_t *in_port, *in_ports, *out_port, *out_ports, *ip_ident;
     const sai_attribute_value_t *packet_action, *action_counter;
     const sai_attribute_value_t *action_set_src_mac, *action_set_dst_mac;
@@ -8890,8 +9019,7 @@ sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
     const sai_attribute_value_t *admin_state;
     const sai_attribute_value_t *tunnel_endpoint = NULL;
     mlnx_acl_pbs_info_t          pbs_info        = MLNX_ACL_PBS_INFO_INVALID;
-    mlnx_acl_port_db_refs_t      ports_refs;
-    uint32_t                     table_id_index, priority_index;
+    uint32_t                     table_id_index;
     uint32_t                     in_port_index, admin_state_index, in_ports_index, ip_ident_index;
     uint32_t                     out_port_index, out_ports_index;
     uint32_t                     action_set_src_mac_index, action_set_dst_mac_index;
@@ -8907,21 +9035,17 @@ sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
     uint32_t action_set_outer_vlan_id_index, action_set_outer_vlan_pri_index;
     uint32_t action_flood_index, action_egress_block_index;
     uint32_t in_port_data, out_port_data, action_set_policer_data;
-    uint32_t acl_table_index, acl_entry_index = ACL_INVALID_DB_INDEX, counter_table_idx;
+    uint32_t acl_table_index, counter_table_idx;
     uint32_t key_desc_index = 0, flex_action_index = 0;
     uint16_t trap_id        = SX_TRAP_ID_ACL_MIN;
-    char     list_str[MAX_LIST_VALUE_STR_LEN];
-    char     key_str[MAX_KEY_STR_LEN];
     bool     is_redirect_action_present = false;
     bool     is_in_port_key_present     = false;
     bool     is_out_port_key_present    = false;
-    uint32_t table_size, created_entry_count, max_flex_keys;
-    bool     is_table_dynamic_sized, is_ip_idnet_used;
-    uint32_t sx_rule_prio;
-    bool     is_offset_allocated = false, is_sx_rule_set = false;
-    bool     counter_byte_flag   = false, counter_packet_flag = false;
+    uint32_t max_flex_keys;
+    bool     is_ip_idnet_used;
+    bool     counter_byte_flag = false, counter_packet_flag = false;
 
-    SX_LOG_ENTER();
+    assert(entry_data);
 
     memset(&flex_acl_rule, 0, sizeof(flex_acl_rule));
     memset(&ipaddr_data, 0, sizeof(ipaddr_data));
@@ -8930,46 +9054,12 @@ sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
     memset(&ip_address_mask, 0, sizeof(ip_address_mask));
     memset(&sx_key_descs, 0, sizeof(sx_key_descs));
 
-    if (NULL == acl_entry_id) {
-        SX_LOG_ERR("NULL acl entry id param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             check_attribs_metadata(attr_count, attr_list, SAI_OBJECT_TYPE_ACL_ENTRY, acl_entry_vendor_attribs,
-                                    SAI_COMMON_API_CREATE))) {
-        SX_LOG_ERR("Failed attribs check\n");
-        return status;
-    }
-    sai_attr_list_to_str(attr_count, attr_list, SAI_OBJECT_TYPE_ACL_ENTRY, MAX_LIST_VALUE_STR_LEN, list_str);
-    SX_LOG_NTC("Create ACL Entry, %s\n", list_str);
-
     status = find_attrib_in_list(attr_count, attr_list, SAI_ACL_ENTRY_ATTR_TABLE_ID, &table_id, &table_id_index);
     assert(SAI_STATUS_SUCCESS == status);
 
-    status = extract_acl_table_index(table_id->oid, &acl_table_index);
-    if (SAI_STATUS_SUCCESS != status) {
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    sai_db_read_lock();
-    acl_table_write_lock(acl_table_index);
-    acl_global_lock();
-
-    stage                  = acl_db_table(acl_table_index).stage;
-    table_size             = ACL_SX_REG_SIZE_TO_TABLE_SIZE(acl_db_table(acl_table_index).region_size);
-    created_entry_count    = acl_db_table(acl_table_index).created_entry_count;
-    is_table_dynamic_sized = acl_db_table(acl_table_index).is_dynamic_sized;
-    is_ip_idnet_used       = acl_db_table(acl_table_index).is_ip_ident_used;
-
-    if ((created_entry_count == table_size) &&
-        (false == is_table_dynamic_sized)) {
-        SX_LOG_ERR("Table is full\n");
-        status = SAI_STATUS_TABLE_FULL;
-        goto out;
-    }
+    acl_table_index  = entry_data->table_index;
+    stage            = acl_db_table(acl_table_index).stage;
+    is_ip_idnet_used = acl_db_table(acl_table_index).is_ip_ident_used;
 
     sx_key_descs = calloc(ACL_MAX_FLEX_KEY_COUNT, sizeof(*sx_key_descs));
     if (NULL == sx_key_descs) {
@@ -8986,23 +9076,6 @@ sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
         goto out;
     }
 
-    if (SAI_STATUS_SUCCESS ==
-        (status =
-             find_attrib_in_list(attr_count, attr_list, SAI_ACL_ENTRY_ATTR_PRIORITY, &priority, &priority_index))) {
-        if (!ACL_SAI_ENTRY_PRIO_CHECK_RANGE(priority->u32)) {
-            SX_LOG_ERR("Priority %u is out of range (%u,%u)\n",
-                       priority->u32,
-                       ACL_SAI_ENTRY_MIN_PRIO,
-                       ACL_SAI_ENTRY_MAX_PRIO);
-            status = SAI_STATUS_INVALID_ATTR_VALUE_0 + priority_index;
-            goto out;
-        }
-
-        sx_rule_prio = ACL_SAI_ENTRY_PRIO_TO_SX(priority->u32);
-    } else {
-        sx_rule_prio = ACL_SAI_ENTRY_PRIO_TO_SX(ACL_DEFAULT_ENTRY_PRIO);
-    }
-
     if (SAI_STATUS_SUCCESS ==
         (status =
              find_attrib_in_list(attr_count, attr_list, SAI_ACL_ENTRY_ATTR_ADMIN_STATE, &admin_state,
@@ -9548,111 +9621,155 @@ sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
     flex_acl_rule.key_desc_count = key_desc_index;
     flex_acl_rule.action_count   = flex_action_index;
 
-    status = acl_db_find_entry_free_index(&acl_entry_index);
+    status = SAI_STATUS_SUCCESS;
+
+    entry_data->rule                         = flex_acl_rule;
+    entry_data->sx_counter_id                = sx_counter_id;
+    entry_data->counter_byte_flag            = counter_byte_flag;
+    entry_data->counter_packet_flag          = counter_packet_flag;
+    entry_data->pbs_info                     = pbs_info;
+    entry_data->sx_mc_container_rx           = sx_mc_container_rx;
+    entry_data->sx_mc_container_tx           = sx_mc_container_tx;
+    entry_data->sx_mc_container_egress_block = sx_mc_container_egress_block;
+
+out:
     if (SAI_ERR(status)) {
-        goto out;
+        mlnx_acl_sx_mc_container_remove(sx_mc_container_rx);
+        mlnx_acl_sx_mc_container_remove(sx_mc_container_tx);
+        mlnx_acl_sx_mc_container_remove(sx_mc_container_egress_block);
+
+        mlnx_acl_pbs_info_delete(pbs_info);
+
+        mlnx_acl_flex_rule_free(&flex_acl_rule);
     }
 
-    status = mlnx_acl_entry_offset_get(acl_table_index, acl_entry_index, sx_rule_prio, &sx_acl_rule_offset);
-    if (SAI_ERR(status)) {
-        SX_LOG_ERR("Failed to get offset for entry\n");
-        goto out;
+    free(sx_key_descs);
+
+    return status;
+}
+
+/*
+ * Allocates an ACL DB entry and a rule offset for the prepared entry and fills the entry DB.
+ * Table lock is needed.
+ */
+static sai_status_t mlnx_acl_entry_create_offset_reserve(_Inout_ mlnx_acl_entry_create_data_t *entry_data)
+{
+    sai_status_t status;
+    uint32_t     acl_table_index, table_size, created_entry_count;
+    bool         is_table_dynamic_sized;
+
+    assert(entry_data);
+
+    acl_table_index        = entry_data->table_index;
+    table_size             = ACL_SX_REG_SIZE_TO_TABLE_SIZE(acl_db_table(acl_table_index).region_size);
+    created_entry_count    = acl_db_table(acl_table_index).created_entry_count;
+    is_table_dynamic_sized = acl_db_table(acl_table_index).is_dynamic_sized;
+
+    if ((created_entry_count >= table_size) &&
+        (false == is_table_dynamic_sized)) {
+        SX_LOG_ERR("Table is full\n");
+        return SAI_STATUS_TABLE_FULL;
     }
 
-    is_offset_allocated = true;
+    status = acl_db_find_entry_free_index(&entry_data->entry_index);
+    if (SAI_ERR(status)) {
+        return status;
+    }
 
-    status = mlnx_acl_sx_rule_prio_set(&flex_acl_rule, sx_rule_prio);
+    status = mlnx_acl_entry_offset_get(entry_data->table_index, entry_data->entry_index, entry_data->sx_prio,
+                                       &entry_data->offset);
     if (SAI_ERR(status)) {
-        goto out;
+        SX_LOG_ERR("Failed to get offset for entry\n");
+        return status;
     }
 
-    acl_db_entry(acl_entry_index).sx_prio             = sx_rule_prio;
-    acl_db_entry(acl_entry_index).offset              = sx_acl_rule_offset;
-    acl_db_entry(acl_entry_index).sx_counter_id       = sx_counter_id;
-    acl_db_entry(acl_entry_index).counter_byte_flag   = counter_byte_flag;
-    acl_db_entry(acl_entry_index).counter_packet_flag = counter_packet_flag;
-    acl_db_entry(acl_entry_index).next_entry_index    = ACL_INVALID_DB_INDEX;
-    acl_db_entry(acl_entry_index).prev_entry_index    = ACL_INVALID_DB_INDEX;
-    acl_db_entry(acl_entry_index).pbs_info            = pbs_info;
+    entry_data->is_offset_allocated = true;
 
-    status = mlnx_acl_entry_sx_acl_rule_set(acl_table_index, acl_entry_index, &flex_acl_rule);
+    status = mlnx_acl_sx_rule_prio_set(&entry_data->rule, entry_data->sx_prio);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    is_sx_rule_set = true;
+    acl_db_entry(entry_data->entry_index).sx_prio             = entry_data->sx_prio;
+    acl_db_entry(entry_data->entry_index).offset              = entry_data->offset;
+    acl_db_entry(entry_data->entry_index).sx_counter_id       = entry_data->sx_counter_id;
+    acl_db_entry(entry_data->entry_index).counter_byte_flag   = entry_data->counter_byte_flag;
+    acl_db_entry(entry_data->entry_index).counter_packet_flag = entry_data->counter_packet_flag;
+    acl_db_entry(entry_data->entry_index).next_entry_index    = ACL_INVALID_DB_INDEX;
+    acl_db_entry(entry_data->entry_index).prev_entry_index    = ACL_INVALID_DB_INDEX;
+    acl_db_entry(entry_data->entry_index).pbs_info            = entry_data->pbs_info;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Port references and table's entry list for the entry which rule is already in SDK */
+static sai_status_t mlnx_acl_entry_create_finish(_In_ const mlnx_acl_entry_create_data_t *entry_data)
+{
+    sai_status_t            status;
+    mlnx_acl_port_db_refs_t ports_refs;
+
+    assert(entry_data);
 
-    status = mlnx_acl_entry_sx_rule_port_refs_get(&flex_acl_rule, ports_refs);
+    status = mlnx_acl_entry_sx_rule_port_refs_get(&entry_data->rule, ports_refs);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     status = mlnx_acl_entry_port_refs_set(ports_refs);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    status = mlnx_acl_pbs_info_port_refs_get(pbs_info, ports_refs);
+    status = mlnx_acl_pbs_info_port_refs_get(entry_data->pbs_info, ports_refs);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     status = mlnx_acl_entry_port_refs_set(ports_refs);
     if (SAI_ERR(status)) {
-        goto out;
-    }
-
-    status = mlnx_acl_db_entry_add_to_table(acl_table_index, acl_entry_index);
-    if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    acl_create_entry_object_id(acl_entry_id, acl_entry_index, acl_table_index);
-
-    acl_entry_key_to_str(*acl_entry_id, key_str);
-    SX_LOG_NTC("Created acl entry %s\n\n", key_str);
-
-out:
-    if (SAI_STATUS_SUCCESS != status) {
-        SX_LOG_ERR(" Failed to create Entry \n");
-
-        if (ACL_INVALID_DB_INDEX != acl_entry_index) {
-            mlnx_acl_db_entry_delete(acl_entry_index);
-        }
-
-        if (is_offset_allocated) {
-            mlnx_acl_entry_offset_del(acl_table_index, sx_rule_prio, sx_acl_rule_offset);
-        }
+    return mlnx_acl_db_entry_add_to_table(entry_data->table_index, entry_data->entry_index);
+}
 
-        if (is_sx_rule_set) {
-            mlnx_acl_flex_rule_delete(acl_table_index, &flex_acl_rule, sx_acl_rule_offset);
-        }
+static void mlnx_acl_entry_create_rollback(_Inout_ mlnx_acl_entry_create_data_t *entry_data)
+{
+    assert(entry_data);
 
-        mlnx_acl_sx_mc_container_remove(sx_mc_container_rx);
-        mlnx_acl_sx_mc_container_remove(sx_mc_container_tx);
-        mlnx_acl_sx_mc_container_remove(sx_mc_container_egress_block);
+    if (ACL_INVALID_DB_INDEX != entry_data->entry_index) {
+        mlnx_acl_db_entry_delete(entry_data->entry_index);
+    }
 
-        mlnx_acl_pbs_info_delete(pbs_info);
+    if (entry_data->is_offset_allocated) {
+        mlnx_acl_entry_offset_del(entry_data->table_index, entry_data->sx_prio, entry_data->offset);
     }
 
-    acl_global_unlock();
-    acl_table_unlock(acl_table_index);
-    sai_db_unlock();
+    if (entry_data->is_sx_rule_set) {
+        mlnx_acl_flex_rule_delete(entry_data->table_index, &entry_data->rule, entry_data->offset);
+    }
 
-    mlnx_acl_flex_rule_free(&flex_acl_rule);
+    mlnx_acl_sx_mc_container_remove(entry_data->sx_mc_container_rx);
+    mlnx_acl_sx_mc_container_remove(entry_data->sx_mc_container_tx);
+    mlnx_acl_sx_mc_container_remove(entry_data->sx_mc_container_egress_block);
 
-    free(sx_key_descs);
+    mlnx_acl_pbs_info_delete(entry_data->pbs_info);
 
-    SX_LOG_EXIT();
-    return status;
+    entry_data->entry_index                  = ACL_INVALID_DB_INDEX;
+    entry_data->is_offset_allocated          = false;
+    entry_data->is_sx_rule_set               = false;
+    entry_data->sx_mc_container_rx           = SX_MC_CONTAINER_ID_INVALID;
+    entry_data->sx_mc_container_tx           = SX_MC_CONTAINER_ID_INVALID;
+    entry_data->sx_mc_container_egress_block = SX_MC_CONTAINER_ID_INVALID;
+    entry_data->pbs_info                     = MLNX_ACL_PBS_INFO_INVALID;
 }
 
 /*
  * Routine Description:
- *   Create an ACL table
+ *   Create an ACL Entry
  *
  * Arguments:
- *  [out] acl_table_id - the the acl table id
+ *  [out] acl_entry_id -  acl entry/rule id
  *  [in] attr_count - number of attributes
  *  [in] attr_list - array of attributes
  *
@@ -9661,29 +9778,114 @@ out:
  *    Failure status code on error
  */
 
-sai_status_t mlnx_create_acl_table(_Out_ sai_object_id_t     * acl_table_id,
+sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
                                    _In_ sai_object_id_t        switch_id,
                                    _In_ uint32_t               attr_count,
                                    _In_ const sai_attribute_t *attr_list)
 {
     sai_status_t                 status;
-    sx_status_t                  sx_status;
-    sx_acl_direction_t           sx_acl_direction;
-    sai_acl_stage_t              sai_acl_stage;
-    const sai_attribute_value_t *stage, *table_size, *acl_action_list, *ip_ident;
-    const sai_attribute_value_t *in_port, *out_port, *in_ports, *out_ports;
-    const sai_attribute_value_t *bind_point_types, *range_type;
-    acl_bind_point_type_list_t   table_bind_point_types;
-    sai_acl_range_type_t         range_types[SAI_ACL_RANGE_TYPE_COUNT] = {0};
-    acl_udf_group_list_t         udf_group_list;
-    uint32_t                     range_type_count = 0;
-    uint32_t                     range_type_index;
-    uint32_t                     stage_index, table_size_index, acl_action_list_index, ip_ident_index;
-    uint32_t                     in_port_index, out_port_index, in_ports_index, out_ports_index;
-    uint32_t                     bind_point_types_index;
-    uint32_t                     key_count      = 0, key_index = 0;
-    uint32_t                     acl_table_size = 0;
-    sx_acl_size_t                sx_region_size;
+    mlnx_acl_entry_create_data_t entry_data;
+    char                         key_str[MAX_KEY_STR_LEN];
+
+    SX_LOG_ENTER();
+
+    if (NULL == acl_entry_id) {
+        SX_LOG_ERR("NULL acl entry id param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    mlnx_acl_entry_create_data_init(&entry_data);
+
+    status = mlnx_acl_entry_create_attrs_check(attr_count, attr_list, &entry_data.table_index, &entry_data.sx_prio);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    sai_db_read_lock();
+    acl_table_write_lock(entry_data.table_index);
+    acl_global_lock();
+
+    status = mlnx_acl_entry_create_prepare(attr_count, attr_list, &entry_data);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    status = mlnx_acl_entry_create_offset_reserve(&entry_data);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    status = mlnx_acl_entry_sx_acl_rule_set(entry_data.table_index, entry_data.entry_index, &entry_data.rule);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    entry_data.is_sx_rule_set = true;
+
+    status = mlnx_acl_entry_create_finish(&entry_data);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    acl_create_entry_object_id(acl_entry_id, entry_data.entry_index, entry_data.table_index);
+
+    acl_entry_key_to_str(*acl_entry_id, key_str);
+    SX_LOG_NTC("Created acl entry %s\n\n", key_str);
+
+out:
+    if (SAI_STATUS_SUCCESS != status) {
+        SX_LOG_ERR(" Failed to create Entry \n");
+        mlnx_acl_entry_create_rollback(&entry_data);
+    }
+
+    acl_global_unlock();
+    acl_table_unlock(entry_data.table_index);
+    sai_db_unlock();
+
+    mlnx_acl_flex_rule_free(&entry_data.rule);
+
+    SX_LOG_EXIT();
+    return status;
+}
+
+/*
+ * Routine Description:
+ *   Create an ACL table
+ *
+ * Arguments:
+ *  [out] acl_table_id - the the acl table id
+ *  [in] attr_count - number of attributes
+ *  [in] attr_list - array of attributes
+ *
+ * Return Values:
+ *    SAI_STATUS_SUCCESS on success
+ *    Failure status code on error
+ */
+
+sai_status_t mlnx_create_acl_table(_Out_ sai_object_id_t     * acl_table_id,
+                                   _In_ sai_object_id_t        switch_id,
+                                   _In_ uint32_t               attr_count,
+                                   _In_ const sai_attribute_t *attr_list)
+{
+    sai_status_t                 status;
+    sx_status_t                  sx_status;
+    sx_acl_direction_t           sx_acl_direction;
+    sai_acl_stage_t              sai_acl_stage;
+    const sai_attribute_value_t *stage, *table_size, *acl_action_list, *ip_ident;
+    const sai_attribute_value_t *in_port, *out_port, *in_ports, *out_ports;
+    const sai_attribute_value_t *bind_point_types, *range_type;
+    acl_bind_point_type_list_t   table_bind_point_types;
+    sai_acl_range_type_t         range_types[SAI_ACL_RANGE_TYPE_COUNT] = {0};
+    acl_udf_group_list_t         udf_group_list;
+    uint32_t                     range_type_count = 0;
+    uint32_t                     range_type_index;
+    uint32_t                     stage_index, table_size_index, acl_action_list_index, ip_ident_index;
+    uint32_t                     in_port_index, out_port_index, in_ports_index, out_ports_index;
+    uint32_t                     bind_point_types_index;
+    uint32_t                     key_count      = 0, key_index = 0;
+    uint32_t                     acl_table_size = 0;
+    sx_acl_size_t                sx_region_size;
     sx_acl_key_type_t            key_handle;
     sx_acl_rule_offset_t         default_rule_offset;
     const sx_acl_action_type_t   action_type = SX_ACL_ACTION_TYPE_BASIC;
@@ -9942,6 +10144,7 @@ sai_status_t mlnx_create_acl_table(_Out_ sai_object_id_t     * acl_table_id,
     acl_db_table(acl_table_index).bind_point_types       = table_bind_point_types;
     acl_db_table(acl_table_index).is_ip_ident_used       = is_ip_ident_used;
     acl_db_table(acl_table_index).head_entry_index       = ACL_INVALID_DB_INDEX;
+    acl_db_table(acl_table_index).psort_holes            = 0;
 
     memcpy(acl_db_table(acl_table_index).udf_group_list, udf_group_list, sizeof(udf_group_list));
 
@@ -10183,6 +10386,465 @@ static sai_status_t mlnx_get_acl_counter_attribute(_In_ sai_object_id_t     acl_
                               attr_list);
 }
 
+static void mlnx_acl_counter_stats_add(_In_ uint64_t reads, _In_ uint64_t sdk_reads, _In_ uint64_t snapshot_hits)
+{
+#ifndef _WIN32
+    pthread_mutex_lock(&acl_counter_snapshot_lock);
+#endif
+    acl_counter_stats.reads         += reads;
+    acl_counter_stats.sdk_reads     += sdk_reads;
+    acl_counter_stats.snapshot_hits += snapshot_hits;
+#ifndef _WIN32
+    pthread_mutex_unlock(&acl_counter_snapshot_lock);
+#endif
+}
+
+void mlnx_acl_counter_stats_get(_Out_ mlnx_acl_counter_stats_t *stats)
+{
+    assert(stats);
+
+#ifndef _WIN32
+    pthread_mutex_lock(&acl_counter_snapshot_lock);
+#endif
+    *stats                = acl_counter_stats;
+    stats->snapshot_ms    = acl_counter_snapshot_period_ms;
+    stats->snapshot_count = acl_counter_snapshot_count;
+#ifndef _WIN32
+    pthread_mutex_unlock(&acl_counter_snapshot_lock);
+#endif
+}
+
+static uint32_t mlnx_acl_counter_snapshot_hash(_In_ sx_flow_counter_id_t sx_counter_id)
+{
+    return (sx_counter_id * 2654435761u) & (ACL_COUNTER_SNAPSHOT_SIZE - 1);
+}
+
+/* Snapshot lock is needed */
+static mlnx_acl_counter_snapshot_t* mlnx_acl_counter_snapshot_find(_In_ sx_flow_counter_id_t sx_counter_id,
+                                                                   _In_ bool                 add)
+{
+    mlnx_acl_counter_snapshot_t *snapshot;
+    uint32_t                     idx;
+
+    /* Snapshot is closed */
+    if (!acl_counter_snapshots) {
+        return NULL;
+    }
+
+    for (idx = mlnx_acl_counter_snapshot_hash(sx_counter_id);
+         acl_counter_snapshots[idx].is_used;
+         idx = (idx + 1) & (ACL_COUNTER_SNAPSHOT_SIZE - 1)) {
+        if (acl_counter_snapshots[idx].sx_counter_id == sx_counter_id) {
+            return &acl_counter_snapshots[idx];
+        }
+    }
+
+    /* Keep the probe sequences short, counters above the limit are read from SDK */
+    if ((!add) || (acl_counter_snapshot_count >= ACL_COUNTER_SNAPSHOT_SIZE / 2)) {
+        return NULL;
+    }
+
+    snapshot = &acl_counter_snapshots[idx];
+    memset(snapshot, 0, sizeof(*snapshot));
+    snapshot->is_used       = true;
+    snapshot->sx_counter_id = sx_counter_id;
+    acl_counter_snapshot_count++;
+
+    return snapshot;
+}
+
+/* Snapshot lock is needed. Open addressing without tombstones, the rest of the cluster is shifted back */
+static void mlnx_acl_counter_snapshot_del(_Inout_ mlnx_acl_counter_snapshot_t *snapshot)
+{
+    uint32_t hole, idx, home;
+
+    hole = (uint32_t)(snapshot - acl_counter_snapshots);
+    idx  = hole;
+
+    acl_counter_snapshots[hole].is_used = false;
+    acl_counter_snapshot_count--;
+
+    while (true) {
+        idx = (idx + 1) & (ACL_COUNTER_SNAPSHOT_SIZE - 1);
+        if (!acl_counter_snapshots[idx].is_used) {
+            return;
+        }
+
+        home = mlnx_acl_counter_snapshot_hash(acl_counter_snapshots[idx].sx_counter_id);
+
+        /* The entry stays if its home is cyclically in (hole, idx] */
+        if ((hole < idx) ? ((hole < home) && (home <= idx)) : ((hole < home) || (home <= idx))) {
+            continue;
+        }
+
+        acl_counter_snapshots[hole]         = acl_counter_snapshots[idx];
+        acl_counter_snapshots[idx].is_used = false;
+        hole                                = idx;
+    }
+}
+
+/* Drops the snapshot of the counter which is cleared or destroyed */
+static void mlnx_acl_counter_snapshot_invalidate(_In_ sx_flow_counter_id_t sx_counter_id)
+{
+    mlnx_acl_counter_snapshot_t *snapshot;
+
+    if (!acl_counter_snapshots) {
+        return;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&acl_counter_snapshot_lock);
+#endif
+    snapshot = mlnx_acl_counter_snapshot_find(sx_counter_id, false);
+    if (snapshot) {
+        mlnx_acl_counter_snapshot_del(snapshot);
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&acl_counter_snapshot_lock);
+#endif
+}
+
+static sai_status_t mlnx_acl_counter_sx_read(_In_ sx_flow_counter_id_t sx_counter_id,
+                                             _Out_ uint64_t           *packets,
+                                             _Out_ uint64_t           *bytes)
+{
+    sx_status_t           sx_status;
+    sx_flow_counter_set_t counter_value;
+
+    sx_status = sx_api_flow_counter_get(gh_sdk, SX_ACCESS_CMD_READ, sx_counter_id, &counter_value);
+    if (SX_STATUS_SUCCESS != sx_status) {
+        SX_LOG_ERR(" Failure to get counter %u in SDK - %s \n", sx_counter_id, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    *packets = counter_value.flow_counter_packets;
+    *bytes   = counter_value.flow_counter_bytes;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Reads the bytes and packets of a counter with one SDK call. With the snapshot enabled,
+ * the counter is refreshed in the background from its first read on and is served from
+ * the snapshot while it is not older than two refresh periods.
+ */
+static sai_status_t mlnx_acl_counter_read(_In_ sx_flow_counter_id_t sx_counter_id,
+                                          _Out_ uint64_t           *packets,
+                                          _Out_ uint64_t           *bytes)
+{
+    sai_status_t                 status;
+    mlnx_acl_counter_snapshot_t *snapshot;
+    uint64_t                     now_us;
+
+    assert(packets);
+    assert(bytes);
+
+    if (!acl_counter_snapshots) {
+        status = mlnx_acl_counter_sx_read(sx_counter_id, packets, bytes);
+        mlnx_acl_counter_stats_add(1, 1, 0);
+        return status;
+    }
+
+    now_us = mlnx_time_us_get();
+
+#ifndef _WIN32
+    pthread_mutex_lock(&acl_counter_snapshot_lock);
+#endif
+    snapshot = mlnx_acl_counter_snapshot_find(sx_counter_id, true);
+    if (snapshot) {
+        snapshot->polled_us = now_us;
+
+        if ((snapshot->timestamp_us) &&
+            (now_us - snapshot->timestamp_us <= acl_counter_snapshot_period_ms * 2000)) {
+            *packets = snapshot->packets;
+            *bytes   = snapshot->bytes;
+            acl_counter_stats.reads++;
+            acl_counter_stats.snapshot_hits++;
+#ifndef _WIN32
+            pthread_mutex_unlock(&acl_counter_snapshot_lock);
+#endif
+            return SAI_STATUS_SUCCESS;
+        }
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&acl_counter_snapshot_lock);
+#endif
+
+    status = mlnx_acl_counter_sx_read(sx_counter_id, packets, bytes);
+    mlnx_acl_counter_stats_add(1, 1, 0);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&acl_counter_snapshot_lock);
+#endif
+    snapshot = mlnx_acl_counter_snapshot_find(sx_counter_id, false);
+    if (snapshot) {
+        snapshot->packets      = *packets;
+        snapshot->bytes        = *bytes;
+        snapshot->timestamp_us = now_us;
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&acl_counter_snapshot_lock);
+#endif
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Refreshes the counters which were read recently, one SDK call per counter as SDK has
+ * no synchronous multi counter read. The snapshot lock is not held during the SDK calls.
+ */
+static void mlnx_acl_counter_snapshot_refresh(void)
+{
+    sai_status_t                 status;
+    mlnx_acl_counter_snapshot_t *snapshot;
+    sx_flow_counter_id_t        *sx_counter_ids;
+    uint64_t                     now_us, packets, bytes, idle_us;
+    uint32_t                     count = 0, sdk_reads = 0, ii;
+
+    sx_counter_ids = calloc(ACL_COUNTER_SNAPSHOT_SIZE, sizeof(*sx_counter_ids));
+    if (!sx_counter_ids) {
+        SX_LOG_ERR("Failed to allocate memory for ACL counters refresh\n");
+        return;
+    }
+
+    idle_us = acl_counter_snapshot_period_ms * 1000 * ACL_COUNTER_SNAPSHOT_IDLE_PERIODS;
+    now_us  = mlnx_time_us_get();
+
+#ifndef _WIN32
+    pthread_mutex_lock(&acl_counter_snapshot_lock);
+#endif
+    for (ii = 0; ii < ACL_COUNTER_SNAPSHOT_SIZE; ii++) {
+        snapshot = &acl_counter_snapshots[ii];
+        if (!snapshot->is_used) {
+            continue;
+        }
+
+        /* Not polled anymore, the deletion shifts the next entries back to ii */
+        while ((snapshot->is_used) && (now_us - snapshot->polled_us > idle_us)) {
+            mlnx_acl_counter_snapshot_del(snapshot);
+        }
+
+        if (snapshot->is_used) {
+            sx_counter_ids[count++] = snapshot->sx_counter_id;
+        }
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&acl_counter_snapshot_lock);
+#endif
+
+    for (ii = 0; ii < count; ii++) {
+        if (acl_counter_snapshot_stop) {
+            break;
+        }
+
+        status = mlnx_acl_counter_sx_read(sx_counter_ids[ii], &packets, &bytes);
+        sdk_reads++;
+        if (SAI_ERR(status)) {
+            continue;
+        }
+
+#ifndef _WIN32
+        pthread_mutex_lock(&acl_counter_snapshot_lock);
+#endif
+        snapshot = mlnx_acl_counter_snapshot_find(sx_counter_ids[ii], false);
+        if (snapshot) {
+            snapshot->packets      = packets;
+            snapshot->bytes        = bytes;
+            snapshot->timestamp_us = mlnx_time_us_get();
+        }
+#ifndef _WIN32
+        pthread_mutex_unlock(&acl_counter_snapshot_lock);
+#endif
+    }
+
+    mlnx_acl_counter_stats_add(0, sdk_reads, 0);
+
+    free(sx_counter_ids);
+}
+
+static void mlnx_acl_counter_snapshot_thread(void *arg)
+{
+#ifndef _WIN32
+    struct timespec tm;
+
+    SX_LOG_ENTER();
+
+    while (!acl_counter_snapshot_stop) {
+        mlnx_acl_counter_snapshot_refresh();
+
+        clock_gettime(CLOCK_MONOTONIC, &tm);
+        tm.tv_sec  += acl_counter_snapshot_period_ms / 1000;
+        tm.tv_nsec += (acl_counter_snapshot_period_ms % 1000) * 1000000;
+        if (tm.tv_nsec >= 1000000000) {
+            tm.tv_sec++;
+            tm.tv_nsec -= 1000000000;
+        }
+
+        pthread_mutex_lock(&acl_counter_snapshot_lock);
+        if (!acl_counter_snapshot_stop) {
+            pthread_cond_timedwait(&acl_counter_snapshot_cond, &acl_counter_snapshot_lock, &tm);
+        }
+        pthread_mutex_unlock(&acl_counter_snapshot_lock);
+    }
+
+    SX_LOG_EXIT();
+#endif /* _WIN32 */
+}
+
+/*
+ * The snapshot is kept in process memory and is enabled by SAI_ACL_COUNTERS_SNAPSHOT_MS,
+ * the refresh period of the background thread. 0 (default) disables it.
+ * Called on ACL init and on switch connect, mlnx_acl_counter_snapshot_close() undoes it.
+ */
+static void mlnx_acl_counter_snapshot_init(void)
+{
+#ifndef _WIN32
+    pthread_condattr_t cond_attr;
+    const char        *period_str;
+
+    if (acl_counter_snapshot_started) {
+        return;
+    }
+
+    period_str = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_ACL_COUNTERS_SNAPSHOT_MS);
+    if (NULL == period_str) {
+        return;
+    }
+
+    acl_counter_snapshot_period_ms = (uint64_t)atoi(period_str);
+    if (0 == acl_counter_snapshot_period_ms) {
+        return;
+    }
+
+    if ((0 != pthread_condattr_init(&cond_attr)) ||
+        (0 != pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC)) ||
+        (0 != pthread_cond_init(&acl_counter_snapshot_cond, &cond_attr))) {
+        SX_LOG_ERR("Failed to init ACL counters snapshot condition variable, snapshot is disabled\n");
+        acl_counter_snapshot_period_ms = 0;
+        return;
+    }
+
+    pthread_condattr_destroy(&cond_attr);
+
+    acl_counter_snapshots = calloc(ACL_COUNTER_SNAPSHOT_SIZE, sizeof(*acl_counter_snapshots));
+    if (!acl_counter_snapshots) {
+        SX_LOG_ERR("Can't allocate memory for ACL counters snapshot, snapshot is disabled\n");
+        pthread_cond_destroy(&acl_counter_snapshot_cond);
+        acl_counter_snapshot_period_ms = 0;
+        return;
+    }
+
+    acl_counter_snapshot_count = 0;
+    acl_counter_snapshot_stop  = false;
+
+    if (CL_SUCCESS != cl_thread_init(&acl_counter_snapshot_thread, mlnx_acl_counter_snapshot_thread, NULL, NULL)) {
+        SX_LOG_ERR("Failed to init ACL counters snapshot thread, snapshot is disabled\n");
+        pthread_cond_destroy(&acl_counter_snapshot_cond);
+        free(acl_counter_snapshots);
+        acl_counter_snapshots          = NULL;
+        acl_counter_snapshot_period_ms = 0;
+        return;
+    }
+
+    acl_counter_snapshot_started = true;
+
+    SX_LOG_NTC("ACL counters snapshot period %u ms\n", (uint32_t)acl_counter_snapshot_period_ms);
+#endif /* _WIN32 */
+}
+
+static void mlnx_acl_counter_snapshot_close(void)
+{
+#ifndef _WIN32
+    mlnx_acl_counter_snapshot_t *snapshots;
+
+    if (!acl_counter_snapshot_started) {
+        return;
+    }
+
+    pthread_mutex_lock(&acl_counter_snapshot_lock);
+    acl_counter_snapshot_stop = true;
+    pthread_cond_signal(&acl_counter_snapshot_cond);
+    pthread_mutex_unlock(&acl_counter_snapshot_lock);
+
+    cl_thread_destroy(&acl_counter_snapshot_thread);
+
+    /* Readers may have seen the pointer before, mlnx_acl_counter_snapshot_find() checks it again under the lock */
+    pthread_mutex_lock(&acl_counter_snapshot_lock);
+    snapshots                      = acl_counter_snapshots;
+    acl_counter_snapshots          = NULL;
+    acl_counter_snapshot_count     = 0;
+    acl_counter_snapshot_period_ms = 0;
+    pthread_mutex_unlock(&acl_counter_snapshot_lock);
+
+    free(snapshots);
+    pthread_cond_destroy(&acl_counter_snapshot_cond);
+
+    acl_counter_snapshot_stop    = false;
+    acl_counter_snapshot_started = false;
+#endif /* _WIN32 */
+}
+
+/**
+ * @brief Get the packets and bytes of several ACL counters.
+ *
+ * Counter OIDs carry the SDK counter id. The ACL lock is only taken to check the counter,
+ * not for the SDK reads.
+ *
+ * @param[in] object_count Number of ACL counters
+ * @param[in] counter_ids Array of ACL counter ids
+ * @param[out] packets Array of object_count packet values, can be NULL
+ * @param[out] bytes Array of object_count byte values, can be NULL
+ * @param[out] object_statuses Status of each ACL counter
+ *
+ * @return #SAI_STATUS_SUCCESS when all counters are read, #SAI_STATUS_FAILURE when some failed,
+ *         other failure status code on invalid parameters
+ */
+sai_status_t mlnx_acl_counters_get(_In_ uint32_t               object_count,
+                                   _In_ const sai_object_id_t *counter_ids,
+                                   _Out_opt_ uint64_t         *packets,
+                                   _Out_opt_ uint64_t         *bytes,
+                                   _Out_ sai_status_t         *object_statuses)
+{
+    sai_status_t         status = SAI_STATUS_SUCCESS;
+    sx_flow_counter_id_t sx_counter_id;
+    uint64_t             counter_packets, counter_bytes;
+    uint32_t             ii;
+
+    SX_LOG_ENTER();
+
+    if ((0 == object_count) || (NULL == counter_ids) || (NULL == object_statuses)) {
+        SX_LOG_ERR("Invalid ACL counters bulk get params\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        object_statuses[ii] = mlnx_acl_counter_resolve(counter_ids[ii], &sx_counter_id);
+        if (!SAI_ERR(object_statuses[ii])) {
+            object_statuses[ii] = mlnx_acl_counter_read(sx_counter_id, &counter_packets, &counter_bytes);
+        }
+
+        if (SAI_ERR(object_statuses[ii])) {
+            status = SAI_STATUS_FAILURE;
+            continue;
+        }
+
+        if (packets) {
+            packets[ii] = counter_packets;
+        }
+
+        if (bytes) {
+            bytes[ii] = counter_bytes;
+        }
+    }
+
+    SX_LOG_EXIT();
+    return status;
+}
+
 static sai_status_t mlnx_acl_counter_set(_In_ const sai_object_key_t      *key,
                                          _In_ const sai_attribute_value_t *value,
                                          void                             *arg)
@@ -10209,6 +10871,8 @@ static sai_status_t mlnx_acl_counter_set(_In_ const sai_object_key_t      *key,
             status = sdk_to_sai(sx_status);
             goto out;
         }
+
+        mlnx_acl_counter_snapshot_invalidate(sx_counter_id);
     }
 
 out:
@@ -10223,41 +10887,40 @@ static sai_status_t mlnx_acl_counter_get(_In_ const sai_object_key_t   *key,
                                          _Inout_ vendor_cache_t        *cache,
                                          void                          *arg)
 {
-    sx_status_t           sx_status;
-    sai_status_t          status;
-    sx_flow_counter_set_t counter_value;
-    sx_flow_counter_id_t  counter_id;
+    sai_status_t              status = SAI_STATUS_SUCCESS;
+    sx_flow_counter_id_t      counter_id;
+    mlnx_acl_counter_cache_t *counter_cache = &cache->acl_counter_cache;
 
     SX_LOG_ENTER();
     assert((SAI_ACL_COUNTER_ATTR_PACKETS == (int64_t)arg) ||
            (SAI_ACL_COUNTER_ATTR_BYTES == (int64_t)arg));
 
-    acl_global_lock();
+    /* Bytes and packets requested in one get call share one read */
+    if (!counter_cache->counter_cache_set) {
+        status = mlnx_acl_counter_resolve(key->key.object_id, &counter_id);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
 
-    status = mlnx_acl_counter_oid_to_sx(key->key.object_id, &counter_id);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
+        status = mlnx_acl_counter_read(counter_id, &counter_cache->packets, &counter_cache->bytes);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
 
-    sx_status = sx_api_flow_counter_get(gh_sdk, SX_ACCESS_CMD_READ, counter_id, &counter_value);
-    if (SX_STATUS_SUCCESS != sx_status) {
-        SX_LOG_ERR(" Failure to get counter in SDK - %s \n", SX_STATUS_MSG(sx_status));
-        status = sdk_to_sai(sx_status);
-        goto out;
+        counter_cache->counter_cache_set = true;
     }
 
     switch ((int64_t)arg) {
     case SAI_ACL_COUNTER_ATTR_BYTES:
-        value->u64 = counter_value.flow_counter_bytes;
+        value->u64 = counter_cache->bytes;
         break;
 
     case SAI_ACL_COUNTER_ATTR_PACKETS:
-        value->u64 = counter_value.flow_counter_packets;
+        value->u64 = counter_cache->packets;
         break;
     }
 
 out:
-    acl_global_unlock();
     SX_LOG_EXIT();
     return status;
 }
@@ -10290,6 +10953,37 @@ static sai_status_t mlnx_acl_counter_oid_to_sx(_In_ sai_object_id_t        count
     return mlnx_acl_counter_oid_data_get(counter_oid, sx_counter_id, NULL, NULL, NULL);
 }
 
+/*
+ * Checks under the ACL lock that the table of the counter still has counters and returns the SDK counter id.
+ * The lock is not held during the SDK read that follows.
+ */
+static sai_status_t mlnx_acl_counter_resolve(_In_ sai_object_id_t        counter_oid,
+                                             _Out_ sx_flow_counter_id_t *sx_counter_id)
+{
+    sai_status_t status;
+    uint32_t     table_db_idx;
+
+    assert(sx_counter_id);
+
+    acl_global_lock();
+
+    status = mlnx_acl_counter_oid_data_get(counter_oid, sx_counter_id, NULL, NULL, &table_db_idx);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    if ((!acl_table_index_check_range(table_db_idx)) || (!acl_db_table(table_db_idx).is_used) ||
+        (0 == acl_db_table(table_db_idx).counter_ref)) {
+        SX_LOG_ERR("ACL counter 0x%" PRIx64 " doesn't exist\n", counter_oid);
+        status = SAI_STATUS_INVALID_OBJECT_ID;
+        goto out;
+    }
+
+out:
+    acl_global_unlock();
+    return status;
+}
+
 static sai_status_t mlnx_acl_counter_oid_data_get(_In_ sai_object_id_t        counter_oid,
                                                   _Out_ sx_flow_counter_id_t *sx_counter_id,
                                                   _Out_ bool                 *byte_counter_flag,
@@ -10803,6 +11497,8 @@ static sai_status_t mlnx_delete_acl_counter(_In_ sai_object_id_t acl_counter_id)
         goto out;
     }
 
+    mlnx_acl_counter_snapshot_invalidate(sx_counter_id);
+
     if (acl_db_table(table_db_idx).counter_ref == 0) {
         SX_LOG_ERR("Failed to decrease counter reference for table %d\n", table_db_idx);
     } else {
@@ -11018,70 +11714,91 @@ static sai_status_t mlnx_acl_sx_rule_mc_containers_remove(_In_ sx_flex_acl_flex_
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_delete_acl_entry_data(_In_ uint32_t table_index, _In_ uint32_t entry_index)
+/* Reads the entry's rule and releases the port references of its keys */
+static sai_status_t mlnx_delete_acl_entry_data_start(_In_ uint32_t                  table_index,
+                                                     _In_ uint32_t                  entry_index,
+                                                     _Out_ sx_flex_acl_flex_rule_t *sx_flex_rule)
 {
-    sai_status_t              status       = SAI_STATUS_SUCCESS;
-    sx_flex_acl_flex_rule_t   sx_flex_rule = MLNX_ACL_SX_FLEX_RULE_EMPTY;
+    sai_status_t            status;
+    mlnx_acl_port_db_refs_t refs;
+
+    assert(acl_table_index_check_range(table_index));
+    assert(acl_entry_index_check_range(entry_index));
+
+    status = mlnx_acl_entry_sx_acl_rule_get(table_index, entry_index, sx_flex_rule);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = mlnx_acl_entry_sx_rule_port_refs_get(sx_flex_rule, refs);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    return mlnx_acl_entry_port_refs_clear(refs);
+}
+
+/* Releases the entry's resources once its rule is deleted from SDK */
+static sai_status_t mlnx_delete_acl_entry_data_finish(_In_ uint32_t                 table_index,
+                                                      _In_ uint32_t                 entry_index,
+                                                      _In_ sx_flex_acl_flex_rule_t *sx_flex_rule)
+{
+    sai_status_t              status;
     sx_flex_acl_rule_offset_t rule_offset;
     mlnx_acl_port_db_refs_t   refs;
     mlnx_acl_pbs_info_t       pbs_info;
     uint32_t                  sx_prio;
 
-    SX_LOG_ENTER();
-
-    assert(acl_table_index_check_range(table_index));
-    assert(acl_entry_index_check_range(entry_index));
-
     sx_prio     = acl_db_entry(entry_index).sx_prio;
     rule_offset = acl_db_entry(entry_index).offset;
     pbs_info    = acl_db_entry(entry_index).pbs_info;
 
-    status = mlnx_acl_entry_sx_acl_rule_get(table_index, entry_index, &sx_flex_rule);
+    status = mlnx_acl_sx_rule_mc_containers_remove(sx_flex_rule);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    status = mlnx_acl_entry_sx_rule_port_refs_get(&sx_flex_rule, refs);
+    status = mlnx_acl_pbs_info_port_refs_get(pbs_info, refs);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     status = mlnx_acl_entry_port_refs_clear(refs);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    status = mlnx_acl_flex_rule_delete(table_index, &sx_flex_rule, rule_offset);
+    status = mlnx_acl_pbs_info_delete(pbs_info);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    status = mlnx_acl_sx_rule_mc_containers_remove(&sx_flex_rule);
+    status = mlnx_acl_entry_offset_del(table_index, sx_prio, rule_offset);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    status = mlnx_acl_pbs_info_port_refs_get(pbs_info, refs);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
+    return mlnx_acl_db_entry_delete(entry_index);
+}
 
-    status = mlnx_acl_entry_port_refs_clear(refs);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
+static sai_status_t mlnx_delete_acl_entry_data(_In_ uint32_t table_index, _In_ uint32_t entry_index)
+{
+    sai_status_t            status       = SAI_STATUS_SUCCESS;
+    sx_flex_acl_flex_rule_t sx_flex_rule = MLNX_ACL_SX_FLEX_RULE_EMPTY;
 
-    status = mlnx_acl_pbs_info_delete(pbs_info);
+    SX_LOG_ENTER();
+
+    status = mlnx_delete_acl_entry_data_start(table_index, entry_index, &sx_flex_rule);
     if (SAI_ERR(status)) {
         goto out;
     }
 
-    status = mlnx_acl_entry_offset_del(table_index, sx_prio, rule_offset);
+    status = mlnx_acl_flex_rule_delete(table_index, &sx_flex_rule, acl_db_entry(entry_index).offset);
     if (SAI_ERR(status)) {
         goto out;
     }
 
-    status = mlnx_acl_db_entry_delete(entry_index);
+    status = mlnx_delete_acl_entry_data_finish(table_index, entry_index, &sx_flex_rule);
     if (SAI_ERR(status)) {
         goto out;
     }
@@ -11187,8 +11904,10 @@ static sx_utils_status_t psort_notification_func(_In_ psort_notification_type_e
                                                  _In_ void                     *cookie)
 {
     sx_utils_status_t    status       = SX_UTILS_STATUS_SUCCESS;
+    sai_status_t         sai_status;
     psort_shift_param_t *shift_param  = (psort_shift_param_t*)data;
     uint32_t             acl_table_id = (uint32_t)(uintptr_t)cookie;
+    bool                 is_plan_active;
 
     SX_LOG_ENTER();
 
@@ -11200,15 +11919,27 @@ static sx_utils_status_t psort_notification_func(_In_ psort_notification_type_e
         break;
 
     case PSORT_TABLE_ALMOST_EMPTY_E:
-        if (SAI_STATUS_SUCCESS != mlnx_acl_table_size_decrease(acl_table_id)) {
+    case PSORT_TABLE_ALMOST_FULL_E:
+        /* Region is resized, the collected moves need to be in HW before */
+        is_plan_active = mlnx_acl_rule_move_plan_is_active(acl_table_id);
+        if (SAI_STATUS_SUCCESS != mlnx_acl_rule_move_plan_commit(acl_table_id)) {
             status = SX_UTILS_STATUS_ERROR;
+            break;
         }
-        break;
 
-    case PSORT_TABLE_ALMOST_FULL_E:
-        if (SAI_STATUS_SUCCESS != mlnx_acl_table_size_increase(acl_table_id)) {
+        if (PSORT_TABLE_ALMOST_EMPTY_E == notif_type) {
+            sai_status = mlnx_acl_table_size_decrease(acl_table_id);
+        } else {
+            sai_status = mlnx_acl_table_size_increase(acl_table_id);
+        }
+
+        if (SAI_STATUS_SUCCESS != sai_status) {
             status = SX_UTILS_STATUS_ERROR;
         }
+
+        if (is_plan_active) {
+            mlnx_acl_rule_move_plan_begin(acl_table_id);
+        }
         break;
 
     default:
@@ -11285,7 +12016,138 @@ static sai_status_t create_rpc_socket(_Inout_ int *s, _Inout_opt_ struct sockadd
     return status;
 }
 
-static sai_status_t mlnx_acl_rpc_call(_Inout_ acl_rpc_info_t *rpc_info)
+#ifndef _WIN32
+/* Shared futexes (not FUTEX_PRIVATE_FLAG) since the words are in the ACL shared memory. 0 timeout - no timeout */
+static void mlnx_acl_futex_wait(_In_ uint32_t *addr, _In_ uint32_t val, _In_ uint64_t timeout_us)
+{
+    struct timespec timeout;
+
+    timeout.tv_sec  = timeout_us / 1000000;
+    timeout.tv_nsec = (timeout_us % 1000000) * 1000;
+
+    if ((-1 == syscall(SYS_futex, addr, FUTEX_WAIT, val, timeout_us ? &timeout : NULL, NULL, 0)) &&
+        (EAGAIN != errno) && (EINTR != errno) && (ETIMEDOUT != errno)) {
+        SX_LOG_ERR("Failed to wait on ACL RPC futex - %s\n", strerror(errno));
+    }
+}
+
+static void mlnx_acl_futex_wake(_In_ uint32_t *addr, _In_ int count)
+{
+    if (-1 == syscall(SYS_futex, addr, FUTEX_WAKE, count, NULL, NULL, 0)) {
+        SX_LOG_ERR("Failed to wake ACL RPC futex - %s\n", strerror(errno));
+    }
+}
+#endif /* _WIN32 */
+
+static bool mlnx_acl_rpc_shm_is_ready(void)
+{
+#ifndef _WIN32
+    return __atomic_load_n(&sai_acl_db->acl_settings_tbl->rpc_shm.is_ready, __ATOMIC_ACQUIRE);
+#else
+    return false;
+#endif /* _WIN32 */
+}
+
+/* Returns NULL when the channel is not working or (without 'wait') all the slots are in use */
+static acl_rpc_shm_slot_t* mlnx_acl_rpc_shm_slot_claim(_In_ bool wait)
+{
+#ifndef _WIN32
+    acl_rpc_shm_t *rpc_shm = &sai_acl_db->acl_settings_tbl->rpc_shm;
+    uint32_t       ii, state;
+
+    do {
+        if (!mlnx_acl_rpc_shm_is_ready()) {
+            return NULL;
+        }
+
+        for (ii = 0; ii < ACL_RPC_SHM_SLOT_COUNT; ii++) {
+            state = ACL_RPC_SHM_SLOT_FREE;
+            if (__atomic_compare_exchange_n(&rpc_shm->slots[ii].state, &state, ACL_RPC_SHM_SLOT_BUSY, false,
+                                            __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                return &rpc_shm->slots[ii];
+            }
+        }
+
+        if (wait) {
+            sched_yield();
+        }
+    } while (wait);
+#endif /* _WIN32 */
+
+    return NULL;
+}
+
+static void mlnx_acl_rpc_shm_slot_release(_Inout_ acl_rpc_shm_slot_t *slot)
+{
+#ifndef _WIN32
+    __atomic_store_n(&slot->state, ACL_RPC_SHM_SLOT_FREE, __ATOMIC_RELEASE);
+#endif /* _WIN32 */
+}
+
+/*
+ * Posts the request of a claimed slot and waits up to ACL_RPC_SHM_CALL_TIMEOUT_USEC for the response.
+ * On SAI_STATUS_SUCCESS the caller reads the response and releases the slot.
+ * On timeout the slot is given back here (or by the server once it is done with it):
+ * SAI_STATUS_NOT_EXECUTED - the server didn't pick the request, nothing was done.
+ * SAI_STATUS_FAILURE - the server is handling the request, the result is lost like on a socket error.
+ */
+static sai_status_t mlnx_acl_rpc_shm_slot_call(_Inout_ acl_rpc_shm_slot_t *slot)
+{
+#ifndef _WIN32
+    acl_rpc_shm_t *rpc_shm = &sai_acl_db->acl_settings_tbl->rpc_shm;
+    uint64_t       deadline_us, now_us;
+    uint32_t       state;
+
+    deadline_us = mlnx_time_us_get() + ACL_RPC_SHM_CALL_TIMEOUT_USEC;
+
+    __atomic_store_n(&slot->state, ACL_RPC_SHM_SLOT_REQUEST, __ATOMIC_SEQ_CST);
+    __atomic_fetch_add(&rpc_shm->requests, 1, __ATOMIC_SEQ_CST);
+    mlnx_acl_futex_wake(&rpc_shm->requests, 1);
+
+    while (ACL_RPC_SHM_SLOT_RESPONSE != (state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE))) {
+        now_us = mlnx_time_us_get();
+        if (now_us < deadline_us) {
+            mlnx_acl_futex_wait(&slot->state, state, deadline_us - now_us);
+            continue;
+        }
+
+        state = ACL_RPC_SHM_SLOT_REQUEST;
+        if (__atomic_compare_exchange_n(&slot->state, &state, ACL_RPC_SHM_SLOT_FREE, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            SX_LOG_ERR("ACL RPC shm request (type %d) was not picked up in time\n", slot->info.type);
+            return SAI_STATUS_NOT_EXECUTED;
+        }
+
+        state = ACL_RPC_SHM_SLOT_HANDLING;
+        if (__atomic_compare_exchange_n(&slot->state, &state, ACL_RPC_SHM_SLOT_ABANDONED, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            SX_LOG_ERR("ACL RPC shm request (type %d) timed out\n", slot->info.type);
+            return SAI_STATUS_FAILURE;
+        }
+        /* The response has just been posted */
+    }
+#endif /* _WIN32 */
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void mlnx_acl_rpc_stats_update(_In_ bool is_shm, _In_ uint64_t start_us)
+{
+#ifndef _WIN32
+    acl_rpc_shm_t *rpc_shm = &sai_acl_db->acl_settings_tbl->rpc_shm;
+    uint64_t       time_us = mlnx_time_us_get() - start_us;
+
+    if (is_shm) {
+        __atomic_fetch_add(&rpc_shm->shm_calls, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&rpc_shm->shm_total_us, time_us, __ATOMIC_RELAXED);
+    } else {
+        __atomic_fetch_add(&rpc_shm->socket_calls, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&rpc_shm->socket_total_us, time_us, __ATOMIC_RELAXED);
+    }
+#endif /* _WIN32 */
+}
+
+static sai_status_t mlnx_acl_rpc_socket_call(_Inout_ acl_rpc_info_t *rpc_info)
 {
     sai_status_t status = SAI_STATUS_SUCCESS;
 
@@ -11328,12 +12190,47 @@ static sai_status_t mlnx_acl_rpc_call(_Inout_ acl_rpc_info_t *rpc_info)
         goto out;
     }
 
-    status = rpc_info->status;
+    status = rpc_info->status;
+
+out:
+#endif
+    SX_LOG_EXIT();
+    return status;
+}
+
+static sai_status_t mlnx_acl_rpc_call(_Inout_ acl_rpc_info_t *rpc_info)
+{
+    sai_status_t        status;
+    acl_rpc_shm_slot_t *slot;
+    uint64_t            start_us;
+
+    start_us = mlnx_time_us_get();
+
+    slot = mlnx_acl_rpc_shm_slot_claim(false);
+    if (!slot) {
+        status = mlnx_acl_rpc_socket_call(rpc_info);
+        mlnx_acl_rpc_stats_update(false, start_us);
+        return status;
+    }
+
+    slot->info = *rpc_info;
+
+    status = mlnx_acl_rpc_shm_slot_call(slot);
+    if (SAI_STATUS_NOT_EXECUTED == status) {
+        status = mlnx_acl_rpc_socket_call(rpc_info);
+        mlnx_acl_rpc_stats_update(false, start_us);
+        return status;
+    }
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    *rpc_info = slot->info;
+    mlnx_acl_rpc_shm_slot_release(slot);
 
-out:
-#endif
-    SX_LOG_EXIT();
-    return status;
+    mlnx_acl_rpc_stats_update(true, start_us);
+
+    return rpc_info->status;
 }
 
 /* SP2 */
@@ -11672,11 +12569,18 @@ static sai_status_t mlnx_acl_entry_offset_get_sp(_In_ uint32_t               tab
     psort_entry.key      = entry_db_idx;
     psort_entry.priority = priority;
 
+    mlnx_acl_rule_move_plan_begin(table_db_idx);
+
     sx_status = psort_entry_set(psort_handle, SX_UTILS_CMD_ADD, &psort_entry);
+
+    status = mlnx_acl_rule_move_plan_commit(table_db_idx);
     if (SX_UTILS_STATUS_SUCCESS != sx_status) {
         SX_LOG_ERR("Failed to get offset form pSort - %s\n", SX_UTILS_STATUS_MSG(sx_status));
         return SAI_STATUS_FAILURE;
     }
+    if (SAI_ERR(status)) {
+        return status;
+    }
 
     SX_LOG_DBG("Added psort entry (index %u, prio %u)\n", psort_entry.index, psort_entry.priority);
 
@@ -11767,6 +12671,30 @@ static sai_status_t mlnx_acl_entry_prio_set_sp(_In_ uint32_t table_db_idx,
 
 static sai_status_t mlnx_acl_init_sp(void)
 {
+    uint32_t ii;
+
+    /* ACL_TABLE_DB_SIZE is known only after the resource limits are read */
+    acl_rule_move_plans = calloc(ACL_TABLE_DB_SIZE, sizeof(*acl_rule_move_plans));
+    if (!acl_rule_move_plans) {
+        SX_LOG_ERR("Failed to allocate memory for ACL rule move plans\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    memset(&psort_opt_batch, 0, sizeof(psort_opt_batch));
+    psort_opt_batch.tables    = calloc(ACL_PSORT_OPT_RING_SIZE, sizeof(*psort_opt_batch.tables));
+    psort_opt_batch.queued_ms = calloc(ACL_PSORT_OPT_RING_SIZE, sizeof(*psort_opt_batch.queued_ms));
+    if (!psort_opt_batch.tables || !psort_opt_batch.queued_ms) {
+        SX_LOG_ERR("Failed to allocate memory for ACL pSort optimization batch\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    memset(sai_acl_db->acl_psort_opt_ring, 0, sizeof(*sai_acl_db->acl_psort_opt_ring) * ACL_PSORT_OPT_RING_SIZE);
+    sai_acl_db->acl_settings_tbl->psort_opt_ring_head       = 0;
+    sai_acl_db->acl_settings_tbl->psort_opt_ring_tail       = 0;
+    sai_acl_db->acl_settings_tbl->psort_opt_last_request_ms = 0;
+    memset(&sai_acl_db->acl_settings_tbl->psort_opt_stats, 0, sizeof(sai_acl_db->acl_settings_tbl->psort_opt_stats));
+    sai_acl_db->acl_settings_tbl->psort_opt_stats.quiet_period_ms = ACL_PSORT_OPT_QUIET_MIN_MS;
+
 #ifndef _WIN32
     pthread_condattr_t cond_attr;
 
@@ -11785,11 +12713,29 @@ static sai_status_t mlnx_acl_init_sp(void)
         return SAI_STATUS_NO_MEMORY;
     }
 
+    /* Quiet period is measured with CLOCK_MONOTONIC */
+    if (0 != pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC)) {
+        SX_LOG_ERR("Failed to set condition variable clock for ACL - %s\n", strerror(errno));
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (0 != pthread_cond_init(&sai_acl_db->acl_settings_tbl->psort_thread_work_cond, &cond_attr)) {
+        SX_LOG_ERR("Failed to init condition variable for ACL - %s\n", strerror(errno));
+        return SAI_STATUS_NO_MEMORY;
+    }
+
     if (CL_SUCCESS != cl_thread_init(&psort_thread, psort_background_thread, NULL, NULL)) {
         SX_LOG_ERR("Failed to init psort thread\n");
         return SAI_STATUS_NO_MEMORY;
     }
 
+    for (ii = 0; ii < ACL_PSORT_OPT_WORKERS_NUM - 1; ii++) {
+        if (CL_SUCCESS != cl_thread_init(&psort_opt_workers[ii], psort_opt_worker_thread, NULL, NULL)) {
+            SX_LOG_ERR("Failed to init psort optimization worker thread\n");
+            return SAI_STATUS_NO_MEMORY;
+        }
+    }
+
     if (0 != pthread_condattr_destroy(&cond_attr)) {
         SX_LOG_ERR("Failed to destory condition variable attribute for ACL\n");
         return SAI_STATUS_FAILURE;
@@ -11799,66 +12745,169 @@ static sai_status_t mlnx_acl_init_sp(void)
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_acl_psort_opt_queue_create(void)
+/*
+ * Ring of the tables queued for pSort optimization. It is in the shared ACL DB since the requests
+ * come from every process, while the only consumer is pSort background thread.
+ * A producer reserves a slot by incrementing the tail and then publishes (table index + 1) in it,
+ * an empty slot is 0. A table is pushed only when its 'queued' flag is raised, so the ring never
+ * holds more than ACL_PSORT_OPT_RING_SIZE tables.
+ */
+static void mlnx_acl_psort_opt_ring_push(_In_ uint32_t table_db_idx)
 {
 #ifndef _WIN32
-    struct mq_attr mq_attributes;
+    uint64_t tail;
 
-    memset(&mq_attributes, 0, sizeof(mq_attributes));
+    tail = __atomic_fetch_add(&sai_acl_db->acl_settings_tbl->psort_opt_ring_tail, 1, __ATOMIC_RELAXED);
 
-    mq_attributes.mq_flags   = 0;
-    mq_attributes.mq_maxmsg  = ACL_QUEUE_SIZE;
-    mq_attributes.mq_msgsize = ACL_QUEUE_MSG_SIZE;
-    mq_attributes.mq_curmsgs = 0;
+    __atomic_store_n(&sai_acl_db->acl_psort_opt_ring[tail % ACL_PSORT_OPT_RING_SIZE],
+                     (uint64_t)table_db_idx + 1, __ATOMIC_RELEASE);
+#endif /* _WIN32 */
+}
 
-    mq_unlink(ACL_QUEUE_NAME);
+static bool mlnx_acl_psort_opt_ring_peek(_Out_ uint32_t *table_db_idx)
+{
+#ifndef _WIN32
+    uint64_t head, value;
 
-    psort_opt_queue_client = mq_open(ACL_QUEUE_NAME,
-                                     O_CREAT | O_WRONLY | O_NONBLOCK,
-                                     (S_IRWXU | S_IRWXG | S_IRWXO),
-                                     &mq_attributes);
-    if (ACL_QUEUE_INVALID_HANDLE == psort_opt_queue_client) {
-        SX_LOG_ERR("Failed to open acl fg_mq - %s\n", strerror(errno));
-        return SAI_STATUS_FAILURE;
+    head  = sai_acl_db->acl_settings_tbl->psort_opt_ring_head;
+    value = __atomic_load_n(&sai_acl_db->acl_psort_opt_ring[head % ACL_PSORT_OPT_RING_SIZE], __ATOMIC_ACQUIRE);
+    if (0 == value) {
+        return false;
     }
+
+    *table_db_idx = (uint32_t)(value - 1);
+
+    return true;
+#else
+    return false;
 #endif /* _WIN32 */
+}
 
-    return SAI_STATUS_SUCCESS;
+static bool mlnx_acl_psort_opt_ring_pop(_Out_ uint32_t *table_db_idx)
+{
+    uint64_t head;
+
+    if (!mlnx_acl_psort_opt_ring_peek(table_db_idx)) {
+        return false;
+    }
+
+    head = sai_acl_db->acl_settings_tbl->psort_opt_ring_head;
+
+    sai_acl_db->acl_psort_opt_ring[head % ACL_PSORT_OPT_RING_SIZE] = 0;
+    sai_acl_db->acl_settings_tbl->psort_opt_ring_head              = head + 1;
+
+    return true;
 }
 
-static sai_status_t mlnx_acl_psort_opt_queue_client_create(void)
+/* Takes all the published tables from the ring, new requests for them are going to queue them again */
+static uint32_t mlnx_acl_psort_opt_ring_drain(_Out_ uint32_t *tables, _Out_ uint64_t *queued_ms)
 {
-#ifndef _WIN32
-    if (ACL_QUEUE_INVALID_HANDLE == psort_opt_queue_client) {
-        psort_opt_queue_client = mq_open(ACL_QUEUE_NAME, O_WRONLY | O_NONBLOCK);
-        if (ACL_QUEUE_INVALID_HANDLE == psort_opt_queue_client) {
-            SX_LOG_ERR("Failed to open mq - %s\n", strerror(errno));
-            return SAI_STATUS_FAILURE;
+    uint32_t table_db_idx, count = 0;
+
+    while ((count < ACL_PSORT_OPT_RING_SIZE) && mlnx_acl_psort_opt_ring_pop(&table_db_idx)) {
+        if (!acl_table_index_check_range(table_db_idx)) {
+            SX_LOG_ERR("Attempt to use invalid ACL Table DB index - %u\n", table_db_idx);
+            continue;
         }
 
-        SX_LOG_DBG("Created psort_opt_queue_client - %d\n", psort_opt_queue_client);
+        tables[count]    = table_db_idx;
+        queued_ms[count] = acl_db_table(table_db_idx).queued_ms;
+        count++;
+
+#ifndef _WIN32
+        __atomic_store_n(&acl_db_table(table_db_idx).queued, 0, __ATOMIC_RELEASE);
+#endif
     }
-#endif /* _WIN32 */
 
-    return SAI_STATUS_SUCCESS;
+    return count;
+}
+
+static void mlnx_acl_psort_opt_stats_update(_In_ uint64_t queued_ms, _In_ uint64_t start_ms, _In_ uint64_t end_ms)
+{
+    mlnx_acl_psort_opt_stats_t *stats = &sai_acl_db->acl_settings_tbl->psort_opt_stats;
+    uint64_t                    latency_ms, duration_ms;
+
+    latency_ms  = (end_ms > queued_ms) ? (end_ms - queued_ms) : 0;
+    duration_ms = end_ms - start_ms;
+
+    stats->tables_optimized++;
+    stats->last_latency_ms    = latency_ms;
+    stats->max_latency_ms     = MAX(stats->max_latency_ms, latency_ms);
+    stats->total_latency_ms  += latency_ms;
+    stats->max_duration_ms    = MAX(stats->max_duration_ms, duration_ms);
+    stats->total_duration_ms += duration_ms;
 }
 
-static sai_status_t mlnx_acl_psort_opt_queue_client_close(void)
+/* Called by pSort background thread and by the workers, each table of the batch is taken by one of them */
+static void mlnx_acl_psort_opt_batch_work(void)
 {
 #ifndef _WIN32
-    if (ACL_QUEUE_INVALID_HANDLE != psort_opt_queue_client) {
-        if (0 != mq_close(psort_opt_queue_client)) {
-            SX_LOG_ERR("Failed to close ACL psort optimization queue - %s\n", strerror(errno));
-            return SAI_STATUS_FAILURE;
-        }
+    uint32_t table_db_idx;
+    uint64_t queued_ms, start_ms, end_ms;
 
-        SX_LOG_DBG("Removed psort_opt_queue_client - %d\n", psort_opt_queue_client);
+    pthread_mutex_lock(&psort_opt_batch_lock);
+    while (psort_opt_batch.next < psort_opt_batch.count) {
+        table_db_idx = psort_opt_batch.tables[psort_opt_batch.next];
+        queued_ms    = psort_opt_batch.queued_ms[psort_opt_batch.next];
+        psort_opt_batch.next++;
+        pthread_mutex_unlock(&psort_opt_batch_lock);
 
-        psort_opt_queue_client = ACL_QUEUE_INVALID_HANDLE;
+        start_ms = mlnx_time_us_get() / 1000;
+        acl_psort_optimize_table(table_db_idx);
+        end_ms = mlnx_time_us_get() / 1000;
+
+        pthread_mutex_lock(&psort_opt_batch_lock);
+        mlnx_acl_psort_opt_stats_update(queued_ms, start_ms, end_ms);
+
+        psort_opt_batch.done++;
+        if (psort_opt_batch.done == psort_opt_batch.count) {
+            pthread_cond_signal(&psort_opt_batch_done_cond);
+        }
     }
+    pthread_mutex_unlock(&psort_opt_batch_lock);
 #endif /* _WIN32 */
+}
 
-    return SAI_STATUS_SUCCESS;
+static void mlnx_acl_psort_opt_batch_run(_In_ uint32_t count)
+{
+#ifndef _WIN32
+    pthread_mutex_lock(&psort_opt_batch_lock);
+    psort_opt_batch.count = count;
+    psort_opt_batch.next  = 0;
+    psort_opt_batch.done  = 0;
+    psort_opt_batch.generation++;
+    /* A single table is not worth waking up the workers */
+    if (count > 1) {
+        pthread_cond_broadcast(&psort_opt_batch_work_cond);
+    }
+    pthread_mutex_unlock(&psort_opt_batch_lock);
+
+    mlnx_acl_psort_opt_batch_work();
+
+    pthread_mutex_lock(&psort_opt_batch_lock);
+    while (psort_opt_batch.done < psort_opt_batch.count) {
+        pthread_cond_wait(&psort_opt_batch_done_cond, &psort_opt_batch_lock);
+    }
+    psort_opt_batch.count = 0;
+    psort_opt_batch.next  = 0;
+    pthread_mutex_unlock(&psort_opt_batch_lock);
+#endif /* _WIN32 */
+}
+
+static void mlnx_acl_psort_opt_workers_close(void)
+{
+#ifndef _WIN32
+    uint32_t ii;
+
+    pthread_mutex_lock(&psort_opt_batch_lock);
+    psort_opt_batch.stop = true;
+    pthread_cond_broadcast(&psort_opt_batch_work_cond);
+    pthread_mutex_unlock(&psort_opt_batch_lock);
+
+    for (ii = 0; ii < ACL_PSORT_OPT_WORKERS_NUM - 1; ii++) {
+        cl_thread_destroy(&psort_opt_workers[ii]);
+    }
+#endif /* _WIN32 */
 }
 
 static sai_status_t mlnx_acl_psort_thread_wake(void)
@@ -11882,11 +12931,6 @@ static sai_status_t mlnx_acl_lazy_init_sp(void)
 {
     sai_status_t status;
 
-    status = mlnx_acl_psort_opt_queue_create();
-    if (SAI_ERR(status)) {
-        return status;
-    }
-
     status = mlnx_acl_psort_thread_wake();
     if (SAI_ERR(status)) {
         return status;
@@ -11906,11 +12950,6 @@ static sai_status_t mlnx_acl_deinit_sp(void)
         return status;
     }
 
-    status = mlnx_acl_psort_opt_queue_client_close();
-    if (SAI_ERR(status)) {
-        return status;
-    }
-
     for (table_index = 0; table_index < ACL_TABLE_DB_SIZE; table_index++) {
         if (acl_db_table(table_index).is_used) {
             status = mlnx_acl_table_deinit_sp(table_index);
@@ -11920,6 +12959,12 @@ static sai_status_t mlnx_acl_deinit_sp(void)
         }
     }
 
+    mlnx_acl_rule_move_plans_free();
+
+    free(psort_opt_batch.tables);
+    free(psort_opt_batch.queued_ms);
+    memset(&psort_opt_batch, 0, sizeof(psort_opt_batch));
+
     return SAI_STATUS_SUCCESS;
 }
 
@@ -11944,37 +12989,34 @@ static sai_status_t mlnx_acl_table_size_set_sp(_In_ uint32_t table_db_idx, _In_
 static sai_status_t mlnx_acl_table_optimize_sp(_In_ uint32_t table_db_idx)
 {
 #ifndef _WIN32
-    sai_status_t status;
+    acl_setting_tbl_t *settings = sai_acl_db->acl_settings_tbl;
+    uint64_t           now_ms;
 
-    if (!sai_acl_db->acl_settings_tbl->psort_thread_start_flag) {
+    if (!settings->psort_thread_start_flag) {
         SX_LOG_ERR("Failed to optimize - ACL pSort thread is not working\n");
         return SAI_STATUS_FAILURE;
     }
 
-    if (sai_acl_db->acl_settings_tbl->psort_thread_suspended) {
+    if (settings->psort_thread_suspended) {
         SX_LOG_NTC("Failed to optimize - ACL pSort thread is suspended\n");
         return SAI_STATUS_SUCCESS;
     }
 
-    status = mlnx_acl_psort_opt_queue_client_create();
-    if (SAI_ERR(status)) {
-        return status;
-    }
+    now_ms = mlnx_time_us_get() / 1000;
 
-    acl_db_table(table_db_idx).queued++;
-    if (-1 == mq_send(psort_opt_queue_client, (const char*)&table_db_idx,
-                      sizeof(table_db_idx), ACL_QUEUE_DEF_MSG_PRIO)) {
-        if (EAGAIN == errno) {
-            SX_LOG_NTC("Failed to enqueue table %d - queue is full\n", table_db_idx);
-            acl_db_table(table_db_idx).queued--;
-            return SAI_STATUS_SUCCESS;
-        } else {
-            SX_LOG_ERR("Failed to enqueue table %d - %s\n", table_db_idx, strerror(errno));
-            acl_db_table(table_db_idx).queued--;
-            return SAI_STATUS_FAILURE;
-        }
+    __atomic_store_n(&settings->psort_opt_last_request_ms, now_ms, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&settings->psort_opt_stats.requests, 1, __ATOMIC_RELAXED);
+
+    /* 'queued' is the dirty flag of the table, only the request which raises it pushes the table to the ring */
+    if (0 != __atomic_exchange_n(&acl_db_table(table_db_idx).queued, 1, __ATOMIC_ACQ_REL)) {
+        __atomic_fetch_add(&settings->psort_opt_stats.coalesced, 1, __ATOMIC_RELAXED);
+        return SAI_STATUS_SUCCESS;
     }
 
+    acl_db_table(table_db_idx).queued_ms = now_ms;
+    mlnx_acl_psort_opt_ring_push(table_db_idx);
+
+    return mlnx_acl_psort_thread_unblock();
 #endif
     return SAI_STATUS_SUCCESS;
 }
@@ -12162,6 +13204,8 @@ sai_status_t mlnx_acl_init(void)
     sai_acl_db->acl_settings_tbl->psort_thread_suspended     = false;
     sai_acl_db->acl_settings_tbl->psort_thread_suspended_ack = false;
 
+    memset(&sai_acl_db->acl_settings_tbl->rpc_shm, 0, sizeof(sai_acl_db->acl_settings_tbl->rpc_shm));
+
 #ifndef _WIN32
     pthread_condattr_t  cond_attr;
     pthread_mutexattr_t mutex_attr;
@@ -12220,6 +13264,11 @@ sai_status_t mlnx_acl_init(void)
         SX_LOG_ERR("Failed to init acl req thread\n");
         return SAI_STATUS_FAILURE;
     }
+
+    if (CL_SUCCESS != cl_thread_init(&rpc_shm_thread, mlnx_acl_rpc_shm_thread, NULL, NULL)) {
+        SX_LOG_ERR("Failed to init acl rpc shm thread\n");
+        return SAI_STATUS_FAILURE;
+    }
 #endif /* _WIN32 */
 
     /* Inint ACL entry db */
@@ -12239,6 +13288,8 @@ sai_status_t mlnx_acl_init(void)
         return status;
     }
 
+    mlnx_acl_counter_snapshot_init();
+
     SX_LOG_EXIT();
     return status;
 }
@@ -12308,61 +13359,274 @@ static sai_status_t mlnx_acl_table_size_increase(_In_ uint32_t table_index)
         return status;
     }
 
-    acl_db_table(table_index).region_size = new_size;
-
-    return SAI_STATUS_SUCCESS;
+    acl_db_table(table_index).region_size = new_size;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_acl_table_size_decrease(_In_ uint32_t table_index)
+{
+    sai_status_t       status = SAI_STATUS_SUCCESS;
+    sx_status_t        sx_status;
+    sx_api_handle_t   *sx_api_handle = NULL;
+    sx_acl_key_type_t  key_type;
+    sx_acl_region_id_t region_id;
+    sx_acl_size_t      new_size, old_size;
+
+    assert(acl_table_index_check_range(table_index));
+
+    if (!acl_db_table(table_index).is_dynamic_sized) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sx_api_handle = mlnx_acl_sx_handle_get();
+
+    region_id = acl_db_table(table_index).region_id;
+    key_type  = acl_db_table(table_index).key_type;
+    old_size  = acl_db_table(table_index).region_size;
+
+    new_size = old_size / 2;
+    new_size = MAX(new_size, ACL_TABLE_SIZE_TO_SX_REG_SIZE(ACL_DEFAULT_TABLE_SIZE));
+
+    if (old_size <= new_size) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    SX_LOG_DBG("Decreasing a size of a table %u: [%u -> %u]\n", table_index, old_size, new_size);
+
+    status = mlnx_acl_cb->table_size_set(table_index, new_size);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    sx_status = sx_api_acl_region_set(*sx_api_handle, SX_ACCESS_CMD_EDIT, key_type, SX_ACL_ACTION_TYPE_BASIC,
+                                      new_size, &region_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to resize a region[%d] - %s.\n", table_index, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    acl_db_table(table_index).region_size = new_size;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_acl_rule_offset_db_update(_In_ uint32_t             acl_table_index,
+                                                   _In_ uint32_t             acl_entry_index,
+                                                   _In_ sx_acl_rule_offset_t old_offset,
+                                                   _In_ sx_acl_rule_offset_t new_offset)
+{
+    /* default rule's entry_index is ACL_INVALID_DB_INDEX */
+    if (ACL_INVALID_DB_INDEX == acl_entry_index) {
+        if (acl_db_table(acl_table_index).def_rules_offset != old_offset) {
+            SX_LOG_ERR("Default rule offset in SAI DB (%d) is not equal to pSort DB (%d)\n",
+                       acl_db_table(acl_table_index).def_rules_offset, old_offset);
+            return SAI_STATUS_FAILURE;
+        }
+
+        acl_db_table(acl_table_index).def_rules_offset = new_offset;
+    } else {
+        if (acl_db_entry(acl_entry_index).offset != old_offset) {
+            SX_LOG_ERR("ACL DB Rule offset is not equal to pSort offset\n");
+            return SAI_STATUS_FAILURE;
+        }
+
+        acl_db_entry(acl_entry_index).offset = new_offset;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void mlnx_acl_psort_move_stats_update(_In_ uint32_t rules_moved, _In_ uint32_t block_moves, _In_ bool is_pass)
+{
+#ifndef _WIN32
+    pthread_mutex_lock(&acl_psort_move_stats_lock);
+#endif
+    if (is_pass) {
+        acl_psort_move_stats.passes++;
+        if (acl_psort_move_stats.max_pass_rules < rules_moved) {
+            acl_psort_move_stats.max_pass_rules = rules_moved;
+        }
+        if (acl_psort_move_stats.max_pass_block_moves < block_moves) {
+            acl_psort_move_stats.max_pass_block_moves = block_moves;
+        }
+    }
+    acl_psort_move_stats.rules_moved += rules_moved;
+    acl_psort_move_stats.block_moves += block_moves;
+#ifndef _WIN32
+    pthread_mutex_unlock(&acl_psort_move_stats_lock);
+#endif
+}
+
+void mlnx_acl_psort_move_stats_get(_Out_ mlnx_acl_psort_move_stats_t *stats)
+{
+    assert(stats);
+
+#ifndef _WIN32
+    pthread_mutex_lock(&acl_psort_move_stats_lock);
+#endif
+    *stats = acl_psort_move_stats;
+#ifndef _WIN32
+    pthread_mutex_unlock(&acl_psort_move_stats_lock);
+#endif
+}
+
+/*
+ * Moves of the pSort shift notifications received until mlnx_acl_rule_move_plan_commit() are
+ * collected instead of being applied one by one. Table lock is needed.
+ */
+static void mlnx_acl_rule_move_plan_begin(_In_ uint32_t acl_table_index)
+{
+    assert(acl_table_index_check_range(acl_table_index));
+
+    /* Plans are only allocated in the process that owns pSort */
+    if (!acl_rule_move_plans) {
+        return;
+    }
+
+    acl_rule_move_plans[acl_table_index].is_active = true;
+    acl_rule_move_plans[acl_table_index].count     = 0;
+}
+
+static bool mlnx_acl_rule_move_plan_is_active(_In_ uint32_t acl_table_index)
+{
+    return (acl_rule_move_plans) && (acl_rule_move_plans[acl_table_index].is_active);
+}
+
+/*
+ * pSort shifts a range of rules one rule at a time, starting from the rule closest to the
+ * destination, so a run of moves with the same distance and adjacent source offsets is
+ * the same as one (overlapping) block move.
+ * The moves are committed to SDK in the order they were received and the offsets in the
+ * ACL DB are updated after each block, so on failure DB still matches the rules in SDK.
+ */
+static sai_status_t mlnx_acl_rule_move_plan_commit(_In_ uint32_t acl_table_index)
+{
+    sai_status_t                status = SAI_STATUS_SUCCESS;
+    sx_status_t                 sx_status;
+    sx_api_handle_t            *sx_api_handle = NULL;
+    sx_acl_region_id_t          region_id;
+    mlnx_acl_rule_move_plan_t  *plan;
+    const mlnx_acl_rule_move_t *moves;
+    sx_acl_rule_offset_t        block_start;
+    int64_t                     delta;
+    uint32_t                    ii, jj, kk, block_size, block_moves = 0;
+
+    assert(acl_table_index_check_range(acl_table_index));
+
+    if (!mlnx_acl_rule_move_plan_is_active(acl_table_index)) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    plan            = &acl_rule_move_plans[acl_table_index];
+    plan->is_active = false;
+
+    if (0 == plan->count) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sx_api_handle = mlnx_acl_sx_handle_get();
+    region_id     = acl_db_table(acl_table_index).region_id;
+    moves         = plan->moves;
+
+    for (ii = 0; ii < plan->count; ii = jj) {
+        jj = ii + 1;
+
+        delta       = (int64_t)moves[ii].new_offset - (int64_t)moves[ii].old_offset;
+        block_start = moves[ii].old_offset;
+        block_size  = 1;
+
+        for (; jj < plan->count; jj++) {
+            if ((int64_t)moves[jj].new_offset - (int64_t)moves[jj].old_offset != delta) {
+                break;
+            }
+
+            if ((delta > 0) && (moves[jj].old_offset + 1 == block_start)) {
+                block_start = moves[jj].old_offset;
+            } else if (!((delta < 0) && (moves[jj].old_offset == block_start + block_size))) {
+                break;
+            }
+
+            block_size++;
+        }
+
+        SX_LOG_DBG("Moving ACL table %u rules block [%u, %u] -> %u\n", acl_table_index, block_start,
+                   block_start + block_size - 1, (sx_acl_rule_offset_t)(block_start + delta));
+
+        sx_status = sx_api_acl_rule_block_move_set(*sx_api_handle, region_id, block_start, block_size,
+                                                   (sx_acl_rule_offset_t)(block_start + delta));
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to move rule block - %s\n", SX_STATUS_MSG(sx_status));
+            status = sdk_to_sai(sx_status);
+            goto out;
+        }
+
+        block_moves++;
+
+        for (kk = ii; kk < jj; kk++) {
+            status = mlnx_acl_rule_offset_db_update(acl_table_index, moves[kk].entry_index,
+                                                    moves[kk].old_offset, moves[kk].new_offset);
+            if (SAI_ERR(status)) {
+                goto out;
+            }
+        }
+    }
+
+out:
+    mlnx_acl_psort_move_stats_update(plan->count, block_moves, true);
+    plan->count = 0;
+    return status;
 }
 
-static sai_status_t mlnx_acl_table_size_decrease(_In_ uint32_t table_index)
+static sai_status_t mlnx_acl_rule_move_plan_add(_In_ uint32_t             acl_table_index,
+                                                _In_ uint32_t             acl_entry_index,
+                                                _In_ sx_acl_rule_offset_t old_offset,
+                                                _In_ sx_acl_rule_offset_t new_offset)
 {
-    sai_status_t       status = SAI_STATUS_SUCCESS;
-    sx_status_t        sx_status;
-    sx_api_handle_t   *sx_api_handle = NULL;
-    sx_acl_key_type_t  key_type;
-    sx_acl_region_id_t region_id;
-    sx_acl_size_t      new_size, old_size;
+    mlnx_acl_rule_move_plan_t *plan = &acl_rule_move_plans[acl_table_index];
+    mlnx_acl_rule_move_t      *moves;
+    uint32_t                   size;
 
-    assert(acl_table_index_check_range(table_index));
+    if (plan->count == plan->size) {
+        size  = plan->size ? plan->size * 2 : ACL_RULE_MOVE_PLAN_INIT_SIZE;
+        moves = realloc(plan->moves, size * sizeof(*moves));
+        if (!moves) {
+            SX_LOG_ERR("Failed to allocate memory for ACL rule move plan\n");
+            return SAI_STATUS_NO_MEMORY;
+        }
 
-    if (!acl_db_table(table_index).is_dynamic_sized) {
-        return SAI_STATUS_SUCCESS;
+        plan->moves = moves;
+        plan->size  = size;
     }
 
-    sx_api_handle = mlnx_acl_sx_handle_get();
-
-    region_id = acl_db_table(table_index).region_id;
-    key_type  = acl_db_table(table_index).key_type;
-    old_size  = acl_db_table(table_index).region_size;
-
-    new_size = old_size / 2;
-    new_size = MAX(new_size, ACL_TABLE_SIZE_TO_SX_REG_SIZE(ACL_DEFAULT_TABLE_SIZE));
+    plan->moves[plan->count].entry_index = acl_entry_index;
+    plan->moves[plan->count].old_offset  = old_offset;
+    plan->moves[plan->count].new_offset  = new_offset;
+    plan->count++;
 
-    if (old_size <= new_size) {
-        return SAI_STATUS_SUCCESS;
-    }
+    return SAI_STATUS_SUCCESS;
+}
 
-    SX_LOG_DBG("Decreasing a size of a table %u: [%u -> %u]\n", table_index, old_size, new_size);
+static void mlnx_acl_rule_move_plans_free(void)
+{
+    uint32_t ii;
 
-    status = mlnx_acl_cb->table_size_set(table_index, new_size);
-    if (SAI_ERR(status)) {
-        return status;
+    if (!acl_rule_move_plans) {
+        return;
     }
 
-    sx_status = sx_api_acl_region_set(*sx_api_handle, SX_ACCESS_CMD_EDIT, key_type, SX_ACL_ACTION_TYPE_BASIC,
-                                      new_size, &region_id);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to resize a region[%d] - %s.\n", table_index, SX_STATUS_MSG(sx_status));
-        return sdk_to_sai(sx_status);
+    for (ii = 0; ii < ACL_TABLE_DB_SIZE; ii++) {
+        free(acl_rule_move_plans[ii].moves);
     }
 
-    acl_db_table(table_index).region_size = new_size;
-
-    return SAI_STATUS_SUCCESS;
+    free(acl_rule_move_plans);
+    acl_rule_move_plans = NULL;
 }
 
 static sai_status_t mlnx_acl_sx_rule_offset_update(_In_ const psort_shift_param_t *shift_param,
                                                    _In_ uint32_t                   acl_table_index)
 {
+    sai_status_t         status;
     sx_status_t          sx_status;
     sx_api_handle_t     *sx_api_handle = NULL;
     sx_acl_region_id_t   region_id;
@@ -12372,8 +13636,6 @@ static sai_status_t mlnx_acl_sx_rule_offset_update(_In_ const psort_shift_param_
 
     SX_LOG_ENTER();
 
-    sx_api_handle = mlnx_acl_sx_handle_get();
-
     region_id       = acl_db_table(acl_table_index).region_id;
     acl_entry_index = (uint32_t)shift_param->key;
     old_offset      = shift_param->old_index;
@@ -12381,42 +13643,65 @@ static sai_status_t mlnx_acl_sx_rule_offset_update(_In_ const psort_shift_param_
 
     if (acl_db_table(acl_table_index).region_size <= new_offset) {
         SX_LOG_ERR("New offset from pSort is bigger then sx_region size\n");
-        sx_status = SX_STATUS_ERROR;
+        status = SAI_STATUS_FAILURE;
         goto out;
     }
 
-    /* default rule's entry_index is ACL_INVALID_DB_INDEX */
-    if (ACL_INVALID_DB_INDEX == acl_entry_index) {
-        if (acl_db_table(acl_table_index).def_rules_offset != old_offset) {
-            SX_LOG_ERR("Default rule offset in SAI DB (%d) is not equal to pSort DB (%d)\n",
-                       acl_db_table(acl_table_index).def_rules_offset, old_offset);
-            sx_status = SX_STATUS_ERROR;
+    if (mlnx_acl_rule_move_plan_is_active(acl_table_index)) {
+        status = mlnx_acl_rule_move_plan_add(acl_table_index, acl_entry_index, old_offset, new_offset);
+        if (SAI_STATUS_NO_MEMORY != status) {
             goto out;
         }
 
-        acl_db_table(acl_table_index).def_rules_offset = new_offset;
-    } else {
-        if (acl_db_entry(acl_entry_index).offset != old_offset) {
-            SX_LOG_ERR("ACL DB Rule offset is not equal to pSort offset\n");
-            sx_status = SX_STATUS_ERROR;
+        /* Apply what is collected so far and continue with a single rule move */
+        status = mlnx_acl_rule_move_plan_commit(acl_table_index);
+        if (SAI_ERR(status)) {
             goto out;
         }
+    }
 
-        acl_db_entry(acl_entry_index).offset = new_offset;
+    status = mlnx_acl_rule_offset_db_update(acl_table_index, acl_entry_index, old_offset, new_offset);
+    if (SAI_ERR(status)) {
+        goto out;
     }
 
     SX_LOG_DBG("Moving ACL table %u entry idx %u: %u -> %u %s\n", acl_table_index, acl_entry_index,
                old_offset, new_offset, (ACL_INVALID_DB_INDEX == acl_entry_index) ? "(default rule)" : " ");
 
+    sx_api_handle = mlnx_acl_sx_handle_get();
+
     sx_status = sx_api_acl_rule_block_move_set(*sx_api_handle, region_id, old_offset, 1, new_offset);
     if (SX_STATUS_SUCCESS != sx_status) {
         SX_LOG_ERR("Failed to move rule block\n");
+        status = sdk_to_sai(sx_status);
         goto out;
     }
 
+    mlnx_acl_psort_move_stats_update(1, 1, false);
+
 out:
     SX_LOG_EXIT();
-    return sdk_to_sai(sx_status);
+    return status;
+}
+
+/* Free offsets between the first and the last rule of the table, table lock is needed */
+static void mlnx_acl_table_psort_holes_update(_In_ uint32_t table_index)
+{
+    sx_acl_rule_offset_t min_offset = (sx_acl_rule_offset_t)(-1), max_offset = 0, offset;
+    uint32_t             entry_index, count = 0;
+
+    entry_index = acl_db_table(table_index).head_entry_index;
+
+    while (entry_index != ACL_INVALID_DB_INDEX) {
+        offset     = acl_db_entry(entry_index).offset;
+        min_offset = MIN(min_offset, offset);
+        max_offset = MAX(max_offset, offset);
+        count++;
+
+        entry_index = acl_db_entry(entry_index).next_entry_index;
+    }
+
+    acl_db_table(table_index).psort_holes = (count > 0) ? ((uint32_t)(max_offset - min_offset) + 1 - count) : 0;
 }
 
 static void acl_psort_optimize_table(_In_ uint32_t table_index)
@@ -12445,6 +13730,8 @@ static void acl_psort_optimize_table(_In_ uint32_t table_index)
     gettimeofday(&tv, NULL);
     start_ms = tv.tv_sec * 1000 + tv.tv_usec / 1000;
 
+    mlnx_acl_rule_move_plan_begin(table_index);
+
     do {
         status = psort_background_worker(psort_handle, &is_complete);
         if (SX_UTILS_STATUS_SUCCESS != status) {
@@ -12457,6 +13744,14 @@ static void acl_psort_optimize_table(_In_ uint32_t table_index)
     } while (!is_complete && ((current_ms - start_ms) <= (ACL_PSORT_OPT_MAX_TIME_MS / 2)));
 
 out:
+    if (SAI_ERR(mlnx_acl_rule_move_plan_commit(table_index))) {
+        SX_LOG_ERR("Failed to apply ACL table %u rule moves\n", table_index);
+    }
+
+    if (acl_db_table(table_index).is_used) {
+        mlnx_acl_table_psort_holes_update(table_index);
+    }
+
     acl_table_unlock(table_index);
     SX_LOG_EXIT();
 }
@@ -12497,11 +13792,6 @@ sai_status_t mlnx_acl_psort_thread_suspend(void)
         return status;
     }
 
-    status = mlnx_acl_psort_opt_queue_client_close();
-    if (SAI_ERR(status)) {
-        return status;
-    }
-
     /* suspend_ack is volatile since otherwise compiler assumes that the following loop is infinite */
     while (!(*suspend_ack)) {
 #ifndef _WIN32
@@ -12523,11 +13813,6 @@ sai_status_t mlnx_acl_psort_thread_resume(void)
         return SAI_STATUS_SUCCESS;
     }
 
-    status = mlnx_acl_psort_opt_queue_create();
-    if (SAI_ERR(status)) {
-        return status;
-    }
-
     sai_acl_db->acl_settings_tbl->psort_thread_suspended     = false;
     sai_acl_db->acl_settings_tbl->psort_thread_suspended_ack = false;
 
@@ -12542,41 +13827,74 @@ sai_status_t mlnx_acl_psort_thread_resume(void)
 }
 
 static void mlnx_acl_psort_queue_drain(void)
+{
+    uint32_t count;
+
+    count = mlnx_acl_psort_opt_ring_drain(psort_opt_batch.tables, psort_opt_batch.queued_ms);
+
+    SX_LOG_DBG("Dropped %u tables queued for pSort optimization\n", count);
+}
+
+static void mlnx_acl_psort_opt_quiet_wait(_In_ uint64_t wait_ms)
 {
 #ifndef _WIN32
-    mqd_t    mq;
-    uint32_t table_idx, ii;
+    struct timespec      tm;
+    const volatile bool *stop      = &sai_acl_db->acl_settings_tbl->psort_thread_stop_flag;
+    const volatile bool *suspended = &sai_acl_db->acl_settings_tbl->psort_thread_suspended;
 
-    mq = mq_open(ACL_QUEUE_NAME, O_RDONLY | O_NONBLOCK);
-    if (ACL_QUEUE_INVALID_HANDLE == mq) {
-        SX_LOG_ERR("Failed to open mqueue handle - %s\n", strerror(errno));
-        return;
+    clock_gettime(CLOCK_MONOTONIC, &tm);
+    tm.tv_sec  += wait_ms / 1000;
+    tm.tv_nsec += (wait_ms % 1000) * 1000000;
+    if (tm.tv_nsec >= 1000000000) {
+        tm.tv_sec++;
+        tm.tv_nsec -= 1000000000;
     }
 
-    for (ii = 0; ii < ACL_QUEUE_SIZE; ii++) {
-        if (-1 == mq_receive(mq, (char*)&table_idx, sizeof(table_idx), NULL)) {
-            if (errno == EAGAIN) {
-                break;
-            }
+    acl_cond_mutex_lock();
+    if (!(*stop) && !(*suspended)) {
+        pthread_cond_timedwait(&sai_acl_db->acl_settings_tbl->psort_thread_work_cond, &acl_cond_mutex, &tm);
+    }
+    acl_cond_mutex_unlock();
+#endif /* _WIN32 */
+}
 
-            SX_LOG_ERR("Failed to drain pSort mqueue - %s\n", strerror(errno));
-            break;
-        }
+/*
+ * Waits until the tables are not updated for a quiet period. The period gets longer while the
+ * updates keep coming during it and shorter when they don't. The oldest queued table is not
+ * delayed for more than ACL_PSORT_OPT_MAX_DELAY_MS.
+ */
+static void mlnx_acl_psort_opt_quiet_period_wait(_In_ uint64_t first_ms)
+{
+    mlnx_acl_psort_opt_stats_t *stats     = &sai_acl_db->acl_settings_tbl->psort_opt_stats;
+    const volatile bool        *stop      = &sai_acl_db->acl_settings_tbl->psort_thread_stop_flag;
+    const volatile bool        *suspended = &sai_acl_db->acl_settings_tbl->psort_thread_suspended;
+    uint64_t                    now_ms, request_ms, last_request_ms, idle_ms, delay_ms;
+    bool                        is_burst = false;
 
-        if (table_idx == ACL_QUEUE_UNBLOCK_MSG) {
-            continue;
+    last_request_ms = __atomic_load_n(&sai_acl_db->acl_settings_tbl->psort_opt_last_request_ms, __ATOMIC_RELAXED);
+
+    while (!(*stop) && !(*suspended)) {
+        now_ms     = mlnx_time_us_get() / 1000;
+        request_ms = __atomic_load_n(&sai_acl_db->acl_settings_tbl->psort_opt_last_request_ms, __ATOMIC_RELAXED);
+        if (request_ms != last_request_ms) {
+            is_burst        = true;
+            last_request_ms = request_ms;
         }
 
-        if (!acl_table_index_check_range(table_idx)) {
-            SX_LOG_ERR("Attempt to use invalid ACL Table DB index while draining mqueue - %u\n", table_idx);
-            continue;
+        idle_ms  = (now_ms > request_ms) ? (now_ms - request_ms) : 0;
+        delay_ms = (now_ms > first_ms) ? (now_ms - first_ms) : 0;
+        if ((idle_ms >= stats->quiet_period_ms) || (delay_ms >= ACL_PSORT_OPT_MAX_DELAY_MS)) {
+            break;
         }
 
-        acl_db_table(table_idx).queued = 0;
+        mlnx_acl_psort_opt_quiet_wait(MIN(stats->quiet_period_ms - idle_ms, ACL_PSORT_OPT_MAX_DELAY_MS - delay_ms));
     }
 
-    mq_close(mq);
-#endif /* ifndef _WIN32 */
+    if (is_burst) {
+        stats->quiet_period_ms = MIN(stats->quiet_period_ms * 2, ACL_PSORT_OPT_QUIET_MAX_MS);
+    } else {
+        stats->quiet_period_ms = MAX(stats->quiet_period_ms / 2, ACL_PSORT_OPT_QUIET_MIN_MS);
+    }
 }
 
 /* Thread can be in 3 states:
@@ -12591,12 +13909,9 @@ static void psort_background_thread(void *arg)
 #ifndef _WIN32
     sx_status_t          sx_status;
     sx_api_handle_t      psort_sx_api;
-    mqd_t                bg_mq;
-    struct timespec      tm;
     int                  pthread_status;
-    uint32_t             mq_message;
-    uint32_t             last_used_table;
-    bool                 timeout     = false;
+    uint32_t             table_db_idx, count;
+    uint64_t             first_ms;
     const volatile bool *start       = &sai_acl_db->acl_settings_tbl->psort_thread_start_flag;
     const volatile bool *stop        = &sai_acl_db->acl_settings_tbl->psort_thread_stop_flag;
     const volatile bool *suspended   = &sai_acl_db->acl_settings_tbl->psort_thread_suspended;
@@ -12629,98 +13944,199 @@ wait_restart:
         return;
     }
 
-    bg_mq = mq_open(ACL_QUEUE_NAME, O_RDONLY);
-    if (ACL_QUEUE_INVALID_HANDLE == bg_mq) {
-        SX_LOG_ERR("Failed to open acl bg_mq - %s\n", strerror(errno));
-        return;
-    }
+    while (!(*stop) && !(*suspended)) {
+        acl_cond_mutex_lock();
+        while (!mlnx_acl_psort_opt_ring_peek(&table_db_idx) && !(*stop) && !(*suspended)) {
+            pthread_cond_wait(&sai_acl_db->acl_settings_tbl->psort_thread_work_cond, &acl_cond_mutex);
+        }
+        acl_cond_mutex_unlock();
 
-    last_used_table = ACL_INVALID_DB_INDEX;
+        if (*stop || *suspended) {
+            break;
+        }
 
-    while (!(*stop) && !(*suspended)) {
-        if (ACL_INVALID_DB_INDEX == last_used_table) {
-            if (-1 == mq_receive(bg_mq, (char*)&mq_message, sizeof(mq_message), NULL)) {
-                SX_LOG_ERR("Failed to read from mq in blocked mode - %s\n", strerror(errno));
-                continue;
-            }
-        } else {
-            clock_gettime(CLOCK_REALTIME, &tm);
-            tm.tv_sec += ACL_QUEUE_TIMEOUT;
+        first_ms = acl_table_index_check_range(table_db_idx) ?
+                   acl_db_table(table_db_idx).queued_ms : mlnx_time_us_get() / 1000;
 
-            if (-1 == mq_timedreceive(bg_mq, (char*)&mq_message, sizeof(mq_message), NULL, &tm)) {
-                if (ETIMEDOUT == errno) {
-                    timeout = true;
-                } else {
-                    SX_LOG_ERR("Failed to read from mq in timed mode - %s\n", strerror(errno));
-                    continue;
-                }
-            }
+        mlnx_acl_psort_opt_quiet_period_wait(first_ms);
+
+        if (*stop || *suspended) {
+            break;
         }
 
-        if (mq_message == ACL_QUEUE_UNBLOCK_MSG) {
+        count = mlnx_acl_psort_opt_ring_drain(psort_opt_batch.tables, psort_opt_batch.queued_ms);
+        if (0 == count) {
             continue;
         }
 
-        if (timeout) {
-            acl_psort_optimize_table(last_used_table);
-            last_used_table = ACL_INVALID_DB_INDEX;
-            timeout         = false;
+        sai_acl_db->acl_settings_tbl->psort_opt_stats.rounds++;
+
+        mlnx_acl_psort_opt_batch_run(count);
+    }
+
+    sx_status = sx_api_close(&psort_sx_api);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to close sx_api_handle_t for pSort thread - %s\n", SX_STATUS_MSG(sx_status));
+    }
+
+    if (*suspended) {
+        mlnx_acl_psort_queue_drain();
+
+        *suspend_ack = true;
+        goto wait_restart;
+    }
+
+#endif /* ifndef _WIN32 */
+    SX_LOG_EXIT();
+}
+
+/*
+ * Optimizes the tables of a batch along with pSort background thread. SDK handle is opened only
+ * for the batch so the workers don't hold it while pSort thread is suspended.
+ */
+static void psort_opt_worker_thread(void *arg)
+{
+#ifndef _WIN32
+    sx_status_t     sx_status;
+    sx_api_handle_t worker_sx_api;
+    int             pthread_status;
+    uint64_t        generation = 0;
+
+    SX_LOG_ENTER();
+
+    pthread_mutex_lock(&psort_opt_batch_lock);
+    while (!psort_opt_batch.stop) {
+        if ((psort_opt_batch.next >= psort_opt_batch.count) || (generation == psort_opt_batch.generation)) {
+            pthread_cond_wait(&psort_opt_batch_work_cond, &psort_opt_batch_lock);
             continue;
+        }
+
+        generation = psort_opt_batch.generation;
+        pthread_mutex_unlock(&psort_opt_batch_lock);
+
+        sx_status = sx_api_open(sai_log_cb, &worker_sx_api);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to open sx_api_handle_t for pSort worker - %s.\n", SX_STATUS_MSG(sx_status));
         } else {
-            if (!acl_table_index_check_range(mq_message)) {
-                SX_LOG_ERR("Attempt to use invalid ACL Table DB index - %u\n", mq_message);
-                continue;
+            pthread_status = pthread_setspecific(pthread_sx_handle_key, &worker_sx_api);
+            if (0 != pthread_status) {
+                SX_LOG_ERR("Failed to set pthread_sx_handle_key value - %s\n", strerror(pthread_status));
+            } else {
+                mlnx_acl_psort_opt_batch_work();
+                pthread_setspecific(pthread_sx_handle_key, NULL);
             }
 
-            if (acl_db_table(mq_message).queued == 0) {
-                SX_LOG_ERR("Received a table idx %d with 'queued' = 0\n", mq_message);
-                continue;
+            sx_status = sx_api_close(&worker_sx_api);
+            if (SX_ERR(sx_status)) {
+                SX_LOG_ERR("Failed to close sx_api_handle_t for pSort worker - %s\n", SX_STATUS_MSG(sx_status));
             }
+        }
 
-            acl_db_table(mq_message).queued--;
+        pthread_mutex_lock(&psort_opt_batch_lock);
+    }
+    pthread_mutex_unlock(&psort_opt_batch_lock);
 
-            if (*suspended) {
-                SX_LOG_DBG("Ignoring table idx %d while thread is in the suspended state\n", mq_message);
-                continue;
-            }
+#endif /* ifndef _WIN32 */
+    SX_LOG_EXIT();
+}
 
-            if (ACL_INVALID_DB_INDEX == last_used_table) {
-                last_used_table = mq_message;
-                continue;
-            }
+static sai_status_t mlnx_acl_rpc_handle(_Inout_ acl_rpc_info_t *rpc_info)
+{
+    sai_status_t status;
 
-            if (mq_message != last_used_table) {
-                acl_psort_optimize_table(last_used_table);
-                last_used_table = mq_message;
-            }
-        }
+    assert(rpc_info);
+
+    switch (rpc_info->type) {
+    case ACL_RPC_TABLE_INIT:
+        status = mlnx_acl_cb->table_init(rpc_info->args.table_id,
+                                         rpc_info->args.table_is_dynamic,
+                                         rpc_info->args.size);
+        break;
+
+    case ACL_RPC_TABLE_DELETE:
+        status = mlnx_acl_cb->table_deinit(rpc_info->args.table_id);
+        break;
+
+    case ACL_RPC_ENTRY_OFFSET_GET:
+        status = mlnx_acl_cb->entry_offset_get(
+            rpc_info->args.table_id,
+            rpc_info->args.entry_id,
+            rpc_info->args.entry_prio,
+            &rpc_info->args.entry_offset);
+        break;
+
+    case ACL_RPC_ENTRY_OFFSET_DEL:
+        status = mlnx_acl_cb->entry_offset_del(rpc_info->args.table_id,
+                                               rpc_info->args.entry_prio,
+                                               rpc_info->args.entry_offset);
+        break;
+
+    case ACL_RPC_TERMINATE_THREAD:
+        status = SAI_STATUS_SUCCESS;
+        break;
+
+    default:
+        SX_LOG_ERR("Attempt to make rpc with undefined type\n");
+        status = SAI_STATUS_FAILURE;
     }
 
-    sx_status = sx_api_close(&psort_sx_api);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to close sx_api_handle_t for pSort thread - %s\n", SX_STATUS_MSG(sx_status));
+    return status;
+}
+
+static void mlnx_acl_rpc_shm_thread(void *arg)
+{
+#ifndef _WIN32
+    acl_rpc_shm_t      *rpc_shm = &sai_acl_db->acl_settings_tbl->rpc_shm;
+    acl_rpc_shm_slot_t *slot    = NULL;
+    uint32_t            requests, state, ii;
+
+    SX_LOG_ENTER();
+
+    acl_cond_mutex_lock();
+    while (false == sai_acl_db->acl_settings_tbl->rpc_thread_start_flag) {
+        pthread_cond_wait(&sai_acl_db->acl_settings_tbl->rpc_thread_init_cond, &acl_cond_mutex);
     }
+    acl_cond_mutex_unlock();
 
-    if (0 != mq_close(bg_mq)) {
-        SX_LOG_ERR("Failed to close bg_mq - %s\n", strerror(errno));
+    /* cond is triggered from resource_deinit() */
+    if (true == sai_acl_db->acl_settings_tbl->rpc_thread_stop_flag) {
+        goto out;
     }
 
-    if (*suspended) {
-        mlnx_acl_psort_queue_drain();
-        if (0 != mq_unlink(ACL_QUEUE_NAME)) {
-            SX_LOG_ERR("Failed to unlink message queue - %s\n", strerror(errno));
-        }
+    __atomic_store_n(&rpc_shm->is_ready, true, __ATOMIC_RELEASE);
 
-        *suspend_ack = true;
-        goto wait_restart;
-    } else {
-        if (0 != mq_unlink(ACL_QUEUE_NAME)) {
-            SX_LOG_ERR("Failed to unlink message queue - %s\n", strerror(errno));
+    while (false == __atomic_load_n(&sai_acl_db->acl_settings_tbl->rpc_thread_stop_flag, __ATOMIC_ACQUIRE)) {
+        requests = __atomic_load_n(&rpc_shm->requests, __ATOMIC_SEQ_CST);
+
+        for (ii = 0; ii < ACL_RPC_SHM_SLOT_COUNT; ii++) {
+            slot  = &rpc_shm->slots[ii];
+            state = ACL_RPC_SHM_SLOT_REQUEST;
+            if (!__atomic_compare_exchange_n(&slot->state, &state, ACL_RPC_SHM_SLOT_HANDLING, false,
+                                             __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                continue;
+            }
+
+            slot->info.status = mlnx_acl_rpc_handle(&slot->info);
+
+            state = ACL_RPC_SHM_SLOT_HANDLING;
+            if (__atomic_compare_exchange_n(&slot->state, &state, ACL_RPC_SHM_SLOT_RESPONSE, false,
+                                            __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+                mlnx_acl_futex_wake(&slot->state, 1);
+            } else {
+                /* ACL_RPC_SHM_SLOT_ABANDONED, the client is gone */
+                __atomic_store_n(&slot->state, ACL_RPC_SHM_SLOT_FREE, __ATOMIC_RELEASE);
+            }
         }
+
+        /* Returns at once if a request was posted after the load above */
+        mlnx_acl_futex_wait(&rpc_shm->requests, requests, 0);
     }
 
-#endif /* ifndef _WIN32 */
+out:
+    __atomic_store_n(&rpc_shm->is_ready, false, __ATOMIC_RELEASE);
+
     SX_LOG_EXIT();
+#endif /* ifndef _WIN32 */
 }
 
 static void mlnx_acl_rpc_thread(void *arg)
@@ -12766,42 +14182,13 @@ static void mlnx_acl_rpc_thread(void *arg)
             goto out;
         }
 
-        switch (rpc_info.type) {
-        case ACL_RPC_TABLE_INIT:
-            status = mlnx_acl_cb->table_init(rpc_info.args.table_id,
-                                             rpc_info.args.table_is_dynamic,
-                                             rpc_info.args.size);
-            break;
-
-        case ACL_RPC_TABLE_DELETE:
-            status = mlnx_acl_cb->table_deinit(rpc_info.args.table_id);
-            break;
-
-        case ACL_RPC_ENTRY_OFFSET_GET:
-            status = mlnx_acl_cb->entry_offset_get(
-                rpc_info.args.table_id,
-                rpc_info.args.entry_id,
-                rpc_info.args.entry_prio,
-                &rpc_info.args.entry_offset);
-            break;
-
-        case ACL_RPC_ENTRY_OFFSET_DEL:
-            status = mlnx_acl_cb->entry_offset_del(rpc_info.args.table_id,
-                                                   rpc_info.args.entry_prio,
-                                                   rpc_info.args.entry_offset);
-            break;
-
-        case ACL_RPC_TERMINATE_THREAD:
+        if (ACL_RPC_TERMINATE_THREAD == rpc_info.type) {
             SX_LOG_NTC("Received exit message for rpc thread\n");
             exit_request = true;
-            status       = SAI_STATUS_SUCCESS;
-            break;
-
-        default:
-            SX_LOG_ERR("Attempt to make rpc with undefined type\n");
-            status = SAI_STATUS_FAILURE;
         }
 
+        status = mlnx_acl_rpc_handle(&rpc_info);
+
         rpc_info.status = status;
 
         bytes =
@@ -13960,6 +15347,13 @@ static sai_status_t mlnx_sai_acl_redirect_action_create(_In_ sai_object_id_t
             return status;
         }
 
+        if (SAI_OBJECT_TYPE_NEXT_HOP_GROUP == object_type) {
+            status = mlnx_next_hop_group_shadow_flush(sx_ecmp_id);
+            if (SAI_ERR(status)) {
+                return status;
+            }
+        }
+
         sx_action->type                                          = SX_FLEX_ACL_ACTION_UC_ROUTE;
         sx_action->fields.action_uc_route.uc_route_type          = SX_UC_ROUTE_TYPE_NEXT_HOP;
         sx_action->fields.action_uc_route.uc_route_param.ecmp_id = sx_ecmp_id;
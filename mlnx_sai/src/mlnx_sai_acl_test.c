@@ -0,0 +1,300 @@
+/*
+ *  Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+/*
+ * Unit test of the pSort rule move plan. pSort shift notifications are passed to
+ * mlnx_acl_sx_rule_offset_update() and the rule block moves are applied to a software region,
+ * which is compared with the rule offsets in ACL DB and with the same moves applied one by one.
+ * The plan is internal to mlnx_sai_acl.c, so the file is included here.
+ */
+
+#include "mlnx_sai_acl.c"
+
+#define ASSERT_TRUE(x, fmt, ...)                            \
+    if (!(x)) {                                             \
+        fprintf(stderr,                                     \
+                "ASSERT TRUE FAILED(%s:%d): %s: " fmt "\n", \
+                __func__, __LINE__, #x, ## __VA_ARGS__);    \
+        exit(1); }
+
+#define TEST_TABLE_INDEX  (0)
+#define TEST_REGION_SIZE  (256)
+#define TEST_RULE_COUNT   (64)
+#define TEST_ITERATIONS   (500)
+#define TEST_PASS_MOVES   (40)
+#define TEST_NO_RULE      (0)
+#define TEST_NO_FAILURE   (-1)
+
+/* Entry index + 1 of the rule at each offset */
+static uint32_t test_region[TEST_REGION_SIZE];
+static uint32_t test_expected_region[TEST_REGION_SIZE];
+static uint32_t test_block_moves;
+static int32_t  test_block_move_fail_at = TEST_NO_FAILURE;
+
+/* SDK call used by the move plan, the blocks may overlap */
+sx_status_t sx_api_acl_rule_block_move_set(_In_ const sx_api_handle_t      handle,
+                                           _In_ const sx_acl_region_id_t   region_id,
+                                           _In_ const sx_acl_rule_offset_t block_start,
+                                           _In_ const sx_acl_size_t        block_size,
+                                           _In_ const sx_acl_rule_offset_t new_block_start)
+{
+    uint32_t block[TEST_REGION_SIZE];
+
+    if ((int32_t)test_block_moves == test_block_move_fail_at) {
+        return SX_STATUS_ERROR;
+    }
+
+    ASSERT_TRUE(block_start + block_size <= TEST_REGION_SIZE, "");
+    ASSERT_TRUE(new_block_start + block_size <= TEST_REGION_SIZE, "");
+
+    memcpy(block, &test_region[block_start], block_size * sizeof(block[0]));
+    memset(&test_region[block_start], 0, block_size * sizeof(block[0]));
+    memcpy(&test_region[new_block_start], block, block_size * sizeof(block[0]));
+    test_block_moves++;
+
+    return SX_STATUS_SUCCESS;
+}
+
+static void test_acl_db_init(void)
+{
+    g_sai_acl_db_ptr = calloc(1, sizeof(*g_sai_acl_db_ptr));
+    ASSERT_TRUE(g_sai_acl_db_ptr, "");
+
+    sai_acl_db->acl_table_db = calloc(ACL_TABLE_DB_SIZE, sizeof(*sai_acl_db->acl_table_db));
+    sai_acl_db->acl_entry_db = calloc(TEST_RULE_COUNT, sizeof(*sai_acl_db->acl_entry_db));
+    acl_rule_move_plans      = calloc(ACL_TABLE_DB_SIZE, sizeof(*acl_rule_move_plans));
+    ASSERT_TRUE(sai_acl_db->acl_table_db && sai_acl_db->acl_entry_db && acl_rule_move_plans, "");
+
+    ASSERT_TRUE(0 == pthread_key_create(&pthread_sx_handle_key, NULL), "");
+
+    acl_db_table(TEST_TABLE_INDEX).region_size = TEST_REGION_SIZE;
+}
+
+static void test_acl_db_deinit(void)
+{
+    mlnx_acl_rule_move_plans_free();
+    pthread_key_delete(pthread_sx_handle_key);
+    free(sai_acl_db->acl_entry_db);
+    free(sai_acl_db->acl_table_db);
+    free(g_sai_acl_db_ptr);
+    g_sai_acl_db_ptr = NULL;
+}
+
+static void test_rules_place(_In_ uint32_t count, _In_ const sx_acl_rule_offset_t *offsets)
+{
+    uint32_t ii;
+
+    memset(test_region, 0, sizeof(test_region));
+
+    for (ii = 0; ii < count; ii++) {
+        ASSERT_TRUE(TEST_NO_RULE == test_region[offsets[ii]], "");
+        test_region[offsets[ii]] = ii + 1;
+        acl_db_entry(ii).offset  = offsets[ii];
+    }
+
+    memcpy(test_expected_region, test_region, sizeof(test_region));
+}
+
+/* A pSort shift notification, the move is also applied to the expected region */
+static sai_status_t test_rule_shift(_In_ uint32_t acl_entry_index, _In_ uint32_t old_offset, _In_ uint32_t new_offset)
+{
+    psort_shift_param_t shift_param;
+
+    ASSERT_TRUE(test_expected_region[old_offset] == acl_entry_index + 1, "");
+    ASSERT_TRUE(TEST_NO_RULE == test_expected_region[new_offset], "");
+
+    test_expected_region[new_offset] = test_expected_region[old_offset];
+    test_expected_region[old_offset] = TEST_NO_RULE;
+
+    memset(&shift_param, 0, sizeof(shift_param));
+    shift_param.key       = acl_entry_index;
+    shift_param.old_index = old_offset;
+    shift_param.new_index = new_offset;
+
+    return mlnx_acl_sx_rule_offset_update(&shift_param, TEST_TABLE_INDEX);
+}
+
+/* ACL DB must describe the region in SDK, also after a failure */
+static void test_rules_check(_In_ uint32_t count)
+{
+    uint32_t ii, rules = 0;
+
+    for (ii = 0; ii < count; ii++) {
+        ASSERT_TRUE(test_region[acl_db_entry(ii).offset] == ii + 1, "entry %u at %u", ii, acl_db_entry(ii).offset);
+    }
+
+    for (ii = 0; ii < TEST_REGION_SIZE; ii++) {
+        rules += (TEST_NO_RULE != test_region[ii]);
+    }
+
+    ASSERT_TRUE(rules == count, "%u rules in the region, expected %u", rules, count);
+}
+
+/* pSort makes room for a rule: 15..19 go up by one, then 10..14 go down by two */
+static void test_move_plan_shift(_In_ int32_t fail_at)
+{
+    mlnx_acl_psort_move_stats_t stats_before, stats_after;
+    sx_acl_rule_offset_t        offsets[10];
+    sai_status_t                status;
+    uint32_t                    ii;
+
+    for (ii = 0; ii < 10; ii++) {
+        offsets[ii] = 10 + ii;
+    }
+    test_rules_place(10, offsets);
+    test_block_moves        = 0;
+    test_block_move_fail_at = fail_at;
+    mlnx_acl_psort_move_stats_get(&stats_before);
+
+    mlnx_acl_rule_move_plan_begin(TEST_TABLE_INDEX);
+    for (ii = 10; ii > 5; ii--) {
+        ASSERT_TRUE(SAI_STATUS_SUCCESS == test_rule_shift(ii - 1, 9 + ii, 10 + ii), "");
+    }
+    for (ii = 0; ii < 5; ii++) {
+        ASSERT_TRUE(SAI_STATUS_SUCCESS == test_rule_shift(ii, 10 + ii, 8 + ii), "");
+    }
+    ASSERT_TRUE(0 == test_block_moves, "moves are applied before commit");
+
+    status = mlnx_acl_rule_move_plan_commit(TEST_TABLE_INDEX);
+    mlnx_acl_psort_move_stats_get(&stats_after);
+    test_block_move_fail_at = TEST_NO_FAILURE;
+
+    test_rules_check(10);
+    ASSERT_TRUE(!mlnx_acl_rule_move_plan_is_active(TEST_TABLE_INDEX), "");
+
+    if ((TEST_NO_FAILURE != fail_at) && (fail_at < 2)) {
+        ASSERT_TRUE(SAI_ERR(status), "fail at %d", fail_at);
+        return;
+    }
+
+    ASSERT_TRUE(SAI_STATUS_SUCCESS == status, "");
+    ASSERT_TRUE(2 == test_block_moves, "%u block moves", test_block_moves);
+    ASSERT_TRUE(!memcmp(test_region, test_expected_region, sizeof(test_region)), "");
+    ASSERT_TRUE(stats_after.passes == stats_before.passes + 1, "");
+    ASSERT_TRUE(stats_after.rules_moved == stats_before.rules_moved + 10, "");
+    ASSERT_TRUE(stats_after.block_moves == stats_before.block_moves + 2, "");
+}
+
+/* A shift without a plan is applied at once */
+static void test_move_plan_inactive(void)
+{
+    sx_acl_rule_offset_t offset = 5;
+
+    test_rules_place(1, &offset);
+    test_block_moves = 0;
+
+    ASSERT_TRUE(SAI_STATUS_SUCCESS == test_rule_shift(0, 5, 6), "");
+    ASSERT_TRUE(1 == test_block_moves, "");
+    ASSERT_TRUE(SAI_STATUS_SUCCESS == mlnx_acl_rule_move_plan_commit(TEST_TABLE_INDEX), "");
+    ASSERT_TRUE(1 == test_block_moves, "");
+    test_rules_check(1);
+}
+
+/* Shifts a run of rules that ends at offset by delta, the way pSort does it */
+static void test_rule_run_shift(_In_ uint32_t offset, _In_ int32_t delta, _In_ uint32_t max_len)
+{
+    uint32_t len, ii, from;
+
+    for (len = 0; len < max_len; len++) {
+        from = (delta > 0) ? offset - len : offset + len;
+        if ((from >= TEST_REGION_SIZE) || (TEST_NO_RULE == test_expected_region[from])) {
+            break;
+        }
+    }
+
+    for (ii = 0; ii < len; ii++) {
+        from = (delta > 0) ? offset - ii : offset + ii;
+        if ((int32_t)from + delta < 0 || (int32_t)from + delta >= TEST_REGION_SIZE ||
+            (TEST_NO_RULE != test_expected_region[from + delta])) {
+            return;
+        }
+
+        ASSERT_TRUE(SAI_STATUS_SUCCESS == test_rule_shift(test_expected_region[from] - 1, from, from + delta), "");
+    }
+}
+
+static void test_move_plan_random(void)
+{
+    sx_acl_rule_offset_t offsets[TEST_RULE_COUNT];
+    uint32_t             iter, ii, jj, offset, moves;
+    int32_t              delta;
+
+    srand(1);
+
+    for (ii = 0; ii < TEST_RULE_COUNT; ii++) {
+        do {
+            offsets[ii] = rand() % TEST_REGION_SIZE;
+            for (jj = 0; jj < ii && offsets[jj] != offsets[ii]; jj++) {
+            }
+        } while (jj < ii);
+    }
+    test_rules_place(TEST_RULE_COUNT, offsets);
+
+    for (iter = 0; iter < TEST_ITERATIONS; iter++) {
+        mlnx_acl_rule_move_plan_begin(TEST_TABLE_INDEX);
+        test_block_moves = 0;
+        moves            = acl_psort_move_stats.rules_moved;
+
+        for (ii = 0; ii < TEST_PASS_MOVES; ii++) {
+            offset = rand() % TEST_REGION_SIZE;
+            if (TEST_NO_RULE == test_expected_region[offset]) {
+                continue;
+            }
+
+            delta = (rand() % 7) - 3;
+            if (0 == delta) {
+                /* a single rule to a free offset anywhere in the region */
+                jj = rand() % TEST_REGION_SIZE;
+                if (TEST_NO_RULE == test_expected_region[jj]) {
+                    ASSERT_TRUE(SAI_STATUS_SUCCESS == test_rule_shift(test_expected_region[offset] - 1, offset, jj),
+                                "");
+                }
+                continue;
+            }
+
+            test_rule_run_shift(offset, delta, 1 + rand() % 8);
+        }
+
+        ASSERT_TRUE(SAI_STATUS_SUCCESS == mlnx_acl_rule_move_plan_commit(TEST_TABLE_INDEX), "iteration %u", iter);
+        moves = (uint32_t)acl_psort_move_stats.rules_moved - moves;
+
+        ASSERT_TRUE(!memcmp(test_region, test_expected_region, sizeof(test_region)), "iteration %u", iter);
+        ASSERT_TRUE(test_block_moves <= moves, "iteration %u: %u block moves for %u rules", iter, test_block_moves,
+                    moves);
+        test_rules_check(TEST_RULE_COUNT);
+    }
+}
+
+int main(void)
+{
+    int32_t fail_at;
+
+    test_acl_db_init();
+
+    test_move_plan_inactive();
+    test_move_plan_shift(TEST_NO_FAILURE);
+    for (fail_at = 0; fail_at < 3; fail_at++) {
+        test_move_plan_shift(fail_at);
+    }
+    test_move_plan_random();
+
+    test_acl_db_deinit();
+
+    printf("mlnx_sai_acl_test: passed\n");
+
+    return 0;
+}
@@ -226,6 +226,345 @@ static void mlnx_bmtor_fx_data_deinit(_In_ const fx_key_list_t *key_list, _In_ c
     }
 }
 
+/* Rule data of one flex table entry, the key and param lists point to the entry own storage */
+typedef struct _mlnx_bmtor_fx_entry_t {
+    fx_action_id_t       action;
+    sx_acl_rule_offset_t offset;
+    fx_key_t             keys[MLNX_FX_KEY_LIST_MAX_LEN];
+    fx_param_t           params[MLNX_FX_PARAMS_LIST_MAX_LEN];
+    uint8_t              key_data[MLNX_FX_KEY_LIST_MAX_LEN][MLNX_FX_BYTE_ARRAY_MAX_LEN];
+    uint8_t              mask_data[MLNX_FX_KEY_LIST_MAX_LEN][MLNX_FX_BYTE_ARRAY_MAX_LEN];
+    uint8_t              param_data[MLNX_FX_PARAMS_LIST_MAX_LEN][MLNX_FX_BYTE_ARRAY_MAX_LEN];
+    fx_key_list_t        key_list;
+    fx_param_list_t      param_list;
+} mlnx_bmtor_fx_entry_t;
+
+typedef sai_status_t (*mlnx_bmtor_fx_entry_parse_fn)(_In_ uint32_t               attr_count,
+                                                     _In_ const sai_attribute_t *attr_list,
+                                                     _Out_ mlnx_bmtor_fx_entry_t *entry);
+typedef void (*mlnx_bmtor_entry_key_to_str_fn)(_In_ sai_object_id_t entry_id, _Out_ char *key_str);
+
+static void mlnx_bmtor_fx_entry_init(_Out_ mlnx_bmtor_fx_entry_t *entry)
+{
+    assert(entry);
+
+    memset(entry, 0, sizeof(*entry));
+
+    entry->action            = FX_ACTION_INVALID_ID;
+    entry->key_list.keys     = entry->keys;
+    entry->param_list.params = entry->params;
+}
+
+static void mlnx_bmtor_fx_entry_key_add(_Inout_ mlnx_bmtor_fx_entry_t *entry,
+                                        _In_ const void              *key,
+                                        _In_ const void              *mask,
+                                        _In_ size_t                   len)
+{
+    size_t idx = entry->key_list.len;
+
+    assert(idx < MLNX_FX_KEY_LIST_MAX_LEN);
+    assert(len <= MLNX_FX_BYTE_ARRAY_MAX_LEN);
+
+    memcpy(entry->key_data[idx], key, len);
+    entry->keys[idx].key.data = entry->key_data[idx];
+    entry->keys[idx].key.len  = len;
+
+    if (mask) {
+        memcpy(entry->mask_data[idx], mask, len);
+        entry->keys[idx].mask.data = entry->mask_data[idx];
+        entry->keys[idx].mask.len  = len;
+    }
+
+    entry->key_list.len++;
+}
+
+static void mlnx_bmtor_fx_entry_param_add(_Inout_ mlnx_bmtor_fx_entry_t *entry,
+                                          _In_ const void              *param,
+                                          _In_ size_t                   len)
+{
+    size_t idx = entry->param_list.len;
+
+    assert(idx < MLNX_FX_PARAMS_LIST_MAX_LEN);
+    assert(len <= MLNX_FX_BYTE_ARRAY_MAX_LEN);
+
+    memcpy(entry->param_data[idx], param, len);
+    entry->params[idx].data = entry->param_data[idx];
+    entry->params[idx].len  = len;
+
+    entry->param_list.len++;
+}
+
+/*
+ * Creates entries of one flex table. The attributes are parsed under the DB lock and all the
+ * parsed entries are written with a single multi-rule SDK call.
+ * In stop on error mode the entries after the first one that fails are not executed: parsing stops
+ * at the first parse failure, and entries that the SDK wrote after the first write failure are
+ * removed again.
+ */
+static sai_status_t mlnx_bmtor_fx_entries_create(_In_ sai_object_type_t              object_type,
+                                                 _In_ fx_table_id_t                  table_id,
+                                                 _In_ mlnx_bmtor_fx_entry_parse_fn   parse_fn,
+                                                 _In_ mlnx_bmtor_entry_key_to_str_fn key_to_str_fn,
+                                                 _In_ uint32_t                       object_count,
+                                                 _In_ const uint32_t                *attr_count,
+                                                 _In_ const sai_attribute_t        **attr_list,
+                                                 _In_ sai_bulk_op_error_mode_t       mode,
+                                                 _Out_ sai_object_id_t              *object_id,
+                                                 _Out_ sai_status_t                 *object_statuses)
+{
+    sai_status_t           status;
+    sx_status_t            sx_status;
+    mlnx_bmtor_fx_entry_t *entries       = NULL;
+    fx_action_id_t        *actions       = NULL;
+    fx_key_list_t         *key_lists     = NULL;
+    fx_param_list_t       *param_lists   = NULL;
+    sx_acl_rule_offset_t  *offsets       = NULL;
+    sx_status_t           *sx_statuses   = NULL;
+    uint32_t              *entry_objects = NULL;
+    uint32_t               ii, jj, entry_count = 0, failed_idx;
+    bool                   stop_on_error, failure = false;
+    char                   key_str[MAX_KEY_STR_LEN];
+
+    SX_LOG_ENTER();
+
+    status =
+        mlnx_bulk_create_attrs_validate(object_count, attr_count, attr_list, mode, object_statuses, &stop_on_error);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    entries       = calloc(object_count, sizeof(*entries));
+    actions       = calloc(object_count, sizeof(*actions));
+    key_lists     = calloc(object_count, sizeof(*key_lists));
+    param_lists   = calloc(object_count, sizeof(*param_lists));
+    offsets       = calloc(object_count, sizeof(*offsets));
+    sx_statuses   = calloc(object_count, sizeof(*sx_statuses));
+    entry_objects = calloc(object_count, sizeof(*entry_objects));
+    if (!entries || !actions || !key_lists || !param_lists || !offsets || !sx_statuses || !entry_objects) {
+        SX_LOG_ERR("Failed to allocate memory\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out_free;
+    }
+
+    sai_db_write_lock();
+
+    /* Lazy initialization */
+    status = sai_fx_initialize();
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Failure in call to sai_fx_initialize\n");
+        for (ii = 0; ii < object_count; ii++) {
+            object_statuses[ii] = status;
+        }
+        goto out;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        object_id[ii] = SAI_NULL_OBJECT_ID;
+
+        if (failure && stop_on_error) {
+            object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        mlnx_bmtor_fx_entry_init(&entries[entry_count]);
+
+        object_statuses[ii] = parse_fn(attr_count[ii], attr_list[ii], &entries[entry_count]);
+        if (SAI_ERR(object_statuses[ii])) {
+            failure = true;
+            continue;
+        }
+
+        actions[entry_count]       = entries[entry_count].action;
+        key_lists[entry_count]     = entries[entry_count].key_list;
+        param_lists[entry_count]   = entries[entry_count].param_list;
+        offsets[entry_count]       = entries[entry_count].offset;
+        sx_statuses[entry_count]   = SX_STATUS_ERROR;
+        entry_objects[entry_count] = ii;
+        entry_count++;
+    }
+
+    if (entry_count > 0) {
+        sx_status = fx_table_entries_add(g_fx_handle, table_id, entry_count, actions, key_lists, param_lists,
+                                         offsets, sx_statuses);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failure in insertion of %u %s - %s\n", entry_count, SAI_TYPE_STR(object_type),
+                       SX_STATUS_MSG(sx_status));
+        }
+    }
+
+    /* Entries parsed after a parse failure are not in the batch, so only write failures are tracked here */
+    failed_idx = object_count;
+
+    for (jj = 0; jj < entry_count; jj++) {
+        ii = entry_objects[jj];
+
+        if (stop_on_error && (ii > failed_idx)) {
+            if (!SX_ERR(sx_statuses[jj])) {
+                fx_table_entry_remove(g_fx_handle, table_id, offsets[jj]);
+            }
+            object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        if (SX_ERR(sx_statuses[jj])) {
+            SX_LOG_ERR("Failure in insertion of %s %u\n", SAI_TYPE_STR(object_type), ii);
+            object_statuses[ii] = SAI_STATUS_FAILURE;
+            failure             = true;
+            failed_idx          = MIN(failed_idx, ii);
+            continue;
+        }
+
+        object_statuses[ii] = mlnx_create_object(object_type, offsets[jj], NULL, &object_id[ii]);
+        if (SAI_ERR(object_statuses[ii])) {
+            fx_table_entry_remove(g_fx_handle, table_id, offsets[jj]);
+            failure    = true;
+            failed_idx = MIN(failed_idx, ii);
+            continue;
+        }
+
+        key_to_str_fn(object_id[ii], key_str);
+        SX_LOG_NTC("Created %s\n", key_str);
+    }
+
+    status = failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+
+out:
+    sai_db_unlock();
+
+    mlnx_bulk_statuses_print(SAI_TYPE_STR(object_type), object_statuses, object_count, SAI_COMMON_API_BULK_CREATE);
+
+out_free:
+    free(entry_objects);
+    free(sx_statuses);
+    free(offsets);
+    free(param_lists);
+    free(key_lists);
+    free(actions);
+    free(entries);
+    SX_LOG_EXIT();
+    return status;
+}
+
+/*
+ * Removes entries of one flex table with a single multi-rule SDK call.
+ * In stop on error mode the entries after the first invalid object id are not executed.
+ */
+static sai_status_t mlnx_bmtor_fx_entries_remove(_In_ sai_object_type_t              object_type,
+                                                 _In_ fx_table_id_t                  table_id,
+                                                 _In_ mlnx_bmtor_entry_key_to_str_fn key_to_str_fn,
+                                                 _In_ bool                           check_pipe,
+                                                 _In_ uint32_t                       object_count,
+                                                 _In_ const sai_object_id_t         *object_id,
+                                                 _In_ sai_bulk_op_error_mode_t       mode,
+                                                 _Out_ sai_status_t                 *object_statuses)
+{
+    sai_status_t          status, pipe_status;
+    sx_status_t           sx_status;
+    sx_acl_rule_offset_t *offsets       = NULL;
+    sx_status_t          *sx_statuses   = NULL;
+    uint32_t             *entry_objects = NULL;
+    uint32_t              ii, jj, offset, entry_count = 0, removed_count = 0;
+    bool                  stop_on_error, failure = false;
+    char                  key_str[MAX_KEY_STR_LEN];
+
+    SX_LOG_ENTER();
+
+    status = mlnx_bulk_remove_attrs_validate(object_count, mode, object_statuses, &stop_on_error);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    offsets       = calloc(object_count, sizeof(*offsets));
+    sx_statuses   = calloc(object_count, sizeof(*sx_statuses));
+    entry_objects = calloc(object_count, sizeof(*entry_objects));
+    if (!offsets || !sx_statuses || !entry_objects) {
+        SX_LOG_ERR("Failed to allocate memory\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out_free;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        if (failure && stop_on_error) {
+            object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        key_to_str_fn(object_id[ii], key_str);
+        SX_LOG_NTC("Remove %s\n", key_str);
+
+        object_statuses[ii] = mlnx_object_to_type(object_id[ii], object_type, &offset, NULL);
+        if (SAI_ERR(object_statuses[ii])) {
+            SX_LOG_ERR("Failure in extracting offset from %s object id 0x%" PRIx64 "\n", SAI_TYPE_STR(object_type),
+                       object_id[ii]);
+            failure = true;
+            continue;
+        }
+
+        offsets[entry_count]       = (sx_acl_rule_offset_t)offset;
+        sx_statuses[entry_count]   = SX_STATUS_ERROR;
+        entry_objects[entry_count] = ii;
+        entry_count++;
+    }
+
+    sai_db_write_lock();
+
+    if (entry_count > 0) {
+        sx_status = fx_table_entries_remove(g_fx_handle, table_id, entry_count, offsets, sx_statuses);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failure in removal of %u %s - %s\n", entry_count, SAI_TYPE_STR(object_type),
+                       SX_STATUS_MSG(sx_status));
+        }
+    }
+
+    for (jj = 0; jj < entry_count; jj++) {
+        ii = entry_objects[jj];
+
+        if (SX_ERR(sx_statuses[jj])) {
+            SX_LOG_ERR("Failure in removal of %s at offset %d\n", SAI_TYPE_STR(object_type), offsets[jj]);
+            object_statuses[ii] = SAI_STATUS_FAILURE;
+            failure             = true;
+            continue;
+        }
+
+        object_statuses[ii] = SAI_STATUS_SUCCESS;
+        removed_count++;
+    }
+
+    status = failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+
+    if (check_pipe && (removed_count > 0)) {
+        pipe_status = mlnx_bmtor_check_pipe_needed();
+        if (SAI_ERR(pipe_status)) {
+            status = pipe_status;
+        }
+    }
+
+    sai_db_unlock();
+
+    mlnx_bulk_statuses_print(SAI_TYPE_STR(object_type), object_statuses, object_count, SAI_COMMON_API_BULK_REMOVE);
+
+out_free:
+    free(entry_objects);
+    free(sx_statuses);
+    free(offsets);
+    SX_LOG_EXIT();
+    return status;
+}
+
 static sai_status_t mlnx_bmtor_fx_entry_to_classf_entry_attr(
     _In_ const fx_key_list_t                             *fx_key_list,
     _In_ const fx_param_list_t                           *fx_param_list,
@@ -378,40 +717,22 @@ out:
     return status;
 }
 
-sai_status_t mlnx_create_table_bitmap_classification_entry(_Out_ sai_object_id_t      *entry_id,
-                                                           _In_ sai_object_id_t        switch_id,
-                                                           _In_ uint32_t               attr_count,
-                                                           _In_ const sai_attribute_t *attr_list)
+static sai_status_t mlnx_bmtor_classf_entry_parse(_In_ uint32_t               attr_count,
+                                                  _In_ const sai_attribute_t *attr_list,
+                                                  _Out_ mlnx_bmtor_fx_entry_t *entry)
 {
     sai_status_t                 sai_status;
     uint32_t                     attr_idx;
     const sai_attribute_value_t *attr;
-    fx_key_t                     bitmap_classification_keys[1];
-    fx_param_t                   bitmap_classification_params[1];
-    fx_key_list_t                bitmap_classification_key_list;
-    fx_param_list_t              bitmap_classification_param_list;
-    int                          keys_idx                       = 0;
-    int                          params_idx                     = 0;
-    fx_action_id_t               flextrum_action                = FX_ACTION_INVALID_ID;
-    sx_acl_rule_offset_t         bitmap_classification_priority = 0;
     sx_router_interface_t        bitmap_classification_router_interface_key;
     uint32_t                     bitmap_classification_in_rif_metadata;
     char                         list_str[MAX_LIST_VALUE_STR_LEN];
-    char                         key_str[MAX_KEY_STR_LEN];
-
-    SX_LOG_ENTER();
-
-    if (NULL == entry_id) {
-        SX_LOG_ERR("NULL entry id param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
 
     if (SAI_STATUS_SUCCESS !=
         (sai_status =
              check_attribs_metadata(attr_count, attr_list, SAI_OBJECT_TYPE_TABLE_BITMAP_CLASSIFICATION_ENTRY,
                                     table_bitmap_classification_entry_vendor_attribs, SAI_COMMON_API_CREATE))) {
         SX_LOG_ERR("Failed attribs check\n");
-        SX_LOG_EXIT();
         return sai_status;
     }
 
@@ -428,20 +749,11 @@ sai_status_t mlnx_create_table_bitmap_classification_entry(_Out_ sai_object_id_t
                                      &attr,
                                      &attr_idx);
     assert(SAI_STATUS_SUCCESS == sai_status);
-    sai_status = get_bitmap_classification_fx_action(attr->s32, &flextrum_action, attr_idx);
+    sai_status = get_bitmap_classification_fx_action(attr->s32, &entry->action, attr_idx);
     if (SAI_ERR(sai_status)) {
-        SX_LOG_EXIT();
         return sai_status;
     }
 
-    sai_db_write_lock();
-
-    /* Lazy initialization */
-    if (SAI_STATUS_SUCCESS != (sai_status = sai_fx_initialize())) {
-        SX_LOG_ERR("Failure in call to sai_fx_initialize\n");
-        goto out;
-    }
-
     sai_status = find_attrib_in_list(attr_count,
                                      attr_list,
                                      SAI_TABLE_BITMAP_CLASSIFICATION_ENTRY_ATTR_ROUTER_INTERFACE_KEY,
@@ -451,91 +763,123 @@ sai_status_t mlnx_create_table_bitmap_classification_entry(_Out_ sai_object_id_t
     if (SAI_STATUS_SUCCESS !=
         (sai_status = mlnx_rif_oid_to_sdk_rif_id(attr->oid, &bitmap_classification_router_interface_key))) {
         SX_LOG_ERR("Invalid bitmap classification entry rif\n");
-        sai_status = SAI_STATUS_INVALID_ATTR_VALUE_0 + attr_idx;
-        goto out;
+        return SAI_STATUS_INVALID_ATTR_VALUE_0 + attr_idx;
     }
-    bitmap_classification_keys[keys_idx].key.data = (uint8_t*)&bitmap_classification_router_interface_key;
-    bitmap_classification_keys[keys_idx].key.len  = sizeof(bitmap_classification_router_interface_key);
-    keys_idx++;
+    mlnx_bmtor_fx_entry_key_add(entry, &bitmap_classification_router_interface_key, NULL,
+                                sizeof(bitmap_classification_router_interface_key));
 
-    if (flextrum_action == CONTROL_IN_RIF_SET_METADATA_ID) {
+    if (entry->action == CONTROL_IN_RIF_SET_METADATA_ID) {
         sai_status = find_attrib_in_list(attr_count,
                                          attr_list,
                                          SAI_TABLE_BITMAP_CLASSIFICATION_ENTRY_ATTR_IN_RIF_METADATA,
                                          &attr,
                                          &attr_idx);
         assert(SAI_STATUS_SUCCESS == sai_status);
-        bitmap_classification_in_rif_metadata         = attr->u32;
-        bitmap_classification_params[params_idx].data = (uint8_t*)&bitmap_classification_in_rif_metadata;
-        bitmap_classification_params[params_idx].len  = sizeof(bitmap_classification_in_rif_metadata);
-        params_idx++;
-    }
-
-    bitmap_classification_key_list.len      = keys_idx;
-    bitmap_classification_param_list.len    = params_idx;
-    bitmap_classification_key_list.keys     = bitmap_classification_keys;
-    bitmap_classification_param_list.params = bitmap_classification_params;
-    if (fx_table_entry_add(g_fx_handle, CONTROL_IN_RIF_TABLE_BITMAP_CLASSIFICATION_ID, flextrum_action,
-                           bitmap_classification_key_list, bitmap_classification_param_list,
-                           &bitmap_classification_priority)) {
-        SX_LOG_ERR("Failure in insertion of bitmap_classification entry %u\n", flextrum_action);
-        sai_status = SAI_STATUS_FAILURE;
-        goto out;
+        bitmap_classification_in_rif_metadata = attr->u32;
+        mlnx_bmtor_fx_entry_param_add(entry, &bitmap_classification_in_rif_metadata,
+                                      sizeof(bitmap_classification_in_rif_metadata));
     }
-    if (SAI_STATUS_SUCCESS !=
-        (sai_status =
-             mlnx_create_object(SAI_OBJECT_TYPE_TABLE_BITMAP_CLASSIFICATION_ENTRY, bitmap_classification_priority,
-                                NULL,
-                                entry_id))) {
-        goto out;
-    }
-
-    table_bitmap_classification_entry_key_to_str(*entry_id, key_str);
-    SX_LOG_NTC("Created table bitmap classification entry %s\n", key_str);
 
-out:
-    sai_db_unlock();
-    SX_LOG_EXIT();
-    return sai_status;
+    return SAI_STATUS_SUCCESS;
 }
 
-sai_status_t mlnx_remove_table_bitmap_classification_entry(_In_ sai_object_id_t entry_id)
+sai_status_t mlnx_create_table_bitmap_classification_entry(_Out_ sai_object_id_t      *entry_id,
+                                                           _In_ sai_object_id_t        switch_id,
+                                                           _In_ uint32_t               attr_count,
+                                                           _In_ const sai_attribute_t *attr_list)
 {
-    sai_status_t status;
-    uint32_t     bitmap_classification_offset;
-    char         key_str[MAX_KEY_STR_LEN];
+    sai_status_t status, object_status;
 
-    table_bitmap_classification_entry_key_to_str(entry_id, key_str);
-    SX_LOG_NTC("Remove table bitmap classification entry %s\n", key_str);
+    if (NULL == entry_id) {
+        SX_LOG_ERR("NULL entry id param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             mlnx_object_to_type(entry_id, SAI_OBJECT_TYPE_TABLE_BITMAP_CLASSIFICATION_ENTRY,
-                                 &bitmap_classification_offset,
-                                 NULL))) {
-        SX_LOG_ERR("Failure in extracting offset from bitmap_classification entry object id 0x%lx " PRIx64 "\n",
-                   entry_id);
-        return status;
+    status = mlnx_create_table_bitmap_classification_entries(switch_id, 1, &attr_count, &attr_list,
+                                                             SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, entry_id,
+                                                             &object_status);
+    if (SAI_ERR(status)) {
+        return SAI_STATUS_FAILURE == status ? object_status : status;
     }
 
-    sai_db_write_lock();
+    return SAI_STATUS_SUCCESS;
+}
 
-    if (fx_table_entry_remove(g_fx_handle, CONTROL_IN_RIF_TABLE_BITMAP_CLASSIFICATION_ID,
-                              bitmap_classification_offset)) {
-        SX_LOG_ERR("Failure in removal of table_bitmap_classification entry at offset %d\n",
-                   bitmap_classification_offset);
-        status = SAI_STATUS_FAILURE;
-        goto out;
-    }
+sai_status_t mlnx_remove_table_bitmap_classification_entry(_In_ sai_object_id_t entry_id)
+{
+    sai_status_t status, object_status;
 
-    status = mlnx_bmtor_check_pipe_needed();
+    status = mlnx_remove_table_bitmap_classification_entries(1, &entry_id, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                                                             &object_status);
     if (SAI_ERR(status)) {
-        goto out;
+        return SAI_STATUS_FAILURE == status ? object_status : status;
     }
 
-out:
-    sai_db_unlock();
-    return status;
+    return SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Bulk table bitmap classification entries creation.
+ *
+ * The entries are written to the flex ACL region with one multi-rule SDK call.
+ *
+ * @param[in] switch_id SAI Switch object id
+ * @param[in] object_count Number of objects to create
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to create.
+ * @param[in] attr_list List of attributes for every object.
+ * @param[in] mode Bulk operation error handling mode.
+ *
+ * @param[out] object_id List of object ids returned
+ * @param[out] object_statuses List of status for every object. Caller needs to allocate the buffer.
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are created or #SAI_STATUS_FAILURE when
+ * any of the objects fails to create.
+ */
+sai_status_t mlnx_create_table_bitmap_classification_entries(_In_ sai_object_id_t          switch_id,
+                                                             _In_ uint32_t                 object_count,
+                                                             _In_ const uint32_t          *attr_count,
+                                                             _In_ const sai_attribute_t  **attr_list,
+                                                             _In_ sai_bulk_op_error_mode_t mode,
+                                                             _Out_ sai_object_id_t        *object_id,
+                                                             _Out_ sai_status_t           *object_statuses)
+{
+    return mlnx_bmtor_fx_entries_create(SAI_OBJECT_TYPE_TABLE_BITMAP_CLASSIFICATION_ENTRY,
+                                        CONTROL_IN_RIF_TABLE_BITMAP_CLASSIFICATION_ID,
+                                        mlnx_bmtor_classf_entry_parse,
+                                        table_bitmap_classification_entry_key_to_str,
+                                        object_count,
+                                        attr_count,
+                                        attr_list,
+                                        mode,
+                                        object_id,
+                                        object_statuses);
+}
+
+/**
+ * @brief Bulk table bitmap classification entries removal.
+ *
+ * @param[in] object_count Number of objects to remove
+ * @param[in] object_id List of object ids
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to allocate the buffer.
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or #SAI_STATUS_FAILURE when
+ * any of the objects fails to remove.
+ */
+sai_status_t mlnx_remove_table_bitmap_classification_entries(_In_ uint32_t                 object_count,
+                                                             _In_ const sai_object_id_t   *object_id,
+                                                             _In_ sai_bulk_op_error_mode_t mode,
+                                                             _Out_ sai_status_t           *object_statuses)
+{
+    return mlnx_bmtor_fx_entries_remove(SAI_OBJECT_TYPE_TABLE_BITMAP_CLASSIFICATION_ENTRY,
+                                        CONTROL_IN_RIF_TABLE_BITMAP_CLASSIFICATION_ID,
+                                        table_bitmap_classification_entry_key_to_str,
+                                        true,
+                                        object_count,
+                                        object_id,
+                                        mode,
+                                        object_statuses);
 }
 
 sai_status_t mlnx_set_table_bitmap_classification_entry_attribute(_In_ sai_object_id_t        entry_id,
@@ -981,24 +1325,14 @@ out:
     return status;
 }
 
-sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *entry_id,
-                                                   _In_ sai_object_id_t        switch_id,
-                                                   _In_ uint32_t               attr_count,
-                                                   _In_ const sai_attribute_t *attr_list)
+static sai_status_t mlnx_bmtor_router_entry_parse(_In_ uint32_t               attr_count,
+                                                  _In_ const sai_attribute_t *attr_list,
+                                                  _Out_ mlnx_bmtor_fx_entry_t *entry)
 {
     sai_status_t                 sai_status;
     uint32_t                     attr_idx;
     const sai_attribute_value_t *attr;
-    fx_key_t                     bitmap_router_keys[2];
-    fx_param_t                   bitmap_router_params[2];
-    fx_key_list_t                bitmap_router_key_list;
-    fx_param_list_t              bitmap_router_param_list;
-    int                          keys_idx        = 0;
-    int                          params_idx      = 0;
-    fx_action_id_t               flextrum_action = FX_ACTION_INVALID_ID;
     char                         list_str[MAX_LIST_VALUE_STR_LEN];
-    char                         key_str[MAX_KEY_STR_LEN];
-    sx_acl_rule_offset_t         bitmap_router_priority;
     uint32_t                     bitmap_router_in_rif_metadata_key, bitmap_router_in_rif_metadata_mask;
     uint32_t                     bitmap_router_dst_ip_key, bitmap_router_dst_ip_key_mask;
     sx_ecmp_id_t                 bitmap_router_next_hop;
@@ -1006,19 +1340,11 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
     sx_router_interface_t        bitmap_router_router_interface;
     sx_trap_id_t                 bitmap_router_trap_id;
 
-    SX_LOG_ENTER();
-
-    if (NULL == entry_id) {
-        SX_LOG_ERR("NULL entry id param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-
     if (SAI_STATUS_SUCCESS !=
         (sai_status =
              check_attribs_metadata(attr_count, attr_list, SAI_OBJECT_TYPE_TABLE_BITMAP_ROUTER_ENTRY,
                                     table_bitmap_router_entry_vendor_attribs, SAI_COMMON_API_CREATE))) {
         SX_LOG_ERR("Failed attribs check\n");
-        SX_LOG_EXIT();
         return sai_status;
     }
 
@@ -1032,7 +1358,7 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
     sai_status =
         find_attrib_in_list(attr_count, attr_list, SAI_TABLE_BITMAP_ROUTER_ENTRY_ATTR_ACTION, &attr, &attr_idx);
     assert(SAI_STATUS_SUCCESS == sai_status);
-    sai_status = get_bitmap_router_fx_action(attr->s32, &flextrum_action, attr_idx);
+    sai_status = get_bitmap_router_fx_action(attr->s32, &entry->action, attr_idx);
     if (SAI_ERR(sai_status)) {
         return sai_status;
     }
@@ -1043,7 +1369,7 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
                                      &attr,
                                      &attr_idx);
     assert(SAI_STATUS_SUCCESS == sai_status);
-    bitmap_router_priority = (sx_acl_rule_offset_t)attr->u32;
+    entry->offset = (sx_acl_rule_offset_t)attr->u32;
 
     sai_status = find_attrib_in_list(attr_count,
                                      attr_list,
@@ -1051,9 +1377,7 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
                                      &attr,
                                      &attr_idx);
     assert(SAI_STATUS_SUCCESS == sai_status);
-    bitmap_router_in_rif_metadata_key     = attr->u32;
-    bitmap_router_keys[keys_idx].key.data = (uint8_t*)&bitmap_router_in_rif_metadata_key;
-    bitmap_router_keys[keys_idx].key.len  = sizeof(bitmap_router_in_rif_metadata_key);
+    bitmap_router_in_rif_metadata_key = attr->u32;
 
     sai_status = find_attrib_in_list(attr_count,
                                      attr_list,
@@ -1061,10 +1385,9 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
                                      &attr,
                                      &attr_idx);
     assert(SAI_STATUS_SUCCESS == sai_status);
-    bitmap_router_in_rif_metadata_mask     = attr->u32;
-    bitmap_router_keys[keys_idx].mask.data = (uint8_t*)&bitmap_router_in_rif_metadata_mask;
-    bitmap_router_keys[keys_idx].mask.len  = sizeof(bitmap_router_in_rif_metadata_mask);
-    keys_idx++;
+    bitmap_router_in_rif_metadata_mask = attr->u32;
+    mlnx_bmtor_fx_entry_key_add(entry, &bitmap_router_in_rif_metadata_key, &bitmap_router_in_rif_metadata_mask,
+                                sizeof(bitmap_router_in_rif_metadata_key));
 
     sai_status = find_attrib_in_list(attr_count,
                                      attr_list,
@@ -1079,22 +1402,11 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
     memcpy(&bitmap_router_dst_ip_key, &attr->ipprefix.addr.ip4, sizeof(uint32_t));
     bitmap_router_dst_ip_key = htonl(bitmap_router_dst_ip_key);
     memcpy(&bitmap_router_dst_ip_key_mask, &attr->ipprefix.mask.ip4, sizeof(uint32_t));
-    bitmap_router_dst_ip_key_mask          = htonl(bitmap_router_dst_ip_key_mask);
-    bitmap_router_keys[keys_idx].key.data  = (uint8_t*)&bitmap_router_dst_ip_key;
-    bitmap_router_keys[keys_idx].key.len   = sizeof(bitmap_router_dst_ip_key);
-    bitmap_router_keys[keys_idx].mask.data = (uint8_t*)&bitmap_router_dst_ip_key_mask;
-    bitmap_router_keys[keys_idx].mask.len  = sizeof(bitmap_router_dst_ip_key_mask);
-    keys_idx++;
-
-    sai_db_write_lock();
+    bitmap_router_dst_ip_key_mask = htonl(bitmap_router_dst_ip_key_mask);
+    mlnx_bmtor_fx_entry_key_add(entry, &bitmap_router_dst_ip_key, &bitmap_router_dst_ip_key_mask,
+                                sizeof(bitmap_router_dst_ip_key));
 
-    /* Lazy initialization */
-    if (SAI_STATUS_SUCCESS != (sai_status = sai_fx_initialize())) {
-        SX_LOG_ERR("Failure in call to sai_fx_initialize\n");
-        goto out;
-    }
-
-    if (CONTROL_IN_RIF_TO_NEXTHOP_ID == flextrum_action) {
+    if (CONTROL_IN_RIF_TO_NEXTHOP_ID == entry->action) {
         sai_status = find_attrib_in_list(attr_count,
                                          attr_list,
                                          SAI_TABLE_BITMAP_ROUTER_ENTRY_ATTR_TUNNEL_INDEX,
@@ -1102,10 +1414,8 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
                                          &attr_idx);
         assert(SAI_STATUS_SUCCESS == sai_status);
 
-        bitmap_tunnel_index                   = attr->u16;
-        bitmap_router_params[params_idx].data = (uint8_t*)&bitmap_tunnel_index;
-        bitmap_router_params[params_idx].len  = sizeof(bitmap_tunnel_index);
-        params_idx++;
+        bitmap_tunnel_index = attr->u16;
+        mlnx_bmtor_fx_entry_param_add(entry, &bitmap_tunnel_index, sizeof(bitmap_tunnel_index));
 
         sai_status = find_attrib_in_list(attr_count,
                                          attr_list,
@@ -1117,13 +1427,10 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
             (sai_status =
                  mlnx_object_to_type(attr->oid, SAI_OBJECT_TYPE_NEXT_HOP, (uint32_t*)&bitmap_router_next_hop, NULL))) {
             SX_LOG_ERR("Invalid bitmap router entry next hop\n");
-            sai_status = SAI_STATUS_INVALID_ATTR_VALUE_0 + attr_idx;
-            goto out;
+            return SAI_STATUS_INVALID_ATTR_VALUE_0 + attr_idx;
         }
-        bitmap_router_params[params_idx].data = (uint8_t*)&bitmap_router_next_hop;
-        bitmap_router_params[params_idx].len  = sizeof(bitmap_router_next_hop);
-        params_idx++;
-    } else if (CONTROL_IN_RIF_TO_LOCAL_ID == flextrum_action) {
+        mlnx_bmtor_fx_entry_param_add(entry, &bitmap_router_next_hop, sizeof(bitmap_router_next_hop));
+    } else if (CONTROL_IN_RIF_TO_LOCAL_ID == entry->action) {
         sai_status = find_attrib_in_list(attr_count,
                                          attr_list,
                                          SAI_TABLE_BITMAP_ROUTER_ENTRY_ATTR_ROUTER_INTERFACE,
@@ -1133,13 +1440,10 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
         if (SAI_STATUS_SUCCESS !=
             (sai_status = mlnx_rif_oid_to_sdk_rif_id(attr->oid, &bitmap_router_router_interface))) {
             SX_LOG_ERR("Invalid bitmap router entry rif\n");
-            sai_status = SAI_STATUS_INVALID_ATTR_VALUE_0 + attr_idx;
-            goto out;
+            return SAI_STATUS_INVALID_ATTR_VALUE_0 + attr_idx;
         }
-        bitmap_router_params[params_idx].data = (uint8_t*)&bitmap_router_router_interface;
-        bitmap_router_params[params_idx].len  = sizeof(bitmap_router_router_interface);
-        params_idx++;
-    } else if (CONTROL_IN_RIF_TO_CPU_ID == flextrum_action) {
+        mlnx_bmtor_fx_entry_param_add(entry, &bitmap_router_router_interface, sizeof(bitmap_router_router_interface));
+    } else if (CONTROL_IN_RIF_TO_CPU_ID == entry->action) {
         sai_status = find_attrib_in_list(attr_count,
                                          attr_list,
                                          SAI_TABLE_BITMAP_ROUTER_ENTRY_ATTR_TRAP_ID,
@@ -1149,72 +1453,112 @@ sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *e
 
         sai_status = mlnx_translate_sai_trap_to_sdk(attr->oid, &bitmap_router_trap_id);
         if (SAI_ERR(sai_status)) {
-            goto out;
+            return sai_status;
         }
 
-        bitmap_router_params[params_idx].data = (uint8_t*)&bitmap_router_trap_id;
-        bitmap_router_params[params_idx].len  = sizeof(bitmap_router_trap_id);
-        params_idx++;
-    }
-
-    bitmap_router_key_list.len      = keys_idx;
-    bitmap_router_param_list.len    = params_idx;
-    bitmap_router_key_list.keys     = bitmap_router_keys;
-    bitmap_router_param_list.params = bitmap_router_params;
-    if (fx_table_entry_add(g_fx_handle, CONTROL_IN_RIF_TABLE_BITMAP_ROUTER_ID, flextrum_action, bitmap_router_key_list,
-                           bitmap_router_param_list, &bitmap_router_priority)) {
-        SX_LOG_ERR("Failure in insertion of bitmap_router entry\n");
-        sai_status = SAI_STATUS_FAILURE;
-        goto out;
-    }
-    if (SAI_STATUS_SUCCESS !=
-        (sai_status =
-             mlnx_create_object(SAI_OBJECT_TYPE_TABLE_BITMAP_ROUTER_ENTRY, bitmap_router_priority, NULL, entry_id))) {
-        goto out;
+        mlnx_bmtor_fx_entry_param_add(entry, &bitmap_router_trap_id, sizeof(bitmap_router_trap_id));
     }
 
-    table_bitmap_router_entry_key_to_str(*entry_id, key_str);
-    SX_LOG_NTC("Created table bitmap router entry %s\n", key_str);
-
-out:
-    sai_db_unlock();
-    SX_LOG_EXIT();
-    return sai_status;
+    return SAI_STATUS_SUCCESS;
 }
 
-sai_status_t mlnx_remove_table_bitmap_router_entry(_In_ sai_object_id_t entry_id)
+sai_status_t mlnx_create_table_bitmap_router_entry(_Out_ sai_object_id_t      *entry_id,
+                                                   _In_ sai_object_id_t        switch_id,
+                                                   _In_ uint32_t               attr_count,
+                                                   _In_ const sai_attribute_t *attr_list)
 {
-    sai_status_t status;
-    uint32_t     bitmap_router_offset;
-    char         key_str[MAX_KEY_STR_LEN];
+    sai_status_t status, object_status;
 
-    table_bitmap_router_entry_key_to_str(entry_id, key_str);
-    SX_LOG_NTC("Remove table bitmap router entry %s\n", key_str);
+    if (NULL == entry_id) {
+        SX_LOG_ERR("NULL entry id param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             mlnx_object_to_type(entry_id, SAI_OBJECT_TYPE_TABLE_BITMAP_ROUTER_ENTRY, &bitmap_router_offset, NULL))) {
-        SX_LOG_ERR("Failure in extracting offset from bitmap_router entry object id 0x%lx " PRIx64 "\n", entry_id);
-        return status;
+    status = mlnx_create_table_bitmap_router_entries(switch_id, 1, &attr_count, &attr_list,
+                                                     SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, entry_id, &object_status);
+    if (SAI_ERR(status)) {
+        return SAI_STATUS_FAILURE == status ? object_status : status;
     }
 
-    sai_db_write_lock();
+    return SAI_STATUS_SUCCESS;
+}
 
-    if (fx_table_entry_remove(g_fx_handle, CONTROL_IN_RIF_TABLE_BITMAP_ROUTER_ID, bitmap_router_offset)) {
-        SX_LOG_ERR("Failure in removal of table_bitmap_router entry at offset %d\n", bitmap_router_offset);
-        status = SAI_STATUS_FAILURE;
-        goto out;
-    }
+sai_status_t mlnx_remove_table_bitmap_router_entry(_In_ sai_object_id_t entry_id)
+{
+    sai_status_t status, object_status;
 
-    status = mlnx_bmtor_check_pipe_needed();
+    status = mlnx_remove_table_bitmap_router_entries(1, &entry_id, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                                                     &object_status);
     if (SAI_ERR(status)) {
-        goto out;
+        return SAI_STATUS_FAILURE == status ? object_status : status;
     }
 
-out:
-    sai_db_unlock();
-    SX_LOG_EXIT();
-    return status;
+    return SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Bulk table bitmap router entries creation.
+ *
+ * The entries are written to the flex ACL region with one multi-rule SDK call,
+ * the offset of every entry is its SAI_TABLE_BITMAP_ROUTER_ENTRY_ATTR_PRIORITY.
+ *
+ * @param[in] switch_id SAI Switch object id
+ * @param[in] object_count Number of objects to create
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to create.
+ * @param[in] attr_list List of attributes for every object.
+ * @param[in] mode Bulk operation error handling mode.
+ *
+ * @param[out] object_id List of object ids returned
+ * @param[out] object_statuses List of status for every object. Caller needs to allocate the buffer.
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are created or #SAI_STATUS_FAILURE when
+ * any of the objects fails to create.
+ */
+sai_status_t mlnx_create_table_bitmap_router_entries(_In_ sai_object_id_t          switch_id,
+                                                     _In_ uint32_t                 object_count,
+                                                     _In_ const uint32_t          *attr_count,
+                                                     _In_ const sai_attribute_t  **attr_list,
+                                                     _In_ sai_bulk_op_error_mode_t mode,
+                                                     _Out_ sai_object_id_t        *object_id,
+                                                     _Out_ sai_status_t           *object_statuses)
+{
+    return mlnx_bmtor_fx_entries_create(SAI_OBJECT_TYPE_TABLE_BITMAP_ROUTER_ENTRY,
+                                        CONTROL_IN_RIF_TABLE_BITMAP_ROUTER_ID,
+                                        mlnx_bmtor_router_entry_parse,
+                                        table_bitmap_router_entry_key_to_str,
+                                        object_count,
+                                        attr_count,
+                                        attr_list,
+                                        mode,
+                                        object_id,
+                                        object_statuses);
+}
+
+/**
+ * @brief Bulk table bitmap router entries removal.
+ *
+ * @param[in] object_count Number of objects to remove
+ * @param[in] object_id List of object ids
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to allocate the buffer.
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or #SAI_STATUS_FAILURE when
+ * any of the objects fails to remove.
+ */
+sai_status_t mlnx_remove_table_bitmap_router_entries(_In_ uint32_t                 object_count,
+                                                     _In_ const sai_object_id_t   *object_id,
+                                                     _In_ sai_bulk_op_error_mode_t mode,
+                                                     _Out_ sai_status_t           *object_statuses)
+{
+    return mlnx_bmtor_fx_entries_remove(SAI_OBJECT_TYPE_TABLE_BITMAP_ROUTER_ENTRY,
+                                        CONTROL_IN_RIF_TABLE_BITMAP_ROUTER_ID,
+                                        table_bitmap_router_entry_key_to_str,
+                                        true,
+                                        object_count,
+                                        object_id,
+                                        mode,
+                                        object_statuses);
 }
 
 sai_status_t mlnx_set_table_bitmap_router_entry_attribute(_In_ sai_object_id_t        entry_id,
@@ -1773,40 +2117,23 @@ static sai_status_t get_meta_tunnel_fx_action(_In_ sai_table_meta_tunnel_entry_a
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_create_table_meta_tunnel_entry(_Out_ sai_object_id_t      *entry_id,
-                                                        _In_ sai_object_id_t        switch_id,
-                                                        _In_ uint32_t               attr_count,
-                                                        _In_ const sai_attribute_t *attr_list)
+static sai_status_t mlnx_bmtor_meta_tunnel_entry_parse(_In_ uint32_t               attr_count,
+                                                       _In_ const sai_attribute_t *attr_list,
+                                                       _Out_ mlnx_bmtor_fx_entry_t *entry)
 {
     sai_status_t                 sai_status;
     const sai_attribute_value_t *attr = NULL;
     uint32_t                     attr_idx;
-    fx_key_t                     meta_tunnel_keys[1];
-    fx_param_t                   meta_tunnel_params[2];
-    fx_key_list_t                meta_tunnel_key_list;
-    fx_param_list_t              meta_tunnel_param_list;
-    fx_action_id_t               flextrum_action = FX_ACTION_INVALID_ID;
     sai_ip4_t                    meta_tunnel_underlay_dip;
     uint16_t                     meta_tunnel_metadata_key;
     sx_tunnel_id_t               meta_tunnel_tunnel_id;
-    sx_acl_rule_offset_t         meta_tunnel_priority = 0;
-    size_t                       keys_idx             = 0, params_idx = 0;
     char                         list_str[MAX_LIST_VALUE_STR_LEN];
-    char                         key_str[MAX_KEY_STR_LEN];
-
-    SX_LOG_ENTER();
-
-    if (NULL == entry_id) {
-        SX_LOG_ERR("NULL entry id param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
 
     if (SAI_STATUS_SUCCESS !=
         (sai_status =
              check_attribs_metadata(attr_count, attr_list, SAI_OBJECT_TYPE_TABLE_META_TUNNEL_ENTRY,
                                     table_bitmap_router_entry_vendor_attribs, SAI_COMMON_API_CREATE))) {
         SX_LOG_ERR("Failed attribs check\n");
-        SX_LOG_EXIT();
         return sai_status;
     }
 
@@ -1817,15 +2144,11 @@ static sai_status_t mlnx_create_table_meta_tunnel_entry(_Out_ sai_object_id_t
                          list_str);
     SX_LOG_NTC("Create table L3 VXLAN entry, %s\n", list_str);
 
-    meta_tunnel_key_list.keys     = meta_tunnel_keys;
-    meta_tunnel_param_list.params = meta_tunnel_params;
-
     sai_status = find_attrib_in_list(attr_count, attr_list, SAI_TABLE_META_TUNNEL_ENTRY_ATTR_ACTION, &attr, &attr_idx);
     assert(sai_status == SAI_STATUS_SUCCESS);
 
-    sai_status = get_meta_tunnel_fx_action(attr->s32, &flextrum_action, attr_idx);
+    sai_status = get_meta_tunnel_fx_action(attr->s32, &entry->action, attr_idx);
     if (SAI_ERR(sai_status)) {
-        SX_LOG_EXIT();
         return sai_status;
     }
 
@@ -1839,17 +2162,12 @@ static sai_status_t mlnx_create_table_meta_tunnel_entry(_Out_ sai_object_id_t
     meta_tunnel_metadata_key = attr->u16;
     if (meta_tunnel_metadata_key & 0xF000) {
         SX_LOG_ERR("METADATA_KEY is out of range (0, 0x0FFF)\n");
-        SX_LOG_EXIT();
         return SAI_STATUS_ATTR_NOT_SUPPORTED_0 + attr_idx;
     }
 
-    meta_tunnel_keys[keys_idx].key.data = (uint8_t*)&meta_tunnel_metadata_key;
-    meta_tunnel_keys[keys_idx].key.len  = sizeof(meta_tunnel_metadata_key);
-    keys_idx++;
+    mlnx_bmtor_fx_entry_key_add(entry, &meta_tunnel_metadata_key, NULL, sizeof(meta_tunnel_metadata_key));
 
-    sai_db_write_lock();
-
-    if (flextrum_action == CONTROL_OUT_RIF_TUNNEL_ENCAP_ID) {
+    if (entry->action == CONTROL_OUT_RIF_TUNNEL_ENCAP_ID) {
         sai_status = find_attrib_in_list(attr_count,
                                          attr_list,
                                          SAI_TABLE_META_TUNNEL_ENTRY_ATTR_TUNNEL_ID,
@@ -1859,12 +2177,10 @@ static sai_status_t mlnx_create_table_meta_tunnel_entry(_Out_ sai_object_id_t
 
         sai_status = mlnx_sai_tunnel_to_sx_tunnel_id(attr->oid, &meta_tunnel_tunnel_id);
         if (SAI_ERR(sai_status)) {
-            goto out;
+            return sai_status;
         }
 
-        meta_tunnel_params[params_idx].data = (uint8_t*)&meta_tunnel_tunnel_id;
-        meta_tunnel_params[params_idx].len  = sizeof(meta_tunnel_tunnel_id);
-        params_idx++;
+        mlnx_bmtor_fx_entry_param_add(entry, &meta_tunnel_tunnel_id, sizeof(meta_tunnel_tunnel_id));
 
         sai_status = find_attrib_in_list(attr_count,
                                          attr_list,
@@ -1875,71 +2191,110 @@ static sai_status_t mlnx_create_table_meta_tunnel_entry(_Out_ sai_object_id_t
 
         meta_tunnel_underlay_dip = htonl(attr->ipaddr.addr.ip4);
 
-        meta_tunnel_params[params_idx].data = (uint8_t*)&meta_tunnel_underlay_dip;
-        meta_tunnel_params[params_idx].len  = sizeof(meta_tunnel_underlay_dip);
-        params_idx++;
-    }
+        mlnx_bmtor_fx_entry_param_add(entry, &meta_tunnel_underlay_dip, sizeof(meta_tunnel_underlay_dip));
 
-    /* Lazy initialization */
-    sai_status = sai_fx_initialize();
-    if (SAI_ERR(sai_status)) {
-        SX_LOG_ERR("Failure in call to sai_fx_initialize\n");
-        return sai_status;
+        SX_LOG_DBG("Creating l3_vxlan entry %u tunnel_id %u\n", entry->action, meta_tunnel_tunnel_id);
     }
 
-    meta_tunnel_key_list.len   = keys_idx;
-    meta_tunnel_param_list.len = params_idx;
+    return SAI_STATUS_SUCCESS;
+}
 
-    SX_LOG_DBG("Creating l3_vxlan entry %u tunnel_id %u\n", flextrum_action,  meta_tunnel_tunnel_id);
-    if (fx_table_entry_add(g_fx_handle, CONTROL_OUT_RIF_TABLE_L3_VXLAN_ID, flextrum_action, meta_tunnel_key_list,
-                           meta_tunnel_param_list, &meta_tunnel_priority)) {
-        SX_LOG_ERR("Failure in insertion of l3_vxlan entry\n");
-        sai_status = SAI_STATUS_FAILURE;
-        goto out;
-    }
+static sai_status_t mlnx_create_table_meta_tunnel_entry(_Out_ sai_object_id_t      *entry_id,
+                                                        _In_ sai_object_id_t        switch_id,
+                                                        _In_ uint32_t               attr_count,
+                                                        _In_ const sai_attribute_t *attr_list)
+{
+    sai_status_t status, object_status;
 
-    sai_status = mlnx_create_object(SAI_OBJECT_TYPE_TABLE_META_TUNNEL_ENTRY, meta_tunnel_priority, NULL, entry_id);
-    if (SAI_ERR(sai_status)) {
-        goto out;
+    if (NULL == entry_id) {
+        SX_LOG_ERR("NULL entry id param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    table_meta_tunnel_entry_key_to_str(*entry_id, key_str);
-    SX_LOG_NTC("Created table L3 VXLAN entry %s\n", key_str);
+    status = mlnx_create_table_meta_tunnel_entries(switch_id, 1, &attr_count, &attr_list,
+                                                   SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, entry_id, &object_status);
+    if (SAI_ERR(status)) {
+        return SAI_STATUS_FAILURE == status ? object_status : status;
+    }
 
-out:
-    sai_db_unlock();
-    SX_LOG_EXIT();
-    return sai_status;
+    return SAI_STATUS_SUCCESS;
 }
 
 static sai_status_t mlnx_remove_table_meta_tunnel_entry(_In_ sai_object_id_t entry_id)
 {
-    sai_status_t status;
-    uint32_t     meta_tunnel_offset;
-    char         key_str[MAX_KEY_STR_LEN];
-
-    table_meta_tunnel_entry_key_to_str(entry_id, key_str);
-    SX_LOG_NTC("Remove table L3 VXLAN entry %s\n", key_str);
+    sai_status_t status, object_status;
 
-    status = mlnx_object_to_type(entry_id, SAI_OBJECT_TYPE_TABLE_META_TUNNEL_ENTRY, &meta_tunnel_offset, NULL);
+    status = mlnx_remove_table_meta_tunnel_entries(1, &entry_id, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                                                   &object_status);
     if (SAI_ERR(status)) {
-        SX_LOG_ERR("Failure in extracting offset from l3_vxlan entry object id 0x%lx " PRIx64 "\n", entry_id);
-        SX_LOG_EXIT();
-        return status;
+        return SAI_STATUS_FAILURE == status ? object_status : status;
     }
 
-    sai_db_write_lock();
+    return SAI_STATUS_SUCCESS;
+}
 
-    if (fx_table_entry_remove(g_fx_handle, CONTROL_OUT_RIF_TABLE_L3_VXLAN_ID, meta_tunnel_offset)) {
-        SX_LOG_ERR("Failure in removal of table_l3_vxlan entry at offset %d\n", meta_tunnel_offset);
-        status = SAI_STATUS_FAILURE;
-        goto out;
-    }
+/**
+ * @brief Bulk table meta tunnel (L3 VXLAN) entries creation.
+ *
+ * The entries are written to the flex ACL region with one multi-rule SDK call.
+ *
+ * @param[in] switch_id SAI Switch object id
+ * @param[in] object_count Number of objects to create
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to create.
+ * @param[in] attr_list List of attributes for every object.
+ * @param[in] mode Bulk operation error handling mode.
+ *
+ * @param[out] object_id List of object ids returned
+ * @param[out] object_statuses List of status for every object. Caller needs to allocate the buffer.
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are created or #SAI_STATUS_FAILURE when
+ * any of the objects fails to create.
+ */
+sai_status_t mlnx_create_table_meta_tunnel_entries(_In_ sai_object_id_t          switch_id,
+                                                   _In_ uint32_t                 object_count,
+                                                   _In_ const uint32_t          *attr_count,
+                                                   _In_ const sai_attribute_t  **attr_list,
+                                                   _In_ sai_bulk_op_error_mode_t mode,
+                                                   _Out_ sai_object_id_t        *object_id,
+                                                   _Out_ sai_status_t           *object_statuses)
+{
+    return mlnx_bmtor_fx_entries_create(SAI_OBJECT_TYPE_TABLE_META_TUNNEL_ENTRY,
+                                        CONTROL_OUT_RIF_TABLE_L3_VXLAN_ID,
+                                        mlnx_bmtor_meta_tunnel_entry_parse,
+                                        table_meta_tunnel_entry_key_to_str,
+                                        object_count,
+                                        attr_count,
+                                        attr_list,
+                                        mode,
+                                        object_id,
+                                        object_statuses);
+}
 
-out:
-    sai_db_unlock();
-    SX_LOG_EXIT();
-    return status;
+/**
+ * @brief Bulk table meta tunnel (L3 VXLAN) entries removal.
+ *
+ * @param[in] object_count Number of objects to remove
+ * @param[in] object_id List of object ids
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to allocate the buffer.
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or #SAI_STATUS_FAILURE when
+ * any of the objects fails to remove.
+ */
+sai_status_t mlnx_remove_table_meta_tunnel_entries(_In_ uint32_t                 object_count,
+                                                   _In_ const sai_object_id_t   *object_id,
+                                                   _In_ sai_bulk_op_error_mode_t mode,
+                                                   _Out_ sai_status_t           *object_statuses)
+{
+    return mlnx_bmtor_fx_entries_remove(SAI_OBJECT_TYPE_TABLE_META_TUNNEL_ENTRY,
+                                        CONTROL_OUT_RIF_TABLE_L3_VXLAN_ID,
+                                        table_meta_tunnel_entry_key_to_str,
+                                        false,
+                                        object_count,
+                                        object_id,
+                                        mode,
+                                        object_statuses);
 }
 
 static sai_status_t mlnx_set_table_meta_tunnel_entry_attribute(_In_ sai_object_id_t        entry_id,
@@ -336,6 +336,23 @@ static sai_status_t mlnx_bridge_port_add(sx_bridge_id_t         bridge_id,
     return SAI_STATUS_TABLE_FULL;
 }
 
+static void mlnx_bridge_port_logical_set(mlnx_bridge_port_t *port, sx_port_log_id_t log)
+{
+    sai_status_t status;
+
+    mlnx_log_port_map_del(g_sai_db_ptr->bridge_ports_log_map, MLNX_BRIDGE_PORT_LOG_MAP_SIZE,
+                          port->logical, port->index);
+
+    port->logical = log;
+
+    if (log) {
+        status = mlnx_log_port_map_set(g_sai_db_ptr->bridge_ports_log_map, MLNX_BRIDGE_PORT_LOG_MAP_SIZE,
+                                       log, port->index);
+        /* The map is sized for all of bridge_ports_db */
+        assert(SAI_STATUS_SUCCESS == status);
+    }
+}
+
 static sai_status_t mlnx_bridge_port_del(mlnx_bridge_port_t *port)
 {
     if (port->index > MAX_BRIDGE_1Q_PORTS) {
@@ -343,6 +360,9 @@ static sai_status_t mlnx_bridge_port_del(mlnx_bridge_port_t *port)
         g_sai_db_ptr->non_1q_bports_created--;
     }
 
+    mlnx_log_port_map_del(g_sai_db_ptr->bridge_ports_log_map, MLNX_BRIDGE_PORT_LOG_MAP_SIZE,
+                          port->logical, port->index);
+
     memset(port, 0, sizeof(*port));
     return SAI_STATUS_SUCCESS;
 }
@@ -404,23 +424,34 @@ sai_status_t mlnx_bridge_port_by_tunnel_id(sx_tunnel_id_t sx_tunnel, mlnx_bridge
     return SAI_STATUS_ITEM_NOT_FOUND;
 }
 
-sai_status_t mlnx_bridge_port_by_log(sx_port_log_id_t log, mlnx_bridge_port_t **port)
+/* Lookup in the log port -> bridge port index, the hit is verified against the DB entry */
+static mlnx_bridge_port_t* mlnx_bridge_port_by_log_lookup(sx_port_log_id_t log)
 {
-    mlnx_bridge_port_t *it;
-    uint32_t            ii, checked;
+    mlnx_bridge_port_t *port;
+    uint32_t            idx;
+    sai_status_t        status;
 
-    mlnx_bridge_1q_port_foreach(it, ii) {
-        if (it->logical == log) {
-            *port = it;
-            return SAI_STATUS_SUCCESS;
-        }
+    status = mlnx_log_port_map_get(g_sai_db_ptr->bridge_ports_log_map, MLNX_BRIDGE_PORT_LOG_MAP_SIZE, log, &idx);
+    if (SAI_ERR(status) || (idx >= MAX_BRIDGE_PORTS)) {
+        return NULL;
     }
 
-    mlnx_bridge_non1q_port_foreach(it, ii, checked) {
-        if (it->logical == log) {
-            *port = it;
-            return SAI_STATUS_SUCCESS;
-        }
+    port = &g_sai_db_ptr->bridge_ports_db[idx];
+    if (!port->is_present || (port->logical != log)) {
+        return NULL;
+    }
+
+    return port;
+}
+
+sai_status_t mlnx_bridge_port_by_log(sx_port_log_id_t log, mlnx_bridge_port_t **port)
+{
+    mlnx_bridge_port_t *it;
+
+    it = mlnx_bridge_port_by_log_lookup(log);
+    if (it) {
+        *port = it;
+        return SAI_STATUS_SUCCESS;
     }
 
     return SAI_STATUS_INVALID_PORT_NUMBER;
@@ -429,13 +460,11 @@ sai_status_t mlnx_bridge_port_by_log(sx_port_log_id_t log, mlnx_bridge_port_t **
 sai_status_t mlnx_bridge_1q_port_by_log(sx_port_log_id_t log, mlnx_bridge_port_t **port)
 {
     mlnx_bridge_port_t *it;
-    uint32_t            ii;
 
-    mlnx_bridge_1q_port_foreach(it, ii) {
-        if (it->logical == log) {
-            *port = it;
-            return SAI_STATUS_SUCCESS;
-        }
+    it = mlnx_bridge_port_by_log_lookup(log);
+    if (it && (it->index < MAX_BRIDGE_1Q_PORTS)) {
+        *port = it;
+        return SAI_STATUS_SUCCESS;
     }
 
     return SAI_STATUS_INVALID_PORT_NUMBER;
@@ -2682,7 +2711,7 @@ static sai_status_t mlnx_create_bridge_port(_Out_ sai_object_id_t     * bridge_p
             }
         }
 
-        bridge_port->logical = log_port;
+        mlnx_bridge_port_logical_set(bridge_port, log_port);
         break;
 
     case SAI_BRIDGE_PORT_TYPE_SUB_PORT:
@@ -2750,7 +2779,7 @@ static sai_status_t mlnx_create_bridge_port(_Out_ sai_object_id_t     * bridge_p
             goto out;
         }
 
-        bridge_port->logical = vport_id;
+        mlnx_bridge_port_logical_set(bridge_port, vport_id);
         bridge_port->parent  = log_port;
         bridge_port->vlan_id = vlan_id;
 
@@ -3131,7 +3160,7 @@ sai_status_t mlnx_bridge_init(void)
             goto out;
         }
 
-        bridge_port->logical     = port->logical;
+        mlnx_bridge_port_logical_set(bridge_port, port->logical);
         bridge_port->admin_state = true;
 
         status = mlnx_vlan_port_add(DEFAULT_VLAN, SAI_VLAN_TAGGING_MODE_UNTAGGED, bridge_port);
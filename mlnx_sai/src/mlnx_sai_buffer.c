@@ -410,6 +410,145 @@ sai_status_t mlnx_sai_get_port_buffer_index_array(uint32_t
     return SAI_STATUS_SUCCESS;
 }
 
+static void mlnx_sai_buffer_ref_slot_unlink(_In_ uint32_t slot_ind)
+{
+    mlnx_sai_buffer_ref_slot_t *slots = g_sai_buffer_db_ptr->buffer_ref_slots;
+    mlnx_sai_buffer_ref_slot_t *slot  = &slots[slot_ind];
+
+    if (SENTINEL_BUFFER_DB_ENTRY_INDEX == slot->profile) {
+        return;
+    }
+
+    if (slot->prev) {
+        slots[slot->prev - 1].next = slot->next;
+    } else {
+        g_sai_buffer_db_ptr->buffer_profile_refs[slot->profile] = slot->next;
+    }
+    if (slot->next) {
+        slots[slot->next - 1].prev = slot->prev;
+    }
+
+    slot->profile = SENTINEL_BUFFER_DB_ENTRY_INDEX;
+    slot->next    = 0;
+    slot->prev    = 0;
+}
+
+/*
+ * Keeps the reverse reference index in sync with port_buffer_data and queue buffer_id.
+ * db_buffer_profile_index == SENTINEL_BUFFER_DB_ENTRY_INDEX removes the reference.
+ * The profile list is kept sorted by slot index, so the references of one port are adjacent.
+ * Requires DB write lock.
+ */
+void mlnx_sai_buffer_profile_ref_set(uint32_t                       db_port_ind,
+                                     port_buffer_index_array_type_t buff_type,
+                                     uint32_t                       ind,
+                                     uint32_t                       db_buffer_profile_index)
+{
+    mlnx_sai_buffer_ref_slot_t *slots = g_sai_buffer_db_ptr->buffer_ref_slots;
+    uint32_t                    slot_ind, prev, next, count;
+
+    if (db_port_ind >= MAX_PORTS) {
+        SX_LOG_ERR("db_port_ind out of bounds\n");
+        return;
+    }
+    if (db_buffer_profile_index >= mlnx_sai_get_buffer_profile_number()) {
+        SX_LOG_ERR("buffer profile index exeeds range:0x%X \n", mlnx_sai_get_buffer_profile_number());
+        return;
+    }
+
+    slot_ind = db_port_ind * BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE;
+    switch (buff_type) {
+    case PORT_BUFF_TYPE_INGRESS:
+        count = buffer_limits.num_ingress_pools;
+        break;
+
+    case PORT_BUFF_TYPE_EGRESS:
+        slot_ind += buffer_limits.num_ingress_pools;
+        count     = buffer_limits.num_egress_pools;
+        break;
+
+    case PORT_BUFF_TYPE_PG:
+        slot_ind += buffer_limits.num_ingress_pools + buffer_limits.num_egress_pools;
+        count     = buffer_limits.num_port_pg_buff;
+        break;
+
+    case PORT_BUFF_TYPE_QUEUE:
+        slot_ind += BUFFER_DB_PER_PORT_PROFILE_INDEX_ARRAY_SIZE;
+        count     = buffer_limits.num_port_queue_buff;
+        break;
+
+    default:
+        SX_LOG_ERR("Invalid buffer type:%d\n", buff_type);
+        return;
+    }
+    if (ind >= count) {
+        SX_LOG_ERR("Buffer index %u out of bounds for buffer type:%d\n", ind, buff_type);
+        return;
+    }
+    slot_ind += ind;
+
+    if (slots[slot_ind].profile == db_buffer_profile_index) {
+        return;
+    }
+
+    mlnx_sai_buffer_ref_slot_unlink(slot_ind);
+    if (SENTINEL_BUFFER_DB_ENTRY_INDEX == db_buffer_profile_index) {
+        return;
+    }
+
+    prev = 0;
+    next = g_sai_buffer_db_ptr->buffer_profile_refs[db_buffer_profile_index];
+    while (next && (next - 1 < slot_ind)) {
+        prev = next;
+        next = slots[next - 1].next;
+    }
+
+    slots[slot_ind].profile = db_buffer_profile_index;
+    slots[slot_ind].prev    = prev;
+    slots[slot_ind].next    = next;
+    if (prev) {
+        slots[prev - 1].next = slot_ind + 1;
+    } else {
+        g_sai_buffer_db_ptr->buffer_profile_refs[db_buffer_profile_index] = slot_ind + 1;
+    }
+    if (next) {
+        slots[next - 1].prev = slot_ind + 1;
+    }
+}
+
+/* Drops all the references of a port from the reverse reference index, requires DB write lock */
+void mlnx_sai_buffer_port_refs_reset(uint32_t db_port_ind)
+{
+    uint32_t slot_ind;
+
+    if (db_port_ind >= MAX_PORTS) {
+        SX_LOG_ERR("db_port_ind out of bounds\n");
+        return;
+    }
+
+    for (slot_ind = db_port_ind * BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE;
+         slot_ind < (db_port_ind + 1) * BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE;
+         slot_ind++) {
+        mlnx_sai_buffer_ref_slot_unlink(slot_ind);
+    }
+}
+
+/* Marks the port buffer of the reference slot (offset within the port slots) in affected_items */
+static void mlnx_sai_buffer_ref_slot_to_affected_item(_In_ uint32_t                          slot_offset,
+                                                      _Inout_ mlnx_affect_port_buff_items_t* affected_items)
+{
+    if (slot_offset < buffer_limits.num_ingress_pools) {
+        affected_items->i_port_buffers[slot_offset] = true;
+    } else if ((slot_offset -= buffer_limits.num_ingress_pools) < buffer_limits.num_egress_pools) {
+        affected_items->e_port_buffers[slot_offset] = true;
+    } else if ((slot_offset -= buffer_limits.num_egress_pools) < buffer_limits.num_port_pg_buff) {
+        affected_items->pgs[slot_offset] = true;
+    } else {
+        affected_items->tcs[slot_offset - buffer_limits.num_port_pg_buff] = true;
+    }
+    affected_items->affected_count++;
+}
+
 static bool mlnx_sai_buffer_get_pool_create_triggered_flag()
 {
     return g_sai_buffer_db_ptr->pool_allocation[0];
@@ -1006,6 +1145,8 @@ static sai_status_t pg_profile_set(uint32_t db_port_index, uint32_t port_pg_ind,
             return sai_status;
         }
         port_pg_profile_refs[port_pg_ind] = SENTINEL_BUFFER_DB_ENTRY_INDEX;
+        mlnx_sai_buffer_profile_ref_set(db_port_index, PORT_BUFF_TYPE_PG, port_pg_ind,
+                                        SENTINEL_BUFFER_DB_ENTRY_INDEX);
     } else {
         if (SAI_STATUS_SUCCESS !=
             (sai_status = mlnx_get_sai_buffer_profile_data(profile, &input_db_buffer_profile_index, &sai_pool_attr))) {
@@ -1057,6 +1198,8 @@ static sai_status_t pg_profile_set(uint32_t db_port_index, uint32_t port_pg_ind,
             return sai_status;
         }
         port_pg_profile_refs[port_pg_ind] = input_db_buffer_profile_index;
+        mlnx_sai_buffer_profile_ref_set(db_port_index, PORT_BUFF_TYPE_PG, port_pg_ind,
+                                        input_db_buffer_profile_index);
         SX_LOG_DBG("Logging newly set buffer profile\n");
         log_sai_buffer_profile_db_entry(input_db_buffer_profile_index);
     }
@@ -3184,14 +3327,11 @@ static sai_status_t mlnx_sai_collect_buffer_refs(_In_ sai_object_id_t
                                                  _In_ uint32_t                        db_port_ind,
                                                  _Out_ mlnx_affect_port_buff_items_t* affected_items)
 {
-    uint32_t                    ind;
     sai_status_t                sai_status;
     uint32_t                    db_buffer_profile_index;
     mlnx_sai_buffer_pool_attr_t sai_pool_attr;
-    bool                        found_match       = false;
-    uint32_t                  * buff_profile_refs = NULL;
-    mlnx_qos_queue_config_t   * queue_cfg         = NULL;
-    uint32_t                    affected_count    = 0;
+    uint32_t                    port_slots = BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE;
+    uint32_t                    slot_base, slot_ind;
 
     SX_LOG_ENTER();
 
@@ -3215,81 +3355,19 @@ static sai_status_t mlnx_sai_collect_buffer_refs(_In_ sai_object_id_t
     SX_LOG_DBG("pool_type:%d db_port_ind:%d\n", sai_pool_attr.pool_type, db_port_ind);
     reset_affected_items(affected_items);
 
-    switch (sai_pool_attr.pool_type) {
-    case SAI_BUFFER_POOL_TYPE_INGRESS:
-        buff_profile_refs = NULL;
-        if (SAI_STATUS_SUCCESS !=
-            (sai_status = mlnx_sai_get_port_buffer_index_array(db_port_ind, PORT_BUFF_TYPE_PG, &buff_profile_refs))) {
-            SX_LOG_EXIT();
-            return sai_status;
-        }
-        for (ind = 0; ind < buffer_limits.num_port_pg_buff; ind++) {
-            if (buff_profile_refs[ind] == db_buffer_profile_index) {
-                affected_items->pgs[ind] = true;
-                SX_LOG_DBG("port[%d].pg[%d]\n", db_port_ind, ind);
-                found_match = true;
-                affected_count++;
-            }
+    /* The profile references are sorted by slot, stop once past the port slots */
+    slot_base = db_port_ind * port_slots;
+    for (slot_ind = g_sai_buffer_db_ptr->buffer_profile_refs[db_buffer_profile_index];
+         slot_ind && (slot_ind - 1 < slot_base + port_slots);
+         slot_ind = g_sai_buffer_db_ptr->buffer_ref_slots[slot_ind - 1].next) {
+        if (slot_ind - 1 >= slot_base) {
+            mlnx_sai_buffer_ref_slot_to_affected_item(slot_ind - 1 - slot_base, affected_items);
         }
-        buff_profile_refs = NULL;
-        if (SAI_STATUS_SUCCESS !=
-            (sai_status =
-                 mlnx_sai_get_port_buffer_index_array(db_port_ind, PORT_BUFF_TYPE_INGRESS, &buff_profile_refs))) {
-            SX_LOG_EXIT();
-            return sai_status;
-        }
-        for (ind = 0; ind < buffer_limits.num_ingress_pools; ind++) {
-            if (buff_profile_refs[ind] == db_buffer_profile_index) {
-                affected_items->i_port_buffers[ind] = true;
-                found_match                         = true;
-                affected_count++;
-                SX_LOG_DBG("port[%d].i_buff[%d]\n", db_port_ind, ind);
-            }
-        }
-        break;
-
-    case SAI_BUFFER_POOL_TYPE_EGRESS:
-        buff_profile_refs = NULL;
-        for (ind = 0; ind < buffer_limits.num_port_queue_buff; ind++) {
-            if (SAI_STATUS_SUCCESS !=
-                (sai_status = mlnx_queue_cfg_lookup(g_sai_db_ptr->ports_db[db_port_ind].logical, ind, &queue_cfg))) {
-                SX_LOG_EXIT();
-                return sai_status;
-            }
-            if (queue_cfg->buffer_id == sai_buffer_id) {
-                affected_items->tcs[ind] = true;
-                found_match              = true;
-                affected_count++;
-                SX_LOG_DBG("port[%d].tc[%d]\n", db_port_ind, ind);
-            }
-        }
-        buff_profile_refs = NULL;
-        if (SAI_STATUS_SUCCESS !=
-            (sai_status =
-                 mlnx_sai_get_port_buffer_index_array(db_port_ind, PORT_BUFF_TYPE_EGRESS, &buff_profile_refs))) {
-            SX_LOG_EXIT();
-            return sai_status;
-        }
-        for (ind = 0; ind < buffer_limits.num_egress_pools; ind++) {
-            if (buff_profile_refs[ind] == db_buffer_profile_index) {
-                affected_items->e_port_buffers[ind] = true;
-                found_match                         = true;
-                affected_count++;
-                SX_LOG_DBG("port[%d].e_buff[%d]\n", db_port_ind, ind);
-            }
-        }
-        break;
-
-    default:
-        SX_LOG_ERR("Invalid pool type:%d\n", sai_pool_attr.pool_type);
-        SX_LOG_EXIT();
-        return SAI_STATUS_FAILURE;
     }
     SX_LOG_EXIT();
-    if (!found_match) {
+    if (0 == affected_items->affected_count) {
         return SAI_STATUS_ITEM_NOT_FOUND;
     }
-    affected_items->affected_count = affected_count;
     return SAI_STATUS_SUCCESS;
 }
 
@@ -3302,7 +3380,8 @@ static sai_status_t mlnx_sai_buffer_apply_buffer_change_to_references(_In_ sai_o
     uint32_t                           db_buffer_profile_index;
     mlnx_sai_db_buffer_profile_entry_t buff_db_entry;
     mlnx_sai_buffer_pool_attr_t        sai_pool_attr;
-    mlnx_port_config_t                *port;
+    uint32_t                           port_slots = BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE;
+    uint32_t                           slot_base, slot_ind;
 
     SX_LOG_ENTER();
     if (!alloc_affected_items(&affected_items)) {
@@ -3316,19 +3395,20 @@ static sai_status_t mlnx_sai_buffer_apply_buffer_change_to_references(_In_ sai_o
         return sai_status;
     }
     buff_db_entry = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index];
-    mlnx_port_phy_foreach(port, port_ind) {
-        sai_status = mlnx_sai_collect_buffer_refs(sai_buffer_id, port_ind, &affected_items);
-        if (SAI_STATUS_ITEM_NOT_FOUND == sai_status) {
-            continue;
-        }
-        if (SAI_STATUS_SUCCESS != sai_status) {
-            free_affected_items(&affected_items);
-            SX_LOG_EXIT();
-            return sai_status;
+    /* Walk only the ports referring the profile, the references of a port are adjacent in the list */
+    slot_ind = g_sai_buffer_db_ptr->buffer_profile_refs[db_buffer_profile_index];
+    while (slot_ind) {
+        port_ind  = (slot_ind - 1) / port_slots;
+        slot_base = port_ind * port_slots;
+        reset_affected_items(&affected_items);
+        for (; slot_ind && (slot_ind - 1 < slot_base + port_slots);
+             slot_ind = g_sai_buffer_db_ptr->buffer_ref_slots[slot_ind - 1].next) {
+            mlnx_sai_buffer_ref_slot_to_affected_item(slot_ind - 1 - slot_base, &affected_items);
         }
         if (SAI_STATUS_SUCCESS !=
             (sai_status =
-                 mlnx_sai_apply_buffer_settings_to_port(port->logical, buff_db_entry, &affected_items, prev_pool))) {
+                 mlnx_sai_apply_buffer_settings_to_port(g_sai_db_ptr->ports_db[port_ind].logical, buff_db_entry,
+                                                        &affected_items, prev_pool))) {
             free_affected_items(&affected_items);
             SX_LOG_EXIT();
             return sai_status;
@@ -3780,6 +3860,8 @@ sai_status_t mlnx_sai_buffer_apply_port_buffer_profile_list(_In_ bool
             SX_LOG_DBG("Resetting port buffer profile reference on port[%d].buff[%d], ingress:%d\n",
                        db_port_ind, ind, is_ingress);
             db_port_buffers[ind] = SENTINEL_BUFFER_DB_ENTRY_INDEX;
+            mlnx_sai_buffer_profile_ref_set(db_port_ind, is_ingress ? PORT_BUFF_TYPE_INGRESS : PORT_BUFF_TYPE_EGRESS,
+                                            ind, SENTINEL_BUFFER_DB_ENTRY_INDEX);
         } else {
             if (SAI_STATUS_SUCCESS !=
                 (sai_status =
@@ -3790,6 +3872,8 @@ sai_status_t mlnx_sai_buffer_apply_port_buffer_profile_list(_In_ bool
             }
             buffer_entry         = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_ind];
             db_port_buffers[ind] = db_buffer_profile_ind;
+            mlnx_sai_buffer_profile_ref_set(db_port_ind, is_ingress ? PORT_BUFF_TYPE_INGRESS : PORT_BUFF_TYPE_EGRESS,
+                                            ind, db_buffer_profile_ind);
         }
         if (is_ingress) {
             affected_items.i_port_buffers[ind] = true;
@@ -3977,63 +4061,21 @@ out:
     return sai_status;
 }
 
-sai_status_t mlnx_sai_get_buffer_pool_stats_ext(_In_ sai_object_id_t      buffer_pool_id,
-                                                _In_ uint32_t             number_of_counters,
-                                                _In_ const sai_stat_id_t *counter_ids,
-                                                _In_ sai_stats_mode_t     mode,
-                                                _Out_ uint64_t           *counters)
+static sai_status_t mlnx_buffer_pool_stats_fill(_In_ uint32_t                                  number_of_counters,
+                                                _In_ const sai_stat_id_t                      *counter_ids,
+                                                _In_ const sx_cos_pool_occupancy_statistics_t *occupancy_stats,
+                                                _Out_ uint64_t                                *counters)
 {
-    sai_status_t                       sai_status;
-    sx_cos_pool_occupancy_statistics_t occupancy_stats;
-    mlnx_sai_buffer_pool_attr_t        sai_pool_attr;
-    char                               key_str[MAX_KEY_STR_LEN];
-    uint32_t                           ii;
-    sx_access_cmd_t                    cmd;
+    uint32_t ii;
 
-    SX_LOG_ENTER();
-    pool_key_to_str(buffer_pool_id, key_str);
-    SX_LOG_DBG("Get pool stats %s\n", key_str);
-    if (0 == number_of_counters) {
-        SX_LOG_ERR("0 number_of_counters array param\n");
-        SX_LOG_EXIT();
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-    if (NULL == counter_ids) {
-        SX_LOG_ERR("NULL counter ids array param\n");
-        SX_LOG_EXIT();
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-    if (NULL == counters) {
-        SX_LOG_ERR("NULL counters array param\n");
-        SX_LOG_EXIT();
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-    if (SAI_STATUS_SUCCESS !=
-        (sai_status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd))) {
-        return sai_status;
-    }
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
-    if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(buffer_pool_id, &sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
-        SX_LOG_EXIT();
-        return sai_status;
-    }
-    cl_plock_release(&g_sai_db_ptr->p_lock);
-    if (SX_STATUS_SUCCESS != (sai_status = sx_api_cos_pool_statistic_get(gh_sdk, cmd,
-                                                                         &sai_pool_attr.sx_pool_id, 1,
-                                                                         &occupancy_stats))) {
-        SX_LOG_ERR("Failed to get pool stat counters - error:%s.\n", SX_STATUS_MSG(sai_status));
-        SX_LOG_EXIT();
-        return sdk_to_sai(sai_status);
-    }
     for (ii = 0; ii < number_of_counters; ii++) {
         switch (counter_ids[ii]) {
         case SAI_BUFFER_POOL_STAT_CURR_OCCUPANCY_BYTES:
-            counters[ii] = (uint64_t)mlnx_cells_to_bytes(occupancy_stats.statistics.curr_occupancy);
+            counters[ii] = (uint64_t)mlnx_cells_to_bytes(occupancy_stats->statistics.curr_occupancy);
             break;
 
         case SAI_BUFFER_POOL_STAT_WATERMARK_BYTES:
-            counters[ii] = (uint64_t)mlnx_cells_to_bytes(occupancy_stats.statistics.watermark);
+            counters[ii] = (uint64_t)mlnx_cells_to_bytes(occupancy_stats->statistics.watermark);
             break;
 
         case SAI_BUFFER_POOL_STAT_DROPPED_PACKETS:
@@ -4064,10 +4106,129 @@ sai_status_t mlnx_sai_get_buffer_pool_stats_ext(_In_ sai_object_id_t      buffer
             return SAI_STATUS_INVALID_PARAMETER;
         }
     }
-    SX_LOG_EXIT();
+
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t mlnx_sai_get_buffer_pool_stats_ext(_In_ sai_object_id_t      buffer_pool_id,
+                                                _In_ uint32_t             number_of_counters,
+                                                _In_ const sai_stat_id_t *counter_ids,
+                                                _In_ sai_stats_mode_t     mode,
+                                                _Out_ uint64_t           *counters)
+{
+    sai_status_t sai_status, object_status;
+
+    if (0 == number_of_counters) {
+        SX_LOG_ERR("0 number_of_counters array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_status = mlnx_bulk_object_get_stats(SAI_OBJECT_TYPE_BUFFER_POOL, 1, &buffer_pool_id, number_of_counters,
+                                            counter_ids, mode, &object_status, counters);
+    if (SAI_ERR(sai_status)) {
+        return SAI_STATUS_FAILURE == sai_status ? object_status : sai_status;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Get statistics counters of several buffer pools.
+ * All pools are read from SDK with one pool statistics call.
+ */
+sai_status_t mlnx_get_buffer_pools_stats_bulk(_In_ uint32_t               object_count,
+                                              _In_ const sai_object_id_t *pool_ids,
+                                              _In_ uint32_t               number_of_counters,
+                                              _In_ const sai_stat_id_t   *counter_ids,
+                                              _In_ sai_stats_mode_t       mode,
+                                              _Out_ sai_status_t         *object_statuses,
+                                              _Out_ uint64_t             *counters)
+{
+    sai_status_t                        sai_status, bulk_status = SAI_STATUS_SUCCESS;
+    sx_cos_pool_occupancy_statistics_t *occupancy_stats = NULL;
+    mlnx_sai_buffer_pool_attr_t         sai_pool_attr;
+    sx_cos_pool_id_t                   *sx_pool_ids = NULL;
+    uint32_t                           *obj_idxs    = NULL;
+    uint32_t                            ii, pools_count = 0;
+    char                                key_str[MAX_KEY_STR_LEN];
+    sx_access_cmd_t                     cmd;
+
+    SX_LOG_ENTER();
+
+    if (SAI_STATUS_SUCCESS !=
+        (sai_status = mlnx_stats_bulk_params_check(object_count, pool_ids, number_of_counters, counter_ids,
+                                                   object_statuses, counters))) {
+        SX_LOG_EXIT();
+        return sai_status;
+    }
+    if (SAI_STATUS_SUCCESS !=
+        (sai_status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd))) {
+        SX_LOG_EXIT();
+        return sai_status;
+    }
+
+    occupancy_stats = calloc(object_count, sizeof(*occupancy_stats));
+    sx_pool_ids     = calloc(object_count, sizeof(*sx_pool_ids));
+    obj_idxs        = calloc(object_count, sizeof(*obj_idxs));
+    if (!occupancy_stats || !sx_pool_ids || !obj_idxs) {
+        SX_LOG_ERR("Failed to allocate memory for pool stats\n");
+        sai_status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    for (ii = 0; ii < object_count; ii++) {
+        pool_key_to_str(pool_ids[ii], key_str);
+        SX_LOG_DBG("Get pool stats %s\n", key_str);
+
+        object_statuses[ii] = mlnx_get_sai_pool_data(pool_ids[ii], &sai_pool_attr);
+        if (SAI_ERR(object_statuses[ii])) {
+            bulk_status = SAI_STATUS_FAILURE;
+            continue;
+        }
+
+        sx_pool_ids[pools_count] = sai_pool_attr.sx_pool_id;
+        obj_idxs[pools_count]    = ii;
+        pools_count++;
+    }
+    cl_plock_release(&g_sai_db_ptr->p_lock);
+
+    if (0 == pools_count) {
+        sai_status = bulk_status;
+        goto out;
+    }
+
+    if (SX_STATUS_SUCCESS != (sai_status = sx_api_cos_pool_statistic_get(gh_sdk, cmd,
+                                                                         sx_pool_ids, pools_count,
+                                                                         occupancy_stats))) {
+        SX_LOG_ERR("Failed to get pool stat counters - error:%s.\n", SX_STATUS_MSG(sai_status));
+        sai_status = sdk_to_sai(sai_status);
+        for (ii = 0; ii < pools_count; ii++) {
+            object_statuses[obj_idxs[ii]] = sai_status;
+        }
+        sai_status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+
+    for (ii = 0; ii < pools_count; ii++) {
+        object_statuses[obj_idxs[ii]] =
+            mlnx_buffer_pool_stats_fill(number_of_counters, counter_ids, &occupancy_stats[ii],
+                                        &counters[(uint64_t)obj_idxs[ii] * number_of_counters]);
+        if (SAI_ERR(object_statuses[obj_idxs[ii]])) {
+            bulk_status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    sai_status = bulk_status;
+
+out:
+    free(occupancy_stats);
+    free(sx_pool_ids);
+    free(obj_idxs);
+    SX_LOG_EXIT();
+    return sai_status;
+}
+
 sai_status_t mlnx_sai_get_buffer_pool_stats(_In_ sai_object_id_t       pool_id,
                                             _In_ uint32_t              number_of_counters,
                                             _In_ const sai_stat_id_t * counter_ids,
@@ -4119,118 +4280,25 @@ sai_status_t mlnx_clear_buffer_pool_stats(_In_ sai_object_id_t      pool_id,
     return SAI_STATUS_SUCCESS;
 }
 
-sai_status_t mlnx_sai_get_ingress_priority_group_stats_ext(_In_ sai_object_id_t      ingress_priority_group_id,
-                                                           _In_ uint32_t             number_of_counters,
-                                                           _In_ const sai_stat_id_t *counter_ids,
-                                                           _In_ sai_stats_mode_t     mode,
-                                                           _Out_ uint64_t           *counters)
+typedef struct _mlnx_pg_stats_obj_t {
+    uint32_t db_port_index;
+    uint32_t pg_ind;
+    uint32_t obj_idx;
+} mlnx_pg_stats_obj_t;
+
+static sai_status_t mlnx_pg_stats_fill(_In_ uint32_t                              db_port_index,
+                                       _In_ uint32_t                              pg_ind,
+                                       _In_ uint32_t                              number_of_counters,
+                                       _In_ const sai_stat_id_t                  *counter_ids,
+                                       _In_ const sx_port_cntr_buff_t            *pg_cnts,
+                                       _In_ const sx_port_occupancy_statistics_t *occupancy_stats,
+                                       _In_ const sx_port_occupancy_statistics_t *headroom_occupancy_stats,
+                                       _Out_ uint64_t                            *counters)
 {
-    sai_status_t                     sai_status;
-    uint32_t                         db_port_index, pg_ind, buff_ind;
-    sx_port_statistic_usage_params_t stats_usage;
-    sx_port_occupancy_statistics_t   occupancy_stats, headroom_occupancy_stats;
-    uint32_t                         usage_cnt = 1;
-    uint32_t                         ii;
-    char                             key_str[MAX_KEY_STR_LEN];
-    sx_port_cntr_buff_t              pg_cnts                         = { 0 };
-    bool                             pg_cnts_needed                  = false, occupancy_stats_needed = false,
-                                     headroom_occupancy_stats_needed = false;
-    uint32_t                           *port_pg_profile_refs         = NULL;
-    mlnx_sai_db_buffer_profile_entry_t *buff_db_entry                = NULL;
-    sx_access_cmd_t                     cmd;
-
-    SX_LOG_ENTER();
-    pg_key_to_str(ingress_priority_group_id, key_str);
-    SX_LOG_DBG("Get PG stats %s\n", key_str);
-    if (0 == number_of_counters) {
-        SX_LOG_ERR("0 number_of_counters array param\n");
-        SX_LOG_EXIT();
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-    if (NULL == counter_ids) {
-        SX_LOG_ERR("NULL counter ids array param\n");
-        SX_LOG_EXIT();
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-    if (NULL == counters) {
-        SX_LOG_ERR("NULL counters array param\n");
-        SX_LOG_EXIT();
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-    if (SAI_STATUS_SUCCESS !=
-        (sai_status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd))) {
-        return sai_status;
-    }
-    if (SAI_STATUS_SUCCESS != (sai_status = get_pg_data(ingress_priority_group_id, &db_port_index, &pg_ind))) {
-        SX_LOG_EXIT();
-        return sai_status;
-    }
-
-    for (ii = 0; ii < number_of_counters; ii++) {
-        switch (counter_ids[ii]) {
-        case SAI_INGRESS_PRIORITY_GROUP_STAT_PACKETS:
-        case SAI_INGRESS_PRIORITY_GROUP_STAT_BYTES:
-        case SAI_INGRESS_PRIORITY_GROUP_STAT_DROPPED_PACKETS:
-            pg_cnts_needed = true;
-            break;
-
-        case SAI_INGRESS_PRIORITY_GROUP_STAT_CURR_OCCUPANCY_BYTES:
-        case SAI_INGRESS_PRIORITY_GROUP_STAT_WATERMARK_BYTES:
-        case SAI_INGRESS_PRIORITY_GROUP_STAT_SHARED_WATERMARK_BYTES:
-            occupancy_stats_needed = true;
-            break;
-
-        case SAI_INGRESS_PRIORITY_GROUP_STAT_XOFF_ROOM_WATERMARK_BYTES:
-            headroom_occupancy_stats_needed = true;
-            break;
-
-        default:
-            break;
-        }
-    }
-
-    if (pg_cnts_needed) {
-        if (SX_STATUS_SUCCESS !=
-            (sai_status =
-                 sx_api_port_counter_buff_get(gh_sdk, cmd,
-                                              g_sai_db_ptr->ports_db[db_port_index].logical,
-                                              pg_ind, &pg_cnts))) {
-            SX_LOG_ERR("Failed to get port pg counters - %s.\n", SX_STATUS_MSG(sai_status));
-            return sdk_to_sai(sai_status);
-        }
-    }
-
-    if (occupancy_stats_needed) {
-        memset(&stats_usage, 0, sizeof(stats_usage));
-        stats_usage.port_cnt                                 = 1;
-        stats_usage.log_port_list_p                          = &g_sai_db_ptr->ports_db[db_port_index].logical;
-        stats_usage.sx_port_params.port_params_type          = SX_COS_INGRESS_PORT_PRIORITY_GROUP_ATTR_E;
-        stats_usage.sx_port_params.port_params_cnt           = 1;
-        stats_usage.sx_port_params.port_param.port_pg_list_p = &pg_ind;
-
-        if (SX_STATUS_SUCCESS !=
-            (sai_status = sx_api_cos_port_buff_type_statistic_get(gh_sdk, cmd, &stats_usage, 1,
-                                                                  &occupancy_stats, &usage_cnt))) {
-            SX_LOG_ERR("Failed to get PG stat counters - %s.\n", SX_STATUS_MSG(sai_status));
-            return sdk_to_sai(sai_status);
-        }
-    }
-
-    if (headroom_occupancy_stats_needed) {
-        memset(&stats_usage, 0, sizeof(stats_usage));
-        stats_usage.port_cnt                                 = 1;
-        stats_usage.log_port_list_p                          = &g_sai_db_ptr->ports_db[db_port_index].logical;
-        stats_usage.sx_port_params.port_params_type          = SX_COS_INGRESS_PORT_PRIORITY_GROUP_HEADROOM_ATTR_E;
-        stats_usage.sx_port_params.port_params_cnt           = 1;
-        stats_usage.sx_port_params.port_param.port_pg_list_p = &pg_ind;
-
-        if (SX_STATUS_SUCCESS !=
-            (sai_status = sx_api_cos_port_buff_type_statistic_get(gh_sdk, cmd, &stats_usage, 1,
-                                                                  &headroom_occupancy_stats, &usage_cnt))) {
-            SX_LOG_ERR("Failed to get PG headroom stat counters - %s.\n", SX_STATUS_MSG(sai_status));
-            return sdk_to_sai(sai_status);
-        }
-    }
+    sai_status_t                        sai_status;
+    uint32_t                            ii, buff_ind;
+    uint32_t                           *port_pg_profile_refs = NULL;
+    mlnx_sai_db_buffer_profile_entry_t *buff_db_entry        = NULL;
 
     for (ii = 0; ii < number_of_counters; ii++) {
         switch (counter_ids[ii]) {
@@ -4241,25 +4309,25 @@ sai_status_t mlnx_sai_get_ingress_priority_group_stats_ext(_In_ sai_object_id_t
             return SAI_STATUS_NOT_SUPPORTED;
 
         case SAI_INGRESS_PRIORITY_GROUP_STAT_PACKETS:
-            counters[ii] = pg_cnts.rx_frames;
+            counters[ii] = pg_cnts->rx_frames;
             break;
 
         case SAI_INGRESS_PRIORITY_GROUP_STAT_BYTES:
-            counters[ii] = pg_cnts.rx_octet;
+            counters[ii] = pg_cnts->rx_octet;
             break;
 
         case SAI_INGRESS_PRIORITY_GROUP_STAT_DROPPED_PACKETS:
             /* On SPC, shared buffer discards is always 0 */
-            counters[ii] = pg_cnts.rx_buffer_discard + pg_cnts.rx_shared_buffer_discard;
+            counters[ii] = pg_cnts->rx_buffer_discard + pg_cnts->rx_shared_buffer_discard;
             break;
 
         case SAI_INGRESS_PRIORITY_GROUP_STAT_CURR_OCCUPANCY_BYTES:
-            counters[ii] = mlnx_cells_to_bytes(occupancy_stats.statistics.curr_occupancy);
+            counters[ii] = mlnx_cells_to_bytes(occupancy_stats->statistics.curr_occupancy);
             break;
 
         case SAI_INGRESS_PRIORITY_GROUP_STAT_SHARED_WATERMARK_BYTES:
         case SAI_INGRESS_PRIORITY_GROUP_STAT_WATERMARK_BYTES:
-            counters[ii] = mlnx_cells_to_bytes(occupancy_stats.statistics.watermark);
+            counters[ii] = mlnx_cells_to_bytes(occupancy_stats->statistics.watermark);
             break;
 
         case SAI_INGRESS_PRIORITY_GROUP_STAT_XOFF_ROOM_WATERMARK_BYTES:
@@ -4279,10 +4347,10 @@ sai_status_t mlnx_sai_get_ingress_priority_group_stats_ext(_In_ sai_object_id_t
                 /* only relevant to loseless when either xon/xoff isn't 0. lossy is 0 */
                 if ((buff_db_entry->xon != 0) || (buff_db_entry->xoff != 0)) {
                     /* watermark is from xoff threshold. xoff threshold is available bytes in reserved buffer */
-                    if (mlnx_cells_to_bytes(headroom_occupancy_stats.statistics.watermark) >
+                    if (mlnx_cells_to_bytes(headroom_occupancy_stats->statistics.watermark) >
                         (buff_db_entry->reserved_size - buff_db_entry->xoff)) {
                         counters[ii] =
-                            mlnx_cells_to_bytes(headroom_occupancy_stats.statistics.watermark) + buff_db_entry->xoff -
+                            mlnx_cells_to_bytes(headroom_occupancy_stats->statistics.watermark) + buff_db_entry->xoff -
                             buff_db_entry->reserved_size;
                     }
                 }
@@ -4297,10 +4365,258 @@ sai_status_t mlnx_sai_get_ingress_priority_group_stats_ext(_In_ sai_object_id_t
             return SAI_STATUS_INVALID_PARAMETER;
         }
     }
-    SX_LOG_EXIT();
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static int mlnx_pg_stats_obj_cmp(const void *a, const void *b)
+{
+    const mlnx_pg_stats_obj_t *obj_a = a;
+    const mlnx_pg_stats_obj_t *obj_b = b;
+
+    if (obj_a->db_port_index != obj_b->db_port_index) {
+        return (obj_a->db_port_index < obj_b->db_port_index) ? -1 : 1;
+    }
+
+    if (obj_a->pg_ind != obj_b->pg_ind) {
+        return (obj_a->pg_ind < obj_b->pg_ind) ? -1 : 1;
+    }
+
+    return (obj_a->obj_idx < obj_b->obj_idx) ? -1 : (obj_a->obj_idx > obj_b->obj_idx);
+}
+
+static sai_status_t mlnx_pg_port_occupancy_get(_In_ sx_port_log_id_t                 log_port,
+                                               _In_ bool                             headroom,
+                                               _In_ sx_access_cmd_t                  cmd,
+                                               _In_ uint32_t                        *pg_list,
+                                               _In_ uint32_t                         pg_count,
+                                               _Out_ sx_port_occupancy_statistics_t *occupancy_list)
+{
+    sx_port_statistic_usage_params_t stats_usage;
+    uint32_t                         usage_cnt = pg_count;
+    sx_status_t                      sx_status;
+
+    memset(&stats_usage, 0, sizeof(stats_usage));
+    stats_usage.port_cnt                                 = 1;
+    stats_usage.log_port_list_p                          = &log_port;
+    stats_usage.sx_port_params.port_params_type          = headroom ?
+                                                           SX_COS_INGRESS_PORT_PRIORITY_GROUP_HEADROOM_ATTR_E :
+                                                           SX_COS_INGRESS_PORT_PRIORITY_GROUP_ATTR_E;
+    stats_usage.sx_port_params.port_params_cnt           = pg_count;
+    stats_usage.sx_port_params.port_param.port_pg_list_p = pg_list;
+
+    if (SX_STATUS_SUCCESS !=
+        (sx_status = sx_api_cos_port_buff_type_statistic_get(gh_sdk, cmd, &stats_usage, 1,
+                                                             occupancy_list, &usage_cnt))) {
+        SX_LOG_ERR("Failed to get PG stat counters - %s.\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    if (usage_cnt != pg_count) {
+        SX_LOG_ERR("Got %u PG stat counters for port 0x%x, expected %u\n", usage_cnt, log_port, pg_count);
+        return SAI_STATUS_FAILURE;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Read the counters of all the requested PGs of one port.
+ * Occupancy and headroom occupancy of all PGs are read with one buffer statistics call each,
+ * only the PG buffer counters are read per PG.
+ */
+static void mlnx_pg_port_stats_get(_In_ const mlnx_pg_stats_obj_t         *objs,
+                                   _In_ uint32_t                           objs_count,
+                                   _In_ uint32_t                           number_of_counters,
+                                   _In_ const sai_stat_id_t               *counter_ids,
+                                   _In_ sx_access_cmd_t                    cmd,
+                                   _In_ bool                               pg_cnts_needed,
+                                   _In_ bool                               occupancy_stats_needed,
+                                   _In_ bool                               headroom_occupancy_stats_needed,
+                                   _Inout_ uint32_t                       *pg_list,
+                                   _Inout_ sx_port_occupancy_statistics_t *occupancy_list,
+                                   _Inout_ sx_port_occupancy_statistics_t *headroom_occupancy_list,
+                                   _Out_ sai_status_t                     *object_statuses,
+                                   _Out_ uint64_t                         *counters)
+{
+    sx_port_log_id_t    log_port = g_sai_db_ptr->ports_db[objs[0].db_port_index].logical;
+    sx_port_cntr_buff_t pg_cnts;
+    sai_status_t        sai_status, port_status = SAI_STATUS_SUCCESS;
+    uint32_t            ii;
+
+    for (ii = 0; ii < objs_count; ii++) {
+        pg_list[ii] = objs[ii].pg_ind;
+    }
+
+    if (occupancy_stats_needed) {
+        port_status = mlnx_pg_port_occupancy_get(log_port, false, cmd, pg_list, objs_count, occupancy_list);
+    }
+
+    if ((SAI_STATUS_SUCCESS == port_status) && headroom_occupancy_stats_needed) {
+        port_status = mlnx_pg_port_occupancy_get(log_port, true, cmd, pg_list, objs_count,
+                                                 headroom_occupancy_list);
+    }
+
+    for (ii = 0; ii < objs_count; ii++) {
+        sai_status = port_status;
+        memset(&pg_cnts, 0, sizeof(pg_cnts));
+
+        if ((SAI_STATUS_SUCCESS == sai_status) && pg_cnts_needed) {
+            if (SX_STATUS_SUCCESS !=
+                (sai_status = sx_api_port_counter_buff_get(gh_sdk, cmd, log_port, objs[ii].pg_ind, &pg_cnts))) {
+                SX_LOG_ERR("Failed to get port pg counters - %s.\n", SX_STATUS_MSG(sai_status));
+                sai_status = sdk_to_sai(sai_status);
+            }
+        }
+
+        if (SAI_STATUS_SUCCESS == sai_status) {
+            sai_status = mlnx_pg_stats_fill(objs[ii].db_port_index, objs[ii].pg_ind, number_of_counters,
+                                            counter_ids, &pg_cnts, &occupancy_list[ii],
+                                            &headroom_occupancy_list[ii],
+                                            &counters[(uint64_t)objs[ii].obj_idx * number_of_counters]);
+        }
+
+        object_statuses[objs[ii].obj_idx] = sai_status;
+    }
+}
+
+sai_status_t mlnx_sai_get_ingress_priority_group_stats_ext(_In_ sai_object_id_t      ingress_priority_group_id,
+                                                           _In_ uint32_t             number_of_counters,
+                                                           _In_ const sai_stat_id_t *counter_ids,
+                                                           _In_ sai_stats_mode_t     mode,
+                                                           _Out_ uint64_t           *counters)
+{
+    sai_status_t sai_status, object_status;
+
+    if (0 == number_of_counters) {
+        SX_LOG_ERR("0 number_of_counters array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_status = mlnx_bulk_object_get_stats(SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP, 1, &ingress_priority_group_id,
+                                            number_of_counters, counter_ids, mode, &object_status, counters);
+    if (SAI_ERR(sai_status)) {
+        return SAI_STATUS_FAILURE == sai_status ? object_status : sai_status;
+    }
+
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * Get statistics counters of several ingress priority groups.
+ * PGs are grouped by port, see mlnx_pg_port_stats_get() for the SDK reads per port.
+ */
+sai_status_t mlnx_get_ingress_priority_groups_stats_bulk(_In_ uint32_t               object_count,
+                                                         _In_ const sai_object_id_t *pg_ids,
+                                                         _In_ uint32_t               number_of_counters,
+                                                         _In_ const sai_stat_id_t   *counter_ids,
+                                                         _In_ sai_stats_mode_t       mode,
+                                                         _Out_ sai_status_t         *object_statuses,
+                                                         _Out_ uint64_t             *counters)
+{
+    sai_status_t                    sai_status, bulk_status = SAI_STATUS_SUCCESS;
+    mlnx_pg_stats_obj_t            *objs                    = NULL;
+    uint32_t                       *pg_list                 = NULL;
+    sx_port_occupancy_statistics_t *occupancy_list          = NULL;
+    sx_port_occupancy_statistics_t *headroom_occupancy_list = NULL;
+    uint32_t                        ii, objs_count = 0, run_start;
+    char                            key_str[MAX_KEY_STR_LEN];
+    bool                            pg_cnts_needed                  = false, occupancy_stats_needed = false,
+                                    headroom_occupancy_stats_needed = false;
+    sx_access_cmd_t                 cmd;
+
+    SX_LOG_ENTER();
+
+    if (SAI_STATUS_SUCCESS !=
+        (sai_status = mlnx_stats_bulk_params_check(object_count, pg_ids, number_of_counters, counter_ids,
+                                                   object_statuses, counters))) {
+        SX_LOG_EXIT();
+        return sai_status;
+    }
+    if (SAI_STATUS_SUCCESS !=
+        (sai_status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd))) {
+        SX_LOG_EXIT();
+        return sai_status;
+    }
+
+    for (ii = 0; ii < number_of_counters; ii++) {
+        switch (counter_ids[ii]) {
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_PACKETS:
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_BYTES:
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_DROPPED_PACKETS:
+            pg_cnts_needed = true;
+            break;
+
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_CURR_OCCUPANCY_BYTES:
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_WATERMARK_BYTES:
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_SHARED_WATERMARK_BYTES:
+            occupancy_stats_needed = true;
+            break;
+
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_XOFF_ROOM_WATERMARK_BYTES:
+            headroom_occupancy_stats_needed = true;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    objs                    = calloc(object_count, sizeof(*objs));
+    pg_list                 = calloc(object_count, sizeof(*pg_list));
+    occupancy_list          = calloc(object_count, sizeof(*occupancy_list));
+    headroom_occupancy_list = calloc(object_count, sizeof(*headroom_occupancy_list));
+    if (!objs || !pg_list || !occupancy_list || !headroom_occupancy_list) {
+        SX_LOG_ERR("Failed to allocate memory for PG stats\n");
+        sai_status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        pg_key_to_str(pg_ids[ii], key_str);
+        SX_LOG_DBG("Get PG stats %s\n", key_str);
+
+        object_statuses[ii] = get_pg_data(pg_ids[ii], &objs[objs_count].db_port_index, &objs[objs_count].pg_ind);
+        if (SAI_ERR(object_statuses[ii])) {
+            bulk_status = SAI_STATUS_FAILURE;
+            continue;
+        }
+
+        objs[objs_count].obj_idx = ii;
+        objs_count++;
+    }
+
+    qsort(objs, objs_count, sizeof(*objs), mlnx_pg_stats_obj_cmp);
+
+    run_start = 0;
+    for (ii = 1; ii <= objs_count; ii++) {
+        if ((ii < objs_count) && (objs[ii].db_port_index == objs[run_start].db_port_index)) {
+            continue;
+        }
+
+        mlnx_pg_port_stats_get(&objs[run_start], ii - run_start, number_of_counters, counter_ids, cmd,
+                               pg_cnts_needed, occupancy_stats_needed, headroom_occupancy_stats_needed,
+                               pg_list, occupancy_list, headroom_occupancy_list, object_statuses, counters);
+        run_start = ii;
+    }
+
+    for (ii = 0; ii < objs_count; ii++) {
+        if (SAI_ERR(object_statuses[objs[ii].obj_idx])) {
+            bulk_status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    sai_status = bulk_status;
+
+out:
+    free(objs);
+    free(pg_list);
+    free(occupancy_list);
+    free(headroom_occupancy_list);
+    SX_LOG_EXIT();
+    return sai_status;
+}
+
 sai_status_t mlnx_sai_get_ingress_priority_group_stats(_In_ sai_object_id_t       ingress_pg_id,
                                                        _In_ uint32_t              number_of_counters,
                                                        _In_ const sai_stat_id_t * counter_ids,
@@ -4501,6 +4817,9 @@ sai_status_t mlnx_buffer_apply(_In_ sai_object_id_t sai_buffer, _In_ sai_object_
         return sai_status;
     }
     queue_cfg->buffer_id = sai_buffer;
+    mlnx_sai_buffer_profile_ref_set(qos_db_port_index, PORT_BUFF_TYPE_QUEUE, qos_ext_data[0],
+                                    (SAI_NULL_OBJECT_ID != sai_buffer) ?
+                                    db_buffer_profile_index : SENTINEL_BUFFER_DB_ENTRY_INDEX);
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -4812,34 +5131,40 @@ static sai_status_t mlnx_sai_is_buffer_in_use(_In_ sai_object_id_t buffer_profil
 {
     sai_status_t                  sai_status;
     uint32_t                      port_ind;
-    mlnx_port_config_t           *port;
+    uint32_t                      db_buffer_profile_index;
     mlnx_affect_port_buff_items_t affected_items;
 
     SX_LOG_ENTER();
+    if (SAI_STATUS_SUCCESS !=
+        (sai_status = get_buffer_profile_db_index(buffer_profile_id, &db_buffer_profile_index))) {
+        SX_LOG_EXIT();
+        return sai_status;
+    }
+    if (0 == g_sai_buffer_db_ptr->buffer_profile_refs[db_buffer_profile_index]) {
+        SX_LOG_EXIT();
+        return SAI_STATUS_SUCCESS;
+    }
+
+    /* Log the references of the first port using the profile */
+    port_ind = (g_sai_buffer_db_ptr->buffer_profile_refs[db_buffer_profile_index] - 1) /
+               BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE;
     if (!alloc_affected_items(&affected_items)) {
         SX_LOG_EXIT();
         return SAI_STATUS_NO_MEMORY;
     }
-    mlnx_port_phy_foreach(port, port_ind) {
-        sai_status = mlnx_sai_collect_buffer_refs(buffer_profile_id, port_ind, &affected_items);
-        if (SAI_STATUS_ITEM_NOT_FOUND == sai_status) {
-            continue;
-        }
-        if (SAI_STATUS_SUCCESS != sai_status) {
-            SX_LOG_ERR("Failed to obtain references to buffer profile:0x%" PRIx64 "\n", buffer_profile_id);
-            free_affected_items(&affected_items);
-            SX_LOG_EXIT();
-            return sai_status;
-        }
-        SX_LOG_ERR("Buffer profile is in use by port[%d].logical==%d\n", port_ind, port->logical);
-        log_buffer_profile_refs(&affected_items);
+    sai_status = mlnx_sai_collect_buffer_refs(buffer_profile_id, port_ind, &affected_items);
+    if (SAI_STATUS_SUCCESS != sai_status) {
+        SX_LOG_ERR("Failed to obtain references to buffer profile:0x%" PRIx64 "\n", buffer_profile_id);
         free_affected_items(&affected_items);
         SX_LOG_EXIT();
-        return SAI_STATUS_OBJECT_IN_USE;
+        return sai_status;
     }
+    SX_LOG_ERR("Buffer profile is in use by port[%d].logical==%d\n", port_ind,
+               g_sai_db_ptr->ports_db[port_ind].logical);
+    log_buffer_profile_refs(&affected_items);
     free_affected_items(&affected_items);
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return SAI_STATUS_OBJECT_IN_USE;
 }
 
 sai_status_t mlnx_buffer_convert_alpha_sai_to_sx(_In_ sai_int8_t sai_alpha, _Out_ sx_cos_port_buff_alpha_e   *sx_alpha)
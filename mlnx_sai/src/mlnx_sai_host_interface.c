@@ -22,6 +22,8 @@
 #ifndef _WIN32
 #include <net/if.h>
 #include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
 #endif
 
 #undef  __MODULE__
@@ -534,12 +536,60 @@ static sai_status_t find_sai_trap_index(_In_ uint32_t         trap_id,
     return SAI_STATUS_ITEM_NOT_FOUND;
 }
 
+/* SDK trap id -> SAI trap, built once from mlnx_traps_info to keep the packet receive path free of scans */
+typedef struct _mlnx_sdk_trap_map_entry_t {
+    const mlnx_trap_info_t *info; /* NULL if SDK trap is not mapped */
+    sai_object_id_t         trap_oid;
+} mlnx_sdk_trap_map_entry_t;
+static mlnx_sdk_trap_map_entry_t mlnx_sdk_trap_map[SXD_TRAP_ID_ACL_MAX];
+static pthread_once_t            mlnx_sdk_trap_map_once = PTHREAD_ONCE_INIT;
+
+static void mlnx_sdk_trap_map_init(void)
+{
+    const mlnx_trap_info_t *info;
+    uint32_t                curr_index, curr_trap, sdk_trap_id;
+    sai_status_t            status;
+
+    for (curr_index = 0; END_TRAP_INFO_ID != mlnx_traps_info[curr_index].trap_id; curr_index++) {
+        info = &mlnx_traps_info[curr_index];
+
+        for (curr_trap = 0; curr_trap < info->sdk_traps_num; curr_trap++) {
+            sdk_trap_id = info->sdk_trap_ids[curr_trap];
+
+            /* First match wins, same as the scan of mlnx_traps_info */
+            if ((sdk_trap_id >= SXD_TRAP_ID_ACL_MAX) || mlnx_sdk_trap_map[sdk_trap_id].info) {
+                continue;
+            }
+
+            status = mlnx_create_object((info->trap_type == MLNX_TRAP_TYPE_REGULAR) ? SAI_OBJECT_TYPE_HOSTIF_TRAP :
+                                        SAI_OBJECT_TYPE_HOSTIF_USER_DEFINED_TRAP,
+                                        info->trap_id, NULL, &mlnx_sdk_trap_map[sdk_trap_id].trap_oid);
+            if (SAI_ERR(status)) {
+                continue;
+            }
+
+            mlnx_sdk_trap_map[sdk_trap_id].info = info;
+        }
+    }
+}
+
+static const mlnx_sdk_trap_map_entry_t* mlnx_sdk_trap_map_get(_In_ sx_trap_id_t sdk_trap_id)
+{
+    pthread_once(&mlnx_sdk_trap_map_once, mlnx_sdk_trap_map_init);
+
+    if (((uint32_t)sdk_trap_id >= SXD_TRAP_ID_ACL_MAX) || !mlnx_sdk_trap_map[sdk_trap_id].info) {
+        return NULL;
+    }
+
+    return &mlnx_sdk_trap_map[sdk_trap_id];
+}
+
 sai_status_t mlnx_translate_sdk_trap_to_sai(_In_ sx_trap_id_t             sdk_trap_id,
                                             _Out_ sai_hostif_trap_type_t *trap_id,
                                             _Out_ const char            **trap_name,
                                             _Out_ mlnx_trap_type_t       *trap_type)
 {
-    uint32_t curr_index, curr_trap;
+    const mlnx_sdk_trap_map_entry_t *entry;
 
     SX_LOG_ENTER();
 
@@ -556,20 +606,38 @@ sai_status_t mlnx_translate_sdk_trap_to_sai(_In_ sx_trap_id_t             sdk_tr
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    for (curr_index = 0; END_TRAP_INFO_ID != mlnx_traps_info[curr_index].trap_id; curr_index++) {
-        for (curr_trap = 0; curr_trap < mlnx_traps_info[curr_index].sdk_traps_num; curr_trap++) {
-            if (sdk_trap_id == mlnx_traps_info[curr_index].sdk_trap_ids[curr_trap]) {
-                *trap_id   = mlnx_traps_info[curr_index].trap_id;
-                *trap_name = mlnx_traps_info[curr_index].trap_name;
-                *trap_type = mlnx_traps_info[curr_index].trap_type;
-                SX_LOG_EXIT();
-                return SAI_STATUS_SUCCESS;
-            }
-        }
+    entry = mlnx_sdk_trap_map_get(sdk_trap_id);
+    if (!entry) {
+        SX_LOG_EXIT();
+        return SAI_STATUS_ITEM_NOT_FOUND;
     }
 
+    *trap_id   = entry->info->trap_id;
+    *trap_name = entry->info->trap_name;
+    *trap_type = entry->info->trap_type;
+
     SX_LOG_EXIT();
-    return SAI_STATUS_ITEM_NOT_FOUND;
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t mlnx_translate_sdk_trap_to_sai_oid(_In_ sx_trap_id_t       sdk_trap_id,
+                                                _Out_ sai_object_id_t *trap_oid,
+                                                _Out_ const char     **trap_name)
+{
+    const mlnx_sdk_trap_map_entry_t *entry;
+
+    assert(trap_oid);
+    assert(trap_name);
+
+    entry = mlnx_sdk_trap_map_get(sdk_trap_id);
+    if (!entry) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    *trap_oid  = entry->trap_oid;
+    *trap_name = entry->info->trap_name;
+
+    return SAI_STATUS_SUCCESS;
 }
 
 sai_status_t mlnx_translate_sai_trap_to_sdk(_In_ sai_object_id_t trap_oid, _Out_ sx_trap_id_t   *sx_trap_id)
@@ -2969,137 +3037,205 @@ static sai_status_t mlnx_user_defined_trap_group_get(_In_ const sai_object_key_t
     return SAI_STATUS_SUCCESS;
 }
 
+/* Per thread receive info, so the receive path doesn't allocate */
+static __thread sx_receive_info_t mlnx_hostif_rx_info;
+
+static sai_status_t mlnx_hostif_rx_packet_fill(_In_ const sx_receive_info_t    *receive_info,
+                                               _Inout_ mlnx_hostif_rx_packet_t *packet)
+{
+    const char  *trap_name;
+    sai_status_t status;
+
+    if (SX_INVALID_PORT == receive_info->source_log_port) {
+        SX_LOG_ERR("sx_api_host_ifc_recv returned unknown port\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    status = mlnx_translate_sdk_trap_to_sai_oid(receive_info->trap_id, &packet->trap_oid, &trap_name);
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("unknown sdk trap %u\n", receive_info->trap_id);
+        return status;
+    }
+
+    status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, receive_info->source_log_port, NULL, &packet->port_oid);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    if (receive_info->is_lag) {
+        status = mlnx_create_object(SAI_OBJECT_TYPE_LAG, receive_info->source_lag_port, NULL, &packet->lag_oid);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    } else {
+        packet->lag_oid = SAI_NULL_OBJECT_ID;
+    }
+
+    SX_LOG_INF("Received trap %s port %x\n", trap_name, receive_info->source_log_port);
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /*
  * Routine Description:
- *   hostif receive function
+ *   hostif batched receive function. Waits for the first packet, then receives the packets already
+ *   queued on the fd, up to count
  *
  * Arguments:
  *    [in]  hif_id  - host interface id
- *    [in,out] buffer_size - [in] allocated buffer size. [out] actual packet size in bytes
- *    [out] buffer - packet buffer
- *    [in,out] attr_count - [in] allocated list size. [out] number of attributes
- *    [out] attr_list - array of attributes
+ *    [in,out] packets - [in] caller buffers and their sizes. [out] packet sizes, trap/port/lag oids and
+ *                       per packet status
+ *    [in,out] count - [in] number of packets. [out] number of filled packets. Receive stops after
+ *                     the first packet with failure status
  *
  * Return Values:
- *    SAI_STATUS_SUCCESS on success
- *    SAI_STATUS_BUFFER_OVERFLOW if buffer_size is insufficient,
- *    and buffer_size will be filled with required size. Or
- *    if attr_count is insufficient, and attr_count
- *    will be filled with required count.
- *    Failure status code on error
+ *    SAI_STATUS_SUCCESS if at least one packet was received, status of the first packet otherwise
  */
-static sai_status_t mlnx_recv_hostif_packet(_In_ sai_object_id_t   hif_id,
-                                            _Inout_ sai_size_t    *buffer_size,
-                                            _Out_ void            *buffer,
-                                            _Inout_ uint32_t      *attr_count,
-                                            _Out_ sai_attribute_t *attr_list)
-{
-    sx_receive_info_t     *receive_info = NULL;
-    mlnx_object_id_t       mlnx_hif     = {0};
-    uint32_t               packet_size;
-    const char            *trap_name;
-    sai_hostif_trap_type_t trap_id;
-    sai_status_t           status = SAI_STATUS_SUCCESS;
-    sx_fd_t                fd;
-    mlnx_trap_type_t       trap_type;
+sai_status_t mlnx_recv_hostif_packet_batch(_In_ sai_object_id_t             hif_id,
+                                           _Inout_ mlnx_hostif_rx_packet_t *packets,
+                                           _Inout_ uint32_t                *count)
+{
+    sx_receive_info_t *receive_info = &mlnx_hostif_rx_info;
+    mlnx_object_id_t   mlnx_hif     = {0};
+    uint32_t           packet_size, ii;
+    sai_status_t       status;
+    sx_status_t        sx_status;
+    sx_fd_t            fd;
+    struct pollfd      pfd;
 
     SX_LOG_ENTER();
 
-    memset(&fd, 0, sizeof(fd));
+    assert(packets);
+    assert(count);
 
-    if (*attr_count < RECV_ATTRIBS_NUM) {
-        SX_LOG_ERR("Insufficient attribute count %u %u\n", RECV_ATTRIBS_NUM, *attr_count);
-        *attr_count = RECV_ATTRIBS_NUM;
-        return SAI_STATUS_BUFFER_OVERFLOW;
+    if (0 == *count) {
+        SX_LOG_ERR("Zero packet count\n");
+        return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    receive_info = (sx_receive_info_t*)calloc(1, sizeof(*receive_info));
-    if (NULL == receive_info) {
-        SX_LOG_ERR("Can't allocate receive_info memory\n");
-        status = SX_STATUS_NO_MEMORY;
-        goto out;
-    }
+    memset(&fd, 0, sizeof(fd));
 
     status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_HOSTIF, hif_id, &mlnx_hif);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     status = check_host_if_is_valid(mlnx_hif);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     cl_plock_acquire(&g_sai_db_ptr->p_lock);
 
     if (SAI_HOSTIF_OBJECT_TYPE_FD != g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) {
         SX_LOG_ERR("Can't recv on non FD host interface type %u\n", g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type);
-        status = SAI_STATUS_INVALID_PARAMETER;
         cl_plock_release(&g_sai_db_ptr->p_lock);
-        goto out;
+        return SAI_STATUS_INVALID_PARAMETER;
     }
 
     memcpy(&fd, &g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].fd, sizeof(fd));
     cl_plock_release(&g_sai_db_ptr->p_lock);
 
-    packet_size = (uint32_t)*buffer_size;
-    if (SX_STATUS_SUCCESS != (status = sx_lib_host_ifc_recv(&fd, buffer, &packet_size, receive_info))) {
-        if (SX_STATUS_NO_MEMORY == status) {
-            SX_LOG_ERR("sx_api_host_ifc_recv failed with insufficient buffer %u %zu\n", packet_size, *buffer_size);
-            *buffer_size = packet_size;
-            status       = SAI_STATUS_BUFFER_OVERFLOW;
-            goto out;
+    pfd.fd     = fd.fd;
+    pfd.events = POLLIN;
+
+    for (ii = 0; ii < *count; ii++) {
+        if (ii > 0) {
+            pfd.revents = 0;
+            if ((poll(&pfd, 1, 0) <= 0) || !(pfd.revents & POLLIN)) {
+                break;
+            }
         }
-        SX_LOG_ERR("sx_api_host_ifc_recv failed with error %s\n", SX_STATUS_MSG(status));
-        status = sdk_to_sai(status);
-        goto out;
-    }
-    *buffer_size = packet_size;
 
-    *attr_count     = RECV_ATTRIBS_NUM;
-    attr_list[0].id = SAI_HOSTIF_PACKET_ATTR_HOSTIF_TRAP_ID;
-    attr_list[1].id = SAI_HOSTIF_PACKET_ATTR_INGRESS_PORT;
-    attr_list[2].id = SAI_HOSTIF_PACKET_ATTR_INGRESS_LAG;
+        packet_size = (uint32_t)packets[ii].buffer_size;
+        sx_status   = sx_lib_host_ifc_recv(&fd, packets[ii].buffer, &packet_size, receive_info);
+        if (SX_STATUS_SUCCESS != sx_status) {
+            if (SX_STATUS_NO_MEMORY == sx_status) {
+                SX_LOG_ERR("sx_api_host_ifc_recv failed with insufficient buffer %u %zu\n", packet_size,
+                           packets[ii].buffer_size);
+                packets[ii].buffer_size = packet_size;
+                packets[ii].status      = SAI_STATUS_BUFFER_OVERFLOW;
+            } else {
+                SX_LOG_ERR("sx_api_host_ifc_recv failed with error %s\n", SX_STATUS_MSG(sx_status));
+                packets[ii].status = sdk_to_sai(sx_status);
+            }
+            ii++;
+            break;
+        }
 
-    if (SX_INVALID_PORT == receive_info->source_log_port) {
-        SX_LOG_ERR("sx_api_host_ifc_recv returned unknown port\n");
-        status = SAI_STATUS_FAILURE;
-        goto out;
+        packets[ii].buffer_size = packet_size;
+        packets[ii].status      = mlnx_hostif_rx_packet_fill(receive_info, &packets[ii]);
+        if (SAI_ERR(packets[ii].status)) {
+            ii++;
+            break;
+        }
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_translate_sdk_trap_to_sai(receive_info->trap_id, &trap_id, &trap_name, &trap_type))) {
-        SX_LOG_ERR("unknown sdk trap %u\n", receive_info->trap_id);
-        goto out;
-    }
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             mlnx_create_object((trap_type ==
-                                 MLNX_TRAP_TYPE_REGULAR) ? SAI_OBJECT_TYPE_HOSTIF_TRAP :
-                                SAI_OBJECT_TYPE_HOSTIF_USER_DEFINED_TRAP,
-                                trap_id, NULL, &attr_list[0].value.oid))) {
-        goto out;
+    *count = ii;
+
+    SX_LOG_EXIT();
+    return packets[0].status;
+}
+
+/*
+ * Routine Description:
+ *   hostif receive function
+ *
+ * Arguments:
+ *    [in]  hif_id  - host interface id
+ *    [in,out] buffer_size - [in] allocated buffer size. [out] actual packet size in bytes
+ *    [out] buffer - packet buffer
+ *    [in,out] attr_count - [in] allocated list size. [out] number of attributes
+ *    [out] attr_list - array of attributes
+ *
+ * Return Values:
+ *    SAI_STATUS_SUCCESS on success
+ *    SAI_STATUS_BUFFER_OVERFLOW if buffer_size is insufficient,
+ *    and buffer_size will be filled with required size. Or
+ *    if attr_count is insufficient, and attr_count
+ *    will be filled with required count.
+ *    Failure status code on error
+ */
+static sai_status_t mlnx_recv_hostif_packet(_In_ sai_object_id_t   hif_id,
+                                            _Inout_ sai_size_t    *buffer_size,
+                                            _Out_ void            *buffer,
+                                            _Inout_ uint32_t      *attr_count,
+                                            _Out_ sai_attribute_t *attr_list)
+{
+    mlnx_hostif_rx_packet_t packet;
+    uint32_t                count = 1;
+    sai_status_t            status;
+
+    SX_LOG_ENTER();
+
+    if (*attr_count < RECV_ATTRIBS_NUM) {
+        SX_LOG_ERR("Insufficient attribute count %u %u\n", RECV_ATTRIBS_NUM, *attr_count);
+        *attr_count = RECV_ATTRIBS_NUM;
+        return SAI_STATUS_BUFFER_OVERFLOW;
     }
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, receive_info->source_log_port, NULL,
-                                                           &attr_list[1].value.oid))) {
-        goto out;
+    memset(&packet, 0, sizeof(packet));
+    packet.buffer      = buffer;
+    packet.buffer_size = *buffer_size;
+
+    status = mlnx_recv_hostif_packet_batch(hif_id, &packet, &count);
+    if (count > 0) {
+        *buffer_size = packet.buffer_size;
     }
 
-    if (receive_info->is_lag) {
-        if (SAI_STATUS_SUCCESS !=
-            (status = mlnx_create_object(SAI_OBJECT_TYPE_LAG, receive_info->source_lag_port, NULL,
-                                         &attr_list[2].value.oid))) {
-            goto out;
-        }
-    } else {
-        attr_list[2].value.oid = SAI_NULL_OBJECT_ID;
+    if (SAI_ERR(status)) {
+        goto out;
     }
 
-    SX_LOG_INF("Received trap %s port %x\n", trap_name, receive_info->source_log_port);
+    *attr_count            = RECV_ATTRIBS_NUM;
+    attr_list[0].id        = SAI_HOSTIF_PACKET_ATTR_HOSTIF_TRAP_ID;
+    attr_list[0].value.oid = packet.trap_oid;
+    attr_list[1].id        = SAI_HOSTIF_PACKET_ATTR_INGRESS_PORT;
+    attr_list[1].value.oid = packet.port_oid;
+    attr_list[2].id        = SAI_HOSTIF_PACKET_ATTR_INGRESS_LAG;
+    attr_list[2].value.oid = packet.lag_oid;
 
 out:
-    free(receive_info);
     SX_LOG_EXIT();
     return status;
 }
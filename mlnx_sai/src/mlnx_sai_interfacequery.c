@@ -39,6 +39,8 @@ static bool                g_initialized = false;
  */
 sai_status_t sai_api_initialize(_In_ uint64_t flags, _In_ const sai_service_method_table_t* services)
 {
+    sai_status_t status;
+
 #ifdef CONFIG_SYSLOG
     if (!g_initialized) {
         openlog("SAI", 0, LOG_USER);
@@ -61,6 +63,12 @@ sai_status_t sai_api_initialize(_In_ uint64_t flags, _In_ const sai_service_meth
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
+    status = mlnx_attr_dispatch_tables_init();
+    if (SAI_ERR(status)) {
+        MLNX_SAI_LOG_ERR("Failed to initialize attribute dispatch tables\n");
+        return status;
+    }
+
     g_initialized = true;
 
     return SAI_STATUS_SUCCESS;
@@ -229,6 +237,7 @@ sai_status_t sai_api_query(_In_ sai_api_t sai_api_id, _Out_ void** api_method_ta
 sai_status_t sai_api_uninitialize(void)
 {
     memset(&g_mlnx_services, 0, sizeof(g_mlnx_services));
+    mlnx_attr_dispatch_tables_deinit();
     g_initialized = false;
 
     return SAI_STATUS_SUCCESS;
@@ -470,6 +479,8 @@ sai_status_t sai_dbg_generate_dump(_In_ const char *dump_file_name)
 
     SAI_dump_queue(file);
 
+    SAI_dump_route(file);
+
     SAI_dump_samplepacket(file);
 
     SAI_dump_scheduler(file);
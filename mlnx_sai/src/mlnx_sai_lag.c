@@ -375,29 +375,37 @@ out:
 }
 
 /* When LAG is added to VLAN then it's members are added to this VLAN by SDK, but
- * SDK do not remove the port from this VLAN when the port is removed from LAG */
-static sai_status_t port_reset_vlan_params_from_port(mlnx_port_config_t *port, mlnx_port_config_t *lag)
+ * SDK do not remove the port from this VLAN when the port is removed from LAG.
+ * The VLAN list of the LAG is built once and the flood control is updated once per VLAN for all the ports */
+static sai_status_t port_reset_vlan_params_from_ports(mlnx_port_config_t **ports,
+                                                      uint32_t             port_count,
+                                                      mlnx_port_config_t  *lag)
 {
     uint16_t            vlan_count = 0;
     mlnx_bridge_port_t *lag_bport;
-    sx_port_vlans_t    *vlan_list;
+    sx_port_vlans_t    *vlan_list = NULL;
+    sx_port_log_id_t   *sx_ports  = NULL;
     sx_status_t         sx_status;
-    sai_status_t        status;
+    sai_status_t        status = SAI_STATUS_SUCCESS;
     uint16_t            vid;
     uint16_t            ii = 0;
+    uint32_t            jj;
 
-    /* Reset to default VLAN ingress filter */
-    sx_status = sx_api_vlan_port_ingr_filter_set(gh_sdk, port->logical, SX_INGR_FILTER_ENABLE);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Port ingress filter set %x failed - %s\n", port->logical, SX_STATUS_MSG(sx_status));
-        return sdk_to_sai(sx_status);
-    }
+    for (jj = 0; jj < port_count; jj++) {
+        /* Reset to default VLAN ingress filter */
+        sx_status = sx_api_vlan_port_ingr_filter_set(gh_sdk, ports[jj]->logical, SX_INGR_FILTER_ENABLE);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Port ingress filter set for port oid %" PRIx64 " failed - %s\n",
+                       ports[jj]->saiport, SX_STATUS_MSG(sx_status));
+            return sdk_to_sai(sx_status);
+        }
 
-    /* Reset port PVID to default VLAN=1 */
-    sx_status = sx_api_vlan_port_pvid_set(gh_sdk, SX_ACCESS_CMD_ADD, port->logical, DEFAULT_VLAN);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to set port pvid - %s.\n", SX_STATUS_MSG(sx_status));
-        return sdk_to_sai(sx_status);
+        sx_status = sx_api_vlan_port_pvid_set(gh_sdk, SX_ACCESS_CMD_ADD, ports[jj]->logical, DEFAULT_VLAN);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to set port oid %" PRIx64 " pvid - %s.\n",
+                       ports[jj]->saiport, SX_STATUS_MSG(sx_status));
+            return sdk_to_sai(sx_status);
+        }
     }
 
     if (!mlnx_port_is_in_bridge_1q(lag)) {
@@ -411,94 +419,195 @@ static sai_status_t port_reset_vlan_params_from_port(mlnx_port_config_t *port, m
     }
     vlan_count = lag_bport->vlans;
 
-    /* Remove port from VLANs on the LAG */
-    if (vlan_count) {
-        vlan_list = (sx_port_vlans_t*)calloc(vlan_count, sizeof(sx_port_vlans_t));
-        if (NULL == vlan_list) {
-            SX_LOG_ERR("Can't allocate vlan list\n");
-            return SAI_STATUS_NO_MEMORY;
-        }
+    if (!vlan_count) {
+        return SAI_STATUS_SUCCESS;
+    }
 
-        mlnx_vlan_id_foreach(vid) {
-            if (!mlnx_vlan_port_is_set(vid, lag_bport)) {
-                continue;
-            }
+    /* Remove ports from VLANs on the LAG */
+    vlan_list = (sx_port_vlans_t*)calloc(vlan_count, sizeof(sx_port_vlans_t));
+    sx_ports  = (sx_port_log_id_t*)calloc(port_count, sizeof(sx_port_log_id_t));
+    if ((NULL == vlan_list) || (NULL == sx_ports)) {
+        SX_LOG_ERR("Can't allocate vlan list\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
 
-            status = mlnx_fid_flood_ctrl_port_event_handle(vid, &mlnx_vlan_db_get_vlan(vid)->flood_data,
-                                                           &port->logical, 1, MLNX_PORT_EVENT_DELETE);
-            if (SAI_ERR(status)) {
-                free(vlan_list);
-                return status;
-            }
+    for (jj = 0; jj < port_count; jj++) {
+        sx_ports[jj] = ports[jj]->logical;
+    }
 
-            vlan_list[ii++].vid = vid;
+    mlnx_port_vlans_foreach(lag_bport, vid) {
+        status = mlnx_fid_flood_ctrl_port_event_handle(vid, &mlnx_vlan_db_get_vlan(vid)->flood_data,
+                                                       sx_ports, port_count, MLNX_PORT_EVENT_DELETE);
+        if (SAI_ERR(status)) {
+            goto out;
         }
 
+        vlan_list[ii++].vid = vid;
+    }
+
+    for (jj = 0; jj < port_count; jj++) {
         sx_status =
-            sx_api_vlan_port_multi_vlan_set(gh_sdk, SX_ACCESS_CMD_DELETE, port->logical, vlan_list, vlan_count);
-        free(vlan_list);
+            sx_api_vlan_port_multi_vlan_set(gh_sdk, SX_ACCESS_CMD_DELETE, sx_ports[jj], vlan_list, vlan_count);
         if (SX_ERR(sx_status)) {
             SX_LOG_ERR("Failed to delete vlans from port oid %" PRIx64 " - %s.\n",
-                       port->saiport, SX_STATUS_MSG(sx_status));
-
-            return sdk_to_sai(sx_status);
+                       ports[jj]->saiport, SX_STATUS_MSG(sx_status));
+            status = sdk_to_sai(sx_status);
+            goto out;
         }
     }
 
-    return sdk_to_sai(sx_status);
+out:
+    free(vlan_list);
+    free(sx_ports);
+    return status;
 }
 
-static sai_status_t remove_port_from_lag(sx_port_log_id_t lag_id, sx_port_log_id_t port_id)
+/* Removes the ports from the LAG with a single LAG port group update, when it fails for more than one port
+ * the ports are removed one by one so every port gets its own status. With stop_on_error the ports after
+ * the first failed one are not touched and get SAI_STATUS_NOT_EXECUTED */
+static sai_status_t remove_ports_from_lag(_In_ sx_port_log_id_t        lag_id,
+                                          _In_ const sx_port_log_id_t *port_ids,
+                                          _In_ uint32_t                port_count,
+                                          _In_ bool                    stop_on_error,
+                                          _Out_ sai_status_t          *port_statuses)
 {
-    sx_status_t         sx_status;
-    sai_status_t        status;
-    mlnx_port_config_t *port;
-    mlnx_port_config_t *lag;
+    sx_status_t          sx_status;
+    sai_status_t         status;
+    mlnx_port_config_t  *lag;
+    mlnx_port_config_t **ports       = NULL;
+    sx_port_log_id_t    *sx_ports    = NULL;
+    uint32_t            *ports_idx   = NULL;
+    uint32_t             ports_count = 0, removed_count = 0;
+    uint32_t             ii;
+    bool                 failure = false, retry_failure = false;
 
-    status = mlnx_port_by_log_id(port_id, &port);
-    if (SAI_ERR(status)) {
-        return status;
-    }
     status = mlnx_port_by_log_id(lag_id, &lag);
     if (SAI_ERR(status)) {
         return status;
     }
 
+    ports     = calloc(port_count, sizeof(*ports));
+    sx_ports  = calloc(port_count, sizeof(*sx_ports));
+    ports_idx = calloc(port_count, sizeof(*ports_idx));
+    if (!ports || !sx_ports || !ports_idx) {
+        SX_LOG_ERR("Can't allocate memory\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    for (ii = 0; ii < port_count; ii++) {
+        port_statuses[ii] = mlnx_port_by_log_id(port_ids[ii], &ports[ports_count]);
+        if (SAI_ERR(port_statuses[ii])) {
+            failure = true;
+            if (stop_on_error) {
+                break;
+            }
+            continue;
+        }
+
+        sx_ports[ports_count]  = port_ids[ii];
+        ports_idx[ports_count] = ii;
+        ports_count++;
+    }
+
+    for (ii++; ii < port_count; ii++) {
+        port_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    if (!ports_count) {
+        status = failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+        goto out;
+    }
+
     sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_DELETE, DEFAULT_ETH_SWID,
-                                          &lag_id, &port_id, 1);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed remove port log id %x from LAG log id %x - %s\n", port_id, lag_id,
+                                          &lag_id, sx_ports, ports_count);
+    if (SX_ERR(sx_status) && (ports_count == 1)) {
+        SX_LOG_ERR("Failed remove port log id %x from LAG log id %x - %s\n", sx_ports[0], lag_id,
                    SX_STATUS_MSG(sx_status));
-        status = sdk_to_sai(sx_status);
-        return status;
-    }
+        port_statuses[ports_idx[0]] = sdk_to_sai(sx_status);
+        failure                     = true;
+    } else if (SX_ERR(sx_status)) {
+        SX_LOG_NTC("Failed to remove %u ports from LAG log id %x at once - %s, removing one by one\n",
+                   ports_count, lag_id, SX_STATUS_MSG(sx_status));
+
+        /* Only a failure of the retry stops it, the ports before the failed lookup above are still removed */
+        for (ii = 0; ii < ports_count; ii++) {
+            if (retry_failure && stop_on_error) {
+                port_statuses[ports_idx[ii]] = SAI_STATUS_NOT_EXECUTED;
+                continue;
+            }
 
-    port->lag_id = 0;
+            sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_DELETE, DEFAULT_ETH_SWID,
+                                                  &lag_id, &sx_ports[ii], 1);
+            if (SX_ERR(sx_status)) {
+                SX_LOG_ERR("Failed remove port log id %x from LAG log id %x - %s\n", sx_ports[ii], lag_id,
+                           SX_STATUS_MSG(sx_status));
+                port_statuses[ports_idx[ii]] = sdk_to_sai(sx_status);
+                failure                      = true;
+                retry_failure                = true;
+                continue;
+            }
 
-    status = port_reset_vlan_params_from_port(port, lag);
-    if (SAI_ERR(status)) {
-        return status;
+            ports[removed_count]     = ports[ii];
+            ports_idx[removed_count] = ports_idx[ii];
+            removed_count++;
+        }
+    } else {
+        removed_count = ports_count;
     }
 
-    sx_status = mlnx_hash_ecmp_cfg_apply_on_port(port_id);
-    if (SX_ERR(sx_status)) {
-        return sdk_to_sai(sx_status);
+    if (!removed_count) {
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
 
-    sx_status = sx_api_fdb_port_learn_mode_set(gh_sdk, port_id, SX_FDB_LEARN_MODE_AUTO_LEARN);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to set port learning mode - %s\n", SX_STATUS_MSG(sx_status));
-        return sdk_to_sai(sx_status);
+    for (ii = 0; ii < removed_count; ii++) {
+        ports[ii]->lag_id = 0;
     }
 
-    /* Do re-apply for port params which were removed by us before add to the LAG */
-    status = mlnx_port_params_clone(port, lag, PORT_PARAMS_WRED | PORT_PARAMS_MIRROR | PORT_PARAMS_SFLOW |
-                                    PORT_PARAMS_POLICER | PORT_PARAMS_EGRESS_BLOCK);
+    status = port_reset_vlan_params_from_ports(ports, removed_count, lag);
     if (SAI_ERR(status)) {
-        return status;
+        for (ii = 0; ii < removed_count; ii++) {
+            port_statuses[ports_idx[ii]] = status;
+        }
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
 
-    return SAI_STATUS_SUCCESS;
+    for (ii = 0; ii < removed_count; ii++) {
+        port_statuses[ports_idx[ii]] = sdk_to_sai(mlnx_hash_ecmp_cfg_apply_on_port(ports[ii]->logical));
+        if (SAI_ERR(port_statuses[ports_idx[ii]])) {
+            failure = true;
+            continue;
+        }
+
+        sx_status = sx_api_fdb_port_learn_mode_set(gh_sdk, ports[ii]->logical, SX_FDB_LEARN_MODE_AUTO_LEARN);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to set port learning mode - %s\n", SX_STATUS_MSG(sx_status));
+            port_statuses[ports_idx[ii]] = sdk_to_sai(sx_status);
+            failure                      = true;
+            continue;
+        }
+
+        /* Do re-apply for port params which were removed by us before add to the LAG */
+        port_statuses[ports_idx[ii]] =
+            mlnx_port_params_clone(ports[ii], lag, PORT_PARAMS_WRED | PORT_PARAMS_MIRROR | PORT_PARAMS_SFLOW |
+                                   PORT_PARAMS_POLICER | PORT_PARAMS_EGRESS_BLOCK);
+        if (SAI_ERR(port_statuses[ports_idx[ii]])) {
+            failure = true;
+        }
+    }
+
+    SX_LOG_DBG("Removed %u ports from LAG log id %x\n", removed_count, lag_id);
+
+    status = failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+
+out:
+    free(ports);
+    free(sx_ports);
+    free(ports_idx);
+    return status;
 }
 
 static sai_status_t mlnx_lag_remove_all_ports(sai_object_id_t lag_oid)
@@ -506,9 +615,10 @@ static sai_status_t mlnx_lag_remove_all_ports(sai_object_id_t lag_oid)
     sai_status_t      status;
     sx_port_log_id_t  lag_id;
     sx_status_t       sx_status;
-    sx_port_log_id_t *port_list = NULL;
-    uint32_t          port_cnt  = 0;
-    uint32_t          ii        = 0;
+    sx_port_log_id_t *port_list     = NULL;
+    sai_status_t     *port_statuses = NULL;
+    uint32_t          port_cnt      = 0;
+    uint32_t          ii            = 0;
 
     status = mlnx_object_to_type(lag_oid, SAI_OBJECT_TYPE_LAG, &lag_id, NULL);
     if (SAI_ERR(status)) {
@@ -523,10 +633,12 @@ static sai_status_t mlnx_lag_remove_all_ports(sai_object_id_t lag_oid)
         return SAI_STATUS_SUCCESS;
     }
 
-    port_list = (sx_port_log_id_t*)malloc(sizeof(sx_port_log_id_t) * port_cnt);
-    if (NULL == port_list) {
+    port_list     = (sx_port_log_id_t*)malloc(sizeof(sx_port_log_id_t) * port_cnt);
+    port_statuses = (sai_status_t*)malloc(sizeof(sai_status_t) * port_cnt);
+    if ((NULL == port_list) || (NULL == port_statuses)) {
         SX_LOG_ERR("Can't allocate memory\n");
-        return SAI_STATUS_NO_MEMORY;
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
     }
 
     sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID, lag_id, port_list, &port_cnt);
@@ -535,16 +647,19 @@ static sai_status_t mlnx_lag_remove_all_ports(sai_object_id_t lag_oid)
         goto out;
     }
 
-    for (ii = 0; ii < port_cnt; ii++) {
-        status = remove_port_from_lag(lag_id, port_list[ii]);
-        if (SAI_ERR(status)) {
-            sai_db_unlock();
-            goto out;
+    status = remove_ports_from_lag(lag_id, port_list, port_cnt, true, port_statuses);
+    if (SAI_STATUS_FAILURE == status) {
+        for (ii = 0; ii < port_cnt; ii++) {
+            if (SAI_ERR(port_statuses[ii])) {
+                status = port_statuses[ii];
+                break;
+            }
         }
     }
 
 out:
     free(port_list);
+    free(port_statuses);
     return status;
 }
 
@@ -926,7 +1041,7 @@ static sai_status_t mlnx_create_lag(_Out_ sai_object_id_t     * lag_id,
 
     for (ii = MAX_PORTS; ii < MAX_PORTS * 2; ii++) {
         if (!mlnx_ports_db[ii].is_present) {
-            mlnx_ports_db[ii].logical = lag_log_port_id;
+            mlnx_port_logical_set(&mlnx_ports_db[ii], lag_log_port_id);
             mlnx_ports_db[ii].saiport = *lag_id;
             lag                       = &mlnx_ports_db[ii];
             break;
@@ -1021,7 +1136,7 @@ out:
         if (lag && lag->is_present) {
             mlnx_port_del(lag);
             lag->saiport = SAI_NULL_OBJECT_ID;
-            lag->logical = 0;
+            mlnx_port_logical_set(lag, 0);
         }
 
         if (lag_log_port_id) {
@@ -1109,35 +1224,41 @@ static sai_status_t mlnx_get_lag_attribute(_In_ sai_object_id_t     lag_id,
     return sai_get_attributes(&key, key_str, SAI_OBJECT_TYPE_LAG, lag_vendor_attribs, attr_count, attr_list);
 }
 
-static sai_status_t mlnx_create_lag_member(_Out_ sai_object_id_t     * lag_member_id,
-                                           _In_ sai_object_id_t        switch_id,
-                                           _In_ uint32_t               attr_count,
-                                           _In_ const sai_attribute_t *attr_list)
+typedef struct _mlnx_lag_member_bulk_entry_t {
+    sx_port_log_id_t      lag_id;
+    sx_port_log_id_t      port_id;
+    sx_collector_mode_t   collect_mode;
+    sx_distributor_mode_t dist_mode;
+    mlnx_port_config_t   *port;
+    uint32_t              object_idx;
+} mlnx_lag_member_bulk_entry_t;
+
+/* Entries after the first one are not executed with stop_on_error */
+static void mlnx_lag_member_bulk_statuses_fail(_In_ const mlnx_lag_member_bulk_entry_t *entries,
+                                               _In_ uint32_t                            entry_count,
+                                               _In_ bool                                stop_on_error,
+                                               _In_ sai_status_t                        status,
+                                               _Out_ sai_status_t                      *object_statuses)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < entry_count; ii++) {
+        object_statuses[entries[ii].object_idx] = (ii && stop_on_error) ? SAI_STATUS_NOT_EXECUTED : status;
+    }
+}
+
+static sai_status_t mlnx_lag_member_attrs_parse(_In_ uint32_t                       attr_count,
+                                                _In_ const sai_attribute_t         *attr_list,
+                                                _Out_ mlnx_lag_member_bulk_entry_t *entry)
 {
     sai_status_t                 status;
-    sx_status_t                  sx_status;
     const sai_attribute_value_t *attr_lag_id, *attr_port_id, *attr_egress_disable, *attr_ingress_disable;
-    sai_object_id_t              lag_oid, port_oid;
     uint32_t                     index;
     char                         list_str[MAX_LIST_VALUE_STR_LEN];
-    char                         key_str[MAX_KEY_STR_LEN];
-    sx_port_log_id_t             lag_id;
-    sx_port_log_id_t             port_id;
-    uint32_t                     port_cnt               = 0;
-    mlnx_port_config_t          *port                   = NULL;
-    mlnx_port_config_t          *lag                    = NULL;
-    sx_collector_mode_t          collect_mode           = COLLECTOR_ENABLE;
-    sx_distributor_mode_t        dist_mode              = DISTRIBUTOR_ENABLE;
-    mlnx_object_id_t             mlnx_lag_member        = {0};
-    const bool                   is_add                 = false;
-    bool                         is_acl_rollback_needed = false;
 
-    SX_LOG_ENTER();
-
-    if (NULL == lag_member_id) {
-        SX_LOG_ERR("NULL lag member id param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
+    memset(entry, 0, sizeof(*entry));
+    entry->collect_mode = COLLECTOR_ENABLE;
+    entry->dist_mode    = DISTRIBUTOR_ENABLE;
 
     status = check_attribs_metadata(attr_count, attr_list, SAI_OBJECT_TYPE_LAG_MEMBER, lag_member_vendor_attribs,
                                     SAI_COMMON_API_CREATE);
@@ -1162,242 +1283,422 @@ static sai_status_t mlnx_create_lag_member(_Out_ sai_object_id_t     * lag_membe
     status = find_attrib_in_list(attr_count, attr_list, SAI_LAG_MEMBER_ATTR_EGRESS_DISABLE,
                                  &attr_egress_disable, &index);
     if (!SAI_ERR(status)) {
-        dist_mode = attr_egress_disable->booldata ? DISTRIBUTOR_DISABLE : DISTRIBUTOR_ENABLE;
+        entry->dist_mode = attr_egress_disable->booldata ? DISTRIBUTOR_DISABLE : DISTRIBUTOR_ENABLE;
     }
 
     /* get ingress mode */
     status = find_attrib_in_list(attr_count, attr_list, SAI_LAG_MEMBER_ATTR_INGRESS_DISABLE,
                                  &attr_ingress_disable, &index);
     if (!SAI_ERR(status)) {
-        collect_mode = attr_ingress_disable->booldata ? COLLECTOR_DISABLE : COLLECTOR_ENABLE;
+        entry->collect_mode = attr_ingress_disable->booldata ? COLLECTOR_DISABLE : COLLECTOR_ENABLE;
     }
 
-    lag_oid  = attr_lag_id->oid;
-    port_oid = attr_port_id->oid;
-
-    status = mlnx_object_to_type(lag_oid, SAI_OBJECT_TYPE_LAG, &lag_id, NULL);
-    if (SAI_ERR(status)) {
-        return status;
-    }
-    status = mlnx_object_to_type(port_oid, SAI_OBJECT_TYPE_PORT, &port_id, NULL);
+    status = mlnx_object_to_type(attr_lag_id->oid, SAI_OBJECT_TYPE_LAG, &entry->lag_id, NULL);
     if (SAI_ERR(status)) {
         return status;
     }
 
-    sai_db_write_lock();
-    status = mlnx_port_by_log_id(port_id, &port);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
-    status = mlnx_port_by_log_id(lag_id, &lag);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
-
-    status = validate_port(lag, port);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
+    return mlnx_object_to_type(attr_port_id->oid, SAI_OBJECT_TYPE_PORT, &entry->port_id, NULL);
+}
 
-    sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID, lag->logical, NULL, &port_cnt);
-    if (SAI_ERR(status = sdk_to_sai(sx_status))) {
-        goto out;
-    }
+/* Applies the LAG VLAN ingress filter and learn mode (read once per LAG by the caller) to the port and
+ * clears the port's own settings which are now taken from the LAG */
+static sai_status_t mlnx_lag_member_port_prepare(_In_ mlnx_port_config_t   *lag,
+                                                 _In_ mlnx_port_config_t   *port,
+                                                 _In_ sx_ingr_filter_mode_t ingr_filter_mode,
+                                                 _In_ sx_fdb_learn_mode_t   learn_mode)
+{
+    sai_status_t status;
+    sx_status_t  sx_status;
+    const bool   is_add = false;
 
-    status = mlnx_port_params_clone(lag,
-                                    port,
-                                    PORT_PARAMS_FOR_LAG | PORT_PARAMS_SFLOW | PORT_PARAMS_POLICER |
-                                    PORT_PARAMS_EGRESS_BLOCK);
-    if (SAI_ERR(status)) {
-        goto out;
+    sx_status = sx_api_vlan_port_ingr_filter_set(gh_sdk, port->logical, ingr_filter_mode);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Port ingress filter set for port oid %" PRIx64 " failed - %s\n",
+                   port->saiport, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
     }
 
-    status = mlnx_port_params_clone(port, lag, PORT_PARAMS_VLAN | PORT_PARAMS_LEARN_MODE);
-    if (SAI_ERR(status)) {
-        goto out;
+    sx_status = sx_api_fdb_port_learn_mode_set(gh_sdk, port->logical, learn_mode);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to set port [%x] learning mode %s - %s.\n", port->logical,
+                   SX_LEARN_MODE_MSG(learn_mode), SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
     }
 
     status = mlnx_port_samplepacket_params_clear(port, true);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     status = mlnx_port_storm_control_policer_params_clear(port, true);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     status = mlnx_port_mirror_params_clear(port);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     status = mlnx_port_egress_block_clear(port->logical);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     status = mlnx_wred_port_queue_db_clear(port);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     status = mlnx_acl_port_lag_event_handle_unlocked(port, ACL_EVENT_TYPE_LAG_MEMBER_ADD);
     if (SAI_ERR(status)) {
         SX_LOG_NTC("Failed to remove Lag member port[%x] from ACLs\n", lag->logical);
-        goto out;
+        return status;
     }
-    is_acl_rollback_needed = true;
 
     status = mlnx_port_mirror_wred_discard_set(port->logical, is_add);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Error removing port mirror wred discard for 0x%x\n", port->logical);
-        goto out;
+        mlnx_acl_port_lag_event_handle_unlocked(port, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
+        return status;
     }
 
-    sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_ADD, DEFAULT_ETH_SWID,
-                                          &lag->logical, &port->logical, 1);
-    if (SAI_ERR(status = sdk_to_sai(sx_status))) {
-        SX_LOG_ERR("Failed to add lag port %s.\n", SX_STATUS_MSG(sx_status));
-        goto out;
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Adds the ports of the entries to the same LAG.
+ * The port parameters are cloned to the LAG from the first port and the LAG parameters are read once,
+ * all the prepared ports are added with a single LAG port group update. When it fails for more than one
+ * port, the ports are added one by one. The prepared ports already have the LAG settings, so with
+ * stop_on_error the ones after the first failed add get the status of the group update, not NOT_EXECUTED.
+ * Returns SAI_STATUS_FAILURE if any port has failed */
+static sai_status_t mlnx_lag_members_add(_In_ mlnx_lag_member_bulk_entry_t *entries,
+                                         _In_ uint32_t                      entry_count,
+                                         _In_ bool                          stop_on_error,
+                                         _Out_ sai_object_id_t             *object_id,
+                                         _Out_ sai_status_t                *object_statuses)
+{
+    sx_status_t           sx_status;
+    sai_status_t          status, group_status;
+    mlnx_port_config_t   *lag;
+    mlnx_port_config_t   *port;
+    sx_port_log_id_t      lag_id           = entries[0].lag_id;
+    sx_port_log_id_t     *sx_ports         = NULL;
+    sx_ingr_filter_mode_t ingr_filter_mode = SX_INGR_FILTER_ENABLE;
+    sx_fdb_learn_mode_t   learn_mode       = SX_FDB_LEARN_MODE_AUTO_LEARN;
+    mlnx_object_id_t      mlnx_lag_member  = {0};
+    uint32_t              prepared_count   = 0, added_count = 0;
+    uint32_t              ii;
+    bool                  failure = false, retry_failure = false, lag_params_cloned = false;
+    char                  key_str[MAX_KEY_STR_LEN];
+
+    status = mlnx_port_by_log_id(lag_id, &lag);
+    if (SAI_ERR(status)) {
+        mlnx_lag_member_bulk_statuses_fail(entries, entry_count, stop_on_error, status, object_statuses);
+        return SAI_STATUS_FAILURE;
     }
 
-    sx_status = sx_api_lag_port_collector_set(gh_sdk, lag->logical, port->logical, collect_mode);
-    if (SAI_ERR(status = sdk_to_sai(sx_status))) {
-        goto out;
+    sx_ports = calloc(entry_count, sizeof(*sx_ports));
+    if (!sx_ports) {
+        SX_LOG_ERR("Can't allocate memory\n");
+        mlnx_lag_member_bulk_statuses_fail(entries, entry_count, stop_on_error, SAI_STATUS_NO_MEMORY,
+                                           object_statuses);
+        return SAI_STATUS_FAILURE;
+    }
+
+    for (ii = 0; ii < entry_count; ii++) {
+        if (failure && stop_on_error) {
+            object_statuses[entries[ii].object_idx] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        status = mlnx_port_by_log_id(entries[ii].port_id, &port);
+        if (SAI_ERR(status)) {
+            goto port_failed;
+        }
+
+        status = validate_port(lag, port);
+        if (SAI_ERR(status)) {
+            goto port_failed;
+        }
+
+        if (!lag_params_cloned) {
+            status = mlnx_port_params_clone(lag,
+                                            port,
+                                            PORT_PARAMS_FOR_LAG | PORT_PARAMS_SFLOW | PORT_PARAMS_POLICER |
+                                            PORT_PARAMS_EGRESS_BLOCK);
+            if (SAI_ERR(status)) {
+                goto port_failed;
+            }
+
+            sx_status = sx_api_vlan_port_ingr_filter_get(gh_sdk, lag->logical, &ingr_filter_mode);
+            if (SX_ERR(sx_status)) {
+                SX_LOG_ERR("Port ingress filter get for LAG oid %" PRIx64 " failed - %s\n",
+                           lag->saiport, SX_STATUS_MSG(sx_status));
+                status = sdk_to_sai(sx_status);
+                goto port_failed;
+            }
+
+            sx_status = sx_api_fdb_port_learn_mode_get(gh_sdk, lag->logical, &learn_mode);
+            if (SX_ERR(sx_status)) {
+                SX_LOG_ERR("Failed to get port [%x] learning mode - %s.\n", lag->logical, SX_STATUS_MSG(sx_status));
+                status = sdk_to_sai(sx_status);
+                goto port_failed;
+            }
+
+            lag_params_cloned = true;
+        }
+
+        status = mlnx_lag_member_port_prepare(lag, port, ingr_filter_mode, learn_mode);
+        if (SAI_ERR(status)) {
+            goto port_failed;
+        }
+
+        entries[prepared_count]      = entries[ii];
+        entries[prepared_count].port = port;
+        sx_ports[prepared_count]     = port->logical;
+        prepared_count++;
+        continue;
+
+port_failed:
+        object_statuses[entries[ii].object_idx] = status;
+        failure                                 = true;
     }
-    sx_status = sx_api_lag_port_distributor_set(gh_sdk, lag->logical, port->logical, dist_mode);
-    if (SAI_ERR(status = sdk_to_sai(sx_status))) {
+
+    if (!prepared_count) {
         goto out;
     }
 
-    port->lag_id = lag->logical;
+    sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_ADD, DEFAULT_ETH_SWID,
+                                          &lag->logical, sx_ports, prepared_count);
+    if (SX_ERR(sx_status) && (prepared_count == 1)) {
+        SX_LOG_ERR("Failed to add lag port %s.\n", SX_STATUS_MSG(sx_status));
+        mlnx_acl_port_lag_event_handle_unlocked(entries[0].port, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
+        object_statuses[entries[0].object_idx] = sdk_to_sai(sx_status);
+        failure                                = true;
+    } else if (SX_ERR(sx_status)) {
+        SX_LOG_NTC("Failed to add %u lag ports at once - %s, adding one by one\n",
+                   prepared_count, SX_STATUS_MSG(sx_status));
+
+        group_status = sdk_to_sai(sx_status);
+
+        /* Only a failure of the retry stops it, the ports before a failed prepare above are still added */
+        for (ii = 0; ii < prepared_count; ii++) {
+            if (retry_failure && stop_on_error) {
+                mlnx_acl_port_lag_event_handle_unlocked(entries[ii].port, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
+                object_statuses[entries[ii].object_idx] = group_status;
+                continue;
+            }
 
-    /* create lag member id */
-    mlnx_lag_member.id.log_port_id = port_id;
-    mlnx_lag_member.ext.lag.lag_id = SX_PORT_LAG_ID_GET(lag_id);
-    mlnx_lag_member.ext.lag.sub_id = SX_PORT_SUB_ID_GET(lag_id);
+            sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_ADD, DEFAULT_ETH_SWID,
+                                                  &lag->logical, &sx_ports[ii], 1);
+            if (SX_ERR(sx_status)) {
+                SX_LOG_ERR("Failed to add lag port %s.\n", SX_STATUS_MSG(sx_status));
+                mlnx_acl_port_lag_event_handle_unlocked(entries[ii].port, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
+                object_statuses[entries[ii].object_idx] = sdk_to_sai(sx_status);
+                failure                                 = true;
+                retry_failure                           = true;
+                continue;
+            }
 
-    status = mlnx_object_id_to_sai(SAI_OBJECT_TYPE_LAG_MEMBER, &mlnx_lag_member, lag_member_id);
-    if (SAI_ERR(status)) {
-        goto out;
+            entries[added_count++] = entries[ii];
+        }
+    } else {
+        added_count = prepared_count;
     }
 
-    lag_member_key_to_str(*lag_member_id, key_str);
-    SX_LOG_NTC("Created LAG member %s\n", key_str);
+    for (ii = 0; ii < added_count; ii++) {
+        port = entries[ii].port;
 
-out:
-    if (SAI_ERR(status)) {
-        if (is_acl_rollback_needed) {
-            mlnx_acl_port_lag_event_handle_unlocked(port, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
+        sx_status = sx_api_lag_port_collector_set(gh_sdk, lag->logical, port->logical, entries[ii].collect_mode);
+        if (SX_ERR(sx_status)) {
+            object_statuses[entries[ii].object_idx] = sdk_to_sai(sx_status);
+            failure                                 = true;
+            continue;
+        }
+        sx_status = sx_api_lag_port_distributor_set(gh_sdk, lag->logical, port->logical, entries[ii].dist_mode);
+        if (SX_ERR(sx_status)) {
+            object_statuses[entries[ii].object_idx] = sdk_to_sai(sx_status);
+            failure                                 = true;
+            continue;
         }
+
+        port->lag_id = lag->logical;
+
+        /* create lag member id */
+        mlnx_lag_member.id.log_port_id = port->logical;
+        mlnx_lag_member.ext.lag.lag_id = SX_PORT_LAG_ID_GET(lag_id);
+        mlnx_lag_member.ext.lag.sub_id = SX_PORT_SUB_ID_GET(lag_id);
+
+        status = mlnx_object_id_to_sai(SAI_OBJECT_TYPE_LAG_MEMBER, &mlnx_lag_member,
+                                       &object_id[entries[ii].object_idx]);
+        object_statuses[entries[ii].object_idx] = status;
+        if (SAI_ERR(status)) {
+            failure = true;
+            continue;
+        }
+
+        lag_member_key_to_str(object_id[entries[ii].object_idx], key_str);
+        SX_LOG_NTC("Created LAG member %s\n", key_str);
     }
 
-    sai_db_unlock();
-    return status;
+    SX_LOG_NTC("Added %u ports to LAG log id %x\n", added_count, lag->logical);
+
+out:
+    free(sx_ports);
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_remove_lag_member(_In_ sai_object_id_t lag_member_id)
+/* The ports are already removed from the LAG, finish the member removal */
+static sai_status_t mlnx_lag_member_port_release(_In_ mlnx_port_config_t *port)
 {
-    sai_status_t        status          = SAI_STATUS_SUCCESS;
-    mlnx_object_id_t    mlnx_lag_member = {0};
-    sx_port_log_id_t    lag_log_port_id = 0;
-    uint32_t            members_count   = 0;
-    mlnx_port_config_t *port_config;
-    mlnx_port_config_t *lag_config;
-    sx_status_t         sx_status;
-    const bool          is_add = true;
-    char                key_str[MAX_KEY_STR_LEN];
+    sai_status_t status;
+    const bool   is_add = true;
 
-    lag_member_key_to_str(lag_member_id, key_str);
-    SX_LOG_NTC("Removing %s\n", key_str);
+    status = mlnx_acl_port_lag_event_handle_unlocked(port, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
+    if (SAI_ERR(status)) {
+        SX_LOG_NTC("Failed to remove Lag member port[%x] from ACLs\n", port->logical);
+        return status;
+    }
 
-    status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_LAG_MEMBER, lag_member_id, &mlnx_lag_member);
+    status = mlnx_port_mirror_wred_discard_set(port->logical, is_add);
     if (SAI_ERR(status)) {
+        SX_LOG_ERR("Error setting port mirror wred discard for port 0x%x\n", port->logical);
         return status;
     }
 
-    SX_PORT_TYPE_ID_SET(lag_log_port_id, SX_PORT_TYPE_LAG);
-    SX_PORT_LAG_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.lag_id);
-    SX_PORT_SUB_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.sub_id);
+    return SAI_STATUS_SUCCESS;
+}
 
-    sai_db_write_lock();
-    status = remove_port_from_lag(lag_log_port_id, mlnx_lag_member.id.log_port_id);
-    if (SAI_ERR(status)) {
-        goto out;
+/* When removing the last member from the LAG, we no longer need to keep on the LAG the settings
+ *  that were cloned to it from the first port, and any additional settings. Instead we need to
+ *  clear these settings, so it will be possible to add any new member to this LAG. */
+static sai_status_t mlnx_lag_cloned_params_clear(_In_ mlnx_port_config_t *lag_config)
+{
+    mlnx_qos_queue_config_t *queue;
+    sai_status_t             status;
+    uint32_t                 ii;
+
+    port_queues_foreach(lag_config, queue, ii) {
+        if (ii >= RM_API_COS_TRAFFIC_CLASS_NUM) {
+            continue;
+        }
+
+        status = mlnx_wred_apply_to_queue(lag_config, ii, SAI_NULL_OBJECT_ID);
+        if (SAI_ERR(status)) {
+            return status;
+        }
     }
 
-    status = mlnx_port_by_log_id(mlnx_lag_member.id.log_port_id, &port_config);
+    status = mlnx_port_samplepacket_params_clear(lag_config, false);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
-    status = mlnx_port_by_log_id(lag_log_port_id, &lag_config);
+
+    status = mlnx_port_storm_control_policer_params_clear(lag_config, false);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    status = mlnx_acl_port_lag_event_handle_unlocked(port_config, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
+    status = mlnx_port_mirror_params_clear(lag_config);
     if (SAI_ERR(status)) {
-        SX_LOG_NTC("Failed to remove Lag member port[%x] from ACLs\n", port_config->logical);
-        goto out;
+        return status;
     }
 
-    sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID, lag_log_port_id, NULL, &members_count);
-    if (SX_ERR(sx_status)) {
-        status = sdk_to_sai(sx_status);
-        goto out;
-    }
+    return mlnx_port_egress_block_clear(lag_config->logical);
+}
 
-    status = mlnx_port_mirror_wred_discard_set(port_config->logical, is_add);
-    if (SAI_ERR(status)) {
-        SX_LOG_ERR("Error setting port mirror wred discard for port 0x%x\n", port_config->logical);
+/* Removes the ports of the entries from the same LAG, see remove_ports_from_lag.
+ * Returns SAI_STATUS_FAILURE if any port has failed */
+static sai_status_t mlnx_lag_members_del(_In_ mlnx_lag_member_bulk_entry_t *entries,
+                                         _In_ uint32_t                      entry_count,
+                                         _In_ bool                          stop_on_error,
+                                         _Out_ sai_status_t                *object_statuses)
+{
+    sai_status_t        status;
+    sx_status_t         sx_status;
+    mlnx_port_config_t *port_config;
+    mlnx_port_config_t *lag_config;
+    sx_port_log_id_t    lag_id        = entries[0].lag_id;
+    sx_port_log_id_t   *port_ids      = NULL;
+    sai_status_t       *port_statuses = NULL;
+    uint32_t            members_count = 0;
+    uint32_t            ii;
+    bool                failure = false;
+
+    port_ids      = calloc(entry_count, sizeof(*port_ids));
+    port_statuses = calloc(entry_count, sizeof(*port_statuses));
+    if (!port_ids || !port_statuses) {
+        SX_LOG_ERR("Can't allocate memory\n");
+        mlnx_lag_member_bulk_statuses_fail(entries, entry_count, stop_on_error, SAI_STATUS_NO_MEMORY,
+                                           object_statuses);
+        failure = true;
         goto out;
     }
 
-    /* When removing the last member from the LAG, we no longer need to keep on the LAG the settings
-     *  that were cloned to it from the first port, and any additional settings. Instead we need to
-     *  clear these settings, so it will be possible to add any new member to this LAG. */
-    if (members_count == 0) {
-        mlnx_qos_queue_config_t *queue;
-        uint32_t                 ii;
+    for (ii = 0; ii < entry_count; ii++) {
+        port_ids[ii] = entries[ii].port_id;
+    }
 
-        port_queues_foreach(lag_config, queue, ii) {
-            if (ii >= RM_API_COS_TRAFFIC_CLASS_NUM) {
-                continue;
-            }
+    status = remove_ports_from_lag(lag_id, port_ids, entry_count, stop_on_error, port_statuses);
+    if (SAI_ERR(status) && (SAI_STATUS_FAILURE != status)) {
+        mlnx_lag_member_bulk_statuses_fail(entries, entry_count, stop_on_error, status, object_statuses);
+        failure = true;
+        goto out;
+    }
 
-            status = mlnx_wred_apply_to_queue(lag_config, ii, SAI_NULL_OBJECT_ID);
-            if (SAI_ERR(status)) {
-                goto out;
-            }
+    for (ii = 0; ii < entry_count; ii++) {
+        object_statuses[entries[ii].object_idx] = port_statuses[ii];
+        if (SAI_ERR(port_statuses[ii])) {
+            failure = true;
+            continue;
         }
 
-        status = mlnx_port_samplepacket_params_clear(lag_config, false);
-        if (SAI_ERR(status)) {
-            goto out;
+        status = mlnx_port_by_log_id(entries[ii].port_id, &port_config);
+        if (!SAI_ERR(status)) {
+            status = mlnx_lag_member_port_release(port_config);
         }
 
-        status = mlnx_port_storm_control_policer_params_clear(lag_config, false);
+        object_statuses[entries[ii].object_idx] = status;
         if (SAI_ERR(status)) {
-            goto out;
+            failure = true;
         }
+    }
 
-        status = mlnx_port_mirror_params_clear(lag_config);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
+    status = mlnx_port_by_log_id(lag_id, &lag_config);
+    if (SAI_ERR(status)) {
+        goto lag_failed;
+    }
+
+    sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID, lag_id, NULL, &members_count);
+    if (SX_ERR(sx_status)) {
+        status = sdk_to_sai(sx_status);
+        goto lag_failed;
+    }
 
-        status = mlnx_port_egress_block_clear(lag_config->logical);
+    if (members_count == 0) {
+        status = mlnx_lag_cloned_params_clear(lag_config);
         if (SAI_ERR(status)) {
-            goto out;
+            goto lag_failed;
         }
     }
 
-    SX_LOG_NTC("Removed SAI LAG member\n");
+    goto out;
+
+lag_failed:
+    /* LAG level failure is reported on the members which were removed */
+    for (ii = 0; ii < entry_count; ii++) {
+        if (SAI_STATUS_SUCCESS == object_statuses[entries[ii].object_idx]) {
+            object_statuses[entries[ii].object_idx] = status;
+        }
+    }
+    failure = true;
 
 out:
-    sai_db_unlock();
-    return status;
+    free(port_ids);
+    free(port_statuses);
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
 }
 
 static sai_status_t mlnx_set_lag_member_attribute(_In_ sai_object_id_t lag_member_id, _In_ const sai_attribute_t *attr)
@@ -1454,7 +1755,79 @@ static sai_status_t mlnx_create_lag_members(_In_ sai_object_id_t          switch
                                             _Out_ sai_object_id_t        *object_id,
                                             _Out_ sai_status_t           *object_statuses)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    mlnx_lag_member_bulk_entry_t *entries = NULL;
+    sai_status_t                  status;
+    uint32_t                      entries_count = 0;
+    uint32_t                      ii, jj;
+    bool                          stop_on_error, failure = false, stopped = false;
+
+    SX_LOG_ENTER();
+
+    status =
+        mlnx_bulk_create_attrs_validate(object_count, attr_count, attr_list, mode, object_statuses, &stop_on_error);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    entries = calloc(object_count, sizeof(*entries));
+    if (!entries) {
+        SX_LOG_ERR("Can't allocate memory\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        object_id[ii] = SAI_NULL_OBJECT_ID;
+
+        status              = mlnx_lag_member_attrs_parse(attr_count[ii], attr_list[ii], &entries[entries_count]);
+        object_statuses[ii] = SAI_ERR(status) ? status : SAI_STATUS_NOT_EXECUTED;
+        if (SAI_ERR(status)) {
+            failure = true;
+            if (stop_on_error) {
+                break;
+            }
+            continue;
+        }
+
+        entries[entries_count++].object_idx = ii;
+    }
+
+    for (ii++; ii < object_count; ii++) {
+        object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    sai_db_write_lock();
+
+    /* Members of the same LAG that follow each other are added together */
+    for (ii = 0; ii < entries_count; ii = jj) {
+        for (jj = ii + 1; (jj < entries_count) && (entries[jj].lag_id == entries[ii].lag_id); jj++) {
+        }
+
+        if (stopped) {
+            continue;
+        }
+
+        status = mlnx_lag_members_add(&entries[ii], jj - ii, stop_on_error, object_id, object_statuses);
+        if (SAI_ERR(status)) {
+            failure = true;
+            stopped = stop_on_error;
+        }
+    }
+
+    sai_db_unlock();
+
+    mlnx_bulk_statuses_print("LAG members", object_statuses, object_count, SAI_COMMON_API_BULK_CREATE);
+
+    free(entries);
+    SX_LOG_EXIT();
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
 }
 
 /**
@@ -1474,7 +1847,115 @@ static sai_status_t mlnx_remove_lag_members(_In_ uint32_t                 object
                                             _In_ sai_bulk_op_error_mode_t mode,
                                             _Out_ sai_status_t           *object_statuses)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    mlnx_lag_member_bulk_entry_t *entries = NULL;
+    mlnx_object_id_t              mlnx_lag_member;
+    sai_status_t                  status;
+    uint32_t                      entries_count = 0;
+    uint32_t                      ii, jj;
+    bool                          stop_on_error, failure = false, stopped = false;
+    char                          key_str[MAX_KEY_STR_LEN];
+
+    SX_LOG_ENTER();
+
+    status = mlnx_bulk_remove_attrs_validate(object_count, mode, object_statuses, &stop_on_error);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    entries = calloc(object_count, sizeof(*entries));
+    if (!entries) {
+        SX_LOG_ERR("Can't allocate memory\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        lag_member_key_to_str(object_id[ii], key_str);
+        SX_LOG_NTC("Removing %s\n", key_str);
+
+        memset(&mlnx_lag_member, 0, sizeof(mlnx_lag_member));
+
+        status              = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_LAG_MEMBER, object_id[ii], &mlnx_lag_member);
+        object_statuses[ii] = SAI_ERR(status) ? status : SAI_STATUS_NOT_EXECUTED;
+        if (SAI_ERR(status)) {
+            failure = true;
+            if (stop_on_error) {
+                break;
+            }
+            continue;
+        }
+
+        SX_PORT_TYPE_ID_SET(entries[entries_count].lag_id, SX_PORT_TYPE_LAG);
+        SX_PORT_LAG_ID_SET(entries[entries_count].lag_id, mlnx_lag_member.ext.lag.lag_id);
+        SX_PORT_SUB_ID_SET(entries[entries_count].lag_id, mlnx_lag_member.ext.lag.sub_id);
+        entries[entries_count].port_id    = mlnx_lag_member.id.log_port_id;
+        entries[entries_count].object_idx = ii;
+        entries_count++;
+    }
+
+    for (ii++; ii < object_count; ii++) {
+        object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    sai_db_write_lock();
+
+    /* Members of the same LAG that follow each other are removed together */
+    for (ii = 0; ii < entries_count; ii = jj) {
+        for (jj = ii + 1; (jj < entries_count) && (entries[jj].lag_id == entries[ii].lag_id); jj++) {
+        }
+
+        if (stopped) {
+            continue;
+        }
+
+        status = mlnx_lag_members_del(&entries[ii], jj - ii, stop_on_error, object_statuses);
+        if (SAI_ERR(status)) {
+            failure = true;
+            stopped = stop_on_error;
+        }
+    }
+
+    sai_db_unlock();
+
+    mlnx_bulk_statuses_print("LAG members", object_statuses, object_count, SAI_COMMON_API_BULK_REMOVE);
+
+    free(entries);
+    SX_LOG_EXIT();
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_create_lag_member(_Out_ sai_object_id_t     * lag_member_id,
+                                           _In_ sai_object_id_t        switch_id,
+                                           _In_ uint32_t               attr_count,
+                                           _In_ const sai_attribute_t *attr_list)
+{
+    sai_status_t status, object_status;
+
+    if (NULL == lag_member_id) {
+        SX_LOG_ERR("NULL lag member id param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    status = mlnx_create_lag_members(switch_id, 1, &attr_count, &attr_list, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                                     lag_member_id, &object_status);
+
+    return (SAI_STATUS_FAILURE == status) ? object_status : status;
+}
+
+static sai_status_t mlnx_remove_lag_member(_In_ sai_object_id_t lag_member_id)
+{
+    sai_status_t status, object_status;
+
+    status = mlnx_remove_lag_members(1, &lag_member_id, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, &object_status);
+
+    return (SAI_STATUS_FAILURE == status) ? object_status : status;
 }
 
 sai_status_t mlnx_lag_log_set(sx_verbosity_level_t level)
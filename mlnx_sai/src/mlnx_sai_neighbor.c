@@ -101,6 +101,239 @@ static sai_status_t mlnx_translate_sai_neighbor_entry_to_sdk(_In_ const sai_neig
     return mlnx_translate_sai_ip_address_to_sdk(&neighbor_entry->ip_address, ip_addr_p);
 }
 
+static sai_status_t mlnx_neighbor_sx_key_get(_In_ const sai_neighbor_entry_t *neighbor_entry,
+                                             _Out_ sx_router_interface_t     *sx_rif,
+                                             _Out_ sx_ip_addr_t              *ipaddr)
+{
+    sai_status_t status;
+
+    memset(ipaddr, 0, sizeof(*ipaddr));
+
+    status = mlnx_translate_sai_neighbor_entry_to_sdk(neighbor_entry, ipaddr);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = mlnx_rif_oid_to_sdk_rif_id(neighbor_entry->rif_id, sx_rif);
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Fail to get sdk rif id from rif oid %" PRIx64 "\n", neighbor_entry->rif_id);
+        return status;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Software shadow of the programmed neighbors, kept in SAI DB so it's shared by all the processes.
+ * Neighbor attributes are read from the shadow, so get and set don't need sx_api_router_neigh_get.
+ * SDK and the shadow are updated together under sai_shadow_db_lock(), so the shadow never keeps a neighbor
+ * changed by another process. A neighbor missing in the shadow (it's full or the key collides) is read from SDK.
+ */
+static uint64_t mlnx_neigh_shadow_key_get(_In_ sx_router_interface_t rif, _In_ const sx_ip_addr_t *ipaddr)
+{
+    const uint32_t *addr;
+    uint32_t        words, ii;
+    uint64_t        key;
+
+    if (SX_IP_VERSION_IPV4 == ipaddr->version) {
+        addr  = &ipaddr->addr.ipv4.s_addr;
+        words = 1;
+    } else {
+        addr  = (const uint32_t*)ipaddr->addr.ipv6.s6_addr32;
+        words = 4;
+    }
+
+    key = 14695981039346656037ULL;
+    key = (key ^ rif) * 1099511628211ULL;
+    key = (key ^ ipaddr->version) * 1099511628211ULL;
+    for (ii = 0; ii < words; ii++) {
+        key = (key ^ addr[ii]) * 1099511628211ULL;
+    }
+
+    return key;
+}
+
+static bool mlnx_neigh_shadow_key_equal(_In_ const mlnx_neigh_shadow_t *entry,
+                                        _In_ sx_router_interface_t      rif,
+                                        _In_ const sx_ip_addr_t        *ipaddr)
+{
+    if ((entry->rif != rif) || (entry->ip_addr.version != ipaddr->version)) {
+        return false;
+    }
+
+    if (SX_IP_VERSION_IPV4 == ipaddr->version) {
+        return entry->ip_addr.addr.ipv4.s_addr == ipaddr->addr.ipv4.s_addr;
+    }
+
+    return !memcmp(entry->ip_addr.addr.ipv6.s6_addr32, ipaddr->addr.ipv6.s6_addr32,
+                   sizeof(ipaddr->addr.ipv6.s6_addr32));
+}
+
+/* The entry found by the key hash may belong to another neighbor, such neighbors are not shadowed */
+static sai_status_t mlnx_neigh_shadow_find(_In_ sx_router_interface_t     rif,
+                                           _In_ const sx_ip_addr_t       *ipaddr,
+                                           _Out_ mlnx_shm_rm_array_idx_t *idx,
+                                           _Out_ mlnx_neigh_shadow_t    **entry)
+{
+    sai_status_t status;
+    void        *elem;
+
+    status = mlnx_shm_rm_array_find_by_key(MLNX_SHM_RM_ARRAY_TYPE_NEIGH_SHADOW,
+                                           mlnx_neigh_shadow_key_get(rif, ipaddr),
+                                           idx,
+                                           &elem);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    *entry = elem;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void mlnx_neigh_shadow_remove(_In_ sx_router_interface_t rif, _In_ const sx_ip_addr_t *ipaddr)
+{
+    mlnx_shm_rm_array_idx_t idx;
+    mlnx_neigh_shadow_t    *entry;
+
+    if (SAI_ERR(mlnx_neigh_shadow_find(rif, ipaddr, &idx, &entry))) {
+        return;
+    }
+
+    if (mlnx_neigh_shadow_key_equal(entry, rif, ipaddr)) {
+        mlnx_shm_rm_array_free(idx);
+    }
+}
+
+static void mlnx_neigh_shadow_set(_In_ sx_router_interface_t  rif,
+                                  _In_ const sx_ip_addr_t    *ipaddr,
+                                  _In_ const sx_neigh_data_t *neigh_data)
+{
+    mlnx_shm_rm_array_idx_t idx;
+    mlnx_neigh_shadow_t    *entry;
+    sai_status_t            status;
+    void                   *elem;
+
+    status = mlnx_neigh_shadow_find(rif, ipaddr, &idx, &entry);
+    if (!SAI_ERR(status)) {
+        if (mlnx_neigh_shadow_key_equal(entry, rif, ipaddr)) {
+            memcpy(&entry->neigh_data, neigh_data, sizeof(entry->neigh_data));
+        }
+        return;
+    }
+
+    if (status != SAI_STATUS_ITEM_NOT_FOUND) {
+        return;
+    }
+
+    if (SAI_ERR(mlnx_shm_rm_array_alloc(MLNX_SHM_RM_ARRAY_TYPE_NEIGH_SHADOW, &idx, &elem))) {
+        SX_LOG_DBG("Neighbor shadow is full, neighbor on rif %u is read from SDK\n", rif);
+        return;
+    }
+
+    if (SAI_ERR(mlnx_shm_rm_array_key_set(idx, mlnx_neigh_shadow_key_get(rif, ipaddr)))) {
+        mlnx_shm_rm_array_free(idx);
+        return;
+    }
+
+    entry          = elem;
+    entry->rif     = rif;
+    entry->ip_addr = *ipaddr;
+    memcpy(&entry->neigh_data, neigh_data, sizeof(entry->neigh_data));
+}
+
+static bool mlnx_neigh_shadow_get(_In_ sx_router_interface_t rif,
+                                  _In_ const sx_ip_addr_t   *ipaddr,
+                                  _Out_ sx_neigh_data_t     *neigh_data)
+{
+    mlnx_shm_rm_array_idx_t idx;
+    mlnx_neigh_shadow_t    *entry;
+
+    if (SAI_ERR(mlnx_neigh_shadow_find(rif, ipaddr, &idx, &entry)) ||
+        !mlnx_neigh_shadow_key_equal(entry, rif, ipaddr)) {
+        return false;
+    }
+
+    memcpy(neigh_data, &entry->neigh_data, sizeof(*neigh_data));
+
+    return true;
+}
+
+static bool mlnx_neigh_shadow_rif_cmp(_In_ const void *elem, _In_ const void *data)
+{
+    const sx_router_interface_t *rif = data;
+
+    return !rif || (((const mlnx_neigh_shadow_t*)elem)->rif == *rif);
+}
+
+/* Drops the entries of the rif or of all the rifs if rif is NULL */
+static void mlnx_neigh_shadow_flush(_In_ const sx_router_interface_t *rif)
+{
+    mlnx_shm_rm_array_idx_t idx = MLNX_SHM_RM_ARRAY_IDX_UNINITIALIZED;
+    void                   *elem;
+
+    while (!SAI_ERR(mlnx_shm_rm_array_find(MLNX_SHM_RM_ARRAY_TYPE_NEIGH_SHADOW, mlnx_neigh_shadow_rif_cmp, idx, rif,
+                                           &idx, &elem))) {
+        mlnx_shm_rm_array_free(idx);
+    }
+}
+
+/* Called when the sx rif is deleted, the id can be reused by a new rif */
+void mlnx_neighbor_shadow_rif_flush(_In_ sx_router_interface_t sx_rif)
+{
+    sai_shadow_db_lock();
+    mlnx_neigh_shadow_flush(&sx_rif);
+    sai_shadow_db_unlock();
+}
+
+static sai_status_t mlnx_neighbor_sx_add(_In_ sx_router_interface_t  sx_rif,
+                                         _In_ const sx_ip_addr_t    *ipaddr,
+                                         _In_ const sx_neigh_data_t *neigh_data)
+{
+    sx_status_t sx_status;
+
+    sai_shadow_db_lock();
+
+    sx_status = sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_ADD, sx_rif, ipaddr, neigh_data);
+    if (!SX_ERR(sx_status)) {
+        mlnx_neigh_shadow_set(sx_rif, ipaddr, neigh_data);
+    }
+
+    sai_shadow_db_unlock();
+
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to create neighbor entry - %s.\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_neighbor_sx_remove(_In_ sx_router_interface_t sx_rif, _In_ const sx_ip_addr_t *ipaddr)
+{
+    sx_neigh_data_t neigh_data;
+    sx_status_t     sx_status;
+
+    memset(&neigh_data, 0, sizeof(neigh_data));
+    neigh_data.rif = sx_rif;
+
+    sai_shadow_db_lock();
+
+    /* On failure the neighbor may be partly removed, it's read from SDK then */
+    mlnx_neigh_shadow_remove(sx_rif, ipaddr);
+
+    sx_status = sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE, sx_rif, ipaddr, &neigh_data);
+
+    sai_shadow_db_unlock();
+
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to remove neighbor entry - %s.\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /*
  * Routine Description:
  *    Create neighbor entry
@@ -150,14 +383,11 @@ static sai_status_t mlnx_create_neighbor_entry(_In_ const sai_neighbor_entry_t*
 
     memset(&neigh_data, 0, sizeof(neigh_data));
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_rif_oid_to_sdk_rif_id(neighbor_entry->rif_id, &neigh_data.rif))) {
-        SX_LOG_ERR("Fail to get sdk rif id from rif oid %" PRIx64 "\n", neighbor_entry->rif_id);
-        SX_LOG_EXIT();
+    status = mlnx_neighbor_sx_key_get(neighbor_entry, &neigh_data.rif, &ipaddr);
+    if (SAI_ERR(status)) {
         return status;
     }
 
-    memset(&ipaddr, 0, sizeof(ipaddr));
     neigh_data.action         = SX_ROUTER_ACTION_FORWARD;
     neigh_data.trap_attr.prio = SX_TRAP_PRIORITY_MED;
 
@@ -182,19 +412,10 @@ static sai_status_t mlnx_create_neighbor_entry(_In_ const sai_neighbor_entry_t*
         neigh_data.is_software_only = no_host->booldata;
     }
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_translate_sai_neighbor_entry_to_sdk(neighbor_entry, &ipaddr))) {
-        return status;
-    }
-
-    if (SX_STATUS_SUCCESS !=
-        (status = sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_ADD, neigh_data.rif,
-                                          &ipaddr, &neigh_data))) {
-        SX_LOG_ERR("Failed to create neighbor entry - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
-    }
+    status = mlnx_neighbor_sx_add(neigh_data.rif, &ipaddr, &neigh_data);
 
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 /*
@@ -212,10 +433,10 @@ static sai_status_t mlnx_create_neighbor_entry(_In_ const sai_neighbor_entry_t*
  */
 static sai_status_t mlnx_remove_neighbor_entry(_In_ const sai_neighbor_entry_t* neighbor_entry)
 {
-    sai_status_t    status;
-    char            key_str[MAX_KEY_STR_LEN];
-    sx_ip_addr_t    ipaddr;
-    sx_neigh_data_t neigh_data;
+    sai_status_t          status;
+    char                  key_str[MAX_KEY_STR_LEN];
+    sx_ip_addr_t          ipaddr;
+    sx_router_interface_t sx_rif;
 
     SX_LOG_ENTER();
 
@@ -227,29 +448,15 @@ static sai_status_t mlnx_remove_neighbor_entry(_In_ const sai_neighbor_entry_t*
     neighbor_key_to_str(neighbor_entry, key_str);
     SX_LOG_NTC("Remove neighbor entry %s\n", key_str);
 
-    memset(&ipaddr, 0, sizeof(ipaddr));
-    memset(&neigh_data, 0, sizeof(neigh_data));
-
-    if (SAI_STATUS_SUCCESS != (status = mlnx_translate_sai_neighbor_entry_to_sdk(neighbor_entry, &ipaddr))) {
-        return status;
-    }
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_rif_oid_to_sdk_rif_id(neighbor_entry->rif_id, &neigh_data.rif))) {
-        SX_LOG_ERR("Fail to get sdk rif id from rif oid %" PRIx64 "\n", neighbor_entry->rif_id);
+    if (SAI_STATUS_SUCCESS != (status = mlnx_neighbor_sx_key_get(neighbor_entry, &sx_rif, &ipaddr))) {
         SX_LOG_EXIT();
         return status;
     }
 
-    if (SX_STATUS_SUCCESS !=
-        (status =
-             sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE, neigh_data.rif, &ipaddr, &neigh_data))) {
-        SX_LOG_ERR("Failed to remove neighbor entry - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
-    }
+    status = mlnx_neighbor_sx_remove(sx_rif, &ipaddr);
 
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 /*
@@ -329,16 +536,18 @@ static sai_status_t mlnx_get_neighbor(const sai_neighbor_entry_t* neighbor_entry
 
     SX_LOG_ENTER();
 
-    memset(&ipaddr, 0, sizeof(ipaddr));
     memset(&filter, 0, sizeof(filter));
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_translate_sai_neighbor_entry_to_sdk(neighbor_entry, &ipaddr))) {
+    if (SAI_STATUS_SUCCESS != (status = mlnx_neighbor_sx_key_get(neighbor_entry, &sx_rif, &ipaddr))) {
         return status;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_rif_oid_to_sdk_rif_id(neighbor_entry->rif_id, &sx_rif))) {
-        return status;
+    sai_shadow_db_lock();
+
+    if (mlnx_neigh_shadow_get(sx_rif, &ipaddr, &neigh_entry->neigh_data)) {
+        sai_shadow_db_unlock();
+        SX_LOG_EXIT();
+        return SAI_STATUS_SUCCESS;
     }
 
     if (SX_STATUS_SUCCESS !=
@@ -346,10 +555,15 @@ static sai_status_t mlnx_get_neighbor(const sai_neighbor_entry_t* neighbor_entry
              sx_api_router_neigh_get(gh_sdk, SX_ACCESS_CMD_GET, sx_rif, &ipaddr, &filter,
                                      neigh_entry,
                                      &entries_count))) {
+        sai_shadow_db_unlock();
         SX_LOG_ERR("Failed to get %d neighbor entries %s.\n", entries_count, SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
+    mlnx_neigh_shadow_set(sx_rif, &ipaddr, &neigh_entry->neigh_data);
+
+    sai_shadow_db_unlock();
+
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -433,36 +647,21 @@ static sai_status_t mlnx_modify_neighbor_entry(_In_ const sai_neighbor_entry_t*
 {
     sai_status_t          status;
     sx_ip_addr_t          ipaddr;
-    sx_neigh_data_t       neigh_data;
     sx_router_interface_t sx_rif;
 
     SX_LOG_ENTER();
 
-    memset(&ipaddr, 0, sizeof(ipaddr));
-    memset(&neigh_data, 0, sizeof(neigh_data));
-
-    if (SAI_STATUS_SUCCESS != (status = mlnx_translate_sai_neighbor_entry_to_sdk(neighbor_entry, &ipaddr))) {
-        return status;
-    }
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_rif_oid_to_sdk_rif_id(neighbor_entry->rif_id, &sx_rif))) {
+    if (SAI_STATUS_SUCCESS != (status = mlnx_neighbor_sx_key_get(neighbor_entry, &sx_rif, &ipaddr))) {
         return status;
     }
 
     /* To modify a neighbor, we delete and readd it with new data */
-    if (SX_STATUS_SUCCESS !=
-        (status =
-             sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE, sx_rif, &ipaddr, &neigh_data))) {
-        SX_LOG_ERR("Failed to remove neighbor entry - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
+    if (SAI_STATUS_SUCCESS != (status = mlnx_neighbor_sx_remove(sx_rif, &ipaddr))) {
+        return status;
     }
 
-    if (SX_STATUS_SUCCESS !=
-        (status =
-             sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_ADD, sx_rif, &ipaddr, new_neigh_data))) {
-        SX_LOG_ERR("Failed to create neighbor entry - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
+    if (SAI_STATUS_SUCCESS != (status = mlnx_neighbor_sx_add(sx_rif, &ipaddr, new_neigh_data))) {
+        return status;
     }
 
     SX_LOG_EXIT();
@@ -575,10 +774,17 @@ static sai_status_t mlnx_remove_all_neighbor_entries(_In_ sai_object_id_t switch
 
     ipaddr.version = SX_IP_VERSION_IPV4_IPV6;
 
-    if (SX_STATUS_SUCCESS !=
-        (status =
-             sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE_ALL, g_resource_limits.router_rifs_dontcare, &ipaddr,
-                                     &neigh_data))) {
+    sai_shadow_db_lock();
+
+    status = sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE_ALL, g_resource_limits.router_rifs_dontcare, &ipaddr,
+                                     &neigh_data);
+
+    /* On failure some of the entries may be removed */
+    mlnx_neigh_shadow_flush(NULL);
+
+    sai_shadow_db_unlock();
+
+    if (SX_STATUS_SUCCESS != status) {
         SX_LOG_ERR("Failed to remove all neighbor entries - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
@@ -25,6 +25,7 @@
 
 typedef struct _mlnx_nh_data_t {
     sx_next_hop_t nh_id;
+    sx_ecmp_id_t  nhop_ecmp_id;
     uint32_t      object_index;
 } mlnx_nh_bulk_data_t;
 typedef struct _mlnx_nh_bulk_pair_t {
@@ -164,6 +165,261 @@ static sai_status_t mlnx_sdk_nhop_find_in_list(const sx_next_hop_t *next_hops,
     return SAI_STATUS_INVALID_OBJECT_ID;
 }
 
+/*
+ * Software shadow of the next hop groups ECMP containers, kept in SAI DB so it's shared by all the processes.
+ * Member updates are applied to the shadow and the whole next hop list is committed to SDK with one ecmp_set.
+ * Until the group is bound (a route or an ACL action refers to it) the commit is deferred, so a group that is
+ * built member by member is programmed once - when it's bound or on shutdown.
+ * A failed commit never drops the shadow - an update of a bound group is reverted by the caller, a group that fails
+ * to bind stays dirty with all the accepted members.
+ * A group that doesn't fit the shadow is loaded to the caller's buffer as bound, so it's updated in SDK directly.
+ * Guarded by sai_shadow_db_lock(), no other lock is taken under it.
+ */
+static sai_status_t mlnx_nhg_shadow_alloc(_In_ sx_ecmp_id_t sx_ecmp_id, _Out_ mlnx_nhg_shadow_t **shadow)
+{
+    mlnx_shm_rm_array_idx_t idx;
+    sai_status_t            status;
+    void                   *elem;
+
+    status = mlnx_shm_rm_array_alloc(MLNX_SHM_RM_ARRAY_TYPE_NHG_SHADOW, &idx, &elem);
+    if (SAI_ERR(status)) {
+        SX_LOG_NTC("Next hop group shadow is full, ecmp id %u is updated in SDK directly\n", sx_ecmp_id);
+        return status;
+    }
+
+    status = mlnx_shm_rm_array_key_set(idx, sx_ecmp_id);
+    if (SAI_ERR(status)) {
+        mlnx_shm_rm_array_free(idx);
+        return status;
+    }
+
+    *shadow                   = elem;
+    (*shadow)->sx_ecmp_id     = sx_ecmp_id;
+    (*shadow)->is_bound       = false;
+    (*shadow)->is_dirty       = false;
+    (*shadow)->next_hop_count = 0;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void mlnx_nhg_shadow_drop(_In_ sx_ecmp_id_t sx_ecmp_id)
+{
+    mlnx_shm_rm_array_idx_t idx;
+    void                   *elem;
+
+    if (!SAI_ERR(mlnx_shm_rm_array_find_by_key(MLNX_SHM_RM_ARRAY_TYPE_NHG_SHADOW, sx_ecmp_id, &idx, &elem))) {
+        mlnx_shm_rm_array_free(idx);
+    }
+}
+
+/*
+ * A group loaded from SDK may already be in use, so it's treated as bound.
+ * buffer holds the group when the shadow is full.
+ */
+static sai_status_t mlnx_nhg_shadow_get(_In_ sx_ecmp_id_t         sx_ecmp_id,
+                                        _In_ mlnx_nhg_shadow_t   *buffer,
+                                        _Out_ mlnx_nhg_shadow_t **shadow)
+{
+    mlnx_shm_rm_array_idx_t idx;
+    sx_status_t             sx_status;
+    sai_status_t            status;
+    void                   *elem;
+    uint32_t                ii;
+
+    status = mlnx_shm_rm_array_find_by_key(MLNX_SHM_RM_ARRAY_TYPE_NHG_SHADOW, sx_ecmp_id, &idx, &elem);
+    if (!SAI_ERR(status)) {
+        *shadow = elem;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    if (status != SAI_STATUS_ITEM_NOT_FOUND) {
+        return status;
+    }
+
+    status = mlnx_nhg_shadow_alloc(sx_ecmp_id, shadow);
+    if (SAI_ERR(status)) {
+        memset(buffer, 0, sizeof(*buffer));
+        buffer->sx_ecmp_id = sx_ecmp_id;
+        *shadow            = buffer;
+    }
+
+    (*shadow)->is_bound       = true;
+    (*shadow)->next_hop_count = ECMP_MAX_PATHS;
+
+    sx_status = sx_api_router_ecmp_get(gh_sdk, sx_ecmp_id, (*shadow)->next_hops, &(*shadow)->next_hop_count);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to get ecmp %u - %s.\n", sx_ecmp_id, SX_STATUS_MSG(sx_status));
+        if (*shadow != buffer) {
+            mlnx_nhg_shadow_drop(sx_ecmp_id);
+        }
+        *shadow = NULL;
+        return sdk_to_sai(sx_status);
+    }
+
+    for (ii = 0; ii < (*shadow)->next_hop_count; ii++) {
+        (*shadow)->nhop_ids[ii] = SX_ROUTER_ECMP_ID_INVALID;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* On failure the shadow stays dirty, SDK keeps the previous next hops */
+static sai_status_t mlnx_nhg_shadow_commit(_In_ mlnx_nhg_shadow_t *shadow)
+{
+    sx_ecmp_id_t sx_ecmp_id     = shadow->sx_ecmp_id;
+    uint32_t     next_hop_count = shadow->next_hop_count;
+    sx_status_t  sx_status;
+
+    if (!shadow->is_dirty) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sx_status = sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_SET, &sx_ecmp_id, shadow->next_hops, &next_hop_count);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to set ecmp %u - %s.\n", shadow->sx_ecmp_id, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    shadow->is_dirty = false;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Called after the shadow is modified, bound groups are committed right away.
+ * Fails only for a bound group, the caller must then revert the shadow to the next hops kept in SDK.
+ */
+static sai_status_t mlnx_nhg_shadow_update(_In_ mlnx_nhg_shadow_t *shadow)
+{
+    sai_status_t status;
+
+    shadow->is_dirty = true;
+
+    if (!shadow->is_bound) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    status = mlnx_nhg_shadow_commit(shadow);
+    if (SAI_ERR(status)) {
+        shadow->is_dirty = false;
+    }
+
+    return status;
+}
+
+static sai_status_t mlnx_nhg_shadow_member_find(_In_ mlnx_nhg_shadow_t *shadow,
+                                                _In_ sx_ecmp_id_t       sx_nhop_id,
+                                                _Out_ uint32_t         *index)
+{
+    sx_next_hop_t next_hop;
+    sai_status_t  status;
+    uint32_t      ii;
+
+    for (ii = 0; ii < shadow->next_hop_count; ii++) {
+        if (shadow->nhop_ids[ii] == sx_nhop_id) {
+            *index = ii;
+            return SAI_STATUS_SUCCESS;
+        }
+    }
+
+    /* The members loaded from SDK are matched by the next hop key */
+    status = mlnx_sdk_nhop_by_ecmp_id_get(sx_nhop_id, &next_hop);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = mlnx_sdk_nhop_find_in_list(shadow->next_hops, shadow->next_hop_count, &next_hop, index);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    shadow->nhop_ids[*index] = sx_nhop_id;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void mlnx_nhg_shadow_member_add(_In_ mlnx_nhg_shadow_t   *shadow,
+                                       _In_ sx_ecmp_id_t         sx_nhop_id,
+                                       _In_ const sx_next_hop_t *next_hop)
+{
+    assert(shadow->next_hop_count < ECMP_MAX_PATHS);
+
+    shadow->next_hops[shadow->next_hop_count] = *next_hop;
+    shadow->nhop_ids[shadow->next_hop_count]  = sx_nhop_id;
+    shadow->next_hop_count++;
+}
+
+static void mlnx_nhg_shadow_member_del(_In_ mlnx_nhg_shadow_t *shadow, _In_ uint32_t index)
+{
+    assert(index < shadow->next_hop_count);
+
+    shadow->next_hop_count--;
+    shadow->next_hops[index] = shadow->next_hops[shadow->next_hop_count];
+    shadow->nhop_ids[index]  = shadow->nhop_ids[shadow->next_hop_count];
+}
+
+/* Saves (or restores) the members of the shadow to revert a failed update */
+static void mlnx_nhg_shadow_members_copy(_Out_ mlnx_nhg_shadow_t *dst, _In_ const mlnx_nhg_shadow_t *src)
+{
+    dst->next_hop_count = src->next_hop_count;
+    memcpy(dst->next_hops, src->next_hops, src->next_hop_count * sizeof(src->next_hops[0]));
+    memcpy(dst->nhop_ids, src->nhop_ids, src->next_hop_count * sizeof(src->nhop_ids[0]));
+}
+
+static bool mlnx_nhg_shadow_any_cmp(_In_ const void *elem, _In_ const void *data)
+{
+    return true;
+}
+
+/*
+ * Commits the pending member updates of the group and marks it as bound, so the further updates are committed
+ * right away. Must be called before the group's ecmp id is passed to SDK as a route or an ACL action parameter.
+ * On failure the group stays unbound with all its members.
+ */
+sai_status_t mlnx_next_hop_group_shadow_flush(_In_ sx_ecmp_id_t sx_ecmp_id)
+{
+    mlnx_shm_rm_array_idx_t idx;
+    mlnx_nhg_shadow_t      *shadow;
+    sai_status_t            status = SAI_STATUS_SUCCESS;
+    void                   *elem;
+
+    sai_shadow_db_lock();
+
+    if (!SAI_ERR(mlnx_shm_rm_array_find_by_key(MLNX_SHM_RM_ARRAY_TYPE_NHG_SHADOW, sx_ecmp_id, &idx, &elem))) {
+        shadow = elem;
+        status = mlnx_nhg_shadow_commit(shadow);
+        if (!SAI_ERR(status)) {
+            shadow->is_bound = true;
+        }
+    }
+
+    sai_shadow_db_unlock();
+
+    return status;
+}
+
+/* Must be called before SAI DB is unloaded. Pending (not committed) next hop lists are discarded, not programmed */
+void mlnx_next_hop_group_shadow_deinit(void)
+{
+    mlnx_shm_rm_array_idx_t idx = MLNX_SHM_RM_ARRAY_IDX_UNINITIALIZED;
+    mlnx_nhg_shadow_t      *shadow;
+    void                   *elem;
+
+    sai_shadow_db_lock();
+
+    while (!SAI_ERR(mlnx_shm_rm_array_find(MLNX_SHM_RM_ARRAY_TYPE_NHG_SHADOW, mlnx_nhg_shadow_any_cmp, idx, NULL,
+                                           &idx, &elem))) {
+        shadow = elem;
+        if (shadow->is_dirty) {
+            SX_LOG_NTC("Discarding %u pending next hops of ecmp %u\n", shadow->next_hop_count, shadow->sx_ecmp_id);
+        }
+
+        mlnx_shm_rm_array_free(idx);
+    }
+
+    sai_shadow_db_unlock();
+}
+
 static sai_status_t mlnx_translate_sai_next_hop_object(_In_ uint32_t              index,
                                                        _In_ const sai_object_id_t next_hop_id,
                                                        _Out_ sx_next_hop_t       *sx_next_hop)
@@ -225,6 +481,7 @@ static sai_status_t mlnx_create_next_hop_group(_Out_ sai_object_id_t     * next_
     char                         key_str[MAX_KEY_STR_LEN];
     sx_next_hop_t                next_hops[1];
     uint32_t                     next_hop_cnt = 0;
+    mlnx_nhg_shadow_t           *shadow;
     sx_ecmp_id_t                 sdk_ecmp_id;
     uint32_t                     type_index;
     sai_status_t                 status;
@@ -263,6 +520,11 @@ static sai_status_t mlnx_create_next_hop_group(_Out_ sai_object_id_t     * next_
         return sdk_to_sai(status);
     }
 
+    /* A group that doesn't fit the shadow is updated in SDK directly */
+    sai_shadow_db_lock();
+    mlnx_nhg_shadow_alloc(sdk_ecmp_id, &shadow);
+    sai_shadow_db_unlock();
+
     status = mlnx_create_object(SAI_OBJECT_TYPE_NEXT_HOP_GROUP, sdk_ecmp_id, NULL, next_hop_group_id);
     if (SAI_ERR(status)) {
         return status;
@@ -303,12 +565,19 @@ static sai_status_t mlnx_remove_next_hop_group(_In_ sai_object_id_t next_hop_gro
         return status;
     }
 
+    sai_shadow_db_lock();
+
     if (SX_STATUS_SUCCESS !=
         (status = sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_DESTROY, &sdk_ecmp_id, NULL, &next_hop_cnt))) {
+        sai_shadow_db_unlock();
         SX_LOG_ERR("Failed to destroy ecmp - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
+    mlnx_nhg_shadow_drop(sdk_ecmp_id);
+
+    sai_shadow_db_unlock();
+
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -375,9 +644,10 @@ static sai_status_t mlnx_next_hop_group_count_get(_In_ const sai_object_key_t
                                                   _Inout_ vendor_cache_t        *cache,
                                                   void                          *arg)
 {
-    uint32_t     sdk_next_hop_cnt;
-    sx_ecmp_id_t sdk_ecmp_id;
-    sai_status_t status;
+    mlnx_nhg_shadow_t  buffer;
+    mlnx_nhg_shadow_t *shadow;
+    sx_ecmp_id_t       sdk_ecmp_id;
+    sai_status_t       status;
 
     SX_LOG_ENTER();
 
@@ -386,15 +656,19 @@ static sai_status_t mlnx_next_hop_group_count_get(_In_ const sai_object_key_t
         return status;
     }
 
-    sdk_next_hop_cnt = 0;
-    if (SX_STATUS_SUCCESS != (status = sx_api_router_ecmp_get(gh_sdk, sdk_ecmp_id, NULL, &sdk_next_hop_cnt))) {
-        SX_LOG_ERR("Failed to get ecmp - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
+    sai_shadow_db_lock();
+
+    status = mlnx_nhg_shadow_get(sdk_ecmp_id, &buffer, &shadow);
+    if (SAI_ERR(status)) {
+        goto out;
     }
-    value->u32 = sdk_next_hop_cnt;
 
+    value->u32 = shadow->next_hop_count;
+
+out:
+    sai_shadow_db_unlock();
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 /* Next hop group type [sai_next_hop_group_type_t] */
@@ -523,41 +797,37 @@ static sai_status_t mlnx_next_hop_group_member_hop_weight_get(_In_ const sai_obj
                                                               _Inout_ vendor_cache_t        *cache,
                                                               void                          *arg)
 {
-    uint32_t      next_hop_count = ECMP_MAX_PATHS;
-    sx_next_hop_t ecmp_next_hops[ECMP_MAX_PATHS];
-    sx_ecmp_id_t  sx_group_id;
-    sx_ecmp_id_t  sx_nhop_id;
-    sx_next_hop_t next_hop;
-    sai_status_t  status;
-    uint32_t      ii;
+    mlnx_nhg_shadow_t  buffer;
+    mlnx_nhg_shadow_t *shadow;
+    sx_ecmp_id_t       sx_group_id;
+    sx_ecmp_id_t       sx_nhop_id;
+    sai_status_t       status;
+    uint32_t           ii;
 
     SX_LOG_ENTER();
 
     status = nhop_group_member_parse_oid(key->key.object_id, &sx_group_id, &sx_nhop_id);
     if (SAI_ERR(status)) {
-        goto out;
+        SX_LOG_EXIT();
+        return status;
     }
 
-    status = sx_api_router_ecmp_get(gh_sdk, sx_group_id, ecmp_next_hops, &next_hop_count);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to get ecmp - %s.\n", SX_STATUS_MSG(status));
-        status = sdk_to_sai(status);
-        goto out;
-    }
+    sai_shadow_db_lock();
 
-    status = mlnx_sdk_nhop_by_ecmp_id_get(sx_nhop_id, &next_hop);
+    status = mlnx_nhg_shadow_get(sx_group_id, &buffer, &shadow);
     if (SAI_ERR(status)) {
         goto out;
     }
 
-    status = mlnx_sdk_nhop_find_in_list(ecmp_next_hops, next_hop_count, &next_hop, &ii);
+    status = mlnx_nhg_shadow_member_find(shadow, sx_nhop_id, &ii);
     if (SAI_ERR(status)) {
         goto out;
     }
 
-    value->u32 = ecmp_next_hops[ii].next_hop_data.weight;
+    value->u32 = shadow->next_hops[ii].next_hop_data.weight;
 
 out:
+    sai_shadow_db_unlock();
     SX_LOG_EXIT();
     return status;
 }
@@ -566,48 +836,44 @@ static sai_status_t mlnx_next_hop_group_member_hop_weight_set(_In_ const sai_obj
                                                               _In_ const sai_attribute_value_t *value,
                                                               void                             *arg)
 {
-    uint32_t      next_hop_count = ECMP_MAX_PATHS;
-    sx_next_hop_t ecmp_next_hops[ECMP_MAX_PATHS];
-    sx_ecmp_id_t  sx_group_id;
-    sx_ecmp_id_t  sx_nhop_id;
-    sx_next_hop_t next_hop;
-    sai_status_t  status;
-    uint32_t      ii;
+    mlnx_nhg_shadow_t  buffer;
+    mlnx_nhg_shadow_t *shadow;
+    sx_ecmp_id_t       sx_group_id;
+    sx_ecmp_id_t       sx_nhop_id;
+    sai_status_t       status;
+    uint32_t           old_weight;
+    uint32_t           ii;
 
     SX_LOG_ENTER();
 
     status = nhop_group_member_parse_oid(key->key.object_id, &sx_group_id, &sx_nhop_id);
     if (SAI_ERR(status)) {
-        goto out;
+        SX_LOG_EXIT();
+        return status;
     }
 
-    status = sx_api_router_ecmp_get(gh_sdk, sx_group_id, ecmp_next_hops, &next_hop_count);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to get ecmp - %s.\n", SX_STATUS_MSG(status));
-        status = sdk_to_sai(status);
-        goto out;
-    }
+    sai_shadow_db_lock();
 
-    status = mlnx_sdk_nhop_by_ecmp_id_get(sx_nhop_id, &next_hop);
+    status = mlnx_nhg_shadow_get(sx_group_id, &buffer, &shadow);
     if (SAI_ERR(status)) {
         goto out;
     }
 
-    status = mlnx_sdk_nhop_find_in_list(ecmp_next_hops, next_hop_count, &next_hop, &ii);
+    status = mlnx_nhg_shadow_member_find(shadow, sx_nhop_id, &ii);
     if (SAI_ERR(status)) {
         goto out;
     }
 
-    ecmp_next_hops[ii].next_hop_data.weight = value->u32;
+    old_weight                                 = shadow->next_hops[ii].next_hop_data.weight;
+    shadow->next_hops[ii].next_hop_data.weight = value->u32;
 
-    status = sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_SET, &sx_group_id, ecmp_next_hops, &next_hop_count);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to set ecmp - %s.\n", SX_STATUS_MSG(status));
-        status = sdk_to_sai(status);
-        goto out;
+    status = mlnx_nhg_shadow_update(shadow);
+    if (SAI_ERR(status)) {
+        shadow->next_hops[ii].next_hop_data.weight = old_weight;
     }
 
 out:
+    sai_shadow_db_unlock();
     SX_LOG_EXIT();
     return status;
 }
@@ -628,8 +894,9 @@ static sai_status_t mlnx_create_next_hop_group_member(_Out_ sai_object_id_t
 {
     const sai_attribute_value_t *group = NULL, *next_hop = NULL, *weight = NULL;
     uint32_t                     group_index, next_hop_index, weight_index;
-    uint32_t                     next_hop_count = ECMP_MAX_PATHS;
-    sx_next_hop_t                ecmp_next_hops[ECMP_MAX_PATHS];
+    sx_next_hop_t                ecmp_next_hop;
+    mlnx_nhg_shadow_t            buffer;
+    mlnx_nhg_shadow_t           *shadow;
     char                         list_str[MAX_LIST_VALUE_STR_LEN];
     char                         value_str[MAX_LIST_VALUE_STR_LEN];
     char                         key_str[MAX_KEY_STR_LEN];
@@ -687,35 +954,42 @@ static sai_status_t mlnx_create_next_hop_group_member(_Out_ sai_object_id_t
     sai_nexthops_to_str(1, &next_hop->oid, MAX_LIST_VALUE_STR_LEN, value_str);
     SX_LOG_NTC("Add next hop %s to %s\n", value_str, key_str);
 
-    status = sx_api_router_ecmp_get(gh_sdk, group_ecmp_id, ecmp_next_hops, &next_hop_count);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to get ecmp - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
+    status = mlnx_translate_sai_next_hop_objects(1, &next_hop->oid, &ecmp_next_hop);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+    if (weight) {
+        ecmp_next_hop.next_hop_data.weight = weight->u32;
+    } else {
+        ecmp_next_hop.next_hop_data.weight = 1;
     }
 
-    if (next_hop_count + 1 > ECMP_MAX_PATHS) {
-        SX_LOG_ERR("Next hop count existing %u + added %u bigger than maximum %u\n",
-                   next_hop_count, next_hop_count + 1, ECMP_MAX_PATHS);
+    sai_shadow_db_lock();
+
+    status = mlnx_nhg_shadow_get(group_ecmp_id, &buffer, &shadow);
+    if (SAI_ERR(status)) {
+        sai_shadow_db_unlock();
+        return status;
+    }
 
+    if (shadow->next_hop_count + 1 > ECMP_MAX_PATHS) {
+        SX_LOG_ERR("Next hop count existing %u + added %u bigger than maximum %u\n",
+                   shadow->next_hop_count, shadow->next_hop_count + 1, ECMP_MAX_PATHS);
+        sai_shadow_db_unlock();
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    status = mlnx_translate_sai_next_hop_objects(1, &next_hop->oid, &ecmp_next_hops[next_hop_count]);
+    mlnx_nhg_shadow_member_add(shadow, nhop_ecmp_id, &ecmp_next_hop);
+
+    status = mlnx_nhg_shadow_update(shadow);
     if (SAI_ERR(status)) {
-        return status;
-    }
-    if (weight) {
-        ecmp_next_hops[next_hop_count].next_hop_data.weight = weight->u32;
-    } else {
-        ecmp_next_hops[next_hop_count].next_hop_data.weight = 1;
+        mlnx_nhg_shadow_member_del(shadow, shadow->next_hop_count - 1);
     }
 
-    next_hop_count++;
+    sai_shadow_db_unlock();
 
-    status = sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_SET, &group_ecmp_id, ecmp_next_hops, &next_hop_count);
     if (SAI_ERR(status)) {
-        SX_LOG_ERR("Failed to set ecmp - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
+        return status;
     }
 
     status = nhop_group_member_to_oid(group_ecmp_id, nhop_ecmp_id, next_hop_group_member_id);
@@ -733,13 +1007,13 @@ static sai_status_t mlnx_create_next_hop_group_member(_Out_ sai_object_id_t
  */
 static sai_status_t mlnx_remove_next_hop_group_member(_In_ sai_object_id_t next_hop_group_member_id)
 {
-    sx_next_hop_t next_hops[ECMP_MAX_PATHS];
-    sx_next_hop_t next_hop_remove;
-    uint32_t      next_hop_count = ECMP_MAX_PATHS;
-    sx_ecmp_id_t  sx_group_id;
-    sx_ecmp_id_t  sx_nhop_id;
-    sai_status_t  status;
-    uint32_t      ii;
+    mlnx_nhg_shadow_t  buffer;
+    mlnx_nhg_shadow_t *shadow;
+    sx_next_hop_t      removed_next_hop;
+    sx_ecmp_id_t       sx_group_id;
+    sx_ecmp_id_t       sx_nhop_id;
+    sai_status_t       status;
+    uint32_t           ii;
 
     SX_LOG_ENTER();
 
@@ -750,31 +1024,35 @@ static sai_status_t mlnx_remove_next_hop_group_member(_In_ sai_object_id_t next_
 
     SX_LOG_NTC("Remove next hop %u from next hop group %u\n", sx_nhop_id, sx_group_id);
 
-    status = sx_api_router_ecmp_get(gh_sdk, sx_group_id, next_hops, &next_hop_count);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to get ecmp - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
-    }
+    sai_shadow_db_lock();
 
-    status = mlnx_sdk_nhop_by_ecmp_id_get(sx_nhop_id, &next_hop_remove);
+    status = mlnx_nhg_shadow_get(sx_group_id, &buffer, &shadow);
     if (SAI_ERR(status)) {
-        return status;
+        goto out;
     }
 
-    status = mlnx_sdk_nhop_find_in_list(next_hops, next_hop_count, &next_hop_remove, &ii);
+    status = mlnx_nhg_shadow_member_find(shadow, sx_nhop_id, &ii);
     if (SAI_ERR(status)) {
-        return status;
+        goto out;
     }
-    next_hops[ii] = next_hops[--next_hop_count];
 
-    status = sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_SET, &sx_group_id, next_hops, &next_hop_count);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to set ecmp - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
+    removed_next_hop = shadow->next_hops[ii];
+    mlnx_nhg_shadow_member_del(shadow, ii);
+
+    status = mlnx_nhg_shadow_update(shadow);
+    if (SAI_ERR(status)) {
+        /* Undo the swap with the last member */
+        shadow->next_hops[shadow->next_hop_count] = shadow->next_hops[ii];
+        shadow->nhop_ids[shadow->next_hop_count]  = shadow->nhop_ids[ii];
+        shadow->next_hops[ii]                     = removed_next_hop;
+        shadow->nhop_ids[ii]                      = sx_nhop_id;
+        shadow->next_hop_count++;
     }
 
+out:
+    sai_shadow_db_unlock();
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 static sai_status_t mlnx_next_hop_bulk_init(_In_ mlnx_nh_bulk_pair_list_t *nh_bulk_data, _In_ uint32_t object_count)
@@ -875,6 +1153,7 @@ static sai_status_t mlnx_next_hop_bulk_create_member_add(_In_ mlnx_nh_bulk_pair_
         bulk_pair.nh.nh_id.next_hop_data.weight = 1;
     }
 
+    bulk_pair.nh.nhop_ecmp_id = nhop_ecmp_id;
     bulk_pair.nh.object_index = object_index;
 
     status = nhop_group_member_to_oid(group_ecmp_id, nhop_ecmp_id, group_member_oid);
@@ -893,151 +1172,139 @@ static sai_status_t mlnx_next_hop_bulk_create_member_add(_In_ mlnx_nh_bulk_pair_
 
 static sai_status_t mlnx_next_hop_bulk_sx_nh_add(_In_ sx_ecmp_id_t               sx_ecmp_id,
                                                  _In_ const mlnx_nh_bulk_data_t *nh_list,
+                                                 _In_ uint32_t                   nh_count,
                                                  _Out_ sai_status_t             *object_statuses)
 {
-    sx_status_t   sx_status;
-    sx_next_hop_t sx_next_hops[ECMP_MAX_PATHS];
-    uint32_t      nh_added, next_hop_count = ECMP_MAX_PATHS;
-    bool          failure = false;
+    sai_status_t       status;
+    mlnx_nhg_shadow_t  buffer;
+    mlnx_nhg_shadow_t *shadow;
+    uint32_t           nh_added = 0, next_hop_count, ii;
 
     assert(nh_list);
     assert(object_statuses);
 
-    memset(sx_next_hops, 0, sizeof(sx_next_hops));
-
-    nh_added = 0;
+    sai_shadow_db_lock();
 
-    sx_status = sx_api_router_ecmp_get(gh_sdk, sx_ecmp_id, sx_next_hops, &next_hop_count);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to get ecmp group %d - %s.\n", sx_ecmp_id, SX_STATUS_MSG(sx_status));
-        failure = true;
+    status = mlnx_nhg_shadow_get(sx_ecmp_id, &buffer, &shadow);
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Failed to get ecmp group %d\n", sx_ecmp_id);
+        goto out;
     }
 
-    if (!failure) {
-        for (nh_added = 0; nh_added < ECMP_MAX_PATHS; nh_added++) {
-            if (nh_list[nh_added].nh_id.next_hop_data.weight == 0) {
-                break;
-            }
-
-            if (next_hop_count + 1 > ECMP_MAX_PATHS) {
-                SX_LOG_ERR("Cannot add sx next hop to sx ecmp id %x - current next hop count is maximum (%u)\n",
-                           sx_ecmp_id, ECMP_MAX_PATHS);
-                failure = true;
-                break;
-            }
+    next_hop_count = shadow->next_hop_count;
 
-            object_statuses[nh_list[nh_added].object_index] = SAI_STATUS_SUCCESS;
-            sx_next_hops[next_hop_count]                    = nh_list[nh_added].nh_id;
-            next_hop_count++;
+    for (nh_added = 0; nh_added < nh_count; nh_added++) {
+        if (shadow->next_hop_count + 1 > ECMP_MAX_PATHS) {
+            SX_LOG_ERR("Cannot add sx next hop to sx ecmp id %x - current next hop count is maximum (%u)\n",
+                       sx_ecmp_id, ECMP_MAX_PATHS);
+            status = SAI_STATUS_FAILURE;
+            break;
         }
+
+        object_statuses[nh_list[nh_added].object_index] = SAI_STATUS_SUCCESS;
+        mlnx_nhg_shadow_member_add(shadow, nh_list[nh_added].nhop_ecmp_id, &nh_list[nh_added].nh_id);
     }
 
     if (nh_added > 0) {
-        sx_status = sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_SET, &sx_ecmp_id, sx_next_hops, &next_hop_count);
-        if (SX_ERR(sx_status)) {
-            SX_LOG_ERR("Failed to update sx ecmp id (%x) - %s.\n", sx_ecmp_id, SX_STATUS_MSG(sx_status));
-            failure  = true;
-            nh_added = 0;
+        if (SAI_ERR(mlnx_nhg_shadow_update(shadow))) {
+            SX_LOG_ERR("Failed to update sx ecmp id (%x)\n", sx_ecmp_id);
+            shadow->next_hop_count = next_hop_count;
+            status                 = SAI_STATUS_FAILURE;
+            nh_added               = 0;
         }
     }
 
-    if (failure) {
-        for (; nh_added < ECMP_MAX_PATHS; nh_added++) {
-            if (nh_list[nh_added].nh_id.next_hop_data.weight == 0) {
-                break;
-            }
+out:
+    sai_shadow_db_unlock();
 
-            object_statuses[nh_list[nh_added].object_index] = SAI_STATUS_FAILURE;
+    if (SAI_ERR(status)) {
+        for (ii = nh_added; ii < nh_count; ii++) {
+            object_statuses[nh_list[ii].object_index] = SAI_STATUS_FAILURE;
         }
+        return SAI_STATUS_FAILURE;
     }
 
-    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+    return SAI_STATUS_SUCCESS;
 }
 
 static sai_status_t mlnx_next_hop_bulk_sx_nh_del(_In_ sx_ecmp_id_t               sx_ecmp_id,
                                                  _In_ const mlnx_nh_bulk_data_t *nh_list,
+                                                 _In_ uint32_t                   nh_count,
                                                  _In_ bool                       stop_on_error,
                                                  _Out_ sai_status_t             *object_statuses)
 {
-    sai_status_t  status;
-    sx_status_t   sx_status;
-    sx_next_hop_t sx_next_hops[ECMP_MAX_PATHS];
-    uint32_t      next_hop_count = ECMP_MAX_PATHS;
-    uint32_t      ii, nh_removed, nh_index_to_remove;
-    bool          failure = false, update_sdk = false;
+    sai_status_t       status;
+    mlnx_nhg_shadow_t  buffer, backup;
+    mlnx_nhg_shadow_t *shadow;
+    uint32_t           ii, nh_removed, nh_index_to_remove;
+    bool               failure = false, update_sdk = false;
 
     assert(nh_list);
     assert(object_statuses);
 
-    memset(sx_next_hops, 0, sizeof(sx_next_hops));
+    sai_shadow_db_lock();
 
-    nh_removed = 0;
+    status = mlnx_nhg_shadow_get(sx_ecmp_id, &buffer, &shadow);
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Failed to get ecmp group %d\n", sx_ecmp_id);
+        sai_shadow_db_unlock();
+        return SAI_STATUS_FAILURE;
+    }
 
-    sx_status = sx_api_router_ecmp_get(gh_sdk, sx_ecmp_id, sx_next_hops, &next_hop_count);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to get ecmp group %d - %s.\n", sx_ecmp_id, SX_STATUS_MSG(sx_status));
-        failure = true;
+    if (shadow->is_bound) {
+        mlnx_nhg_shadow_members_copy(&backup, shadow);
     }
 
-    if (!failure) {
-        for (nh_removed = 0; nh_removed < ECMP_MAX_PATHS; nh_removed++) {
-            if (nh_list[nh_removed].nh_id.next_hop_data.weight == 0) {
+    for (nh_removed = 0; nh_removed < nh_count; nh_removed++) {
+        status = mlnx_nhg_shadow_member_find(shadow, nh_list[nh_removed].nhop_ecmp_id, &nh_index_to_remove);
+        object_statuses[nh_list[nh_removed].object_index] = status;
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to remove next hop group member at index %d\n", nh_list[nh_removed].object_index);
+            failure = true;
+            if (stop_on_error) {
                 break;
+            } else {
+                continue;
             }
+        }
 
-            status = mlnx_sdk_nhop_find_in_list(sx_next_hops,
-                                                next_hop_count,
-                                                &nh_list[nh_removed].nh_id,
-                                                &nh_index_to_remove);
-            object_statuses[nh_list[nh_removed].object_index] = status;
-            if (SAI_ERR(status)) {
-                SX_LOG_ERR("Failed to remove next hop group member at index %d\n", nh_list[nh_removed].object_index);
-                failure = true;
-                if (stop_on_error) {
-                    break;
-                } else {
-                    continue;
-                }
-            }
-
-            if (next_hop_count == 0) {
-                SX_LOG_ERR("Failed to update next_hop_count - underflow\n");
-                return SAI_STATUS_FAILURE;
-            }
-
-            sx_next_hops[nh_index_to_remove] = sx_next_hops[next_hop_count - 1];
-            next_hop_count--;
+        mlnx_nhg_shadow_member_del(shadow, nh_index_to_remove);
 
-            update_sdk = true;
-        }
+        update_sdk = true;
     }
 
     if (update_sdk) {
-        sx_status = sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_SET, &sx_ecmp_id, sx_next_hops, &next_hop_count);
-        if (SX_ERR(sx_status)) {
-            SX_LOG_ERR("Failed to update sx ecmp id (%x) - %s.\n", sx_ecmp_id, SX_STATUS_MSG(sx_status));
+        status = mlnx_nhg_shadow_update(shadow);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to update sx ecmp id (%x)\n", sx_ecmp_id);
+            mlnx_nhg_shadow_members_copy(shadow, &backup);
             failure = true;
             for (ii = 0; ii < nh_removed; ii++) {
-                object_statuses[nh_list[ii].object_index] = sdk_to_sai(sx_status);
+                if (!SAI_ERR(object_statuses[nh_list[ii].object_index])) {
+                    object_statuses[nh_list[ii].object_index] = status;
+                }
             }
         }
     }
 
+    sai_shadow_db_unlock();
+
     return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
 }
 
 static sai_status_t mlnx_next_hop_bulk_sx_update(_In_ sai_common_api_t           api,
                                                  _In_ sx_ecmp_id_t               sx_ecmp_id,
                                                  _In_ const mlnx_nh_bulk_data_t *nh_list,
+                                                 _In_ uint32_t                   nh_count,
                                                  _In_ bool                       stop_on_error,
                                                  _Out_ sai_status_t             *object_statuses)
 {
     assert((api == SAI_COMMON_API_BULK_CREATE) || (api == SAI_COMMON_API_BULK_REMOVE));
 
     if (api == SAI_COMMON_API_BULK_CREATE) {
-        return mlnx_next_hop_bulk_sx_nh_add(sx_ecmp_id, nh_list, object_statuses);
+        return mlnx_next_hop_bulk_sx_nh_add(sx_ecmp_id, nh_list, nh_count, object_statuses);
     } else { /* SAI_COMMON_API_BULK_REMOVE */
-        return mlnx_next_hop_bulk_sx_nh_del(sx_ecmp_id, nh_list, stop_on_error, object_statuses);
+        return mlnx_next_hop_bulk_sx_nh_del(sx_ecmp_id, nh_list, nh_count, stop_on_error, object_statuses);
     }
 }
 
@@ -1066,21 +1333,24 @@ static sai_status_t mlnx_next_hop_bulk_apply(_In_ mlnx_nh_bulk_pair_list_t *nh_b
 
     assert((api == SAI_COMMON_API_BULK_CREATE) || (api == SAI_COMMON_API_BULK_REMOVE));
 
+    if (nh_bulk_data->count == 0) {
+        return SAI_STATUS_SUCCESS;
+    }
+
     qsort(nh_bulk_data->pairs, nh_bulk_data->count, sizeof(mlnx_nh_bulk_pair_t), mlnx_next_hop_bulk_data_sort_fn);
 
-    nh_list = calloc(ECMP_MAX_PATHS, sizeof(mlnx_nh_bulk_data_t));
+    nh_list = calloc(nh_bulk_data->count, sizeof(mlnx_nh_bulk_data_t));
     if (!nh_list) {
         return SAI_STATUS_NO_MEMORY;
     }
 
-    sx_ecmp_id = nh_bulk_data->pairs[0].group_id;
+    sx_ecmp_id   = nh_bulk_data->pairs[0].group_id;
+    nh_to_update = 0;
 
-    nh_list[0]   = nh_bulk_data->pairs[0].nh;
-    nh_to_update = 1;
-
-    for (ii = 1; ii < nh_bulk_data->count; ii++) {
+    for (ii = 0; ii < nh_bulk_data->count; ii++) {
         if (nh_bulk_data->pairs[ii].group_id != sx_ecmp_id) {
-            status = mlnx_next_hop_bulk_sx_update(api, sx_ecmp_id, nh_list, stop_on_error, object_statuses);
+            status = mlnx_next_hop_bulk_sx_update(api, sx_ecmp_id, nh_list, nh_to_update, stop_on_error,
+                                                  object_statuses);
             if (SAI_ERR(status)) {
                 failure = true;
                 if (stop_on_error) {
@@ -1088,17 +1358,15 @@ static sai_status_t mlnx_next_hop_bulk_apply(_In_ mlnx_nh_bulk_pair_list_t *nh_b
                 }
             }
 
-            memset(nh_list, 0, sizeof(mlnx_nh_bulk_data_t) * ECMP_MAX_PATHS);
             nh_to_update = 0;
+            sx_ecmp_id   = nh_bulk_data->pairs[ii].group_id;
         }
 
         nh_list[nh_to_update] = nh_bulk_data->pairs[ii].nh;
         nh_to_update++;
-
-        sx_ecmp_id = nh_bulk_data->pairs[ii].group_id;
     }
 
-    status = mlnx_next_hop_bulk_sx_update(api, sx_ecmp_id, nh_list, stop_on_error, object_statuses);
+    status = mlnx_next_hop_bulk_sx_update(api, sx_ecmp_id, nh_list, nh_to_update, stop_on_error, object_statuses);
     if (SAI_ERR(status)) {
         failure = true;
     }
@@ -1123,12 +1391,10 @@ static sai_status_t mlnx_next_hop_bulk_remove_member_add(_In_ mlnx_nh_bulk_pair_
         return status;
     }
 
-    status = mlnx_sdk_nhop_by_ecmp_id_get(nh_ecmp_id, &nh_pair.nh.nh_id);
-    if (SAI_ERR(status)) {
-        return status;
-    }
+    memset(&nh_pair, 0, sizeof(nh_pair));
 
     nh_pair.group_id        = group_ecmp_id;
+    nh_pair.nh.nhop_ecmp_id = nh_ecmp_id;
     nh_pair.nh.object_index = object_index;
 
     status = mlnx_next_hop_bulk_map_add(nh_bulk_data, &nh_pair);
@@ -19,6 +19,9 @@
 #include "sai.h"
 #include "mlnx_sai.h"
 #include "assert.h"
+#ifndef _WIN32
+#include <pthread.h>
+#endif
 
 #undef  __MODULE__
 #define __MODULE__ SAI_PORT
@@ -3958,24 +3961,25 @@ static sai_status_t mlnx_get_port_attribute(_In_ sai_object_id_t     port_id,
     return sai_status;
 }
 
-/**
- * @brief Get port statistics counters extended.
- *
- * @param[in] port_id Port id
- * @param[in] number_of_counters Number of counters in the array
- * @param[in] counter_ids Specifies the array of counter ids
- * @param[in] mode Statistics mode
- * @param[out] counters Array of resulting counter values.
- *
- * @return #SAI_STATUS_SUCCESS on success, failure status code on error
- */
-sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
-                                     _In_ uint32_t             number_of_counters,
-                                     _In_ const sai_stat_id_t *counter_ids,
-                                     _In_ sai_stats_mode_t     mode,
-                                     _Out_ uint64_t           *counters)
-{
-    sai_status_t                  status;
+typedef enum _mlnx_port_cntr_grp_t {
+    MLNX_PORT_CNTR_GRP_RFC_2863,
+    MLNX_PORT_CNTR_GRP_RFC_2819,
+    MLNX_PORT_CNTR_GRP_IEEE_802_DOT_3,
+    MLNX_PORT_CNTR_GRP_DISCARD,
+    MLNX_PORT_CNTR_GRP_PERF,
+    MLNX_PORT_CNTR_GRP_RFC_3635,
+    MLNX_PORT_CNTR_GRP_REDECN,
+    MLNX_PORT_CNTR_GRP_PRIO_0,
+    MLNX_PORT_CNTR_GRP_COUNT = MLNX_PORT_CNTR_GRP_PRIO_0 + COS_IEEE_PRIO_MAX_NUM + 1
+} mlnx_port_cntr_grp_t;
+
+#define MLNX_PORT_CNTR_GRP_BIT(grp) (1u << (grp))
+
+/* Last counter values read from SDK for one port, per counter group */
+typedef struct _mlnx_port_cntr_snapshot_t {
+    sx_port_log_id_t              log_id;
+    uint32_t                      valid_grps;
+    uint64_t                      timestamp_us[MLNX_PORT_CNTR_GRP_COUNT];
     sx_port_cntr_rfc_2863_t       cnts_2863;
     sx_port_cntr_rfc_2819_t       cnts_2819;
     sx_port_cntr_rfc_3635_t       cnts_3635;
@@ -3984,44 +3988,50 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
     sx_cos_redecn_port_counters_t redecn_cnts;
     sx_port_cntr_discard_t        discard_cnts;
     sx_port_cntr_perf_t           perf_cnts;
-    uint32_t                      ii, port_data;
-    mlnx_port_config_t           *port;
-    sx_port_log_id_t              red_port_id;
-    uint32_t                      iter = 0;
-    char                          key_str[MAX_KEY_STR_LEN];
-    bool                          cnts_2863_needed              = false, cnts_2819_needed = false,
-                                  cntr_802_needed               = false;
-    bool redecn_cnts_needed                                     = false, discard_cnts_needed = false,
-         perf_cnts_needed                                       = false;
-    bool            cntr_prio_needed[COS_IEEE_PRIO_MAX_NUM + 1] = { 0 };
-    bool            cnts_3635_needed                            = false;
-    sx_access_cmd_t cmd;
+} mlnx_port_cntr_snapshot_t;
 
-    SX_LOG_ENTER();
+#define MLNX_PORT_CNTR_CACHE_IDX_NONE (UINT32_MAX)
 
-    memset(&redecn_cnts, 0, sizeof(redecn_cnts));
+/*
+ * Snapshots are kept in process memory, indexed like ports_db.
+ * A counter group younger than SAI_PORT_STATS_CACHE_MS is served from the snapshot,
+ * so a poller reading many counters of a port in one epoch hits SDK once per group.
+ * 0 (default) disables the cache.
+ */
+static pthread_once_t             g_port_cntr_cache_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t            g_port_cntr_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t                   g_port_cntr_cache_max_age_us;
+static mlnx_port_cntr_snapshot_t *g_port_cntr_cache;
+static mlnx_port_cntr_stats_t     g_port_cntr_stats;
 
-    port_key_to_str(port_id, key_str);
-    SX_LOG_DBG("Get port stats %s\n", key_str);
+static void mlnx_port_cntr_cache_init(void)
+{
+    const char *max_age_str;
 
-    if (NULL == counter_ids) {
-        SX_LOG_ERR("NULL counter ids array param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
+    max_age_str = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_PORT_STATS_CACHE_MS);
+    if (NULL == max_age_str) {
+        return;
     }
 
-    if (NULL == counters) {
-        SX_LOG_ERR("NULL counters array param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
+    g_port_cntr_cache_max_age_us = (uint64_t)atoi(max_age_str) * 1000;
+    if (0 == g_port_cntr_cache_max_age_us) {
+        return;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd))) {
-        return status;
+    g_port_cntr_cache = calloc(MAX_PORTS, sizeof(*g_port_cntr_cache));
+    if (!g_port_cntr_cache) {
+        SX_LOG_ERR("Can't allocate memory for port counters cache, cache is disabled\n");
+        g_port_cntr_cache_max_age_us = 0;
+        return;
     }
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_object_to_type(port_id, SAI_OBJECT_TYPE_PORT, &port_data, NULL))) {
-        return status;
-    }
+    SX_LOG_NTC("Port counters cache max age %" PRIu64 " ms\n", g_port_cntr_cache_max_age_us / 1000);
+}
+
+static uint32_t mlnx_port_cntr_grps_get(_In_ uint32_t number_of_counters, _In_ const sai_stat_id_t *counter_ids)
+{
+    uint32_t grps = 0;
+    uint32_t ii;
 
     for (ii = 0; ii < number_of_counters; ii++) {
         switch ((int)counter_ids[ii]) {
@@ -4040,7 +4050,7 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_IF_OUT_ERRORS:
         case SAI_PORT_STAT_IF_OUT_BROADCAST_PKTS:
         case SAI_PORT_STAT_IF_OUT_MULTICAST_PKTS:
-            cnts_2863_needed = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_RFC_2863);
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_DROP_EVENTS:
@@ -4072,19 +4082,19 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_ETHER_STATS_PKTS:
         case SAI_PORT_STAT_ETHER_STATS_COLLISIONS:
         case SAI_PORT_STAT_ETHER_STATS_CRC_ALIGN_ERRORS:
-            cnts_2819_needed = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_RFC_2819);
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_TX_NO_ERRORS:
         case SAI_PORT_STAT_ETHER_STATS_RX_NO_ERRORS:
         case SAI_PORT_STAT_PAUSE_RX_PKTS:
         case SAI_PORT_STAT_PAUSE_TX_PKTS:
-            cntr_802_needed = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_IEEE_802_DOT_3);
             break;
 
         case SAI_PORT_STAT_WRED_DROPPED_PACKETS:
         case SAI_PORT_STAT_ECN_MARKED_PACKETS:
-            redecn_cnts_needed = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_REDECN);
             break;
 
         case SAI_PORT_STAT_PFC_0_RX_PKTS:
@@ -4095,7 +4105,7 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_PFC_5_RX_PKTS:
         case SAI_PORT_STAT_PFC_6_RX_PKTS:
         case SAI_PORT_STAT_PFC_7_RX_PKTS:
-            cntr_prio_needed[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PKTS) / 2] = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_PRIO_0 + (counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PKTS) / 2);
             break;
 
         case SAI_PORT_STAT_PFC_0_TX_PKTS:
@@ -4106,7 +4116,7 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_PFC_5_TX_PKTS:
         case SAI_PORT_STAT_PFC_6_TX_PKTS:
         case SAI_PORT_STAT_PFC_7_TX_PKTS:
-            cntr_prio_needed[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PKTS) / 2] = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_PRIO_0 + (counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PKTS) / 2);
             break;
 
         case SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION:
@@ -4117,7 +4127,7 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_PFC_5_RX_PAUSE_DURATION:
         case SAI_PORT_STAT_PFC_6_RX_PAUSE_DURATION:
         case SAI_PORT_STAT_PFC_7_RX_PAUSE_DURATION:
-            cntr_prio_needed[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION) / 2] = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_PRIO_0 + (counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION) / 2);
             break;
 
         case SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION:
@@ -4128,11 +4138,11 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_PFC_5_TX_PAUSE_DURATION:
         case SAI_PORT_STAT_PFC_6_TX_PAUSE_DURATION:
         case SAI_PORT_STAT_PFC_7_TX_PAUSE_DURATION:
-            cntr_prio_needed[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION) / 2] = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_PRIO_0 + (counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION) / 2);
             break;
 
         case SAI_PORT_STAT_IF_IN_VLAN_DISCARDS:
-            discard_cnts_needed = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_DISCARD);
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_64_OCTETS:
@@ -4144,7 +4154,7 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_ETHER_OUT_PKTS_1519_TO_2047_OCTETS:
         case SAI_PORT_STAT_ETHER_OUT_PKTS_2048_TO_4095_OCTETS:
         case SAI_PORT_STAT_ETHER_OUT_PKTS_4096_TO_9216_OCTETS:
-            perf_cnts_needed = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_PERF);
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_ALIGNMENT_ERRORS:
@@ -4161,258 +4171,460 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_DOT3_STATS_INTERNAL_MAC_RECEIVE_ERRORS:
         case SAI_PORT_STAT_DOT3_STATS_SYMBOL_ERRORS:
         case SAI_PORT_STAT_DOT3_CONTROL_IN_UNKNOWN_OPCODES:
-            cnts_3635_needed = true;
+            grps |= MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_RFC_3635);
             break;
         }
     }
 
-    if (cnts_2863_needed) {
+    return grps;
+}
+
+static sai_status_t mlnx_port_cntr_snapshot_fetch(_In_ sx_port_log_id_t              port_data,
+                                                  _In_ sx_port_log_id_t              red_port_id,
+                                                  _In_ sx_access_cmd_t               cmd,
+                                                  _In_ uint32_t                      grps,
+                                                  _Inout_ mlnx_port_cntr_snapshot_t *snapshot)
+{
+    sx_status_t status;
+    uint32_t    ii, sdk_calls = 0;
+
+    if (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_RFC_2863)) {
+        sdk_calls++;
         if (SX_STATUS_SUCCESS !=
-            (status = sx_api_port_counter_rfc_2863_get(gh_sdk, cmd, port_data, &cnts_2863))) {
+            (status = sx_api_port_counter_rfc_2863_get(gh_sdk, cmd, port_data, &snapshot->cnts_2863))) {
             SX_LOG_ERR("Failed to get port rfc 2863 counters - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+            goto out;
         }
     }
 
-    if (cnts_2819_needed) {
+    if (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_RFC_2819)) {
+        sdk_calls++;
         if (SX_STATUS_SUCCESS !=
-            (status = sx_api_port_counter_rfc_2819_get(gh_sdk, cmd, port_data, &cnts_2819))) {
+            (status = sx_api_port_counter_rfc_2819_get(gh_sdk, cmd, port_data, &snapshot->cnts_2819))) {
             SX_LOG_ERR("Failed to get port rfc 2819 counters - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+            goto out;
         }
     }
 
-    if (cntr_802_needed) {
+    if (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_IEEE_802_DOT_3)) {
+        sdk_calls++;
         if (SX_STATUS_SUCCESS !=
-            (status = sx_api_port_counter_ieee_802_dot_3_get(gh_sdk, cmd, port_data, &cntr_802))) {
+            (status = sx_api_port_counter_ieee_802_dot_3_get(gh_sdk, cmd, port_data, &snapshot->cntr_802))) {
             SX_LOG_ERR("Failed to get port ieee 802 3 counters - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+            goto out;
         }
     }
 
-    if (discard_cnts_needed) {
+    if (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_DISCARD)) {
+        sdk_calls++;
         if (SX_STATUS_SUCCESS !=
-            (status = sx_api_port_counter_discard_get(gh_sdk, cmd, port_data, &discard_cnts))) {
+            (status = sx_api_port_counter_discard_get(gh_sdk, cmd, port_data, &snapshot->discard_cnts))) {
             SX_LOG_ERR("Failed to get port discard counters - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+            goto out;
         }
     }
 
-    if (perf_cnts_needed) {
+    if (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_PERF)) {
+        sdk_calls++;
         if (SX_STATUS_SUCCESS !=
-            (status = sx_api_port_counter_perf_get(gh_sdk, cmd, port_data, 0, &perf_cnts))) {
+            (status = sx_api_port_counter_perf_get(gh_sdk, cmd, port_data, 0, &snapshot->perf_cnts))) {
             SX_LOG_ERR("Failed to get port perf counters - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+            goto out;
         }
     }
 
-    if (cnts_3635_needed) {
+    if (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_RFC_3635)) {
+        sdk_calls++;
         if (SX_STATUS_SUCCESS !=
-            (status = sx_api_port_counter_rfc_3635_get(gh_sdk, cmd, port_data, &cnts_3635))) {
+            (status = sx_api_port_counter_rfc_3635_get(gh_sdk, cmd, port_data, &snapshot->cnts_3635))) {
             SX_LOG_ERR("Failed to get port rfc 3635 counters - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+            goto out;
         }
     }
 
-    if (redecn_cnts_needed) {
-        /* In case if port is LAG member then use LAG logical id for redecn counters */
-        sai_db_read_lock();
-        status = mlnx_port_by_log_id(port_data, &port);
-        if (SAI_ERR(status)) {
-            sai_db_unlock();
-            return status;
-        }
-        if (mlnx_port_is_lag_member(port)) {
-            red_port_id = port->lag_id;
-        } else {
-            red_port_id = port_data;
-        }
-        sai_db_unlock();
-
+    if (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_REDECN)) {
+        memset(&snapshot->redecn_cnts, 0, sizeof(snapshot->redecn_cnts));
+        sdk_calls++;
         if (SX_STATUS_SUCCESS !=
-            (status = sx_api_cos_redecn_counters_get(gh_sdk, cmd, red_port_id, &redecn_cnts))) {
+            (status = sx_api_cos_redecn_counters_get(gh_sdk, cmd, red_port_id, &snapshot->redecn_cnts))) {
             SX_LOG_ERR("Failed to get port redecn counters - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+            goto out;
         }
     }
 
     for (ii = 0; ii <= COS_IEEE_PRIO_MAX_NUM; ii++) {
-        if (cntr_prio_needed[ii]) {
+        if (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_PRIO_0 + ii)) {
+            sdk_calls++;
             if (SX_STATUS_SUCCESS !=
                 (status = sx_api_port_counter_prio_get(gh_sdk, cmd, port_data,
-                                                       SX_PORT_PRIO_ID_0 + ii, &cntr_prio[ii]))) {
+                                                       SX_PORT_PRIO_ID_0 + ii, &snapshot->cntr_prio[ii]))) {
                 SX_LOG_ERR("Failed to get port prio %d counters - %s.\n",
                            SX_PORT_PRIO_ID_0 + ii, SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
+                goto out;
+            }
+        }
+    }
+
+    status = SX_STATUS_SUCCESS;
+
+out:
+    pthread_mutex_lock(&g_port_cntr_cache_lock);
+    g_port_cntr_stats.sdk_calls += sdk_calls;
+    pthread_mutex_unlock(&g_port_cntr_cache_lock);
+    return sdk_to_sai(status);
+}
+
+/* Copy the groups still fresh at now_us from the cached snapshot, return the groups left to fetch */
+static uint32_t mlnx_port_cntr_cache_lookup(_In_ uint32_t                    cache_idx,
+                                            _In_ sx_port_log_id_t            port_data,
+                                            _In_ uint32_t                    grps,
+                                            _In_ uint64_t                    now_us,
+                                            _Out_ mlnx_port_cntr_snapshot_t *snapshot)
+{
+    const mlnx_port_cntr_snapshot_t *cached;
+    uint32_t                         grp, hits = 0;
+
+    pthread_mutex_lock(&g_port_cntr_cache_lock);
+
+    cached = &g_port_cntr_cache[cache_idx];
+    if (cached->log_id == port_data) {
+        for (grp = 0; grp < MLNX_PORT_CNTR_GRP_COUNT; grp++) {
+            if (!(grps & cached->valid_grps & MLNX_PORT_CNTR_GRP_BIT(grp))) {
+                continue;
+            }
+
+            if (now_us - cached->timestamp_us[grp] > g_port_cntr_cache_max_age_us) {
+                continue;
+            }
+
+            grps &= ~MLNX_PORT_CNTR_GRP_BIT(grp);
+            hits++;
+        }
+
+        /* Groups are copied as a whole, the caller only reads the ones it asked for */
+        *snapshot = *cached;
+    }
+
+    g_port_cntr_stats.cache_hits += hits;
+
+    pthread_mutex_unlock(&g_port_cntr_cache_lock);
+
+    return grps;
+}
+
+static void mlnx_port_cntr_cache_update(_In_ uint32_t                         cache_idx,
+                                        _In_ sx_port_log_id_t                 port_data,
+                                        _In_ sx_access_cmd_t                  cmd,
+                                        _In_ uint32_t                         fetched_grps,
+                                        _In_ uint64_t                         now_us,
+                                        _In_ const mlnx_port_cntr_snapshot_t *snapshot)
+{
+    mlnx_port_cntr_snapshot_t *cached;
+    uint32_t                   grp;
+
+    pthread_mutex_lock(&g_port_cntr_cache_lock);
+
+    cached = &g_port_cntr_cache[cache_idx];
+    if (cached->log_id != port_data) {
+        memset(cached, 0, sizeof(*cached));
+        cached->log_id = port_data;
+    }
+
+    /* Values read with clear are gone from HW, don't serve them again */
+    if (SX_ACCESS_CMD_READ_CLEAR == cmd) {
+        cached->valid_grps &= ~fetched_grps;
+        goto out;
+    }
+
+    if (fetched_grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_RFC_2863)) {
+        cached->cnts_2863 = snapshot->cnts_2863;
+    }
+    if (fetched_grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_RFC_2819)) {
+        cached->cnts_2819 = snapshot->cnts_2819;
+    }
+    if (fetched_grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_IEEE_802_DOT_3)) {
+        cached->cntr_802 = snapshot->cntr_802;
+    }
+    if (fetched_grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_DISCARD)) {
+        cached->discard_cnts = snapshot->discard_cnts;
+    }
+    if (fetched_grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_PERF)) {
+        cached->perf_cnts = snapshot->perf_cnts;
+    }
+    if (fetched_grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_RFC_3635)) {
+        cached->cnts_3635 = snapshot->cnts_3635;
+    }
+    if (fetched_grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_REDECN)) {
+        cached->redecn_cnts = snapshot->redecn_cnts;
+    }
+    for (grp = 0; grp <= COS_IEEE_PRIO_MAX_NUM; grp++) {
+        if (fetched_grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_PRIO_0 + grp)) {
+            cached->cntr_prio[grp] = snapshot->cntr_prio[grp];
+        }
+    }
+
+    for (grp = 0; grp < MLNX_PORT_CNTR_GRP_COUNT; grp++) {
+        if (fetched_grps & MLNX_PORT_CNTR_GRP_BIT(grp)) {
+            cached->timestamp_us[grp] = now_us;
+        }
+    }
+    cached->valid_grps |= fetched_grps;
+
+out:
+    pthread_mutex_unlock(&g_port_cntr_cache_lock);
+}
+
+static void mlnx_port_cntr_cache_invalidate(_In_ sx_port_log_id_t port_data)
+{
+    uint32_t ii;
+
+    if (!g_port_cntr_cache) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_port_cntr_cache_lock);
+
+    for (ii = 0; ii < MAX_PORTS; ii++) {
+        if (g_port_cntr_cache[ii].log_id == port_data) {
+            g_port_cntr_cache[ii].valid_grps = 0;
+        }
+    }
+
+    pthread_mutex_unlock(&g_port_cntr_cache_lock);
+}
+
+/*
+ * Fill the snapshot with the requested counter groups of the port.
+ * Groups read within the cache max age are taken from the cache, the rest are read from SDK.
+ */
+static sai_status_t mlnx_port_cntr_snapshot_get(_In_ sx_port_log_id_t            port_data,
+                                                _In_ sx_access_cmd_t              cmd,
+                                                _In_ uint32_t                     grps,
+                                                _In_ uint64_t                     now_us,
+                                                _Out_ mlnx_port_cntr_snapshot_t *snapshot)
+{
+    mlnx_port_config_t *port;
+    sx_port_log_id_t    red_port_id = port_data;
+    uint32_t            cache_idx   = MLNX_PORT_CNTR_CACHE_IDX_NONE;
+    uint32_t            fetch_grps  = grps;
+    sai_status_t        status;
+
+    pthread_once(&g_port_cntr_cache_once, mlnx_port_cntr_cache_init);
+
+    if (g_port_cntr_cache || (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_REDECN))) {
+        sai_db_read_lock();
+        status = mlnx_port_by_log_id_soft(port_data, &port);
+        if (SAI_STATUS_SUCCESS == status) {
+            /* In case if port is LAG member then use LAG logical id for redecn counters */
+            if (mlnx_port_is_lag_member(port)) {
+                red_port_id = port->lag_id;
             }
+            if (port->index < MAX_PORTS) {
+                cache_idx = port->index;
+            }
+        }
+        sai_db_unlock();
+
+        if (SAI_ERR(status) && (grps & MLNX_PORT_CNTR_GRP_BIT(MLNX_PORT_CNTR_GRP_REDECN))) {
+            SX_LOG_ERR("Failed lookup port config by log id 0x%x\n", port_data);
+            return status;
+        }
+    }
+
+    if (!g_port_cntr_cache) {
+        cache_idx = MLNX_PORT_CNTR_CACHE_IDX_NONE;
+    }
+
+    if ((cache_idx != MLNX_PORT_CNTR_CACHE_IDX_NONE) && (SX_ACCESS_CMD_READ == cmd)) {
+        fetch_grps = mlnx_port_cntr_cache_lookup(cache_idx, port_data, grps, now_us, snapshot);
+    }
+
+    if (fetch_grps) {
+        status = mlnx_port_cntr_snapshot_fetch(port_data, red_port_id, cmd, fetch_grps, snapshot);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        if (cache_idx != MLNX_PORT_CNTR_CACHE_IDX_NONE) {
+            mlnx_port_cntr_cache_update(cache_idx, port_data, cmd, fetch_grps, now_us, snapshot);
         }
     }
 
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_port_stats_fill(_In_ uint32_t                         number_of_counters,
+                                         _In_ const sai_stat_id_t             *counter_ids,
+                                         _In_ const mlnx_port_cntr_snapshot_t *snapshot,
+                                         _Out_ uint64_t                       *counters)
+{
+    uint32_t ii, iter = 0;
+
     for (ii = 0; ii < number_of_counters; ii++) {
         switch ((int)counter_ids[ii]) {
         case SAI_PORT_STAT_IF_IN_OCTETS:
-            counters[ii] = cnts_2863.if_in_octets;
+            counters[ii] = snapshot->cnts_2863.if_in_octets;
             break;
 
         case SAI_PORT_STAT_IF_IN_UCAST_PKTS:
-            counters[ii] = cnts_2863.if_in_ucast_pkts;
+            counters[ii] = snapshot->cnts_2863.if_in_ucast_pkts;
             break;
 
         case SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS:
-            counters[ii] = cnts_2863.if_in_broadcast_pkts + cnts_2863.if_in_multicast_pkts;
+            counters[ii] = snapshot->cnts_2863.if_in_broadcast_pkts + snapshot->cnts_2863.if_in_multicast_pkts;
             break;
 
         case SAI_PORT_STAT_IF_IN_DISCARDS:
-            counters[ii] = cnts_2863.if_in_discards;
+            counters[ii] = snapshot->cnts_2863.if_in_discards;
             break;
 
         case SAI_PORT_STAT_IF_IN_ERRORS:
-            counters[ii] = cnts_2863.if_in_errors;
+            counters[ii] = snapshot->cnts_2863.if_in_errors;
             break;
 
         case SAI_PORT_STAT_IF_IN_UNKNOWN_PROTOS:
-            counters[ii] = cnts_2863.if_in_unknown_protos;
+            counters[ii] = snapshot->cnts_2863.if_in_unknown_protos;
             break;
 
         case SAI_PORT_STAT_IF_IN_BROADCAST_PKTS:
-            counters[ii] = cnts_2863.if_in_broadcast_pkts;
+            counters[ii] = snapshot->cnts_2863.if_in_broadcast_pkts;
             break;
 
         case SAI_PORT_STAT_IF_IN_MULTICAST_PKTS:
-            counters[ii] = cnts_2863.if_in_multicast_pkts;
+            counters[ii] = snapshot->cnts_2863.if_in_multicast_pkts;
             break;
 
         case SAI_PORT_STAT_IF_OUT_OCTETS:
-            counters[ii] = cnts_2863.if_out_octets;
+            counters[ii] = snapshot->cnts_2863.if_out_octets;
             break;
 
         case SAI_PORT_STAT_IF_OUT_UCAST_PKTS:
-            counters[ii] = cnts_2863.if_out_ucast_pkts;
+            counters[ii] = snapshot->cnts_2863.if_out_ucast_pkts;
             break;
 
         case SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS:
-            counters[ii] = cnts_2863.if_out_broadcast_pkts + cnts_2863.if_out_multicast_pkts;
+            counters[ii] = snapshot->cnts_2863.if_out_broadcast_pkts + snapshot->cnts_2863.if_out_multicast_pkts;
             break;
 
         case SAI_PORT_STAT_IF_OUT_DISCARDS:
-            counters[ii] = cnts_2863.if_out_discards;
+            counters[ii] = snapshot->cnts_2863.if_out_discards;
             break;
 
         case SAI_PORT_STAT_IF_OUT_ERRORS:
-            counters[ii] = cnts_2863.if_out_errors;
+            counters[ii] = snapshot->cnts_2863.if_out_errors;
             break;
 
         case SAI_PORT_STAT_IF_OUT_BROADCAST_PKTS:
-            counters[ii] = cnts_2863.if_out_broadcast_pkts;
+            counters[ii] = snapshot->cnts_2863.if_out_broadcast_pkts;
             break;
 
         case SAI_PORT_STAT_IF_OUT_MULTICAST_PKTS:
-            counters[ii] = cnts_2863.if_out_multicast_pkts;
+            counters[ii] = snapshot->cnts_2863.if_out_multicast_pkts;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_DROP_EVENTS:
-            counters[ii] = cnts_2819.ether_stats_drop_events;
+            counters[ii] = snapshot->cnts_2819.ether_stats_drop_events;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_MULTICAST_PKTS:
-            counters[ii] = cnts_2819.ether_stats_multicast_pkts;
+            counters[ii] = snapshot->cnts_2819.ether_stats_multicast_pkts;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_BROADCAST_PKTS:
-            counters[ii] = cnts_2819.ether_stats_broadcast_pkts;
+            counters[ii] = snapshot->cnts_2819.ether_stats_broadcast_pkts;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_UNDERSIZE_PKTS:
-            counters[ii] = cnts_2819.ether_stats_undersize_pkts;
+            counters[ii] = snapshot->cnts_2819.ether_stats_undersize_pkts;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_FRAGMENTS:
-            counters[ii] = cnts_2819.ether_stats_fragments;
+            counters[ii] = snapshot->cnts_2819.ether_stats_fragments;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS_64_OCTETS:
         case SAI_PORT_STAT_ETHER_IN_PKTS_64_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts64octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts64octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS_65_TO_127_OCTETS:
         case SAI_PORT_STAT_ETHER_IN_PKTS_65_TO_127_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts65to127octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts65to127octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS_128_TO_255_OCTETS:
         case SAI_PORT_STAT_ETHER_IN_PKTS_128_TO_255_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts128to255octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts128to255octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS_256_TO_511_OCTETS:
         case SAI_PORT_STAT_ETHER_IN_PKTS_256_TO_511_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts256to511octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts256to511octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS_512_TO_1023_OCTETS:
         case SAI_PORT_STAT_ETHER_IN_PKTS_512_TO_1023_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts512to1023octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts512to1023octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS_1024_TO_1518_OCTETS:
         case SAI_PORT_STAT_ETHER_IN_PKTS_1024_TO_1518_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts1024to1518octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts1024to1518octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS_1519_TO_2047_OCTETS:
         case SAI_PORT_STAT_ETHER_IN_PKTS_1519_TO_2047_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts1519to2047octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts1519to2047octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS_2048_TO_4095_OCTETS:
         case SAI_PORT_STAT_ETHER_IN_PKTS_2048_TO_4095_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts2048to4095octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts2048to4095octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS_4096_TO_9216_OCTETS:
         case SAI_PORT_STAT_ETHER_IN_PKTS_4096_TO_9216_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts4096to8191octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts4096to8191octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_OVERSIZE_PKTS:
-            counters[ii] = cnts_2819.ether_stats_oversize_pkts;
+            counters[ii] = snapshot->cnts_2819.ether_stats_oversize_pkts;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_JABBERS:
-            counters[ii] = cnts_2819.ether_stats_jabbers;
+            counters[ii] = snapshot->cnts_2819.ether_stats_jabbers;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_octets;
+            counters[ii] = snapshot->cnts_2819.ether_stats_octets;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_PKTS:
-            counters[ii] = cnts_2819.ether_stats_pkts;
+            counters[ii] = snapshot->cnts_2819.ether_stats_pkts;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_COLLISIONS:
-            counters[ii] = cnts_2819.ether_stats_collisions;
+            counters[ii] = snapshot->cnts_2819.ether_stats_collisions;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_CRC_ALIGN_ERRORS:
-            counters[ii] = cnts_2819.ether_stats_crc_align_errors;
+            counters[ii] = snapshot->cnts_2819.ether_stats_crc_align_errors;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_TX_NO_ERRORS:
-            counters[ii] = cntr_802.a_frames_transmitted_ok;
+            counters[ii] = snapshot->cntr_802.a_frames_transmitted_ok;
             break;
 
         case SAI_PORT_STAT_ETHER_STATS_RX_NO_ERRORS:
-            counters[ii] = cntr_802.a_frames_received_ok;
+            counters[ii] = snapshot->cntr_802.a_frames_received_ok;
             break;
 
         case SAI_PORT_STAT_PAUSE_RX_PKTS:
-            counters[ii] = cntr_802.a_pause_mac_ctrl_frames_received;
+            counters[ii] = snapshot->cntr_802.a_pause_mac_ctrl_frames_received;
             break;
 
         case SAI_PORT_STAT_PAUSE_TX_PKTS:
-            counters[ii] = cntr_802.a_pause_mac_ctrl_frames_transmitted;
+            counters[ii] = snapshot->cntr_802.a_pause_mac_ctrl_frames_transmitted;
             break;
 
         case SAI_PORT_STAT_GREEN_WRED_DROPPED_PACKETS:
@@ -4429,12 +4641,12 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
             counters[ii] = 0;
             /* TODO : change to  g_resource_limits.cos_port_ets_traffic_class_max + 1 when sdk is updated to use rm */
             for (iter = 0; iter < RM_API_COS_TRAFFIC_CLASS_NUM; iter++) {
-                counters[ii] += redecn_cnts.tc_red_dropped_packets[iter];
+                counters[ii] += snapshot->redecn_cnts.tc_red_dropped_packets[iter];
             }
             break;
 
         case SAI_PORT_STAT_ECN_MARKED_PACKETS:
-            counters[ii] = redecn_cnts.ecn_marked_packets;
+            counters[ii] = snapshot->redecn_cnts.ecn_marked_packets;
             break;
 
         case SAI_PORT_STAT_PFC_0_RX_PKTS:
@@ -4445,7 +4657,7 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_PFC_5_RX_PKTS:
         case SAI_PORT_STAT_PFC_6_RX_PKTS:
         case SAI_PORT_STAT_PFC_7_RX_PKTS:
-            counters[ii] = cntr_prio[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PKTS) / 2].rx_pause;
+            counters[ii] = snapshot->cntr_prio[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PKTS) / 2].rx_pause;
             break;
 
         case SAI_PORT_STAT_PFC_0_TX_PKTS:
@@ -4456,7 +4668,7 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_PFC_5_TX_PKTS:
         case SAI_PORT_STAT_PFC_6_TX_PKTS:
         case SAI_PORT_STAT_PFC_7_TX_PKTS:
-            counters[ii] = cntr_prio[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PKTS) / 2].tx_pause;
+            counters[ii] = snapshot->cntr_prio[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PKTS) / 2].tx_pause;
             break;
 
         case SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION:
@@ -4467,7 +4679,7 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_PFC_5_RX_PAUSE_DURATION:
         case SAI_PORT_STAT_PFC_6_RX_PAUSE_DURATION:
         case SAI_PORT_STAT_PFC_7_RX_PAUSE_DURATION:
-            counters[ii] = cntr_prio[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION) / 2].rx_pause_duration;
+            counters[ii] = snapshot->cntr_prio[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION) / 2].rx_pause_duration;
             break;
 
         case SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION:
@@ -4478,103 +4690,103 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         case SAI_PORT_STAT_PFC_5_TX_PAUSE_DURATION:
         case SAI_PORT_STAT_PFC_6_TX_PAUSE_DURATION:
         case SAI_PORT_STAT_PFC_7_TX_PAUSE_DURATION:
-            counters[ii] = cntr_prio[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION) / 2].tx_pause_duration;
+            counters[ii] = snapshot->cntr_prio[(counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION) / 2].tx_pause_duration;
             break;
 
         case SAI_PORT_STAT_IF_IN_VLAN_DISCARDS:
-            counters[ii] = discard_cnts.ingress_vlan_membership;
+            counters[ii] = snapshot->discard_cnts.ingress_vlan_membership;
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_64_OCTETS:
-            counters[ii] = perf_cnts.tx_stats_pkts64octets;
+            counters[ii] = snapshot->perf_cnts.tx_stats_pkts64octets;
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_65_TO_127_OCTETS:
-            counters[ii] = perf_cnts.tx_stats_pkts65to127octets;
+            counters[ii] = snapshot->perf_cnts.tx_stats_pkts65to127octets;
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_128_TO_255_OCTETS:
-            counters[ii] = perf_cnts.tx_stats_pkts128to255octets;
+            counters[ii] = snapshot->perf_cnts.tx_stats_pkts128to255octets;
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_256_TO_511_OCTETS:
-            counters[ii] = perf_cnts.tx_stats_pkts256to511octets;
+            counters[ii] = snapshot->perf_cnts.tx_stats_pkts256to511octets;
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_512_TO_1023_OCTETS:
-            counters[ii] = perf_cnts.tx_stats_pkts512to1023octets;
+            counters[ii] = snapshot->perf_cnts.tx_stats_pkts512to1023octets;
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_1024_TO_1518_OCTETS:
-            counters[ii] = perf_cnts.tx_stats_pkts1024to1518octets;
+            counters[ii] = snapshot->perf_cnts.tx_stats_pkts1024to1518octets;
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_1519_TO_2047_OCTETS:
-            counters[ii] = perf_cnts.tx_stats_pkts1519to2047octets;
+            counters[ii] = snapshot->perf_cnts.tx_stats_pkts1519to2047octets;
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_2048_TO_4095_OCTETS:
-            counters[ii] = perf_cnts.tx_stats_pkts2048to4095octets;
+            counters[ii] = snapshot->perf_cnts.tx_stats_pkts2048to4095octets;
             break;
 
         case SAI_PORT_STAT_ETHER_OUT_PKTS_4096_TO_9216_OCTETS:
-            counters[ii] = perf_cnts.tx_stats_pkts4096to8191octets;
+            counters[ii] = snapshot->perf_cnts.tx_stats_pkts4096to8191octets;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_ALIGNMENT_ERRORS:
-            counters[ii] = cnts_3635.dot3stats_alignment_errors;
+            counters[ii] = snapshot->cnts_3635.dot3stats_alignment_errors;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_FCS_ERRORS:
-            counters[ii] = cnts_3635.dot3stats_fcs_errors;
+            counters[ii] = snapshot->cnts_3635.dot3stats_fcs_errors;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_SINGLE_COLLISION_FRAMES:
-            counters[ii] = cnts_3635.dot3stats_single_collision_frames;
+            counters[ii] = snapshot->cnts_3635.dot3stats_single_collision_frames;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_MULTIPLE_COLLISION_FRAMES:
-            counters[ii] = cnts_3635.dot3stats_multiple_collision_frames;
+            counters[ii] = snapshot->cnts_3635.dot3stats_multiple_collision_frames;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_SQE_TEST_ERRORS:
-            counters[ii] = cnts_3635.dot3stats_sqe_test_errors;
+            counters[ii] = snapshot->cnts_3635.dot3stats_sqe_test_errors;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_DEFERRED_TRANSMISSIONS:
-            counters[ii] = cnts_3635.dot3stats_deferred_transmissions;
+            counters[ii] = snapshot->cnts_3635.dot3stats_deferred_transmissions;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_LATE_COLLISIONS:
-            counters[ii] = cnts_3635.dot3stats_late_collisions;
+            counters[ii] = snapshot->cnts_3635.dot3stats_late_collisions;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_EXCESSIVE_COLLISIONS:
-            counters[ii] = cnts_3635.dot3stats_excessive_collisions;
+            counters[ii] = snapshot->cnts_3635.dot3stats_excessive_collisions;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_INTERNAL_MAC_TRANSMIT_ERRORS:
-            counters[ii] = cnts_3635.dot3stats_internal_mac_transmit_errors;
+            counters[ii] = snapshot->cnts_3635.dot3stats_internal_mac_transmit_errors;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_CARRIER_SENSE_ERRORS:
-            counters[ii] = cnts_3635.dot3stats_carrier_sense_errors;
+            counters[ii] = snapshot->cnts_3635.dot3stats_carrier_sense_errors;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_FRAME_TOO_LONGS:
-            counters[ii] = cnts_3635.dot3stats_frame_too_longs;
+            counters[ii] = snapshot->cnts_3635.dot3stats_frame_too_longs;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_INTERNAL_MAC_RECEIVE_ERRORS:
-            counters[ii] = cnts_3635.dot3stats_internal_mac_receive_errors;
+            counters[ii] = snapshot->cnts_3635.dot3stats_internal_mac_receive_errors;
             break;
 
         case SAI_PORT_STAT_DOT3_STATS_SYMBOL_ERRORS:
-            counters[ii] = cnts_3635.dot3stats_symbol_errors;
+            counters[ii] = snapshot->cnts_3635.dot3stats_symbol_errors;
             break;
 
         case SAI_PORT_STAT_DOT3_CONTROL_IN_UNKNOWN_OPCODES:
-            counters[ii] = cnts_3635.dot3control_in_unknown_opcodes;
+            counters[ii] = snapshot->cnts_3635.dot3control_in_unknown_opcodes;
             break;
 
         case SAI_PORT_STAT_IF_OUT_QLEN:
@@ -4634,10 +4846,128 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         }
     }
 
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
+void mlnx_port_cntr_stats_get(_Out_ mlnx_port_cntr_stats_t *stats)
+{
+    assert(stats);
+
+    pthread_once(&g_port_cntr_cache_once, mlnx_port_cntr_cache_init);
+
+    pthread_mutex_lock(&g_port_cntr_cache_lock);
+    *stats            = g_port_cntr_stats;
+    stats->max_age_ms   = g_port_cntr_cache_max_age_us / 1000;
+    pthread_mutex_unlock(&g_port_cntr_cache_lock);
+}
+
+/**
+ * @brief Get port statistics counters extended.
+ *
+ * @param[in] port_id Port id
+ * @param[in] number_of_counters Number of counters in the array
+ * @param[in] counter_ids Specifies the array of counter ids
+ * @param[in] mode Statistics mode
+ * @param[out] counters Array of resulting counter values.
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
+                                     _In_ uint32_t             number_of_counters,
+                                     _In_ const sai_stat_id_t *counter_ids,
+                                     _In_ sai_stats_mode_t     mode,
+                                     _Out_ uint64_t           *counters)
+{
+    sai_status_t status, object_status;
+
+    status = mlnx_bulk_object_get_stats(SAI_OBJECT_TYPE_PORT, 1, &port_id, number_of_counters, counter_ids, mode,
+                                        &object_status, counters);
+    if (SAI_ERR(status)) {
+        return SAI_STATUS_FAILURE == status ? object_status : status;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get statistics counters of several ports in one sweep.
+ *
+ * Every port is read with the same counter ids, the counter groups they need are
+ * resolved once and all ports share one snapshot epoch.
+ *
+ * @param[in] object_count Number of ports
+ * @param[in] port_ids Array of port ids
+ * @param[in] number_of_counters Number of counters per port
+ * @param[in] counter_ids Specifies the array of counter ids
+ * @param[in] mode Statistics mode
+ * @param[out] object_statuses Status of each port
+ * @param[out] counters Array of object_count * number_of_counters values, grouped by port
+ *
+ * @return #SAI_STATUS_SUCCESS when all ports are read, #SAI_STATUS_FAILURE when some port failed,
+ *         other failure status code on invalid parameters
+ */
+sai_status_t mlnx_get_ports_stats_bulk(_In_ uint32_t               object_count,
+                                       _In_ const sai_object_id_t *port_ids,
+                                       _In_ uint32_t               number_of_counters,
+                                       _In_ const sai_stat_id_t   *counter_ids,
+                                       _In_ sai_stats_mode_t       mode,
+                                       _Out_ sai_status_t         *object_statuses,
+                                       _Out_ uint64_t             *counters)
+{
+    sai_status_t              status, bulk_status = SAI_STATUS_SUCCESS;
+    mlnx_port_cntr_snapshot_t snapshot;
+    uint32_t                  ii, port_data, grps;
+    uint64_t                  now_us;
+    char                      key_str[MAX_KEY_STR_LEN];
+    sx_access_cmd_t           cmd;
+
+    SX_LOG_ENTER();
+
+    if (SAI_STATUS_SUCCESS !=
+        (status = mlnx_stats_bulk_params_check(object_count, port_ids, number_of_counters, counter_ids,
+                                               object_statuses, counters))) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS !=
+        (status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd))) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    grps   = mlnx_port_cntr_grps_get(number_of_counters, counter_ids);
+    now_us = mlnx_time_us_get();
+
+    for (ii = 0; ii < object_count; ii++) {
+        port_key_to_str(port_ids[ii], key_str);
+        SX_LOG_DBG("Get port stats %s\n", key_str);
+
+        status = mlnx_object_to_type(port_ids[ii], SAI_OBJECT_TYPE_PORT, &port_data, NULL);
+        if (SAI_STATUS_SUCCESS == status) {
+            memset(&snapshot, 0, sizeof(snapshot));
+            status = mlnx_port_cntr_snapshot_get(port_data, cmd, grps, now_us, &snapshot);
+        }
+
+        if (SAI_STATUS_SUCCESS == status) {
+            status = mlnx_port_stats_fill(number_of_counters, counter_ids, &snapshot,
+                                          &counters[(uint64_t)ii * number_of_counters]);
+        }
+
+        object_statuses[ii] = status;
+        if (SAI_ERR(status)) {
+            bulk_status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    pthread_mutex_lock(&g_port_cntr_cache_lock);
+    g_port_cntr_stats.polls += object_count;
+    pthread_mutex_unlock(&g_port_cntr_cache_lock);
+
+    SX_LOG_EXIT();
+    return bulk_status;
+}
+
 /*
  * Routine Description:
  *   Get port statistics counters.
@@ -4712,6 +5042,8 @@ static sai_status_t mlnx_clear_port_all_stats(_In_ sai_object_id_t port_id)
         return sdk_to_sai(status);
     }
 
+    mlnx_port_cntr_cache_invalidate(port_data);
+
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -4727,6 +5059,44 @@ sai_status_t mlnx_port_log_set(sx_verbosity_level_t level)
     }
 }
 
+/* Present port with the logical id log_id found via ports_log_map, NULL if none. DB read lock is needed */
+static mlnx_port_config_t* mlnx_port_by_log_id_lookup(sx_port_log_id_t log_id)
+{
+    mlnx_port_config_t *port;
+    uint32_t            idx;
+    sai_status_t        status;
+
+    status = mlnx_log_port_map_get(g_sai_db_ptr->ports_log_map, MLNX_PORT_LOG_MAP_SIZE, log_id, &idx);
+    if (SAI_ERR(status) || (idx >= MAX_PORTS * 2)) {
+        return NULL;
+    }
+
+    port = &mlnx_ports_db[idx];
+    if (!port->is_present || (port->logical != log_id)) {
+        return NULL;
+    }
+
+    return port;
+}
+
+/* DB write lock is needed */
+void mlnx_port_logical_set(mlnx_port_config_t *port, sx_port_log_id_t log_id)
+{
+    sai_status_t status;
+
+    assert(port);
+
+    mlnx_log_port_map_del(g_sai_db_ptr->ports_log_map, MLNX_PORT_LOG_MAP_SIZE, port->logical, port->index);
+
+    port->logical = log_id;
+
+    if (log_id) {
+        status = mlnx_log_port_map_set(g_sai_db_ptr->ports_log_map, MLNX_PORT_LOG_MAP_SIZE, log_id, port->index);
+        /* The map is sized for all of ports_db */
+        assert(SAI_STATUS_SUCCESS == status);
+    }
+}
+
 /*
  * Get index of port configuration in port qos db
  *
@@ -4743,15 +5113,13 @@ sai_status_t mlnx_port_log_set(sx_verbosity_level_t level)
 sai_status_t mlnx_port_idx_by_log_id(sx_port_log_id_t log_port_id, uint32_t *index)
 {
     mlnx_port_config_t *port;
-    uint32_t            ii = 0;
 
     assert(index != NULL);
 
-    mlnx_port_foreach(port, ii) {
-        if (log_port_id == port->logical) {
-            *index = ii;
-            return SAI_STATUS_SUCCESS;
-        }
+    port = mlnx_port_by_log_id_lookup(log_port_id);
+    if (port) {
+        *index = port->index;
+        return SAI_STATUS_SUCCESS;
     }
 
     SX_LOG_ERR("Port index not found in DB by log id 0x%x\n", log_port_id);
@@ -4781,15 +5149,13 @@ sai_status_t mlnx_port_idx_by_obj_id(sai_object_id_t obj_id, uint32_t *index)
 sai_status_t mlnx_port_by_log_id_soft(sx_port_log_id_t log_id, mlnx_port_config_t **port)
 {
     mlnx_port_config_t *port_cfg;
-    uint32_t            ii;
 
     assert(port != NULL);
 
-    mlnx_port_foreach(port_cfg, ii) {
-        if (port_cfg->logical == log_id) {
-            *port = port_cfg;
-            return SAI_STATUS_SUCCESS;
-        }
+    port_cfg = mlnx_port_by_log_id_lookup(log_id);
+    if (port_cfg) {
+        *port = port_cfg;
+        return SAI_STATUS_SUCCESS;
     }
 
     return SAI_STATUS_INVALID_PORT_NUMBER;
@@ -4812,15 +5178,13 @@ sai_status_t mlnx_port_by_log_id(sx_port_log_id_t log_id, mlnx_port_config_t **p
 sai_status_t mlnx_lag_by_log_id(sx_port_log_id_t log_id, mlnx_port_config_t **lag)
 {
     mlnx_port_config_t *lag_cfg;
-    uint32_t            ii;
 
     assert(lag != NULL);
 
-    mlnx_lag_foreach(lag_cfg, ii) {
-        if (lag_cfg->logical == log_id) {
-            *lag = lag_cfg;
-            return SAI_STATUS_SUCCESS;
-        }
+    lag_cfg = mlnx_port_by_log_id_lookup(log_id);
+    if (lag_cfg && (lag_cfg->index >= MAX_PORTS)) {
+        *lag = lag_cfg;
+        return SAI_STATUS_SUCCESS;
     }
 
     SX_LOG_ERR("Failed lookup port config for lag by log id 0x%x\n", log_id);
@@ -6737,6 +7101,9 @@ sai_status_t mlnx_port_config_uninit(mlnx_port_config_t *port)
             }
             buff_count = mlnx_sai_get_buffer_resource_limits()->num_egress_pools;
             mlnx_port_reset_buffer_refs(buff_refs, buff_count);
+
+            /* Buffer profiles reverse references, including queues */
+            mlnx_sai_buffer_port_refs_reset(port_index);
         }
 
         /* Reset port's queues */
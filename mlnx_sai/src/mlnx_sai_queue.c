@@ -497,178 +497,87 @@ static sai_status_t mlnx_get_queue_attribute(_In_ sai_object_id_t     queue_id,
     return sai_status;
 }
 
-/**
- * @brief Get queue statistics counters extended.
- *
- * @param[in] queue_id Queue id
- * @param[in] number_of_counters Number of counters in the array
- * @param[in] counter_ids Specifies the array of counter ids
- * @param[in] mode Statistics mode
- * @param[out] counters Array of resulting counter values.
- *
- * @return #SAI_STATUS_SUCCESS on success, failure status code on error
- */
-sai_status_t mlnx_get_queue_statistics_ext(_In_ sai_object_id_t      queue_id,
-                                           _In_ uint32_t             number_of_counters,
-                                           _In_ const sai_stat_id_t *counter_ids,
-                                           _In_ sai_stats_mode_t     mode,
-                                           _Out_ uint64_t           *counters)
+typedef struct _mlnx_queue_stats_obj_t {
+    sx_port_log_id_t port_num;
+    uint8_t          queue_num;
+    uint32_t         obj_idx;
+} mlnx_queue_stats_obj_t;
+
+static sai_status_t mlnx_queue_mc_stats_fill(_In_ uint32_t                   number_of_counters,
+                                             _In_ const sai_stat_id_t       *counter_ids,
+                                             _In_ const sx_port_cntr_perf_t *perf_cnts,
+                                             _Out_ uint64_t                 *counters)
 {
-    sai_status_t                     status;
-    uint8_t                          ext_data[EXTENDED_DATA_SIZE] = {0};
-    uint8_t                          queue_num                    = 0;
-    sx_port_log_id_t                 port_num;
-    const uint8_t                    port_prio_id = 0;
-    uint32_t                         ii;
-    char                             key_str[MAX_KEY_STR_LEN];
-    sx_port_statistic_usage_params_t stats_usage;
-    sx_port_occupancy_statistics_t   occupancy_stats;
-    uint32_t                         usage_cnt = 1;
-    sx_port_traffic_cntr_t           tc_cnts   = { 0 };
-    sx_port_cntr_perf_t              perf_cnts;
-    bool                             tc_cnts_needed = false, occupancy_stats_needed = false;
-    mlnx_qos_queue_config_t         *queue_cfg      = NULL;
-    uint32_t                         db_buffer_profile_index;
-    sx_access_cmd_t                  cmd;
-
-    SX_LOG_ENTER();
-
-    queue_key_to_str(queue_id, key_str);
-    SX_LOG_DBG("Get queue stats %s\n", key_str);
-
-    if (NULL == counter_ids) {
-        SX_LOG_ERR("NULL counter ids array param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-
-    if (NULL == counters) {
-        SX_LOG_ERR("NULL counters array param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd))) {
-        return status;
-    }
-
-    if (SAI_STATUS_SUCCESS != mlnx_object_to_type(queue_id, SAI_OBJECT_TYPE_QUEUE, &port_num, ext_data)) {
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-    queue_num = ext_data[0];
-    if (queue_num > g_resource_limits.cos_port_ets_traffic_class_max) {
-        SX_LOG_ERR("Invalid queue num %u - exceed maximum %u\n", queue_num,
-                   g_resource_limits.cos_port_ets_traffic_class_max);
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-    /* TODO : change to > g_resource_limits.cos_port_ets_traffic_class_max when sdk is updated to use rm */
-    if (queue_num >= RM_API_COS_TRAFFIC_CLASS_NUM) {
-        status = sx_api_port_counter_perf_get(gh_sdk, cmd,
-                                              port_num,
-                                              port_prio_id,
-                                              &perf_cnts);
-        if (SX_STATUS_SUCCESS != status) {
-            SX_LOG_ERR("Error getting port counter perf for port 0x%x\n", port_num);
-            return sdk_to_sai(status);
-        }
-
-        for (ii = 0; ii < number_of_counters; ii++) {
-            switch (counter_ids[ii]) {
-            case SAI_QUEUE_STAT_DROPPED_BYTES:
-            case SAI_QUEUE_STAT_GREEN_PACKETS:
-            case SAI_QUEUE_STAT_GREEN_BYTES:
-            case SAI_QUEUE_STAT_GREEN_DROPPED_PACKETS:
-            case SAI_QUEUE_STAT_GREEN_DROPPED_BYTES:
-            case SAI_QUEUE_STAT_YELLOW_PACKETS:
-            case SAI_QUEUE_STAT_YELLOW_BYTES:
-            case SAI_QUEUE_STAT_YELLOW_DROPPED_PACKETS:
-            case SAI_QUEUE_STAT_YELLOW_DROPPED_BYTES:
-            case SAI_QUEUE_STAT_RED_PACKETS:
-            case SAI_QUEUE_STAT_RED_BYTES:
-            case SAI_QUEUE_STAT_RED_DROPPED_PACKETS:
-            case SAI_QUEUE_STAT_RED_DROPPED_BYTES:
-            case SAI_QUEUE_STAT_GREEN_WRED_DROPPED_PACKETS:
-            case SAI_QUEUE_STAT_GREEN_WRED_DROPPED_BYTES:
-            case SAI_QUEUE_STAT_YELLOW_WRED_DROPPED_PACKETS:
-            case SAI_QUEUE_STAT_YELLOW_WRED_DROPPED_BYTES:
-            case SAI_QUEUE_STAT_RED_WRED_DROPPED_PACKETS:
-            case SAI_QUEUE_STAT_RED_WRED_DROPPED_BYTES:
-            case SAI_QUEUE_STAT_WRED_DROPPED_BYTES:
-            case SAI_QUEUE_STAT_SHARED_CURR_OCCUPANCY_BYTES:
-            case SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES:
-            case SAI_QUEUE_STAT_BYTES:
-            case SAI_QUEUE_STAT_DROPPED_PACKETS:
-            case SAI_QUEUE_STAT_WRED_DROPPED_PACKETS:
-            case SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES:
-            case SAI_QUEUE_STAT_WATERMARK_BYTES:
-            case SAI_QUEUE_STAT_GREEN_WRED_ECN_MARKED_PACKETS:
-            case SAI_QUEUE_STAT_GREEN_WRED_ECN_MARKED_BYTES:
-            case SAI_QUEUE_STAT_YELLOW_WRED_ECN_MARKED_PACKETS:
-            case SAI_QUEUE_STAT_YELLOW_WRED_ECN_MARKED_BYTES:
-            case SAI_QUEUE_STAT_RED_WRED_ECN_MARKED_PACKETS:
-            case SAI_QUEUE_STAT_RED_WRED_ECN_MARKED_BYTES:
-            case SAI_QUEUE_STAT_WRED_ECN_MARKED_PACKETS:
-            case SAI_QUEUE_STAT_WRED_ECN_MARKED_BYTES:
-                SX_LOG_INF("Queue counter %d set item %u not supported for queue num greater than %d\n",
-                           counter_ids[ii],
-                           ii,
-                           RM_API_COS_TRAFFIC_CLASS_NUM);
-                return SAI_STATUS_ATTR_NOT_SUPPORTED_0 + ii;
-
-            case SAI_QUEUE_STAT_PACKETS:
-                counters[ii] = perf_cnts.no_buffer_discard_mc;
-                break;
-
-            default:
-                SX_LOG_ERR("Invalid queue counter %d\n", counter_ids[ii]);
-                return SAI_STATUS_INVALID_PARAMETER;
-            }
-        }
-        return SAI_STATUS_SUCCESS;
-    }
+    uint32_t ii;
 
     for (ii = 0; ii < number_of_counters; ii++) {
         switch (counter_ids[ii]) {
-        case SAI_QUEUE_STAT_PACKETS:
+        case SAI_QUEUE_STAT_DROPPED_BYTES:
+        case SAI_QUEUE_STAT_GREEN_PACKETS:
+        case SAI_QUEUE_STAT_GREEN_BYTES:
+        case SAI_QUEUE_STAT_GREEN_DROPPED_PACKETS:
+        case SAI_QUEUE_STAT_GREEN_DROPPED_BYTES:
+        case SAI_QUEUE_STAT_YELLOW_PACKETS:
+        case SAI_QUEUE_STAT_YELLOW_BYTES:
+        case SAI_QUEUE_STAT_YELLOW_DROPPED_PACKETS:
+        case SAI_QUEUE_STAT_YELLOW_DROPPED_BYTES:
+        case SAI_QUEUE_STAT_RED_PACKETS:
+        case SAI_QUEUE_STAT_RED_BYTES:
+        case SAI_QUEUE_STAT_RED_DROPPED_PACKETS:
+        case SAI_QUEUE_STAT_RED_DROPPED_BYTES:
+        case SAI_QUEUE_STAT_GREEN_WRED_DROPPED_PACKETS:
+        case SAI_QUEUE_STAT_GREEN_WRED_DROPPED_BYTES:
+        case SAI_QUEUE_STAT_YELLOW_WRED_DROPPED_PACKETS:
+        case SAI_QUEUE_STAT_YELLOW_WRED_DROPPED_BYTES:
+        case SAI_QUEUE_STAT_RED_WRED_DROPPED_PACKETS:
+        case SAI_QUEUE_STAT_RED_WRED_DROPPED_BYTES:
+        case SAI_QUEUE_STAT_WRED_DROPPED_BYTES:
+        case SAI_QUEUE_STAT_SHARED_CURR_OCCUPANCY_BYTES:
+        case SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES:
         case SAI_QUEUE_STAT_BYTES:
         case SAI_QUEUE_STAT_DROPPED_PACKETS:
         case SAI_QUEUE_STAT_WRED_DROPPED_PACKETS:
-            tc_cnts_needed = true;
-            break;
-
         case SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES:
         case SAI_QUEUE_STAT_WATERMARK_BYTES:
-        case SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES:
-            occupancy_stats_needed = true;
-            break;
+        case SAI_QUEUE_STAT_GREEN_WRED_ECN_MARKED_PACKETS:
+        case SAI_QUEUE_STAT_GREEN_WRED_ECN_MARKED_BYTES:
+        case SAI_QUEUE_STAT_YELLOW_WRED_ECN_MARKED_PACKETS:
+        case SAI_QUEUE_STAT_YELLOW_WRED_ECN_MARKED_BYTES:
+        case SAI_QUEUE_STAT_RED_WRED_ECN_MARKED_PACKETS:
+        case SAI_QUEUE_STAT_RED_WRED_ECN_MARKED_BYTES:
+        case SAI_QUEUE_STAT_WRED_ECN_MARKED_PACKETS:
+        case SAI_QUEUE_STAT_WRED_ECN_MARKED_BYTES:
+            SX_LOG_INF("Queue counter %d set item %u not supported for queue num greater than %d\n",
+                       counter_ids[ii],
+                       ii,
+                       RM_API_COS_TRAFFIC_CLASS_NUM);
+            return SAI_STATUS_ATTR_NOT_SUPPORTED_0 + ii;
 
-        default:
+        case SAI_QUEUE_STAT_PACKETS:
+            counters[ii] = perf_cnts->no_buffer_discard_mc;
             break;
-        }
-    }
 
-    if (tc_cnts_needed) {
-        if (SX_STATUS_SUCCESS !=
-            (status = sx_api_port_counter_tc_get(gh_sdk, cmd, port_num, queue_num, &tc_cnts))) {
-            SX_LOG_ERR("Failed to get port tc counters - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+        default:
+            SX_LOG_ERR("Invalid queue counter %d\n", counter_ids[ii]);
+            return SAI_STATUS_INVALID_PARAMETER;
         }
     }
 
-    if (occupancy_stats_needed) {
-        memset(&stats_usage, 0, sizeof(stats_usage));
-        stats_usage.port_cnt                                 = 1;
-        stats_usage.log_port_list_p                          = &port_num;
-        stats_usage.sx_port_params.port_params_type          = SX_COS_EGRESS_PORT_TRAFFIC_CLASS_ATTR_E;
-        stats_usage.sx_port_params.port_params_cnt           = 1;
-        stats_usage.sx_port_params.port_param.port_tc_list_p = &queue_num;
+    return SAI_STATUS_SUCCESS;
+}
 
-        if (SX_STATUS_SUCCESS !=
-            (status = sx_api_cos_port_buff_type_statistic_get(gh_sdk, cmd, &stats_usage, 1,
-                                                              &occupancy_stats, &usage_cnt))) {
-            SX_LOG_ERR("Failed to get port buff statistics - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
-        }
-    }
+static sai_status_t mlnx_queue_stats_fill(_In_ sx_port_log_id_t                      port_num,
+                                          _In_ uint8_t                               queue_num,
+                                          _In_ uint32_t                              number_of_counters,
+                                          _In_ const sai_stat_id_t                  *counter_ids,
+                                          _In_ const sx_port_traffic_cntr_t         *tc_cnts,
+                                          _In_ const sx_port_occupancy_statistics_t *occupancy_stats,
+                                          _Out_ uint64_t                            *counters)
+{
+    sai_status_t             status;
+    mlnx_qos_queue_config_t *queue_cfg = NULL;
+    uint32_t                 db_buffer_profile_index;
+    uint32_t                 ii;
 
     for (ii = 0; ii < number_of_counters; ii++) {
         switch (counter_ids[ii]) {
@@ -705,33 +614,33 @@ sai_status_t mlnx_get_queue_statistics_ext(_In_ sai_object_id_t      queue_id,
             return SAI_STATUS_ATTR_NOT_SUPPORTED_0;
 
         case SAI_QUEUE_STAT_PACKETS:
-            counters[ii] = tc_cnts.tx_frames;
+            counters[ii] = tc_cnts->tx_frames;
             break;
 
         case SAI_QUEUE_STAT_BYTES:
-            counters[ii] = tc_cnts.tx_octet;
+            counters[ii] = tc_cnts->tx_octet;
             break;
 
         case SAI_QUEUE_STAT_DROPPED_PACKETS:
-            counters[ii] = tc_cnts.tx_no_buffer_discard_uc;
+            counters[ii] = tc_cnts->tx_no_buffer_discard_uc;
             break;
 
         case SAI_QUEUE_STAT_WRED_DROPPED_PACKETS:
-            counters[ii] = tc_cnts.tx_wred_discard;
+            counters[ii] = tc_cnts->tx_wred_discard;
             break;
 
         case SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES:
-            counters[ii] = (uint64_t)occupancy_stats.statistics.curr_occupancy *
+            counters[ii] = (uint64_t)occupancy_stats->statistics.curr_occupancy *
                            g_resource_limits.shared_buff_buffer_unit_size;
             break;
 
         case SAI_QUEUE_STAT_WATERMARK_BYTES:
-            counters[ii] = (uint64_t)occupancy_stats.statistics.watermark *
+            counters[ii] = (uint64_t)occupancy_stats->statistics.watermark *
                            g_resource_limits.shared_buff_buffer_unit_size;
             break;
 
         case SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES:
-            counters[ii] = (uint64_t)occupancy_stats.statistics.watermark *
+            counters[ii] = (uint64_t)occupancy_stats->statistics.watermark *
                            g_resource_limits.shared_buff_buffer_unit_size;
 
             sai_db_read_lock();
@@ -766,10 +675,285 @@ sai_status_t mlnx_get_queue_statistics_ext(_In_ sai_object_id_t      queue_id,
         }
     }
 
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
+static int mlnx_queue_stats_obj_cmp(const void *a, const void *b)
+{
+    const mlnx_queue_stats_obj_t *obj_a = a;
+    const mlnx_queue_stats_obj_t *obj_b = b;
+
+    if (obj_a->port_num != obj_b->port_num) {
+        return (obj_a->port_num < obj_b->port_num) ? -1 : 1;
+    }
+
+    if (obj_a->queue_num != obj_b->queue_num) {
+        return (obj_a->queue_num < obj_b->queue_num) ? -1 : 1;
+    }
+
+    return (obj_a->obj_idx < obj_b->obj_idx) ? -1 : (obj_a->obj_idx > obj_b->obj_idx);
+}
+
+/*
+ * Read the counters of all the requested queues of one port.
+ * Multicast queues share one perf counters read and the occupancy of all unicast queues
+ * is read with one buffer statistics call, only tc counters are read per queue.
+ * The occupancy call gets each TC once, queues find their result by TC through tc_slot.
+ */
+static void mlnx_queue_port_stats_get(_In_ const mlnx_queue_stats_obj_t      *objs,
+                                      _In_ uint32_t                           objs_count,
+                                      _In_ uint32_t                           number_of_counters,
+                                      _In_ const sai_stat_id_t               *counter_ids,
+                                      _In_ sx_access_cmd_t                    cmd,
+                                      _In_ bool                               tc_cnts_needed,
+                                      _In_ bool                               occupancy_stats_needed,
+                                      _Inout_ uint8_t                        *tc_list,
+                                      _Inout_ sx_port_occupancy_statistics_t *occupancy_list,
+                                      _Out_ sai_status_t                     *object_statuses,
+                                      _Out_ uint64_t                         *counters)
+{
+    sx_port_log_id_t                 port_num     = objs[0].port_num;
+    const uint8_t                    port_prio_id = 0;
+    sx_port_statistic_usage_params_t stats_usage;
+    sx_port_traffic_cntr_t           tc_cnts;
+    sx_port_cntr_perf_t              perf_cnts;
+    sai_status_t                     status, mc_status = SAI_STATUS_SUCCESS, occupancy_status = SAI_STATUS_SUCCESS;
+    uint32_t                         ii, uc_count = 0, mc_count = 0, usage_cnt;
+    uint32_t                         tc_slot[RM_API_COS_TRAFFIC_CLASS_NUM];
+    uint64_t                        *obj_counters;
+
+    for (ii = 0; ii < objs_count; ii++) {
+        /* TODO : change to  g_resource_limits.cos_port_ets_traffic_class_max when sdk is updated to use rm */
+        if (objs[ii].queue_num >= RM_API_COS_TRAFFIC_CLASS_NUM) {
+            mc_count++;
+        } else if ((0 == uc_count) || (tc_list[uc_count - 1] != objs[ii].queue_num)) {
+            /* objs are sorted by queue, so the same queue requested twice is adjacent */
+            tc_slot[objs[ii].queue_num] = uc_count;
+            tc_list[uc_count++]         = objs[ii].queue_num;
+        }
+    }
+
+    if (mc_count > 0) {
+        status = sx_api_port_counter_perf_get(gh_sdk, cmd, port_num, port_prio_id, &perf_cnts);
+        if (SX_STATUS_SUCCESS != status) {
+            SX_LOG_ERR("Error getting port counter perf for port 0x%x\n", port_num);
+            mc_status = sdk_to_sai(status);
+        }
+    }
+
+    if (occupancy_stats_needed && (uc_count > 0)) {
+        memset(&stats_usage, 0, sizeof(stats_usage));
+        stats_usage.port_cnt                                 = 1;
+        stats_usage.log_port_list_p                          = &port_num;
+        stats_usage.sx_port_params.port_params_type          = SX_COS_EGRESS_PORT_TRAFFIC_CLASS_ATTR_E;
+        stats_usage.sx_port_params.port_params_cnt           = uc_count;
+        stats_usage.sx_port_params.port_param.port_tc_list_p = tc_list;
+        usage_cnt                                            = uc_count;
+
+        if (SX_STATUS_SUCCESS !=
+            (status = sx_api_cos_port_buff_type_statistic_get(gh_sdk, cmd, &stats_usage, 1,
+                                                              occupancy_list, &usage_cnt))) {
+            SX_LOG_ERR("Failed to get port buff statistics - %s.\n", SX_STATUS_MSG(status));
+            occupancy_status = sdk_to_sai(status);
+        } else if (usage_cnt != uc_count) {
+            SX_LOG_ERR("Got %u port buff statistics for port 0x%x, expected %u\n", usage_cnt, port_num, uc_count);
+            occupancy_status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    for (ii = 0; ii < objs_count; ii++) {
+        obj_counters = &counters[(uint64_t)objs[ii].obj_idx * number_of_counters];
+
+        if (objs[ii].queue_num >= RM_API_COS_TRAFFIC_CLASS_NUM) {
+            status = mc_status;
+            if (SAI_STATUS_SUCCESS == status) {
+                status = mlnx_queue_mc_stats_fill(number_of_counters, counter_ids, &perf_cnts, obj_counters);
+            }
+            object_statuses[objs[ii].obj_idx] = status;
+            continue;
+        }
+
+        status = occupancy_status;
+        memset(&tc_cnts, 0, sizeof(tc_cnts));
+
+        if ((SAI_STATUS_SUCCESS == status) && tc_cnts_needed) {
+            if (SX_STATUS_SUCCESS !=
+                (status = sx_api_port_counter_tc_get(gh_sdk, cmd, port_num, objs[ii].queue_num, &tc_cnts))) {
+                SX_LOG_ERR("Failed to get port tc counters - %s.\n", SX_STATUS_MSG(status));
+                status = sdk_to_sai(status);
+            }
+        }
+
+        if (SAI_STATUS_SUCCESS == status) {
+            status = mlnx_queue_stats_fill(port_num, objs[ii].queue_num, number_of_counters, counter_ids,
+                                           &tc_cnts, &occupancy_list[tc_slot[objs[ii].queue_num]], obj_counters);
+        }
+
+        object_statuses[objs[ii].obj_idx] = status;
+    }
+}
+
+/**
+ * @brief Get queue statistics counters extended.
+ *
+ * @param[in] queue_id Queue id
+ * @param[in] number_of_counters Number of counters in the array
+ * @param[in] counter_ids Specifies the array of counter ids
+ * @param[in] mode Statistics mode
+ * @param[out] counters Array of resulting counter values.
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+sai_status_t mlnx_get_queue_statistics_ext(_In_ sai_object_id_t      queue_id,
+                                           _In_ uint32_t             number_of_counters,
+                                           _In_ const sai_stat_id_t *counter_ids,
+                                           _In_ sai_stats_mode_t     mode,
+                                           _Out_ uint64_t           *counters)
+{
+    sai_status_t status, object_status;
+
+    status = mlnx_bulk_object_get_stats(SAI_OBJECT_TYPE_QUEUE, 1, &queue_id, number_of_counters, counter_ids, mode,
+                                        &object_status, counters);
+    if (SAI_ERR(status)) {
+        return SAI_STATUS_FAILURE == status ? object_status : status;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get statistics counters of several queues.
+ *
+ * Queues are grouped by port, see mlnx_queue_port_stats_get() for the SDK reads per port.
+ *
+ * @param[in] object_count Number of queues
+ * @param[in] queue_ids Array of queue ids
+ * @param[in] number_of_counters Number of counters per queue
+ * @param[in] counter_ids Specifies the array of counter ids
+ * @param[in] mode Statistics mode
+ * @param[out] object_statuses Status of each queue
+ * @param[out] counters Array of object_count * number_of_counters values, grouped by queue
+ *
+ * @return #SAI_STATUS_SUCCESS when all queues are read, #SAI_STATUS_FAILURE when some queue failed,
+ *         other failure status code on invalid parameters
+ */
+sai_status_t mlnx_get_queues_stats_bulk(_In_ uint32_t               object_count,
+                                        _In_ const sai_object_id_t *queue_ids,
+                                        _In_ uint32_t               number_of_counters,
+                                        _In_ const sai_stat_id_t   *counter_ids,
+                                        _In_ sai_stats_mode_t       mode,
+                                        _Out_ sai_status_t         *object_statuses,
+                                        _Out_ uint64_t             *counters)
+{
+    sai_status_t                    status, bulk_status = SAI_STATUS_SUCCESS;
+    uint8_t                         ext_data[EXTENDED_DATA_SIZE];
+    mlnx_queue_stats_obj_t         *objs           = NULL;
+    uint8_t                        *tc_list        = NULL;
+    sx_port_occupancy_statistics_t *occupancy_list = NULL;
+    uint32_t                        ii, objs_count = 0, run_start;
+    char                            key_str[MAX_KEY_STR_LEN];
+    bool                            tc_cnts_needed = false, occupancy_stats_needed = false;
+    sx_access_cmd_t                 cmd;
+
+    SX_LOG_ENTER();
+
+    if (SAI_STATUS_SUCCESS !=
+        (status = mlnx_stats_bulk_params_check(object_count, queue_ids, number_of_counters, counter_ids,
+                                               object_statuses, counters))) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS !=
+        (status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd))) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    for (ii = 0; ii < number_of_counters; ii++) {
+        switch (counter_ids[ii]) {
+        case SAI_QUEUE_STAT_PACKETS:
+        case SAI_QUEUE_STAT_BYTES:
+        case SAI_QUEUE_STAT_DROPPED_PACKETS:
+        case SAI_QUEUE_STAT_WRED_DROPPED_PACKETS:
+            tc_cnts_needed = true;
+            break;
+
+        case SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES:
+        case SAI_QUEUE_STAT_WATERMARK_BYTES:
+        case SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES:
+            occupancy_stats_needed = true;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    objs           = calloc(object_count, sizeof(*objs));
+    tc_list        = calloc(object_count, sizeof(*tc_list));
+    occupancy_list = calloc(object_count, sizeof(*occupancy_list));
+    if (!objs || !tc_list || !occupancy_list) {
+        SX_LOG_ERR("Failed to allocate memory for queue stats\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        queue_key_to_str(queue_ids[ii], key_str);
+        SX_LOG_DBG("Get queue stats %s\n", key_str);
+
+        memset(ext_data, 0, sizeof(ext_data));
+        if (SAI_STATUS_SUCCESS !=
+            mlnx_object_to_type(queue_ids[ii], SAI_OBJECT_TYPE_QUEUE, &objs[objs_count].port_num, ext_data)) {
+            object_statuses[ii] = SAI_STATUS_INVALID_PARAMETER;
+            bulk_status         = SAI_STATUS_FAILURE;
+            continue;
+        }
+
+        objs[objs_count].queue_num = ext_data[0];
+        objs[objs_count].obj_idx   = ii;
+        if (objs[objs_count].queue_num > g_resource_limits.cos_port_ets_traffic_class_max) {
+            SX_LOG_ERR("Invalid queue num %u - exceed maximum %u\n", objs[objs_count].queue_num,
+                       g_resource_limits.cos_port_ets_traffic_class_max);
+            object_statuses[ii] = SAI_STATUS_INVALID_PARAMETER;
+            bulk_status         = SAI_STATUS_FAILURE;
+            continue;
+        }
+
+        objs_count++;
+    }
+
+    qsort(objs, objs_count, sizeof(*objs), mlnx_queue_stats_obj_cmp);
+
+    run_start = 0;
+    for (ii = 1; ii <= objs_count; ii++) {
+        if ((ii < objs_count) && (objs[ii].port_num == objs[run_start].port_num)) {
+            continue;
+        }
+
+        mlnx_queue_port_stats_get(&objs[run_start], ii - run_start, number_of_counters, counter_ids, cmd,
+                                  tc_cnts_needed, occupancy_stats_needed, tc_list, occupancy_list,
+                                  object_statuses, counters);
+        run_start = ii;
+    }
+
+    for (ii = 0; ii < objs_count; ii++) {
+        if (SAI_ERR(object_statuses[objs[ii].obj_idx])) {
+            bulk_status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    status = bulk_status;
+
+out:
+    free(objs);
+    free(tc_list);
+    free(occupancy_list);
+    SX_LOG_EXIT();
+    return status;
+}
+
 /**
  * @brief Get queue statistics counters.
  *
@@ -238,14 +238,6 @@ sai_status_t mlnx_rif_oid_create(_In_ mlnx_rif_type_t          rif_type,
     return SAI_STATUS_SUCCESS;
 }
 
-static bool mlnx_rif_counter_db_cmp(_In_ const void *elem, _In_ const void *data)
-{
-    const mlnx_rif_db_t  *rif_db = (const mlnx_rif_db_t*)elem;
-    sx_router_interface_t rif    = *(const sx_router_interface_t*)data;
-
-    return rif_db->sx_data.rif_id == rif;
-}
-
 sai_status_t mlnx_rif_sx_to_sai_oid(_In_ sx_router_interface_t sx_rif_id, _Out_ sai_object_id_t      *oid)
 {
     sai_status_t             status;
@@ -254,9 +246,7 @@ sai_status_t mlnx_rif_sx_to_sai_oid(_In_ sx_router_interface_t sx_rif_id, _Out_
     mlnx_shm_rm_array_idx_t  idx;
     uint32_t                 ii;
 
-    status = mlnx_shm_rm_array_find(MLNX_SHM_RM_ARRAY_TYPE_RIF, mlnx_rif_counter_db_cmp,
-                                    MLNX_SHM_RM_ARRAY_IDX_UNINITIALIZED,
-                                    (void*)&sx_rif_id, &idx, &elem);
+    status = mlnx_shm_rm_array_find_by_key(MLNX_SHM_RM_ARRAY_TYPE_RIF, sx_rif_id, &idx, &elem);
     if (status == SAI_STATUS_SUCCESS) {
         return mlnx_rif_oid_create(MLNX_RIF_TYPE_DEFAULT, NULL, idx, oid);
     }
@@ -480,6 +470,8 @@ sai_status_t mlnx_rif_sx_deinit(_In_ mlnx_rif_sx_data_t *sx_data)
         return sdk_to_sai(sx_status);
     }
 
+    mlnx_neighbor_shadow_rif_flush(sx_data->rif_id);
+
     SX_LOG_DBG("Removed sx rif %d and counter %d\n", sx_data->rif_id, sx_data->counter);
 
     return SAI_STATUS_SUCCESS;
@@ -774,6 +766,11 @@ static sai_status_t mlnx_create_router_interface(_Out_ sai_object_id_t      *rif
         rif_db_data->sx_data.rif_id  = sdk_rif_id;
         rif_db_data->sx_data.counter = sx_counter;
         rif_db_data->sx_data.vrf_id  = vrid_data;
+
+        status = mlnx_shm_rm_array_key_set(db_idx, sdk_rif_id);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
     }
 
     if (SAI_STATUS_SUCCESS ==
@@ -1390,6 +1387,77 @@ static sai_status_t mlnx_rif_attrib_get(_In_ const sai_object_key_t   *key,
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_rif_stats_fill(_In_ uint32_t                       number_of_counters,
+                                        _In_ const sai_stat_id_t           *counter_ids,
+                                        _In_ const sx_router_counter_set_t *sx_counter_set,
+                                        _Out_ uint64_t                     *counters)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < number_of_counters; ii++) {
+        switch (counter_ids[ii]) {
+        case SAI_ROUTER_INTERFACE_STAT_IN_OCTETS:
+            counters[ii] = sx_counter_set->router_ingress_good_unicast_bytes +
+                           sx_counter_set->router_ingress_good_multicast_bytes +
+                           sx_counter_set->router_ingress_good_broadcast_bytes;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_IN_PACKETS:
+            counters[ii] = sx_counter_set->router_ingress_good_unicast_packets +
+                           sx_counter_set->router_ingress_good_multicast_packets +
+                           sx_counter_set->router_ingress_good_broadcast_packets;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS:
+            counters[ii] = sx_counter_set->router_egress_good_unicast_bytes +
+                           sx_counter_set->router_egress_good_multicast_bytes +
+                           sx_counter_set->router_egress_good_broadcast_bytes;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS:
+            counters[ii] = sx_counter_set->router_egress_good_unicast_packets +
+                           sx_counter_set->router_egress_good_multicast_packets +
+                           sx_counter_set->router_egress_good_broadcast_packets;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_IN_ERROR_OCTETS:
+            counters[ii] = sx_counter_set->router_ingress_bad_unicast_bytes +
+                           sx_counter_set->router_ingress_bad_multicast_bytes +
+                           sx_counter_set->router_ingress_error_bytes +
+                           sx_counter_set->router_ingress_discard_bytes;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_IN_ERROR_PACKETS:
+            counters[ii] = sx_counter_set->router_ingress_bad_unicast_packets +
+                           sx_counter_set->router_ingress_bad_multicast_packets +
+                           sx_counter_set->router_ingress_error_packets +
+                           sx_counter_set->router_ingress_discard_packets;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_OCTETS:
+            counters[ii] = sx_counter_set->router_egress_bad_unicast_bytes +
+                           sx_counter_set->router_egress_bad_multicast_bytes +
+                           sx_counter_set->router_egress_error_bytes +
+                           sx_counter_set->router_egress_discard_bytes;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_PACKETS:
+            counters[ii] = sx_counter_set->router_egress_bad_unicast_packets +
+                           sx_counter_set->router_egress_bad_multicast_packets +
+                           sx_counter_set->router_egress_error_packets +
+                           sx_counter_set->router_egress_discard_packets;
+            break;
+
+        default:
+            SX_LOG_ERR("Invalid sai_router_interface_stat_t - %d\n", counter_ids[ii]);
+            SX_LOG_EXIT();
+            return SAI_STATUS_INVALID_ATTRIBUTE_0 + ii;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /**
  * @brief Get router interface statistics counters extended.
  *
@@ -1406,32 +1474,58 @@ static sai_status_t mlnx_get_router_interface_stats_ext(_In_ sai_object_id_t
                                                         _In_ const sai_stat_id_t *counter_ids,
                                                         _In_ sai_stats_mode_t     mode,
                                                         _Out_ uint64_t           *counters)
+{
+    sai_status_t status, object_status;
+
+    status = mlnx_bulk_object_get_stats(SAI_OBJECT_TYPE_ROUTER_INTERFACE, 1, &router_interface_id,
+                                        number_of_counters, counter_ids, mode, &object_status, counters);
+    if (SAI_ERR(status)) {
+        return SAI_STATUS_FAILURE == status ? object_status : status;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get statistics counters of several router interfaces.
+ *
+ * Every RIF has its own SDK router counter, so the counters are still read per RIF,
+ * the DB lock is taken once for the whole sweep.
+ *
+ * @param[in] object_count Number of router interfaces
+ * @param[in] rif_ids Array of router interface ids
+ * @param[in] number_of_counters Number of counters per router interface
+ * @param[in] counter_ids Specifies the array of counter ids
+ * @param[in] mode Statistics mode
+ * @param[out] object_statuses Status of each router interface
+ * @param[out] counters Array of object_count * number_of_counters values, grouped by router interface
+ *
+ * @return #SAI_STATUS_SUCCESS when all router interfaces are read, #SAI_STATUS_FAILURE when some failed,
+ *         other failure status code on invalid parameters
+ */
+sai_status_t mlnx_get_router_interfaces_stats_bulk(_In_ uint32_t               object_count,
+                                                   _In_ const sai_object_id_t *rif_ids,
+                                                   _In_ uint32_t               number_of_counters,
+                                                   _In_ const sai_stat_id_t   *counter_ids,
+                                                   _In_ sai_stats_mode_t       mode,
+                                                   _Out_ sai_status_t         *object_statuses,
+                                                   _Out_ uint64_t             *counters)
 {
     sx_status_t             sx_status;
-    sai_status_t            status;
+    sai_status_t            status, bulk_status = SAI_STATUS_SUCCESS;
     sx_access_cmd_t         sx_cmd;
     sx_router_counter_set_t sx_counter_set;
     sx_router_counter_id_t  sx_counter;
     uint32_t                ii;
     char                    key_str[MAX_KEY_STR_LEN];
 
-    memset(&sx_counter_set, 0, sizeof(sx_counter_set));
-
     SX_LOG_ENTER();
 
-    rif_key_to_str(router_interface_id, key_str);
-    SX_LOG_DBG("Get rif stats %s\n", key_str);
-
-    if (NULL == counter_ids) {
-        SX_LOG_ERR("NULL counter ids array param\n");
-        SX_LOG_EXIT();
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-
-    if (NULL == counters) {
-        SX_LOG_ERR("NULL counters array param\n");
+    status = mlnx_stats_bulk_params_check(object_count, rif_ids, number_of_counters, counter_ids,
+                                          object_statuses, counters);
+    if (SAI_ERR(status)) {
         SX_LOG_EXIT();
-        return SAI_STATUS_INVALID_PARAMETER;
+        return status;
     }
 
     if (mode > SAI_STATS_MODE_READ_AND_CLEAR) {
@@ -1444,87 +1538,39 @@ static sai_status_t mlnx_get_router_interface_stats_ext(_In_ sai_object_id_t
 
     sai_db_read_lock();
 
-    status = mlnx_rif_oid_counter_get(router_interface_id, &sx_counter);
-    if (SAI_ERR(status)) {
-        sai_db_unlock();
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    sx_status = sx_api_router_counter_get(gh_sdk, sx_cmd, sx_counter, &sx_counter_set);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to %s sx counter %d - %s\n", SX_ACCESS_CMD_STR(sx_cmd), sx_counter,
-                   SX_STATUS_MSG(sx_status));
-        sai_db_unlock();
-        SX_LOG_EXIT();
-        return sdk_to_sai(sx_status);
-    }
-
-    sai_db_unlock();
+    for (ii = 0; ii < object_count; ii++) {
+        rif_key_to_str(rif_ids[ii], key_str);
+        SX_LOG_DBG("Get rif stats %s\n", key_str);
 
-    for (ii = 0; ii < number_of_counters; ii++) {
-        switch (counter_ids[ii]) {
-        case SAI_ROUTER_INTERFACE_STAT_IN_OCTETS:
-            counters[ii] = sx_counter_set.router_ingress_good_unicast_bytes +
-                           sx_counter_set.router_ingress_good_multicast_bytes +
-                           sx_counter_set.router_ingress_good_broadcast_bytes;
-            break;
-
-        case SAI_ROUTER_INTERFACE_STAT_IN_PACKETS:
-            counters[ii] = sx_counter_set.router_ingress_good_unicast_packets +
-                           sx_counter_set.router_ingress_good_multicast_packets +
-                           sx_counter_set.router_ingress_good_broadcast_packets;
-            break;
-
-        case SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS:
-            counters[ii] = sx_counter_set.router_egress_good_unicast_bytes +
-                           sx_counter_set.router_egress_good_multicast_bytes +
-                           sx_counter_set.router_egress_good_broadcast_bytes;
-            break;
-
-        case SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS:
-            counters[ii] = sx_counter_set.router_egress_good_unicast_packets +
-                           sx_counter_set.router_egress_good_multicast_packets +
-                           sx_counter_set.router_egress_good_broadcast_packets;
-            break;
-
-        case SAI_ROUTER_INTERFACE_STAT_IN_ERROR_OCTETS:
-            counters[ii] = sx_counter_set.router_ingress_bad_unicast_bytes +
-                           sx_counter_set.router_ingress_bad_multicast_bytes +
-                           sx_counter_set.router_ingress_error_bytes +
-                           sx_counter_set.router_ingress_discard_bytes;
-            break;
-
-        case SAI_ROUTER_INTERFACE_STAT_IN_ERROR_PACKETS:
-            counters[ii] = sx_counter_set.router_ingress_bad_unicast_packets +
-                           sx_counter_set.router_ingress_bad_multicast_packets +
-                           sx_counter_set.router_ingress_error_packets +
-                           sx_counter_set.router_ingress_discard_packets;
-            break;
+        status = mlnx_rif_oid_counter_get(rif_ids[ii], &sx_counter);
+        if (SAI_ERR(status)) {
+            object_statuses[ii] = status;
+            bulk_status         = SAI_STATUS_FAILURE;
+            continue;
+        }
 
-        case SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_OCTETS:
-            counters[ii] = sx_counter_set.router_egress_bad_unicast_bytes +
-                           sx_counter_set.router_egress_bad_multicast_bytes +
-                           sx_counter_set.router_egress_error_bytes +
-                           sx_counter_set.router_egress_discard_bytes;
-            break;
+        memset(&sx_counter_set, 0, sizeof(sx_counter_set));
 
-        case SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_PACKETS:
-            counters[ii] = sx_counter_set.router_egress_bad_unicast_packets +
-                           sx_counter_set.router_egress_bad_multicast_packets +
-                           sx_counter_set.router_egress_error_packets +
-                           sx_counter_set.router_egress_discard_packets;
-            break;
+        sx_status = sx_api_router_counter_get(gh_sdk, sx_cmd, sx_counter, &sx_counter_set);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to %s sx counter %d - %s\n", SX_ACCESS_CMD_STR(sx_cmd), sx_counter,
+                       SX_STATUS_MSG(sx_status));
+            object_statuses[ii] = sdk_to_sai(sx_status);
+            bulk_status         = SAI_STATUS_FAILURE;
+            continue;
+        }
 
-        default:
-            SX_LOG_ERR("Invalid sai_router_interface_stat_t - %d\n", counter_ids[ii]);
-            SX_LOG_EXIT();
-            return SAI_STATUS_INVALID_ATTRIBUTE_0 + ii;
+        object_statuses[ii] = mlnx_rif_stats_fill(number_of_counters, counter_ids, &sx_counter_set,
+                                                  &counters[(uint64_t)ii * number_of_counters]);
+        if (SAI_ERR(object_statuses[ii])) {
+            bulk_status = SAI_STATUS_FAILURE;
         }
     }
 
+    sai_db_unlock();
+
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return bulk_status;
 }
 
 /**
@@ -23,6 +23,24 @@
 #undef  __MODULE__
 #define __MODULE__ SAI_ROUTE
 
+/* Number of next hop oids resolved via sx_api_router_ecmp_get cached during a bulk operation */
+#define MLNX_ROUTE_NH_CACHE_SIZE (256)
+
+typedef struct _mlnx_route_nh_cache_entry_t {
+    bool            is_valid;
+    sai_object_id_t oid;
+    sx_next_hop_t   sx_next_hop;
+} mlnx_route_nh_cache_entry_t;
+
+typedef struct _mlnx_route_nh_cache_t {
+    mlnx_route_nh_cache_entry_t entries[MLNX_ROUTE_NH_CACHE_SIZE];
+} mlnx_route_nh_cache_t;
+
+#define MLNX_ROUTE_SHADOW_KEY_WORDS (4)
+#define MLNX_ROUTE_SHADOW_AF_IPV4   (0)
+#define MLNX_ROUTE_SHADOW_AF_IPV6   (1)
+#define MLNX_ROUTE_SHADOW_AF_COUNT  (2)
+
 static sx_verbosity_level_t LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNING;
 static sai_status_t mlnx_route_packet_action_get(_In_ const sai_object_key_t   *key,
                                                  _Inout_ sai_attribute_value_t *value,
@@ -114,15 +132,758 @@ static sai_status_t mlnx_translate_sai_route_entry_to_sdk(_In_ const sai_route_e
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * Software shadow of the programmed routes.
+ * A binary compressed radix trie per VRF and address family, keyed by the prefix bits in SDK (host) order.
+ * Nodes without a route are glue nodes and always have two children.
+ * The shadow is a cache - a miss falls back to the SDK, so it's safe to drop an entry on any failure.
+ * The tries are process local. Every change bumps route_shadow_generation in SAI DB under sai_shadow_db_lock(),
+ * so a process whose generation doesn't match drops its shadow before use.
+ * SDK is called without the lock. A writer takes the generation before the SDK call and only keeps its route
+ * in the shadow if the generation is the same afterwards, otherwise the route is dropped and read from SDK.
+ */
+
+/* Fields of sx_uc_route_data_t used by SAI, routes with more than one next hop are not kept */
+typedef struct _mlnx_route_shadow_data_t {
+    sx_router_action_t    action;
+    sx_uc_route_type_t    type;
+    sx_trap_priority_t    trap_prio;
+    uint32_t              next_hop_cnt;
+    sx_ecmp_id_t          ecmp_id;
+    sx_router_interface_t rif;
+    sx_ip_addr_t          next_hop;
+} mlnx_route_shadow_data_t;
+
+typedef struct _mlnx_route_shadow_node_t {
+    struct _mlnx_route_shadow_node_t *parent;
+    struct _mlnx_route_shadow_node_t *child[2];
+    uint32_t                          key[MLNX_ROUTE_SHADOW_KEY_WORDS];
+    uint32_t                          prefix_len;
+    bool                              has_route;
+    mlnx_route_shadow_data_t          route;
+} mlnx_route_shadow_node_t;
+
+typedef struct _mlnx_route_shadow_vrf_t {
+    mlnx_route_shadow_node_t *root[MLNX_ROUTE_SHADOW_AF_COUNT];
+    uint32_t                  route_count;
+    uint32_t                  node_count;
+} mlnx_route_shadow_vrf_t;
+
+static mlnx_route_shadow_vrf_t **mlnx_route_shadow_vrfs       = NULL;
+static uint32_t                  mlnx_route_shadow_vrfs_size  = 0;
+static uint64_t                  mlnx_route_shadow_generation = 0;
+
+static uint32_t mlnx_route_shadow_word_mask(_In_ uint32_t bits)
+{
+    return (bits == 0) ? 0 : (0xFFFFFFFF << (32 - bits));
+}
+
+static uint32_t mlnx_route_shadow_word_leading_ones(_In_ uint32_t word)
+{
+    uint32_t count = 0;
+
+    while ((count < 32) && (word & (0x80000000 >> count))) {
+        count++;
+    }
+
+    return count;
+}
+
+static uint32_t mlnx_route_shadow_bit(_In_ const uint32_t *key, _In_ uint32_t bit)
+{
+    return (key[bit / 32] >> (31 - bit % 32)) & 1;
+}
+
+static void mlnx_route_shadow_key_mask(_Inout_ uint32_t *key, _In_ uint32_t prefix_len)
+{
+    uint32_t ii, bits;
+
+    for (ii = 0; ii < MLNX_ROUTE_SHADOW_KEY_WORDS; ii++) {
+        bits     = (prefix_len > ii * 32) ? MIN(prefix_len - ii * 32, 32) : 0;
+        key[ii] &= mlnx_route_shadow_word_mask(bits);
+    }
+}
+
+/* Returns the number of leading bits (up to max_len) equal in both keys */
+static uint32_t mlnx_route_shadow_common_len(_In_ const uint32_t *key1,
+                                             _In_ const uint32_t *key2,
+                                             _In_ uint32_t        max_len)
+{
+    uint32_t ii, diff;
+
+    for (ii = 0; ii * 32 < max_len; ii++) {
+        diff = key1[ii] ^ key2[ii];
+        if (diff) {
+            return MIN(ii * 32 + mlnx_route_shadow_word_leading_ones(~diff), max_len);
+        }
+    }
+
+    return max_len;
+}
+
+/* Only prefixes with a contiguous mask are shadowed */
+static bool mlnx_route_shadow_key_get(_In_ const sx_ip_prefix_t *ip_prefix,
+                                      _Out_ uint32_t            *key,
+                                      _Out_ uint32_t            *prefix_len,
+                                      _Out_ uint32_t            *af)
+{
+    const uint32_t *addr, *mask;
+    uint32_t        words, ones, ii;
+    bool            partial = false;
+
+    memset(key, 0, sizeof(uint32_t) * MLNX_ROUTE_SHADOW_KEY_WORDS);
+    *prefix_len = 0;
+
+    if (SX_IP_VERSION_IPV4 == ip_prefix->version) {
+        addr  = &ip_prefix->prefix.ipv4.addr.s_addr;
+        mask  = &ip_prefix->prefix.ipv4.mask.s_addr;
+        words = 1;
+        *af   = MLNX_ROUTE_SHADOW_AF_IPV4;
+    } else if (SX_IP_VERSION_IPV6 == ip_prefix->version) {
+        addr  = (const uint32_t*)ip_prefix->prefix.ipv6.addr.s6_addr32;
+        mask  = (const uint32_t*)ip_prefix->prefix.ipv6.mask.s6_addr32;
+        words = MLNX_ROUTE_SHADOW_KEY_WORDS;
+        *af   = MLNX_ROUTE_SHADOW_AF_IPV6;
+    } else {
+        return false;
+    }
+
+    for (ii = 0; ii < words; ii++) {
+        if (partial && mask[ii]) {
+            return false;
+        }
+
+        ones = mlnx_route_shadow_word_leading_ones(mask[ii]);
+        if (mask[ii] != mlnx_route_shadow_word_mask(ones)) {
+            return false;
+        }
+
+        partial      = (ones < 32);
+        key[ii]      = addr[ii] & mask[ii];
+        *prefix_len += ones;
+    }
+
+    return true;
+}
+
+static bool mlnx_route_shadow_data_pack(_In_ const sx_uc_route_data_t  *route_data,
+                                        _Out_ mlnx_route_shadow_data_t *route)
+{
+    if (route_data->next_hop_cnt > 1) {
+        return false;
+    }
+
+    memset(route, 0, sizeof(*route));
+
+    route->action       = route_data->action;
+    route->type         = route_data->type;
+    route->trap_prio    = route_data->trap_attr.prio;
+    route->next_hop_cnt = route_data->next_hop_cnt;
+
+    if (SX_UC_ROUTE_TYPE_LOCAL == route_data->type) {
+        route->rif = route_data->uc_route_param.local_egress_rif;
+    } else {
+        route->ecmp_id = route_data->uc_route_param.ecmp_id;
+    }
+
+    if (route_data->next_hop_cnt) {
+        memcpy(&route->next_hop, &route_data->next_hop_list_p[0], sizeof(route->next_hop));
+    }
+
+    return true;
+}
+
+static void mlnx_route_shadow_data_unpack(_In_ const mlnx_route_shadow_data_t *route,
+                                          _Out_ sx_uc_route_data_t            *route_data)
+{
+    memset(route_data, 0, sizeof(*route_data));
+
+    route_data->action         = route->action;
+    route_data->type           = route->type;
+    route_data->trap_attr.prio = route->trap_prio;
+    route_data->next_hop_cnt   = route->next_hop_cnt;
+
+    if (SX_UC_ROUTE_TYPE_LOCAL == route->type) {
+        route_data->uc_route_param.local_egress_rif = route->rif;
+    } else {
+        route_data->uc_route_param.ecmp_id = route->ecmp_id;
+    }
+
+    if (route->next_hop_cnt) {
+        memcpy(&route_data->next_hop_list_p[0], &route->next_hop, sizeof(route->next_hop));
+    }
+}
+
+static void mlnx_route_shadow_key_to_prefix(_In_ const uint32_t  *key,
+                                            _In_ uint32_t         prefix_len,
+                                            _In_ uint32_t         af,
+                                            _Out_ sx_ip_prefix_t *ip_prefix)
+{
+    uint32_t *addr, *mask;
+    uint32_t  words, ii, bits;
+
+    memset(ip_prefix, 0, sizeof(*ip_prefix));
+
+    if (MLNX_ROUTE_SHADOW_AF_IPV4 == af) {
+        ip_prefix->version = SX_IP_VERSION_IPV4;
+        addr               = &ip_prefix->prefix.ipv4.addr.s_addr;
+        mask               = &ip_prefix->prefix.ipv4.mask.s_addr;
+        words              = 1;
+    } else {
+        ip_prefix->version = SX_IP_VERSION_IPV6;
+        addr               = (uint32_t*)ip_prefix->prefix.ipv6.addr.s6_addr32;
+        mask               = (uint32_t*)ip_prefix->prefix.ipv6.mask.s6_addr32;
+        words              = MLNX_ROUTE_SHADOW_KEY_WORDS;
+    }
+
+    for (ii = 0; ii < words; ii++) {
+        bits     = (prefix_len > ii * 32) ? MIN(prefix_len - ii * 32, 32) : 0;
+        mask[ii] = mlnx_route_shadow_word_mask(bits);
+        addr[ii] = key[ii];
+    }
+}
+
+static mlnx_route_shadow_vrf_t* mlnx_route_shadow_vrf_get(_In_ sx_router_id_t vrid, _In_ bool create)
+{
+    mlnx_route_shadow_vrf_t **vrfs;
+    uint32_t                  new_size;
+
+    if (vrid < mlnx_route_shadow_vrfs_size) {
+        if (mlnx_route_shadow_vrfs[vrid] || !create) {
+            return mlnx_route_shadow_vrfs[vrid];
+        }
+    } else {
+        if (!create) {
+            return NULL;
+        }
+
+        new_size = vrid + 1;
+        vrfs     = realloc(mlnx_route_shadow_vrfs, new_size * sizeof(*vrfs));
+        if (!vrfs) {
+            return NULL;
+        }
+
+        memset(&vrfs[mlnx_route_shadow_vrfs_size], 0, (new_size - mlnx_route_shadow_vrfs_size) * sizeof(*vrfs));
+        mlnx_route_shadow_vrfs      = vrfs;
+        mlnx_route_shadow_vrfs_size = new_size;
+    }
+
+    mlnx_route_shadow_vrfs[vrid] = calloc(1, sizeof(mlnx_route_shadow_vrf_t));
+
+    return mlnx_route_shadow_vrfs[vrid];
+}
+
+static mlnx_route_shadow_node_t* mlnx_route_shadow_node_alloc(_Inout_ mlnx_route_shadow_vrf_t *vrf,
+                                                              _In_ const uint32_t             *key,
+                                                              _In_ uint32_t                    prefix_len)
+{
+    mlnx_route_shadow_node_t *node;
+
+    node = calloc(1, sizeof(*node));
+    if (!node) {
+        return NULL;
+    }
+
+    memcpy(node->key, key, sizeof(node->key));
+    mlnx_route_shadow_key_mask(node->key, prefix_len);
+    node->prefix_len = prefix_len;
+    vrf->node_count++;
+
+    return node;
+}
+
+static mlnx_route_shadow_node_t** mlnx_route_shadow_node_link(_In_ mlnx_route_shadow_vrf_t  *vrf,
+                                                              _In_ uint32_t                  af,
+                                                              _In_ mlnx_route_shadow_node_t *node)
+{
+    if (!node->parent) {
+        return &vrf->root[af];
+    }
+
+    return &node->parent->child[node->parent->child[1] == node];
+}
+
+/* Removes the nodes on the way up which carry no route and don't split the trie anymore */
+static void mlnx_route_shadow_node_prune(_Inout_ mlnx_route_shadow_vrf_t *vrf,
+                                         _In_ uint32_t                    af,
+                                         _In_ mlnx_route_shadow_node_t   *node)
+{
+    mlnx_route_shadow_node_t *child, *parent;
+
+    while (node && !node->has_route && !(node->child[0] && node->child[1])) {
+        child  = node->child[0] ? node->child[0] : node->child[1];
+        parent = node->parent;
+
+        *mlnx_route_shadow_node_link(vrf, af, node) = child;
+        if (child) {
+            child->parent = parent;
+        }
+
+        free(node);
+        vrf->node_count--;
+
+        if (child) {
+            break;
+        }
+
+        node = parent;
+    }
+}
+
+static mlnx_route_shadow_node_t* mlnx_route_shadow_node_find(_In_ const mlnx_route_shadow_vrf_t *vrf,
+                                                             _In_ uint32_t                       af,
+                                                             _In_ const uint32_t                *key,
+                                                             _In_ uint32_t                       prefix_len)
+{
+    mlnx_route_shadow_node_t *node = vrf->root[af];
+
+    while (node && (node->prefix_len <= prefix_len)) {
+        if (mlnx_route_shadow_common_len(key, node->key, node->prefix_len) < node->prefix_len) {
+            return NULL;
+        }
+
+        if (node->prefix_len == prefix_len) {
+            return node->has_route ? node : NULL;
+        }
+
+        node = node->child[mlnx_route_shadow_bit(key, node->prefix_len)];
+    }
+
+    return NULL;
+}
+
+static mlnx_route_shadow_node_t* mlnx_route_shadow_node_insert(_Inout_ mlnx_route_shadow_vrf_t *vrf,
+                                                               _In_ uint32_t                    af,
+                                                               _In_ const uint32_t             *key,
+                                                               _In_ uint32_t                    prefix_len)
+{
+    mlnx_route_shadow_node_t **link   = &vrf->root[af];
+    mlnx_route_shadow_node_t  *parent = NULL, *node, *new_node, *glue;
+    uint32_t                   common, bit;
+
+    for (node = *link; node; node = *link) {
+        common = mlnx_route_shadow_common_len(key, node->key, MIN(prefix_len, node->prefix_len));
+
+        if (common < node->prefix_len) {
+            new_node = mlnx_route_shadow_node_alloc(vrf, key, prefix_len);
+            if (!new_node) {
+                return NULL;
+            }
+
+            /* New prefix covers the node - insert it above */
+            if (common == prefix_len) {
+                new_node->parent = parent;
+                new_node->child[mlnx_route_shadow_bit(node->key, prefix_len)] = node;
+                node->parent = new_node;
+                *link        = new_node;
+                return new_node;
+            }
+
+            /* Prefixes diverge - add a glue node at the split point */
+            glue = mlnx_route_shadow_node_alloc(vrf, key, common);
+            if (!glue) {
+                free(new_node);
+                vrf->node_count--;
+                return NULL;
+            }
+
+            bit                = mlnx_route_shadow_bit(key, common);
+            glue->parent       = parent;
+            glue->child[bit]   = new_node;
+            glue->child[!bit]  = node;
+            new_node->parent   = glue;
+            node->parent       = glue;
+            *link              = glue;
+            return new_node;
+        }
+
+        if (prefix_len == node->prefix_len) {
+            return node;
+        }
+
+        parent = node;
+        link   = &node->child[mlnx_route_shadow_bit(key, node->prefix_len)];
+    }
+
+    new_node = mlnx_route_shadow_node_alloc(vrf, key, prefix_len);
+    if (!new_node) {
+        return NULL;
+    }
+
+    new_node->parent = parent;
+    *link            = new_node;
+    return new_node;
+}
+
+static void mlnx_route_shadow_tree_free(_Inout_ mlnx_route_shadow_node_t *node)
+{
+    if (!node) {
+        return;
+    }
+
+    mlnx_route_shadow_tree_free(node->child[0]);
+    mlnx_route_shadow_tree_free(node->child[1]);
+    free(node);
+}
+
+/* route_data is a scratch buffer, it's big so it's not kept on the stack of every level */
+static void mlnx_route_shadow_tree_foreach(_In_ sx_router_id_t                  vrid,
+                                           _In_ uint32_t                        af,
+                                           _In_ const mlnx_route_shadow_node_t *node,
+                                           _In_ mlnx_route_shadow_iter_cb_t     cb,
+                                           _In_ void                           *arg,
+                                           _Inout_ sx_uc_route_data_t          *route_data)
+{
+    sx_ip_prefix_t ip_prefix;
+
+    if (!node) {
+        return;
+    }
+
+    if (node->has_route) {
+        mlnx_route_shadow_key_to_prefix(node->key, node->prefix_len, af, &ip_prefix);
+        mlnx_route_shadow_data_unpack(&node->route, route_data);
+        cb(vrid, &ip_prefix, route_data, arg);
+    }
+
+    mlnx_route_shadow_tree_foreach(vrid, af, node->child[0], cb, arg, route_data);
+    mlnx_route_shadow_tree_foreach(vrid, af, node->child[1], cb, arg, route_data);
+}
+
+static void mlnx_route_shadow_remove(_In_ sx_router_id_t vrid, _In_ const sx_ip_prefix_t *ip_prefix)
+{
+    mlnx_route_shadow_vrf_t  *vrf;
+    mlnx_route_shadow_node_t *node;
+    uint32_t                  key[MLNX_ROUTE_SHADOW_KEY_WORDS];
+    uint32_t                  prefix_len, af;
+
+    if (!mlnx_route_shadow_key_get(ip_prefix, key, &prefix_len, &af)) {
+        return;
+    }
+
+    vrf = mlnx_route_shadow_vrf_get(vrid, false);
+    if (vrf) {
+        node = mlnx_route_shadow_node_find(vrf, af, key, prefix_len);
+        if (node) {
+            node->has_route = false;
+            vrf->route_count--;
+            mlnx_route_shadow_node_prune(vrf, af, node);
+        }
+    }
+}
+
+static void mlnx_route_shadow_set(_In_ sx_router_id_t            vrid,
+                                  _In_ const sx_ip_prefix_t     *ip_prefix,
+                                  _In_ const sx_uc_route_data_t *route_data)
+{
+    mlnx_route_shadow_vrf_t  *vrf;
+    mlnx_route_shadow_node_t *node = NULL;
+    mlnx_route_shadow_data_t  route;
+    uint32_t                  key[MLNX_ROUTE_SHADOW_KEY_WORDS];
+    uint32_t                  prefix_len, af;
+
+    if (!mlnx_route_shadow_key_get(ip_prefix, key, &prefix_len, &af)) {
+        return;
+    }
+
+    /* Don't leave a stale entry, the route will be read from SDK */
+    if (!mlnx_route_shadow_data_pack(route_data, &route)) {
+        mlnx_route_shadow_remove(vrid, ip_prefix);
+        return;
+    }
+
+    vrf = mlnx_route_shadow_vrf_get(vrid, true);
+    if (vrf) {
+        node = mlnx_route_shadow_node_insert(vrf, af, key, prefix_len);
+    }
+
+    if (!node) {
+        SX_LOG_ERR("Failed to allocate memory for route shadow, vrid %u\n", vrid);
+        mlnx_route_shadow_remove(vrid, ip_prefix);
+        return;
+    }
+
+    if (!node->has_route) {
+        node->has_route = true;
+        vrf->route_count++;
+    }
+
+    memcpy(&node->route, &route, sizeof(node->route));
+}
+
+static bool mlnx_route_shadow_get(_In_ sx_router_id_t         vrid,
+                                  _In_ const sx_ip_prefix_t  *ip_prefix,
+                                  _Out_ sx_uc_route_data_t   *route_data)
+{
+    mlnx_route_shadow_vrf_t  *vrf;
+    mlnx_route_shadow_node_t *node = NULL;
+    uint32_t                  key[MLNX_ROUTE_SHADOW_KEY_WORDS];
+    uint32_t                  prefix_len, af;
+
+    if (!mlnx_route_shadow_key_get(ip_prefix, key, &prefix_len, &af)) {
+        return false;
+    }
+
+    vrf = mlnx_route_shadow_vrf_get(vrid, false);
+    if (vrf) {
+        node = mlnx_route_shadow_node_find(vrf, af, key, prefix_len);
+        if (node && route_data) {
+            mlnx_route_shadow_data_unpack(&node->route, route_data);
+        }
+    }
+
+    return (node != NULL);
+}
+
+static void mlnx_route_shadow_vrf_flush_impl(_In_ sx_router_id_t vrid)
+{
+    mlnx_route_shadow_vrf_t *vrf;
+    uint32_t                 af;
+
+    vrf = mlnx_route_shadow_vrf_get(vrid, false);
+    if (!vrf) {
+        return;
+    }
+
+    for (af = 0; af < MLNX_ROUTE_SHADOW_AF_COUNT; af++) {
+        mlnx_route_shadow_tree_free(vrf->root[af]);
+    }
+
+    free(vrf);
+    mlnx_route_shadow_vrfs[vrid] = NULL;
+}
+
+/* Called under sai_shadow_db_lock(), drops the shadow if another process changed routes since it was filled */
+static void mlnx_route_shadow_sync(void)
+{
+    uint32_t vrid;
+
+    if (mlnx_route_shadow_generation == g_sai_db_ptr->route_shadow_generation) {
+        return;
+    }
+
+    for (vrid = 0; vrid < mlnx_route_shadow_vrfs_size; vrid++) {
+        mlnx_route_shadow_vrf_flush_impl((sx_router_id_t)vrid);
+    }
+
+    mlnx_route_shadow_generation = g_sai_db_ptr->route_shadow_generation;
+}
+
+/* Called under sai_shadow_db_lock() after routes are changed in SDK and in the shadow of this process */
+static void mlnx_route_shadow_changed(void)
+{
+    mlnx_route_shadow_generation = ++g_sai_db_ptr->route_shadow_generation;
+}
+
+/* Called under sai_shadow_db_lock() before SDK is accessed, the result is passed to commit/fill after the SDK call */
+static uint64_t mlnx_route_shadow_begin(void)
+{
+    mlnx_route_shadow_sync();
+
+    return g_sai_db_ptr->route_shadow_generation;
+}
+
+/* Called after the route is set in SDK, route_data is NULL if the route is removed or its state is unknown */
+static void mlnx_route_shadow_commit(_In_ sx_router_id_t                vrid,
+                                     _In_ const sx_ip_prefix_t         *ip_prefix,
+                                     _In_opt_ const sx_uc_route_data_t *route_data,
+                                     _In_ uint64_t                      generation)
+{
+    sai_shadow_db_lock();
+    mlnx_route_shadow_sync();
+
+    /* Routes were changed during the SDK call and the order against this one is unknown */
+    if (route_data && (generation == g_sai_db_ptr->route_shadow_generation)) {
+        mlnx_route_shadow_set(vrid, ip_prefix, route_data);
+    } else {
+        mlnx_route_shadow_remove(vrid, ip_prefix);
+    }
+
+    mlnx_route_shadow_changed();
+    sai_shadow_db_unlock();
+}
+
+/* Called after the route is read from SDK, it's kept only if no route was changed since the read */
+static void mlnx_route_shadow_fill(_In_ sx_router_id_t            vrid,
+                                   _In_ const sx_ip_prefix_t     *ip_prefix,
+                                   _In_ const sx_uc_route_data_t *route_data,
+                                   _In_ uint64_t                  generation)
+{
+    sai_shadow_db_lock();
+    mlnx_route_shadow_sync();
+
+    if (generation == g_sai_db_ptr->route_shadow_generation) {
+        mlnx_route_shadow_set(vrid, ip_prefix, route_data);
+    }
+
+    sai_shadow_db_unlock();
+}
+
+bool mlnx_route_shadow_exists(_In_ sx_router_id_t vrid, _In_ const sx_ip_prefix_t *ip_prefix)
+{
+    bool exists;
+
+    sai_shadow_db_lock();
+    mlnx_route_shadow_sync();
+    exists = mlnx_route_shadow_get(vrid, ip_prefix, NULL);
+    sai_shadow_db_unlock();
+
+    return exists;
+}
+
+/* cb is called with the shadow locked and must not modify routes */
+void mlnx_route_shadow_foreach(_In_ mlnx_route_shadow_iter_cb_t cb, _In_ void *arg)
+{
+    sx_uc_route_data_t route_data;
+    uint32_t           vrid, af;
+
+    assert(cb);
+
+    sai_shadow_db_lock();
+    mlnx_route_shadow_sync();
+
+    for (vrid = 0; vrid < mlnx_route_shadow_vrfs_size; vrid++) {
+        if (!mlnx_route_shadow_vrfs[vrid]) {
+            continue;
+        }
+
+        for (af = 0; af < MLNX_ROUTE_SHADOW_AF_COUNT; af++) {
+            mlnx_route_shadow_tree_foreach((sx_router_id_t)vrid, af, mlnx_route_shadow_vrfs[vrid]->root[af], cb, arg,
+                                           &route_data);
+        }
+    }
+
+    sai_shadow_db_unlock();
+}
+
+static void mlnx_route_shadow_vrf_stats_add(_In_ const mlnx_route_shadow_vrf_t *vrf,
+                                            _Inout_ mlnx_route_shadow_stats_t  *stats)
+{
+    stats->vrf_count++;
+    stats->route_count += vrf->route_count;
+    stats->node_count  += vrf->node_count;
+    stats->mem_bytes   += sizeof(*vrf) + (uint64_t)vrf->node_count * sizeof(mlnx_route_shadow_node_t);
+}
+
+void mlnx_route_shadow_stats_get(_In_ sx_router_id_t vrid, _Out_ mlnx_route_shadow_stats_t *stats)
+{
+    mlnx_route_shadow_vrf_t *vrf;
+
+    assert(stats);
+
+    memset(stats, 0, sizeof(*stats));
+
+    sai_shadow_db_lock();
+    mlnx_route_shadow_sync();
+
+    vrf = mlnx_route_shadow_vrf_get(vrid, false);
+    if (vrf) {
+        mlnx_route_shadow_vrf_stats_add(vrf, stats);
+    }
+
+    sai_shadow_db_unlock();
+}
+
+void mlnx_route_shadow_total_stats_get(_Out_ mlnx_route_shadow_stats_t *stats)
+{
+    uint32_t vrid;
+
+    assert(stats);
+
+    memset(stats, 0, sizeof(*stats));
+
+    sai_shadow_db_lock();
+    mlnx_route_shadow_sync();
+
+    for (vrid = 0; vrid < mlnx_route_shadow_vrfs_size; vrid++) {
+        if (mlnx_route_shadow_vrfs[vrid]) {
+            mlnx_route_shadow_vrf_stats_add(mlnx_route_shadow_vrfs[vrid], stats);
+        }
+    }
+
+    stats->mem_bytes += (uint64_t)mlnx_route_shadow_vrfs_size * sizeof(*mlnx_route_shadow_vrfs);
+
+    sai_shadow_db_unlock();
+}
+
+/* Called after the VRF is removed in SDK together with its routes */
+void mlnx_route_shadow_vrf_flush(_In_ sx_router_id_t vrid)
+{
+    sai_shadow_db_lock();
+    mlnx_route_shadow_sync();
+    mlnx_route_shadow_vrf_flush_impl(vrid);
+    mlnx_route_shadow_changed();
+    sai_shadow_db_unlock();
+}
+
+/* Must be called before SAI DB is unloaded */
+void mlnx_route_shadow_deinit(void)
+{
+    uint32_t vrid;
+
+    sai_shadow_db_lock();
+
+    for (vrid = 0; vrid < mlnx_route_shadow_vrfs_size; vrid++) {
+        mlnx_route_shadow_vrf_flush_impl((sx_router_id_t)vrid);
+    }
+
+    free(mlnx_route_shadow_vrfs);
+    mlnx_route_shadow_vrfs      = NULL;
+    mlnx_route_shadow_vrfs_size = 0;
+
+    sai_shadow_db_unlock();
+}
+
+static sai_status_t mlnx_route_next_hop_get(_In_ sai_object_id_t            oid,
+                                            _In_ sx_ecmp_id_t               sdk_ecmp_id,
+                                            _In_ uint32_t                   next_hop_param_index,
+                                            _Inout_opt_ mlnx_route_nh_cache_t *nh_cache,
+                                            _Out_ sx_next_hop_t            *sdk_next_hop)
+{
+    sx_status_t                  status;
+    mlnx_route_nh_cache_entry_t *cache_entry = NULL;
+    uint32_t                     sdk_next_hop_cnt;
+
+    if (nh_cache) {
+        cache_entry = &nh_cache->entries[sdk_ecmp_id % MLNX_ROUTE_NH_CACHE_SIZE];
+        if (cache_entry->is_valid && (cache_entry->oid == oid)) {
+            memcpy(sdk_next_hop, &cache_entry->sx_next_hop, sizeof(*sdk_next_hop));
+            return SAI_STATUS_SUCCESS;
+        }
+    }
+
+    /* ECMP container should contains exactly 1 next hop */
+    sdk_next_hop_cnt = 1;
+    memset(sdk_next_hop, 0, sizeof(*sdk_next_hop));
+    if (SX_STATUS_SUCCESS !=
+        (status = sx_api_router_ecmp_get(gh_sdk, sdk_ecmp_id, sdk_next_hop, &sdk_next_hop_cnt))) {
+        SX_LOG_ERR("Failed to get ecmp - %s.\n", SX_STATUS_MSG(status));
+        return sdk_to_sai(status);
+    }
+    if (1 != sdk_next_hop_cnt) {
+        SX_LOG_ERR("Invalid next hop object\n");
+        return SAI_STATUS_INVALID_ATTR_VALUE_0 + next_hop_param_index;
+    }
+
+    if (cache_entry) {
+        cache_entry->is_valid = true;
+        cache_entry->oid      = oid;
+        memcpy(&cache_entry->sx_next_hop, sdk_next_hop, sizeof(cache_entry->sx_next_hop));
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 static sai_status_t mlnx_fill_route_data(sx_uc_route_data_t      *route_data,
                                          sai_object_id_t          oid,
                                          uint32_t                 next_hop_param_index,
-                                         const sai_route_entry_t* route_entry)
+                                         const sai_route_entry_t* route_entry,
+                                         mlnx_route_nh_cache_t   *nh_cache)
 {
     sai_status_t  status;
     sx_ecmp_id_t  sdk_ecmp_id;
     sx_next_hop_t sdk_next_hop;
-    uint32_t      sdk_next_hop_cnt;
+    uint32_t      sdk_next_hop_cnt = 1;
     uint32_t      port_data;
 
     SX_LOG_ENTER();
@@ -132,18 +893,11 @@ static sai_status_t mlnx_fill_route_data(sx_uc_route_data_t      *route_data,
             return status;
         }
 
-        /* ECMP container should contains exactly 1 next hop */
-        sdk_next_hop_cnt = 1;
-        memset(&sdk_next_hop, 0, sizeof(sdk_next_hop));
-        if (SX_STATUS_SUCCESS !=
-            (status = sx_api_router_ecmp_get(gh_sdk, sdk_ecmp_id, &sdk_next_hop, &sdk_next_hop_cnt))) {
-            SX_LOG_ERR("Failed to get ecmp - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
-        }
-        if (1 != sdk_next_hop_cnt) {
-            SX_LOG_ERR("Invalid next hop object\n");
-            return SAI_STATUS_INVALID_ATTR_VALUE_0 + next_hop_param_index;
+        status = mlnx_route_next_hop_get(oid, sdk_ecmp_id, next_hop_param_index, nh_cache, &sdk_next_hop);
+        if (SAI_ERR(status)) {
+            return status;
         }
+
         route_data->type = SX_UC_ROUTE_TYPE_NEXT_HOP;
         if (SX_NEXT_HOP_TYPE_TUNNEL_ENCAP == sdk_next_hop.next_hop_key.type) {
             route_data->next_hop_cnt           = 0;
@@ -172,6 +926,11 @@ static sai_status_t mlnx_fill_route_data(sx_uc_route_data_t      *route_data,
             return status;
         }
 
+        status = mlnx_next_hop_group_shadow_flush(sdk_ecmp_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
         route_data->type                   = SX_UC_ROUTE_TYPE_NEXT_HOP;
         route_data->next_hop_cnt           = 0;
         route_data->uc_route_param.ecmp_id = sdk_ecmp_id;
@@ -209,12 +968,13 @@ static sai_status_t mlnx_fill_route_data(sx_uc_route_data_t      *route_data,
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_route_attr_to_sx_data(_In_ const sai_route_entry_t *route_entry,
-                                               _In_ uint32_t                 attr_count,
-                                               _In_ const sai_attribute_t   *attr_list,
-                                               _Out_ sx_ip_prefix_t         *sx_ip_prefix,
-                                               _Out_ sx_router_id_t         *sx_vrid,
-                                               _Out_ sx_uc_route_data_t     *sx_route_data)
+static sai_status_t mlnx_route_attr_to_sx_data(_In_ const sai_route_entry_t     *route_entry,
+                                               _In_ uint32_t                     attr_count,
+                                               _In_ const sai_attribute_t       *attr_list,
+                                               _Inout_opt_ mlnx_route_nh_cache_t *nh_cache,
+                                               _Out_ sx_ip_prefix_t             *sx_ip_prefix,
+                                               _Out_ sx_router_id_t             *sx_vrid,
+                                               _Out_ sx_uc_route_data_t         *sx_route_data)
 {
     sai_status_t                 status;
     const sai_attribute_value_t *action, *next_hop;
@@ -277,7 +1037,7 @@ static sai_status_t mlnx_route_attr_to_sx_data(_In_ const sai_route_entry_t *rou
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    status = mlnx_fill_route_data(sx_route_data, next_hop_oid, next_hop_index, route_entry);
+    status = mlnx_fill_route_data(sx_route_data, next_hop_oid, next_hop_index, route_entry, nh_cache);
     if (SAI_ERR(status)) {
         return status;
     }
@@ -290,6 +1050,51 @@ static sai_status_t mlnx_route_attr_to_sx_data(_In_ const sai_route_entry_t *rou
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_route_sx_add(_In_ sx_router_id_t            vrid,
+                                      _In_ const sx_ip_prefix_t     *ip_prefix,
+                                      _In_ const sx_uc_route_data_t *route_data)
+{
+    sx_status_t sx_status;
+    uint64_t    generation;
+    bool        exists;
+
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    exists     = mlnx_route_shadow_get(vrid, ip_prefix, NULL);
+    sai_shadow_db_unlock();
+
+    if (exists) {
+        SX_LOG_ERR("Route already exists, vrid %u\n", vrid);
+        return SAI_STATUS_ITEM_ALREADY_EXISTS;
+    }
+
+    sx_status = sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_ADD, vrid, (sx_ip_prefix_t*)ip_prefix,
+                                           (sx_uc_route_data_t*)route_data);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to set route - %s.\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    mlnx_route_shadow_commit(vrid, ip_prefix, route_data, generation);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_route_sx_remove(_In_ sx_router_id_t vrid, _In_ const sx_ip_prefix_t *ip_prefix)
+{
+    sx_status_t sx_status;
+
+    sx_status = sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_DELETE, vrid, (sx_ip_prefix_t*)ip_prefix, NULL);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to remove route - %s.\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    mlnx_route_shadow_commit(vrid, ip_prefix, NULL, 0);
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /*
  * Routine Description:
  *    Create Route
@@ -311,7 +1116,6 @@ static sai_status_t mlnx_create_route(_In_ const sai_route_entry_t* route_entry,
                                       _In_ const sai_attribute_t   *attr_list)
 {
     sai_status_t       status;
-    sx_status_t        sx_status;
     sx_ip_prefix_t     ip_prefix;
     sx_router_id_t     vrid = DEFAULT_VRID;
     sx_uc_route_data_t route_data;
@@ -321,21 +1125,16 @@ static sai_status_t mlnx_create_route(_In_ const sai_route_entry_t* route_entry,
     memset(&ip_prefix, 0, sizeof(ip_prefix));
     memset(&route_data, 0, sizeof(route_data));
 
-    status = mlnx_route_attr_to_sx_data(route_entry, attr_count, attr_list, &ip_prefix, &vrid, &route_data);
+    status = mlnx_route_attr_to_sx_data(route_entry, attr_count, attr_list, NULL, &ip_prefix, &vrid, &route_data);
     if (SAI_ERR(status)) {
         SX_LOG_EXIT();
         return status;
     }
 
-    sx_status = sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_ADD, vrid, &ip_prefix, &route_data);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to set route - %s.\n", SX_STATUS_MSG(sx_status));
-        SX_LOG_EXIT();
-        return sdk_to_sai(sx_status);
-    }
+    status = mlnx_route_sx_add(vrid, &ip_prefix, &route_data);
 
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 /*
@@ -375,15 +1174,10 @@ static sai_status_t mlnx_remove_route(_In_ const sai_route_entry_t* route_entry)
         return status;
     }
 
-    if (SX_STATUS_SUCCESS !=
-        (status =
-             sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_DELETE, vrid, &ip_prefix, NULL))) {
-        SX_LOG_ERR("Failed to remove route - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
-    }
+    status = mlnx_route_sx_remove(vrid, &ip_prefix);
 
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 /*
@@ -456,6 +1250,8 @@ static sai_status_t mlnx_get_route(const sai_route_entry_t* route_entry,
     uint32_t                 entries_count = 1;
     sx_ip_prefix_t           ip_prefix;
     sx_uc_route_key_filter_t filter;
+    uint64_t                 generation;
+    bool                     found;
 
     SX_LOG_ENTER();
 
@@ -467,6 +1263,17 @@ static sai_status_t mlnx_get_route(const sai_route_entry_t* route_entry,
         return status;
     }
 
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    found      = mlnx_route_shadow_get(*vrid, &ip_prefix, &route_get_entry->route_data);
+    sai_shadow_db_unlock();
+
+    if (found) {
+        memcpy(&route_get_entry->network_addr, &ip_prefix, sizeof(route_get_entry->network_addr));
+        SX_LOG_EXIT();
+        return SAI_STATUS_SUCCESS;
+    }
+
     if (SX_STATUS_SUCCESS !=
         (status =
              sx_api_router_uc_route_get(gh_sdk, SX_ACCESS_CMD_GET, *vrid, &ip_prefix, &filter,
@@ -475,6 +1282,9 @@ static sai_status_t mlnx_get_route(const sai_route_entry_t* route_entry,
         return sdk_to_sai(status);
     }
 
+    /* Route was changed by another process or is not from this instance (e.g. warm boot) - keep it in shadow */
+    mlnx_route_shadow_fill(*vrid, &ip_prefix, &route_get_entry->route_data, generation);
+
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -579,6 +1389,11 @@ static sai_status_t mlnx_modify_route(sx_router_id_t           vrid,
                                       sx_access_cmd_t          cmd)
 {
     sx_status_t status;
+    uint64_t    generation;
+
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    sai_shadow_db_unlock();
 
     /* Delete and Add for action/priority, or Set for next hops changes */
     if (SX_ACCESS_CMD_ADD == cmd) {
@@ -593,10 +1408,14 @@ static sai_status_t mlnx_modify_route(sx_router_id_t           vrid,
     if (SX_STATUS_SUCCESS !=
         (status = sx_api_router_uc_route_set(gh_sdk, cmd, vrid,
                                              &route_get_entry->network_addr, &route_get_entry->route_data))) {
+        /* After delete + failed add the route is not in HW anymore, the shadow is re-synced on the next read */
+        mlnx_route_shadow_commit(vrid, &route_get_entry->network_addr, NULL, generation);
         SX_LOG_ERR("Failed to set route - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
+    mlnx_route_shadow_commit(vrid, &route_get_entry->network_addr, &route_get_entry->route_data, generation);
+
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -673,7 +1492,7 @@ static sai_status_t mlnx_route_next_hop_id_set(_In_ const sai_object_key_t
     mlnx_fdb_route_action_fetch(SAI_OBJECT_TYPE_ROUTE_ENTRY, route_entry, &route_get_entry.route_data.action);
 
     if (SAI_STATUS_SUCCESS != (status = mlnx_fill_route_data(&route_get_entry.route_data, value->oid, 0,
-                                                             route_entry))) {
+                                                             route_entry, NULL))) {
         return status;
     }
 
@@ -692,6 +1511,92 @@ sai_status_t mlnx_route_log_set(sx_verbosity_level_t level)
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * SDK has no call to program several routes at once, so each route is set with its own
+ * sx_api_router_uc_route_set call, in order, as for a sequential create.
+ * Next hops resolved via nh_cache are shared by the whole bulk.
+ */
+static sai_status_t mlnx_route_bulk_create(_In_ uint32_t                 object_count,
+                                           _In_ const sai_route_entry_t *route_entry,
+                                           _In_ const uint32_t          *attr_count,
+                                           _In_ const sai_attribute_t  **attr_list,
+                                           _In_ bool                     stop_on_error,
+                                           _Out_ sai_status_t           *object_statuses,
+                                           _Out_ bool                   *failure)
+{
+    mlnx_route_nh_cache_t *nh_cache = NULL;
+    sx_uc_route_data_t     route_data;
+    sx_ip_prefix_t         ip_prefix;
+    sx_router_id_t         vrid;
+    uint32_t               ii;
+
+    assert(failure);
+
+    nh_cache = calloc(1, sizeof(*nh_cache));
+    if (!nh_cache) {
+        SX_LOG_ERR("Failed to allocate memory for bulk route create\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        memset(&route_data, 0, sizeof(route_data));
+        memset(&ip_prefix, 0, sizeof(ip_prefix));
+        vrid = DEFAULT_VRID;
+
+        object_statuses[ii] = mlnx_route_attr_to_sx_data(&route_entry[ii], attr_count[ii], attr_list[ii], nh_cache,
+                                                         &ip_prefix, &vrid, &route_data);
+        if (!SAI_ERR(object_statuses[ii])) {
+            object_statuses[ii] = mlnx_route_sx_add(vrid, &ip_prefix, &route_data);
+        }
+
+        if (SAI_ERR(object_statuses[ii])) {
+            *failure = true;
+            if (stop_on_error) {
+                break;
+            }
+        }
+    }
+
+    free(nh_cache);
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_route_bulk_remove(_In_ uint32_t                 object_count,
+                                           _In_ const sai_route_entry_t *route_entry,
+                                           _In_ bool                     stop_on_error,
+                                           _Out_ sai_status_t           *object_statuses,
+                                           _Out_ bool                   *failure)
+{
+    char           key_str[MAX_KEY_STR_LEN];
+    sx_ip_prefix_t ip_prefix;
+    sx_router_id_t vrid;
+    uint32_t       ii;
+
+    assert(failure);
+
+    for (ii = 0; ii < object_count; ii++) {
+        route_key_to_str(&route_entry[ii], key_str);
+        SX_LOG_NTC("Remove route %s\n", key_str);
+
+        memset(&ip_prefix, 0, sizeof(ip_prefix));
+        vrid = DEFAULT_VRID;
+
+        object_statuses[ii] = mlnx_translate_sai_route_entry_to_sdk(&route_entry[ii], &ip_prefix, &vrid);
+        if (!SAI_ERR(object_statuses[ii])) {
+            object_statuses[ii] = mlnx_route_sx_remove(vrid, &ip_prefix);
+        }
+
+        if (SAI_ERR(object_statuses[ii])) {
+            *failure = true;
+            if (stop_on_error) {
+                break;
+            }
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 static sai_status_t mlnx_route_bulk_api_impl(_In_ sai_common_api_t         api,
                                              _In_ uint32_t                 object_count,
                                              _In_ const sai_route_entry_t *route_entry,
@@ -728,12 +1633,27 @@ static sai_status_t mlnx_route_bulk_api_impl(_In_ sai_common_api_t         api,
         }
     }
 
+    if (api == SAI_COMMON_API_BULK_CREATE) {
+        status = mlnx_route_bulk_create(object_count, route_entry, attr_count, attr_list_for_create, stop_on_error,
+                                        object_statuses, &failure);
+        if (SAI_ERR(status)) {
+            SX_LOG_EXIT();
+            return status;
+        }
+        goto out;
+    }
+
+    if (api == SAI_COMMON_API_BULK_REMOVE) {
+        status = mlnx_route_bulk_remove(object_count, route_entry, stop_on_error, object_statuses, &failure);
+        if (SAI_ERR(status)) {
+            SX_LOG_EXIT();
+            return status;
+        }
+        goto out;
+    }
+
     for (ii = 0; ii < object_count; ii++) {
         switch (api) {
-        case SAI_COMMON_API_BULK_CREATE:
-            object_statuses[ii] = mlnx_create_route(&route_entry[ii], attr_count[ii], attr_list_for_create[ii]);
-            break;
-
         case SAI_COMMON_API_BULK_GET:
             object_statuses[ii] = mlnx_get_route_attribute(&route_entry[ii], attr_count[ii], attr_list_for_get[ii]);
             break;
@@ -742,10 +1662,6 @@ static sai_status_t mlnx_route_bulk_api_impl(_In_ sai_common_api_t         api,
             object_statuses[ii] = mlnx_set_route_attribute(&route_entry[ii], &attr_list_for_set[ii]);
             break;
 
-        case SAI_COMMON_API_BULK_REMOVE:
-            object_statuses[ii] = mlnx_remove_route(&route_entry[ii]);
-            break;
-
         default:
             assert(false);
         }
@@ -0,0 +1,394 @@
+/*
+ *  Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+/*
+ * Unit test of the route shadow. The trie is checked against a plain list of routes,
+ * the generation checks are run with another process emulated by bumping the generation in SAI DB.
+ * The shadow is internal to mlnx_sai_route.c, so the file is included here.
+ */
+
+#include "mlnx_sai_route.c"
+
+#define ASSERT_TRUE(x, fmt, ...)                            \
+    if (!(x)) {                                             \
+        fprintf(stderr,                                     \
+                "ASSERT TRUE FAILED(%s:%d): %s: " fmt "\n", \
+                __func__, __LINE__, #x, ## __VA_ARGS__);    \
+        exit(1); }
+
+#define TEST_ROUTES_MAX  (512)
+#define TEST_VRF_COUNT   (4)
+#define TEST_ITERATIONS  (20000)
+#define TEST_ECMP_ID_MAX (1000)
+
+typedef struct _test_route_t {
+    bool           valid;
+    sx_router_id_t vrid;
+    sx_ip_prefix_t ip_prefix;
+    sx_ecmp_id_t   ecmp_id;
+} test_route_t;
+
+static test_route_t test_routes[TEST_ROUTES_MAX];
+static uint32_t     test_foreach_count;
+
+static void test_sai_db_init(void)
+{
+    g_sai_db_ptr = calloc(1, sizeof(*g_sai_db_ptr));
+    ASSERT_TRUE(g_sai_db_ptr, "");
+    ASSERT_TRUE(CL_SUCCESS == cl_plock_init_pshared(&g_sai_db_ptr->shadow_lock), "");
+}
+
+static void test_route_data_set(_Out_ sx_uc_route_data_t *route_data, _In_ sx_ecmp_id_t ecmp_id)
+{
+    memset(route_data, 0, sizeof(*route_data));
+
+    route_data->action                 = SX_ROUTER_ACTION_FORWARD;
+    route_data->type                   = SX_UC_ROUTE_TYPE_NEXT_HOP;
+    route_data->trap_attr.prio         = SX_TRAP_PRIORITY_MED;
+    route_data->uc_route_param.ecmp_id = ecmp_id;
+}
+
+static void test_prefix_set(_Out_ sx_ip_prefix_t *ip_prefix, _In_ uint32_t af, _In_ uint32_t prefix_len)
+{
+    uint32_t key[MLNX_ROUTE_SHADOW_KEY_WORDS];
+    uint32_t ii;
+
+    /* few distinct bits, so prefixes share their beginning and the trie gets glue nodes */
+    for (ii = 0; ii < MLNX_ROUTE_SHADOW_KEY_WORDS; ii++) {
+        key[ii] = ((uint32_t)(rand() & 0x3) << 30) | ((uint32_t)(rand() & 0x3) << 20) | (rand() & 0x3);
+    }
+
+    mlnx_route_shadow_key_mask(key, prefix_len);
+    mlnx_route_shadow_key_to_prefix(key, prefix_len, af, ip_prefix);
+}
+
+static bool test_prefix_equal(_In_ const sx_ip_prefix_t *prefix1, _In_ const sx_ip_prefix_t *prefix2)
+{
+    if (prefix1->version != prefix2->version) {
+        return false;
+    }
+
+    if (SX_IP_VERSION_IPV4 == prefix1->version) {
+        return !memcmp(&prefix1->prefix.ipv4, &prefix2->prefix.ipv4, sizeof(prefix1->prefix.ipv4));
+    }
+
+    return !memcmp(&prefix1->prefix.ipv6, &prefix2->prefix.ipv6, sizeof(prefix1->prefix.ipv6));
+}
+
+static test_route_t* test_route_find(_In_ sx_router_id_t vrid, _In_ const sx_ip_prefix_t *ip_prefix)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < TEST_ROUTES_MAX; ii++) {
+        if (test_routes[ii].valid && (test_routes[ii].vrid == vrid) &&
+            test_prefix_equal(&test_routes[ii].ip_prefix, ip_prefix)) {
+            return &test_routes[ii];
+        }
+    }
+
+    return NULL;
+}
+
+/* Returns the number of nodes under node and checks the trie layout */
+static uint32_t test_trie_check(_In_ const mlnx_route_shadow_node_t *node, _Inout_ uint32_t *route_count)
+{
+    const mlnx_route_shadow_node_t *child;
+    uint32_t                        key[MLNX_ROUTE_SHADOW_KEY_WORDS];
+    uint32_t                        count = 1, ii;
+
+    if (!node) {
+        return 0;
+    }
+
+    memcpy(key, node->key, sizeof(key));
+    mlnx_route_shadow_key_mask(key, node->prefix_len);
+    ASSERT_TRUE(!memcmp(key, node->key, sizeof(key)), "bits after prefix len %u", node->prefix_len);
+    ASSERT_TRUE(node->has_route || (node->child[0] && node->child[1]), "glue node with one child");
+
+    for (ii = 0; ii < 2; ii++) {
+        child = node->child[ii];
+        if (!child) {
+            continue;
+        }
+
+        ASSERT_TRUE(child->parent == node, "");
+        ASSERT_TRUE(child->prefix_len > node->prefix_len, "");
+        ASSERT_TRUE(mlnx_route_shadow_common_len(child->key, node->key, node->prefix_len) == node->prefix_len, "");
+        ASSERT_TRUE(mlnx_route_shadow_bit(child->key, node->prefix_len) == ii, "");
+
+        count += test_trie_check(child, route_count);
+    }
+
+    *route_count += node->has_route;
+
+    return count;
+}
+
+static void test_shadow_check(void)
+{
+    mlnx_route_shadow_vrf_t *vrf;
+    sx_uc_route_data_t       route_data;
+    uint32_t                 vrid, af, node_count, route_count, ii;
+
+    for (vrid = 0; vrid < mlnx_route_shadow_vrfs_size; vrid++) {
+        vrf = mlnx_route_shadow_vrfs[vrid];
+        if (!vrf) {
+            continue;
+        }
+
+        node_count  = 0;
+        route_count = 0;
+        for (af = 0; af < MLNX_ROUTE_SHADOW_AF_COUNT; af++) {
+            ASSERT_TRUE(!vrf->root[af] || !vrf->root[af]->parent, "");
+            node_count += test_trie_check(vrf->root[af], &route_count);
+        }
+
+        ASSERT_TRUE(node_count == vrf->node_count, "vrid %u nodes %u counted %u", vrid, vrf->node_count, node_count);
+        ASSERT_TRUE(route_count == vrf->route_count, "vrid %u routes %u counted %u", vrid, vrf->route_count,
+                    route_count);
+    }
+
+    for (ii = 0; ii < TEST_ROUTES_MAX; ii++) {
+        if (!test_routes[ii].valid) {
+            continue;
+        }
+
+        ASSERT_TRUE(mlnx_route_shadow_get(test_routes[ii].vrid, &test_routes[ii].ip_prefix, &route_data),
+                    "route %u", ii);
+        ASSERT_TRUE(route_data.uc_route_param.ecmp_id == test_routes[ii].ecmp_id, "route %u", ii);
+    }
+}
+
+static void test_foreach_cb(_In_ sx_router_id_t            vrid,
+                            _In_ const sx_ip_prefix_t     *ip_prefix,
+                            _In_ const sx_uc_route_data_t *route_data,
+                            _In_ void                     *arg)
+{
+    test_route_t *route = test_route_find(vrid, ip_prefix);
+
+    ASSERT_TRUE(route, "vrid %u", vrid);
+    ASSERT_TRUE(route->ecmp_id == route_data->uc_route_param.ecmp_id, "vrid %u", vrid);
+    ASSERT_TRUE(SX_ROUTER_ACTION_FORWARD == route_data->action, "");
+    ASSERT_TRUE(SX_UC_ROUTE_TYPE_NEXT_HOP == route_data->type, "");
+
+    test_foreach_count++;
+}
+
+static void test_route_shadow_trie(void)
+{
+    mlnx_route_shadow_stats_t stats;
+    sx_uc_route_data_t        route_data;
+    sx_ip_prefix_t            ip_prefix;
+    sx_router_id_t            vrid;
+    test_route_t             *route;
+    uint32_t                  iter, af, route_count, ii;
+
+    srand(1);
+    memset(test_routes, 0, sizeof(test_routes));
+
+    for (iter = 0; iter < TEST_ITERATIONS; iter++) {
+        vrid = rand() % TEST_VRF_COUNT;
+        af   = rand() % MLNX_ROUTE_SHADOW_AF_COUNT;
+        test_prefix_set(&ip_prefix, af, rand() % ((MLNX_ROUTE_SHADOW_AF_IPV4 == af) ? 33 : 129));
+        route = test_route_find(vrid, &ip_prefix);
+
+        switch (rand() % 3) {
+        case 0:
+            mlnx_route_shadow_remove(vrid, &ip_prefix);
+            if (route) {
+                route->valid = false;
+            }
+            break;
+
+        case 1:
+            if (!route) {
+                for (ii = 0; ii < TEST_ROUTES_MAX && test_routes[ii].valid; ii++) {
+                }
+                if (ii == TEST_ROUTES_MAX) {
+                    break;
+                }
+                route            = &test_routes[ii];
+                route->valid     = true;
+                route->vrid      = vrid;
+                route->ip_prefix = ip_prefix;
+            }
+            route->ecmp_id = rand() % TEST_ECMP_ID_MAX;
+            test_route_data_set(&route_data, route->ecmp_id);
+            mlnx_route_shadow_set(vrid, &ip_prefix, &route_data);
+            break;
+
+        default:
+            ASSERT_TRUE(mlnx_route_shadow_get(vrid, &ip_prefix, NULL) == (route != NULL), "iteration %u", iter);
+            break;
+        }
+
+        if (iter % 100 == 0) {
+            test_shadow_check();
+        }
+    }
+
+    test_shadow_check();
+
+    route_count = 0;
+    for (ii = 0; ii < TEST_ROUTES_MAX; ii++) {
+        route_count += test_routes[ii].valid;
+    }
+
+    test_foreach_count = 0;
+    mlnx_route_shadow_foreach(test_foreach_cb, NULL);
+    ASSERT_TRUE(test_foreach_count == route_count, "%u routes, %u visited", route_count, test_foreach_count);
+
+    mlnx_route_shadow_total_stats_get(&stats);
+    ASSERT_TRUE(stats.route_count == route_count, "%u routes, stats %u", route_count, stats.route_count);
+
+    for (ii = 0; ii < TEST_ROUTES_MAX; ii++) {
+        if (test_routes[ii].valid) {
+            mlnx_route_shadow_remove(test_routes[ii].vrid, &test_routes[ii].ip_prefix);
+            test_routes[ii].valid = false;
+        }
+    }
+
+    /* glue nodes are removed together with the last route under them */
+    mlnx_route_shadow_total_stats_get(&stats);
+    ASSERT_TRUE(stats.route_count == 0, "%u routes left", stats.route_count);
+    ASSERT_TRUE(stats.node_count == 0, "%u nodes left", stats.node_count);
+}
+
+/* Only the routes the shadow can describe in full are kept */
+static void test_route_shadow_not_kept(void)
+{
+    sx_uc_route_data_t route_data;
+    sx_ip_prefix_t     ip_prefix;
+
+    memset(&ip_prefix, 0, sizeof(ip_prefix));
+    ip_prefix.version                 = SX_IP_VERSION_IPV4;
+    ip_prefix.prefix.ipv4.addr.s_addr = 0x0A000000;
+    ip_prefix.prefix.ipv4.mask.s_addr = 0xFF00FF00;
+    test_route_data_set(&route_data, 1);
+    mlnx_route_shadow_set(0, &ip_prefix, &route_data);
+    ASSERT_TRUE(!mlnx_route_shadow_get(0, &ip_prefix, NULL), "non contiguous mask");
+
+    ip_prefix.prefix.ipv4.mask.s_addr = 0xFF000000;
+    mlnx_route_shadow_set(0, &ip_prefix, &route_data);
+    ASSERT_TRUE(mlnx_route_shadow_get(0, &ip_prefix, NULL), "");
+
+    route_data.next_hop_cnt = 2;
+    mlnx_route_shadow_set(0, &ip_prefix, &route_data);
+    ASSERT_TRUE(!mlnx_route_shadow_get(0, &ip_prefix, NULL), "route with several next hops");
+
+    route_data.next_hop_cnt                        = 1;
+    route_data.next_hop_list_p[0].version          = SX_IP_VERSION_IPV4;
+    route_data.next_hop_list_p[0].addr.ipv4.s_addr = 0x0B000001;
+    mlnx_route_shadow_set(0, &ip_prefix, &route_data);
+    memset(&route_data, 0, sizeof(route_data));
+    ASSERT_TRUE(mlnx_route_shadow_get(0, &ip_prefix, &route_data), "");
+    ASSERT_TRUE(route_data.next_hop_cnt == 1, "");
+    ASSERT_TRUE(route_data.next_hop_list_p[0].addr.ipv4.s_addr == 0x0B000001, "");
+
+    mlnx_route_shadow_vrf_flush(0);
+}
+
+static void test_route_shadow_generation(void)
+{
+    mlnx_route_shadow_stats_t stats;
+    sx_uc_route_data_t        route_data;
+    sx_ip_prefix_t            ip_prefix;
+    uint64_t                  generation;
+
+    memset(&ip_prefix, 0, sizeof(ip_prefix));
+    ip_prefix.version                 = SX_IP_VERSION_IPV4;
+    ip_prefix.prefix.ipv4.addr.s_addr = 0x0A010000;
+    ip_prefix.prefix.ipv4.mask.s_addr = 0xFFFF0000;
+    test_route_data_set(&route_data, 5);
+
+    /* create */
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    sai_shadow_db_unlock();
+    mlnx_route_shadow_commit(1, &ip_prefix, &route_data, generation);
+    ASSERT_TRUE(mlnx_route_shadow_exists(1, &ip_prefix), "");
+    ASSERT_TRUE(g_sai_db_ptr->route_shadow_generation == generation + 1, "commit doesn't bump the generation");
+
+    /* another process changed routes, the shadow is dropped */
+    g_sai_db_ptr->route_shadow_generation++;
+    ASSERT_TRUE(!mlnx_route_shadow_exists(1, &ip_prefix), "");
+
+    /* read from SDK, another process changed routes during the read */
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    sai_shadow_db_unlock();
+    g_sai_db_ptr->route_shadow_generation++;
+    mlnx_route_shadow_fill(1, &ip_prefix, &route_data, generation);
+    ASSERT_TRUE(!mlnx_route_shadow_exists(1, &ip_prefix), "");
+
+    /* read from SDK */
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    sai_shadow_db_unlock();
+    mlnx_route_shadow_fill(1, &ip_prefix, &route_data, generation);
+    ASSERT_TRUE(mlnx_route_shadow_exists(1, &ip_prefix), "");
+    ASSERT_TRUE(g_sai_db_ptr->route_shadow_generation == generation, "fill bumps the generation");
+
+    /* set, another process changed routes during the SDK call */
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    sai_shadow_db_unlock();
+    g_sai_db_ptr->route_shadow_generation++;
+    mlnx_route_shadow_commit(1, &ip_prefix, &route_data, generation);
+    ASSERT_TRUE(!mlnx_route_shadow_exists(1, &ip_prefix), "");
+
+    /* remove */
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    sai_shadow_db_unlock();
+    mlnx_route_shadow_fill(1, &ip_prefix, &route_data, generation);
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    sai_shadow_db_unlock();
+    mlnx_route_shadow_commit(1, &ip_prefix, NULL, generation);
+    ASSERT_TRUE(!mlnx_route_shadow_exists(1, &ip_prefix), "");
+
+    /* VRF removal */
+    sai_shadow_db_lock();
+    generation = mlnx_route_shadow_begin();
+    sai_shadow_db_unlock();
+    mlnx_route_shadow_commit(1, &ip_prefix, &route_data, generation);
+    mlnx_route_shadow_stats_get(1, &stats);
+    ASSERT_TRUE(stats.route_count == 1, "");
+    mlnx_route_shadow_vrf_flush(1);
+    mlnx_route_shadow_stats_get(1, &stats);
+    ASSERT_TRUE(stats.vrf_count == 0, "");
+    ASSERT_TRUE(!mlnx_route_shadow_exists(1, &ip_prefix), "");
+}
+
+int main(void)
+{
+    test_sai_db_init();
+
+    test_route_shadow_trie();
+    test_route_shadow_not_kept();
+    test_route_shadow_generation();
+
+    mlnx_route_shadow_deinit();
+    cl_plock_destroy(&g_sai_db_ptr->shadow_lock);
+    free(g_sai_db_ptr);
+    g_sai_db_ptr = NULL;
+
+    printf("mlnx_sai_route_test: passed\n");
+
+    return 0;
+}
@@ -288,6 +288,8 @@ static sai_status_t mlnx_remove_virtual_router(_In_ sai_object_id_t vr_id)
         return sdk_to_sai(status);
     }
 
+    mlnx_route_shadow_vrf_flush(vrid);
+
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -450,6 +450,7 @@ static sai_status_t mlnx_stp_ports_get(_In_ const sai_object_key_t   *key,
     uint32_t              idx;
     uint32_t              ii = 0;
     uint16_t              vid;
+    uint32_t              stp_ports_map[MLNX_U32BITARRAY_SIZE(MAX_BRIDGE_1Q_PORTS)] = {0};
 
     SX_LOG_ENTER();
 
@@ -472,9 +473,15 @@ static sai_status_t mlnx_stp_ports_get(_In_ const sai_object_key_t   *key,
 
     sai_db_read_lock();
 
-    mlnx_stp_vlans_foreach(sx_stp_id, vid) {
-        mlnx_vlan_ports_foreach(vid, port, idx) {
-            ports_count++;
+    /* A port belongs to the STP if any of its VLANs is bound to it, walk the port's own VLANs
+     * so the cost follows the actual membership */
+    mlnx_bridge_1q_port_foreach(port, idx) {
+        mlnx_port_vlans_foreach(port, vid) {
+            if (mlnx_vlan_stp_id_get(vid) == sx_stp_id) {
+                array_bit_set(stp_ports_map, idx);
+                ports_count++;
+                break;
+            }
         }
     }
 
@@ -490,36 +497,21 @@ static sai_status_t mlnx_stp_ports_get(_In_ const sai_object_key_t   *key,
         goto out;
     }
 
-    mlnx_stp_vlans_foreach(sx_stp_id, vid) {
-        mlnx_vlan_ports_foreach(vid, port, idx) {
-            bool             is_stp_port_exist = false;
-            mlnx_object_id_t port_stp_oid;
-            sai_object_id_t  oid;
-            uint32_t         jj;
-
-            memset(&port_stp_oid, 0, sizeof(port_stp_oid));
-
-            port_stp_oid.id.log_port_id = port->logical;
-            port_stp_oid.ext.stp.id     = sx_stp_id;
+    for (idx = array_bit_next(stp_ports_map, MAX_BRIDGE_1Q_PORTS, 0);
+         idx < MAX_BRIDGE_1Q_PORTS;
+         idx = array_bit_next(stp_ports_map, MAX_BRIDGE_1Q_PORTS, idx + 1)) {
+        mlnx_object_id_t port_stp_oid;
 
-            status = mlnx_object_id_to_sai(SAI_OBJECT_TYPE_STP_PORT, &port_stp_oid, &oid);
-            if (SAI_ERR(status)) {
-                goto out;
-            }
+        memset(&port_stp_oid, 0, sizeof(port_stp_oid));
 
-            /* In case same port is in few VLANs it will appear in the list few times,
-             * so let's filter it out */
-            for (jj = 0; jj < ii; jj++) {
-                if (ports_list[jj] == oid) {
-                    is_stp_port_exist = true;
-                    break;
-                }
-            }
+        port_stp_oid.id.log_port_id = g_sai_db_ptr->bridge_ports_db[idx].logical;
+        port_stp_oid.ext.stp.id     = sx_stp_id;
 
-            if (!is_stp_port_exist) {
-                ports_list[ii++] = oid;
-            }
+        status = mlnx_object_id_to_sai(SAI_OBJECT_TYPE_STP_PORT, &port_stp_oid, &ports_list[ii]);
+        if (SAI_ERR(status)) {
+            goto out;
         }
+        ii++;
     }
 
     ports_count = ii;
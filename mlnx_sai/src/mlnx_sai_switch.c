@@ -27,6 +27,9 @@
 #include <libxml/tree.h>
 #include <sys/mman.h>
 #include <pthread.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <time.h>
 #endif
 #include <complib/cl_mem.h>
 #include <complib/cl_passivelock.h>
@@ -61,7 +64,7 @@ typedef struct _sai_switch_notification_t {
 static sx_verbosity_level_t LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNING;
 sx_api_handle_t                  gh_sdk = 0;
 static sai_switch_notification_t g_notification_callbacks;
-static sai_switch_profile_id_t   g_profile_id;
+sai_switch_profile_id_t          g_profile_id;
 rm_resources_t                   g_resource_limits;
 sai_db_t                        *g_sai_db_ptr              = NULL;
 sai_qos_db_t                    *g_sai_qos_db_ptr          = NULL;
@@ -81,6 +84,89 @@ static uint32_t                  g_neighbor_table_size, g_ipv4_neighbor_table_si
 static bool                      g_uninit_data_plane_on_removal = true;
 static uint32_t                  g_mlnx_shm_rm_size             = 0;
 
+#define MLNX_EVENT_QUEUE_PORT_SIZE   (64)
+#define MLNX_EVENT_QUEUE_FDB_SIZE    (64)
+#define MLNX_EVENT_QUEUE_PACKET_SIZE (256)
+#define MLNX_EVENT_RX_BURST_MAX      (64)
+
+#define SAI_KEY_FDB_EVENT_BATCH_SIZE       "SAI_FDB_EVENT_BATCH_SIZE"
+#define SAI_KEY_FDB_EVENT_BATCH_WINDOW_MS  "SAI_FDB_EVENT_BATCH_WINDOW_MS"
+#define MLNX_FDB_EVENT_BATCH_SIZE_DEFAULT  (1024)
+#define MLNX_FDB_EVENT_BATCH_SIZE_MAX      (64 * 1024)
+#define MLNX_FDB_EVENT_BATCH_WINDOW_MS_MAX (10 * 1000)
+#define MLNX_FDB_EVENT_BATCH_IDX_NONE      (UINT32_MAX)
+
+typedef struct _mlnx_event_slot_t {
+    uint8_t          *buf;
+    uint32_t          size;
+    sx_receive_info_t receive_info;
+    uint64_t          enqueue_us;
+} mlnx_event_slot_t;
+typedef struct _mlnx_event_queue_t {
+    pthread_mutex_t            lock;
+    pthread_cond_t             not_empty;
+    pthread_cond_t             not_full;
+    mlnx_event_slot_t         *slots;
+    uint32_t                   size;
+    uint32_t                   head;
+    uint32_t                   count;
+    bool                       drop_on_full;
+    bool                       stop;
+    mlnx_event_channel_stats_t stats;
+} mlnx_event_queue_t;
+/* Latest not yet delivered event of a (MAC, bv_id) in the FDB batch */
+typedef struct _mlnx_fdb_event_batch_key_t {
+    sai_mac_t       mac;
+    sai_object_id_t bv_id;
+    uint32_t        event_idx; /* MLNX_FDB_EVENT_BATCH_IDX_NONE if the key has nothing pending */
+    uint32_t        gen; /* slot is free if not equal to the batch key_gen */
+} mlnx_fdb_event_batch_key_t;
+/*
+ * FDB events are accumulated across SDK events and delivered in one on_fdb_event call.
+ * Buffers hold batch_size + SX_FDB_NOTIFY_SIZE_MAX events, so a whole SDK event always fits.
+ */
+typedef struct _mlnx_fdb_event_batch_t {
+    sai_fdb_event_notification_data_t *events;
+    sai_attribute_t                   *attrs;
+    bool                              *cancelled;
+    mlnx_fdb_event_batch_key_t        *keys;
+    uint32_t                           keys_size;
+    uint32_t                           key_gen;
+    uint32_t                           count;
+    uint32_t                           cancelled_count;
+    uint32_t                           batch_size;
+    uint64_t                           window_us;
+} mlnx_fdb_event_batch_t;
+struct _mlnx_event_worker_ctx_t;
+typedef void (*mlnx_event_handler_fn)(_In_ struct _mlnx_event_worker_ctx_t *ctx,
+                                      _In_ const mlnx_event_slot_t         *slot);
+typedef void (*mlnx_event_flush_fn)(_In_ struct _mlnx_event_worker_ctx_t *ctx);
+typedef struct _mlnx_event_worker_ctx_t {
+    cl_thread_t            thread;
+    bool                   is_started;
+    mlnx_event_queue_t    *queue;
+    mlnx_event_handler_fn  handler;
+    mlnx_event_flush_fn    flush; /* optional, called when flush_deadline_us passes and the queue is empty */
+    uint64_t               flush_deadline_us; /* 0 if nothing to flush */
+    mlnx_fdb_event_batch_t fdb_batch;
+} mlnx_event_worker_ctx_t;
+typedef struct _mlnx_event_dispatcher_t {
+    sai_object_id_t         switch_id;
+    volatile sx_status_t    worker_status;
+    mlnx_event_queue_t      queues[MLNX_EVENT_CHANNEL_COUNT];
+    mlnx_event_worker_ctx_t workers[MLNX_EVENT_CHANNEL_COUNT];
+} mlnx_event_dispatcher_t;
+
+#define MLNX_EVENT_QUEUE_INITIALIZER \
+    {.lock = PTHREAD_MUTEX_INITIALIZER, .not_empty = PTHREAD_COND_INITIALIZER, .not_full = PTHREAD_COND_INITIALIZER}
+static mlnx_event_dispatcher_t g_event_dispatcher = {
+    .queues = {
+        [MLNX_EVENT_CHANNEL_PORT]   = MLNX_EVENT_QUEUE_INITIALIZER,
+        [MLNX_EVENT_CHANNEL_FDB]    = MLNX_EVENT_QUEUE_INITIALIZER,
+        [MLNX_EVENT_CHANNEL_PACKET] = MLNX_EVENT_QUEUE_INITIALIZER,
+    }
+};
+
 void log_cb(sx_log_severity_t severity, const char *module_name, char *msg);
 void log_pause_cb(void);
 #ifdef CONFIG_SYSLOG
@@ -1783,6 +1869,7 @@ static sai_status_t mlnx_sai_db_initialize(const char *config_file, sx_chip_type
         return status;
     }
     sai_tunnel_db_init();
+    mlnx_tunnel_map_entry_db_init();
 
     status = mlnx_sai_rm_db_init();
     if (SAI_ERR(status)) {
@@ -2604,12 +2691,15 @@ static void sai_db_values_init()
     g_sai_db_ptr->ports_configured = 0;
     g_sai_db_ptr->ports_number     = 0;
     memset(g_sai_db_ptr->ports_db, 0, sizeof(g_sai_db_ptr->ports_db));
+    memset(g_sai_db_ptr->ports_log_map, 0, sizeof(g_sai_db_ptr->ports_log_map));
+    memset(g_sai_db_ptr->bridge_ports_log_map, 0, sizeof(g_sai_db_ptr->bridge_ports_log_map));
     memset(g_sai_db_ptr->hostif_db, 0, sizeof(g_sai_db_ptr->hostif_db));
     g_sai_db_ptr->default_trap_group = SAI_NULL_OBJECT_ID;
     g_sai_db_ptr->default_vrid       = SAI_NULL_OBJECT_ID;
     memset(&g_sai_db_ptr->callback_channel, 0, sizeof(g_sai_db_ptr->callback_channel));
     memset(g_sai_db_ptr->traps_db, 0, sizeof(g_sai_db_ptr->traps_db));
     memset(g_sai_db_ptr->qos_maps_db, 0, sizeof(g_sai_db_ptr->qos_maps_db));
+    g_sai_db_ptr->route_shadow_generation = 0;
     g_sai_db_ptr->qos_maps_db[MLNX_QOS_MAP_PFC_PG_INDEX].is_used    = 1;
     g_sai_db_ptr->qos_maps_db[MLNX_QOS_MAP_PFC_QUEUE_INDEX].is_used = 1;
     g_sai_db_ptr->switch_default_tc                                 = 0;
@@ -2675,6 +2765,7 @@ static sai_status_t sai_db_unload(boolean_t erase_db)
     if (erase_db == TRUE) {
         cl_shm_destroy(SAI_PATH);
         if (g_sai_db_ptr != NULL) {
+            cl_plock_destroy(&g_sai_db_ptr->shadow_lock);
             cl_plock_destroy(&g_sai_db_ptr->p_lock);
         }
     }
@@ -2709,11 +2800,35 @@ sai_status_t mlnx_shm_rm_bridge_size_get(_Out_ size_t *size)
 static mlnx_shm_rm_array_init_info_t mlnx_shm_array_info[MLNX_SHM_RM_ARRAY_TYPE_SIZE] = {
     [MLNX_SHM_RM_ARRAY_TYPE_RIF] = {sizeof(mlnx_rif_db_t),
                                     mlnx_shm_rm_rif_size_get,
-                                    0},
+                                    0,
+                                    true},
     [MLNX_SHM_RM_ARRAY_TYPE_BRIDGE] = {sizeof(mlnx_bridge_t),
                                        mlnx_shm_rm_bridge_size_get,
-                                       0}
+                                       0,
+                                       false},
+    [MLNX_SHM_RM_ARRAY_TYPE_NHG_SHADOW] = {sizeof(mlnx_nhg_shadow_t),
+                                           NULL,
+                                           MLNX_NHG_SHADOW_SIZE,
+                                           true},
+    [MLNX_SHM_RM_ARRAY_TYPE_NEIGH_SHADOW] = {sizeof(mlnx_neigh_shadow_t),
+                                             NULL,
+                                             MLNX_NEIGH_SHADOW_SIZE,
+                                             true}
 };
+static size_t mlnx_sai_rm_key_bucket_count_get(_In_ const mlnx_shm_rm_array_init_info_t *init_info)
+{
+    size_t count = 1;
+
+    if (!init_info->key_index) {
+        return 0;
+    }
+
+    while (count < init_info->elem_count) {
+        count <<= 1;
+    }
+
+    return count;
+}
 static size_t mlnx_sai_rm_db_size_get(void)
 {
     sai_status_t                   status;
@@ -2740,6 +2855,7 @@ static size_t mlnx_sai_rm_db_size_get(void)
         }
 
         total_size += init_info->elem_count * init_info->elem_size;
+        total_size += mlnx_sai_rm_key_bucket_count_get(init_info) * sizeof(uint32_t);
     }
 
     return total_size;
@@ -2794,6 +2910,19 @@ static sai_status_t sai_db_create()
         return SAI_STATUS_NO_MEMORY;
     }
 
+    cl_err = cl_plock_init_pshared(&g_sai_db_ptr->shadow_lock);
+    if (cl_err) {
+        MLNX_SAI_LOG_ERR("Failed to initialize the SAI shadow DB rwlock\n");
+        cl_plock_destroy(&g_sai_db_ptr->p_lock);
+        err = munmap(g_sai_db_ptr, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size);
+        if (err == -1) {
+            MLNX_SAI_LOG_ERR("Failed to unmap the shared memory of the SAI DB\n");
+        }
+        g_sai_db_ptr = NULL;
+        cl_shm_destroy(SAI_PATH);
+        return SAI_STATUS_NO_MEMORY;
+    }
+
     return SAI_STATUS_SUCCESS;
 }
 
@@ -2812,11 +2941,26 @@ static void* mlnx_rm_array_elem_by_idx(_In_ const mlnx_shm_rm_array_info_t *info
     return mlnx_rm_offset_to_ptf(info->offset_to_head) + (info->elem_size * idx);
 }
 
-static void mlnx_sai_rm_array_canary_init(mlnx_shm_rm_array_type_t type)
+static uint32_t* mlnx_rm_array_key_buckets(_In_ const mlnx_shm_rm_array_info_t *info)
 {
-    const mlnx_shm_rm_array_info_t *info;
-    mlnx_shm_array_hdr_t           *array_hdr;
-    uint32_t                        ii;
+    return (uint32_t*)mlnx_rm_offset_to_ptf(info->offset_to_key_buckets);
+}
+
+static uint32_t mlnx_rm_array_key_bucket(_In_ const mlnx_shm_rm_array_info_t *info, _In_ uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+
+    return (uint32_t)(key & (info->key_bucket_count - 1));
+}
+
+static void mlnx_sai_rm_array_hdr_init(mlnx_shm_rm_array_type_t type)
+{
+    mlnx_shm_rm_array_info_t *info;
+    mlnx_shm_array_hdr_t     *array_hdr;
+    uint32_t                 *buckets;
+    uint32_t                  ii;
 
     assert(MLNX_SHM_RM_ARRAY_TYPE_IS_VALID(type));
 
@@ -2826,7 +2970,16 @@ static void mlnx_sai_rm_array_canary_init(mlnx_shm_rm_array_type_t type)
         array_hdr = mlnx_rm_array_elem_by_idx(info, ii);
         assert(array_hdr);
 
-        array_hdr->canary = MLNX_SHM_RM_ARRAY_CANARY(type);
+        array_hdr->canary    = MLNX_SHM_RM_ARRAY_CANARY(type);
+        array_hdr->free_next = (ii + 1 < info->elem_count) ? ii + 1 : MLNX_SHM_RM_ARRAY_LINK_NONE;
+        array_hdr->key_next  = MLNX_SHM_RM_ARRAY_LINK_NONE;
+    }
+
+    info->free_head = (info->elem_count > 0) ? 0 : MLNX_SHM_RM_ARRAY_LINK_NONE;
+
+    buckets = mlnx_rm_array_key_buckets(info);
+    for (ii = 0; ii < info->key_bucket_count; ii++) {
+        buckets[ii] = MLNX_SHM_RM_ARRAY_LINK_NONE;
     }
 }
 
@@ -2846,28 +2999,44 @@ static sai_status_t mlnx_sai_rm_db_init(void)
         info->elem_size      = init_info->elem_size;
         info->offset_to_head = shm_rm_ptr - shm_rm_base_ptr;
         shm_rm_ptr          += info->elem_size * info->elem_count;
+    }
+
+    /* Key buckets go after all the arrays to keep the elements aligned */
+    for (type = MLNX_SHM_RM_ARRAY_TYPE_MIN; type <= MLNX_SHM_RM_ARRAY_TYPE_MAX; type++) {
+        init_info                   = &mlnx_shm_array_info[type];
+        info                        = &g_sai_db_ptr->array_info[type];
+        info->key_bucket_count      = mlnx_sai_rm_key_bucket_count_get(init_info);
+        info->offset_to_key_buckets = shm_rm_ptr - shm_rm_base_ptr;
+        shm_rm_ptr                 += info->key_bucket_count * sizeof(uint32_t);
 
-        mlnx_sai_rm_array_canary_init(type);
+        mlnx_sai_rm_array_hdr_init(type);
     }
 
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * Elements are taken from the free list. Some users (bridge) mark elements as used directly by index,
+ * such elements are dropped from the list when met here
+ */
 sai_status_t mlnx_shm_rm_array_alloc(_In_ mlnx_shm_rm_array_type_t  type,
                                      _Out_ mlnx_shm_rm_array_idx_t *idx,
                                      _Out_ void                   **elem)
 {
-    const mlnx_shm_rm_array_info_t *info;
-    mlnx_shm_array_hdr_t           *array_hdr;
-    uint32_t                        ii;
+    mlnx_shm_rm_array_info_t *info;
+    mlnx_shm_array_hdr_t     *array_hdr;
+    uint32_t                  ii;
 
     assert(MLNX_SHM_RM_ARRAY_TYPE_IS_VALID(type));
 
     info = &g_sai_db_ptr->array_info[type];
 
-    for (ii = 0; ii < info->elem_count; ii++) {
+    while (info->free_head != MLNX_SHM_RM_ARRAY_LINK_NONE) {
+        ii        = info->free_head;
         array_hdr = mlnx_rm_array_elem_by_idx(info, ii);
-        assert(array_hdr);
+        if (!array_hdr) {
+            return SAI_STATUS_FAILURE;
+        }
 
         if (!MLNX_SHM_RM_ARRAY_HDR_IS_VALID(type, array_hdr)) {
             SX_LOG_ERR("array_hdr for type %d idx %d is corrupted (canary is %x, not %x)\n",
@@ -2875,11 +3044,15 @@ sai_status_t mlnx_shm_rm_array_alloc(_In_ mlnx_shm_rm_array_type_t  type,
             return SAI_STATUS_FAILURE;
         }
 
+        info->free_head      = array_hdr->free_next;
+        array_hdr->free_next = MLNX_SHM_RM_ARRAY_LINK_NONE;
+
         if (!array_hdr->is_used) {
-            array_hdr->is_used = true;
-            idx->type          = type;
-            idx->idx           = ii;
-            *elem              = (void*)array_hdr;
+            array_hdr->is_used  = true;
+            array_hdr->is_keyed = false;
+            idx->type           = type;
+            idx->idx            = ii;
+            *elem               = (void*)array_hdr;
             return SAI_STATUS_SUCCESS;
         }
     }
@@ -2887,10 +3060,76 @@ sai_status_t mlnx_shm_rm_array_alloc(_In_ mlnx_shm_rm_array_type_t  type,
     return SAI_STATUS_INSUFFICIENT_RESOURCES;
 }
 
+static void mlnx_shm_rm_array_key_unlink(_In_ const mlnx_shm_rm_array_info_t *info,
+                                         _In_ uint32_t                        ii,
+                                         _Inout_ mlnx_shm_array_hdr_t        *array_hdr)
+{
+    mlnx_shm_array_hdr_t *prev_hdr;
+    uint32_t             *link;
+
+    if (!array_hdr->is_keyed) {
+        return;
+    }
+
+    link = &mlnx_rm_array_key_buckets(info)[mlnx_rm_array_key_bucket(info, array_hdr->key)];
+    while (*link != MLNX_SHM_RM_ARRAY_LINK_NONE) {
+        if (*link == ii) {
+            *link = array_hdr->key_next;
+            break;
+        }
+
+        prev_hdr = mlnx_rm_array_elem_by_idx(info, *link);
+        assert(prev_hdr);
+        link = &prev_hdr->key_next;
+    }
+
+    array_hdr->key_next = MLNX_SHM_RM_ARRAY_LINK_NONE;
+    array_hdr->is_keyed = false;
+}
+
 sai_status_t mlnx_shm_rm_array_free(_In_ mlnx_shm_rm_array_idx_t idx)
+{
+    mlnx_shm_rm_array_info_t *info;
+    mlnx_shm_array_hdr_t     *array_hdr;
+
+    if (!MLNX_SHM_RM_ARRAY_TYPE_IS_VALID(idx.type)) {
+        SX_LOG_ERR("Invalid idx type %d\n", idx.type);
+        return SAI_STATUS_FAILURE;
+    }
+
+    info = &g_sai_db_ptr->array_info[idx.type];
+
+    array_hdr = mlnx_rm_array_elem_by_idx(info, idx.idx);
+    if (!array_hdr) {
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (!MLNX_SHM_RM_ARRAY_HDR_IS_VALID(idx.type, array_hdr)) {
+        SX_LOG_ERR("array_hdr for type %d idx %d is corrupted (canary is %x, not %x)\n",
+                   idx.type, idx.idx, array_hdr->canary, MLNX_SHM_RM_ARRAY_CANARY(idx.type));
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (!array_hdr->is_used) {
+        SX_LOG_ERR("Failed to free element - already free or not allocated\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    mlnx_shm_rm_array_key_unlink(info, idx.idx, array_hdr);
+
+    array_hdr->is_used   = false;
+    array_hdr->free_next = info->free_head;
+    info->free_head      = idx.idx;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Add allocated element to the key index of its array, the key of the element is replaced if already set */
+sai_status_t mlnx_shm_rm_array_key_set(_In_ mlnx_shm_rm_array_idx_t idx, _In_ uint64_t key)
 {
     const mlnx_shm_rm_array_info_t *info;
     mlnx_shm_array_hdr_t           *array_hdr;
+    uint32_t                       *bucket;
 
     if (!MLNX_SHM_RM_ARRAY_TYPE_IS_VALID(idx.type)) {
         SX_LOG_ERR("Invalid idx type %d\n", idx.type);
@@ -2899,6 +3138,11 @@ sai_status_t mlnx_shm_rm_array_free(_In_ mlnx_shm_rm_array_idx_t idx)
 
     info = &g_sai_db_ptr->array_info[idx.type];
 
+    if (info->key_bucket_count == 0) {
+        SX_LOG_ERR("Array type %d has no key index\n", idx.type);
+        return SAI_STATUS_FAILURE;
+    }
+
     array_hdr = mlnx_rm_array_elem_by_idx(info, idx.idx);
     if (!array_hdr) {
         return SAI_STATUS_FAILURE;
@@ -2911,15 +3155,71 @@ sai_status_t mlnx_shm_rm_array_free(_In_ mlnx_shm_rm_array_idx_t idx)
     }
 
     if (!array_hdr->is_used) {
-        SX_LOG_ERR("Failed to free element - already free or not allocated\n");
+        SX_LOG_ERR("Failed to set key for element - not allocated\n");
         return SAI_STATUS_FAILURE;
     }
 
-    array_hdr->is_used = false;
+    mlnx_shm_rm_array_key_unlink(info, idx.idx, array_hdr);
+
+    bucket              = &mlnx_rm_array_key_buckets(info)[mlnx_rm_array_key_bucket(info, key)];
+    array_hdr->key      = key;
+    array_hdr->key_next = *bucket;
+    array_hdr->is_keyed = true;
+    *bucket             = idx.idx;
 
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t mlnx_shm_rm_array_find_by_key(_In_ mlnx_shm_rm_array_type_t  type,
+                                           _In_ uint64_t                  key,
+                                           _Out_ mlnx_shm_rm_array_idx_t *idx,
+                                           _Out_ void                   **elem)
+{
+    const mlnx_shm_rm_array_info_t *info;
+    mlnx_shm_array_hdr_t           *array_hdr;
+    uint32_t                        ii;
+
+    assert(elem);
+    assert(idx);
+
+    if (!MLNX_SHM_RM_ARRAY_TYPE_IS_VALID(type)) {
+        SX_LOG_ERR("Invalid idx type %d\n", type);
+        return SAI_STATUS_FAILURE;
+    }
+
+    info = &g_sai_db_ptr->array_info[type];
+
+    if (info->key_bucket_count == 0) {
+        SX_LOG_ERR("Array type %d has no key index\n", type);
+        return SAI_STATUS_FAILURE;
+    }
+
+    ii = mlnx_rm_array_key_buckets(info)[mlnx_rm_array_key_bucket(info, key)];
+    while (ii != MLNX_SHM_RM_ARRAY_LINK_NONE) {
+        array_hdr = mlnx_rm_array_elem_by_idx(info, ii);
+        if (!array_hdr) {
+            return SAI_STATUS_FAILURE;
+        }
+
+        if (!MLNX_SHM_RM_ARRAY_HDR_IS_VALID(type, array_hdr)) {
+            SX_LOG_ERR("array_hdr for type %d idx %d is corrupted (canary is %x, not %x)\n",
+                       type, ii, array_hdr->canary, MLNX_SHM_RM_ARRAY_CANARY(type));
+            return SAI_STATUS_FAILURE;
+        }
+
+        if (array_hdr->is_used && (array_hdr->key == key)) {
+            idx->type = type;
+            idx->idx  = ii;
+            *elem     = (void*)array_hdr;
+            return SAI_STATUS_SUCCESS;
+        }
+
+        ii = array_hdr->key_next;
+    }
+
+    return SAI_STATUS_ITEM_NOT_FOUND;
+}
+
 sai_status_t mlnx_shm_rm_array_find(_In_ mlnx_shm_rm_array_type_t  type,
                                     _In_ mlnx_shm_rm_array_cmp_fn  cmp_fn,
                                     _In_ mlnx_shm_rm_array_idx_t   start_idx,
@@ -3132,9 +3432,9 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
     }
 
     for (ii = 0; ii < MAX_PORTS; ii++) {
-        port          = mlnx_port_by_local_id(port_attributes_p[ii].port_mapping.local_port);
-        port->logical = port_attributes_p[ii].log_port;
-        status        = mlnx_create_object(SAI_OBJECT_TYPE_PORT, port->logical, NULL, &port->saiport);
+        port = mlnx_port_by_local_id(port_attributes_p[ii].port_mapping.local_port);
+        mlnx_port_logical_set(port, port_attributes_p[ii].log_port);
+        status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, port->logical, NULL, &port->saiport);
         if (SAI_ERR(status)) {
             goto out;
         }
@@ -3507,28 +3807,666 @@ static sai_status_t mlnx_switch_parse_fdb_event(uint8_t
     return SAI_STATUS_SUCCESS;
 }
 
+/* Called with queue lock taken. Swaps the receive buffer with the one of the free slot, so no copy is done */
+static void mlnx_event_queue_push(_Inout_ mlnx_event_queue_t   *queue,
+                                  _Inout_ uint8_t             **buf,
+                                  _In_ uint32_t                 size,
+                                  _In_ const sx_receive_info_t *receive_info)
+{
+    mlnx_event_slot_t *slot;
+    uint8_t           *tmp;
+
+    slot = &queue->slots[(queue->head + queue->count) % queue->size];
+
+    tmp                = slot->buf;
+    slot->buf          = *buf;
+    *buf               = tmp;
+    slot->size         = size;
+    slot->receive_info = *receive_info;
+    slot->enqueue_us   = mlnx_time_us_get();
+
+    queue->count++;
+    queue->stats.enqueued++;
+    queue->stats.depth = queue->count;
+    if (queue->count > queue->stats.depth_max) {
+        queue->stats.depth_max = queue->count;
+    }
+}
+
+/*
+ * Hand the received event over to the channel worker.
+ * Packet queue drops on overflow, port and FDB queues apply back pressure on the dispatcher.
+ */
+static void mlnx_event_queue_enqueue(_Inout_ mlnx_event_queue_t   *queue,
+                                     _Inout_ uint8_t             **buf,
+                                     _In_ uint32_t                 size,
+                                     _In_ const sx_receive_info_t *receive_info)
+{
+    pthread_mutex_lock(&queue->lock);
+
+    while ((queue->count == queue->size) && !queue->stop) {
+        if (queue->drop_on_full) {
+            queue->stats.dropped++;
+            pthread_mutex_unlock(&queue->lock);
+            return;
+        }
+
+        pthread_cond_wait(&queue->not_full, &queue->lock);
+    }
+
+    if (!queue->stop) {
+        mlnx_event_queue_push(queue, buf, size, receive_info);
+        pthread_cond_signal(&queue->not_empty);
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+}
+
+static void mlnx_event_queue_stop(_Inout_ mlnx_event_queue_t *queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    queue->stop = true;
+    pthread_cond_broadcast(&queue->not_empty);
+    pthread_cond_broadcast(&queue->not_full);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+static void mlnx_event_worker_failed(_In_ sx_status_t status)
+{
+    g_event_dispatcher.worker_status = status;
+    event_thread_asked_to_stop       = true;
+}
+
+static void mlnx_event_port_handle(_In_ mlnx_event_worker_ctx_t *ctx, _In_ const mlnx_event_slot_t *slot)
+{
+    sai_port_oper_status_notification_t port_data;
+    const sx_receive_info_t            *receive_info = &slot->receive_info;
+    sai_status_t                        status;
+
+    status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, receive_info->event_info.pude.log_port, NULL,
+                                &port_data.port_id);
+    if (SAI_ERR(status)) {
+        mlnx_event_worker_failed(SX_STATUS_ERROR);
+        return;
+    }
+
+    if (SX_PORT_OPER_STATUS_UP == receive_info->event_info.pude.oper_state) {
+        port_data.port_state = SAI_PORT_OPER_STATUS_UP;
+    } else {
+        port_data.port_state = SAI_PORT_OPER_STATUS_DOWN;
+    }
+    SX_LOG_NTC("Port %x changed state to %s\n", receive_info->event_info.pude.log_port,
+               (SX_PORT_OPER_STATUS_UP == receive_info->event_info.pude.oper_state) ? "up" : "down");
+
+    if (g_notification_callbacks.on_port_state_change) {
+        g_notification_callbacks.on_port_state_change(1, &port_data);
+    }
+}
+
+static void mlnx_fdb_event_batch_keys_clear(_Inout_ mlnx_fdb_event_batch_t *batch)
+{
+    batch->key_gen++;
+
+    if (0 == batch->key_gen) {
+        memset(batch->keys, 0, batch->keys_size * sizeof(*batch->keys));
+        batch->key_gen = 1;
+    }
+}
+
+static uint32_t mlnx_fdb_event_batch_key_hash(_In_ const sai_mac_t mac, _In_ sai_object_id_t bv_id)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    uint32_t ii;
+
+    for (ii = 0; ii < sizeof(sai_mac_t); ii++) {
+        hash = (hash ^ mac[ii]) * 0x100000001b3ULL;
+    }
+
+    for (ii = 0; ii < sizeof(bv_id); ii++) {
+        hash = (hash ^ ((bv_id >> (ii * 8)) & 0xff)) * 0x100000001b3ULL;
+    }
+
+    return (uint32_t)(hash ^ (hash >> 32));
+}
+
+static mlnx_fdb_event_batch_key_t* mlnx_fdb_event_batch_key_get(_Inout_ mlnx_fdb_event_batch_t                  *batch,
+                                                                _In_ const sai_fdb_event_notification_data_t *event)
+{
+    mlnx_fdb_event_batch_key_t *key;
+    uint32_t                    ii;
+
+    ii = mlnx_fdb_event_batch_key_hash(event->fdb_entry.mac_address, event->fdb_entry.bv_id) &
+         (batch->keys_size - 1);
+
+    /* keys_size is at least twice the number of events, so there is always a free slot */
+    while (true) {
+        key = &batch->keys[ii];
+
+        if (key->gen != batch->key_gen) {
+            memcpy(key->mac, event->fdb_entry.mac_address, sizeof(key->mac));
+            key->bv_id     = event->fdb_entry.bv_id;
+            key->event_idx = MLNX_FDB_EVENT_BATCH_IDX_NONE;
+            key->gen       = batch->key_gen;
+            return key;
+        }
+
+        if ((key->bv_id == event->fdb_entry.bv_id) &&
+            (0 == memcmp(key->mac, event->fdb_entry.mac_address, sizeof(key->mac)))) {
+            return key;
+        }
+
+        ii = (ii + 1) & (batch->keys_size - 1);
+    }
+}
+
+/*
+ * Merge the events parsed into [first, batch->count) with the pending ones:
+ * - a learn replaces the pending learn of the same (MAC, bv_id) (MAC move)
+ * - an age cancels the pending learn of the same (MAC, bv_id), the age is still delivered since the learn
+ *   may be a move of a MAC that the upper layer already has on another port
+ * - a flush may refer to any of the pending entries, so it ends the merge scope
+ */
+static void mlnx_fdb_event_batch_merge(_Inout_ mlnx_fdb_event_batch_t *batch, _In_ uint32_t first)
+{
+    sai_fdb_event_notification_data_t *event;
+    mlnx_fdb_event_batch_key_t        *key;
+    uint32_t                           ii;
+
+    for (ii = first; ii < batch->count; ii++) {
+        event = &batch->events[ii];
+
+        batch->cancelled[ii] = false;
+
+        if (event->event_type == SAI_FDB_EVENT_FLUSHED) {
+            mlnx_fdb_event_batch_keys_clear(batch);
+            continue;
+        }
+
+        key = mlnx_fdb_event_batch_key_get(batch, event);
+
+        if ((key->event_idx != MLNX_FDB_EVENT_BATCH_IDX_NONE) &&
+            (batch->events[key->event_idx].event_type == SAI_FDB_EVENT_LEARNED)) {
+            if (event->event_type == SAI_FDB_EVENT_LEARNED) {
+                batch->cancelled[key->event_idx] = true;
+                batch->cancelled_count++;
+            } else if (event->event_type == SAI_FDB_EVENT_AGED) {
+                batch->cancelled[key->event_idx] = true;
+                batch->cancelled_count++;
+            }
+        }
+
+        key->event_idx = ii;
+    }
+}
+
+static void mlnx_event_fdb_flush(_In_ mlnx_event_worker_ctx_t *ctx)
+{
+    mlnx_fdb_event_batch_t *batch = &ctx->fdb_batch;
+    uint32_t                ii, count = 0;
+
+    ctx->flush_deadline_us = 0;
+
+    if (0 == batch->count) {
+        return;
+    }
+
+    /* Compact the batch, attributes of the event ii are always at ii * FDB_NOTIF_ATTRIBS_NUM */
+    for (ii = 0; ii < batch->count; ii++) {
+        if (batch->cancelled[ii]) {
+            continue;
+        }
+
+        if (count != ii) {
+            batch->events[count] = batch->events[ii];
+            memcpy(&batch->attrs[count * FDB_NOTIF_ATTRIBS_NUM], &batch->attrs[ii * FDB_NOTIF_ATTRIBS_NUM],
+                   FDB_NOTIF_ATTRIBS_NUM * sizeof(*batch->attrs));
+            batch->events[count].attr = &batch->attrs[count * FDB_NOTIF_ATTRIBS_NUM];
+        }
+
+        count++;
+    }
+
+    SX_LOG_DBG("Delivering %u FDB events, %u cancelled\n", count, batch->cancelled_count);
+
+    if ((count > 0) && g_notification_callbacks.on_fdb_event) {
+        g_notification_callbacks.on_fdb_event(count, batch->events);
+    }
+
+    batch->count           = 0;
+    batch->cancelled_count = 0;
+    mlnx_fdb_event_batch_keys_clear(batch);
+}
+
+static void mlnx_event_fdb_handle(_In_ mlnx_event_worker_ctx_t *ctx, _In_ const mlnx_event_slot_t *slot)
+{
+    mlnx_fdb_event_batch_t *batch = &ctx->fdb_batch;
+    sai_status_t            status;
+    uint32_t                event_count = 0, first;
+
+    SX_LOG_INF("Received trap fdb event sdk %u\n", slot->receive_info.trap_id);
+
+    first  = batch->count;
+    status = mlnx_switch_parse_fdb_event(slot->buf, (sx_receive_info_t*)&slot->receive_info,
+                                         &batch->events[first], &event_count,
+                                         &batch->attrs[first * FDB_NOTIF_ATTRIBS_NUM]);
+    if (SAI_ERR(status)) {
+        return;
+    }
+
+    /* event arrived from sdk, but had only records with no matching bridge port */
+    if (0 == event_count) {
+        return;
+    }
+
+    batch->count += event_count;
+    mlnx_fdb_event_batch_merge(batch, first);
+
+    if (batch->count >= batch->batch_size) {
+        mlnx_event_fdb_flush(ctx);
+        return;
+    }
+
+    if (0 == ctx->flush_deadline_us) {
+        ctx->flush_deadline_us = mlnx_time_us_get() + batch->window_us;
+    }
+}
+
+static void mlnx_event_packet_handle(_In_ mlnx_event_worker_ctx_t *ctx, _In_ const mlnx_event_slot_t *slot)
+{
+    const sx_receive_info_t *receive_info = &slot->receive_info;
+    sai_attribute_t          callback_data[RECV_ATTRIBS_NUM];
+    const char              *trap_name;
+    sai_status_t             status;
+
+    callback_data[0].id = SAI_HOSTIF_PACKET_ATTR_HOSTIF_TRAP_ID;
+    callback_data[1].id = SAI_HOSTIF_PACKET_ATTR_INGRESS_PORT;
+    callback_data[2].id = SAI_HOSTIF_PACKET_ATTR_INGRESS_LAG;
+
+    status = mlnx_translate_sdk_trap_to_sai_oid(receive_info->trap_id, &callback_data[0].value.oid, &trap_name);
+    if (SAI_ERR(status)) {
+        SX_LOG_WRN("unknown sdk trap %u, waiting for next packet\n", receive_info->trap_id);
+        return;
+    }
+
+    if (SX_INVALID_PORT == receive_info->source_log_port) {
+        SX_LOG_WRN("sx_api_host_ifc_recv on callback fd returned unknown port, waiting for next packet\n");
+        return;
+    }
+
+    status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, receive_info->source_log_port, NULL,
+                                &callback_data[1].value.oid);
+    if (SAI_ERR(status)) {
+        mlnx_event_worker_failed(SX_STATUS_ERROR);
+        return;
+    }
+
+    if (receive_info->is_lag) {
+        status = mlnx_create_object(SAI_OBJECT_TYPE_LAG, receive_info->source_lag_port, NULL,
+                                    &callback_data[2].value.oid);
+        if (SAI_ERR(status)) {
+            mlnx_event_worker_failed(SX_STATUS_ERROR);
+            return;
+        }
+    } else {
+        callback_data[2].value.oid = SAI_NULL_OBJECT_ID;
+    }
+
+    SX_LOG_INF("Received trap %s sdk %u port %x is lag %u %x\n", trap_name, receive_info->trap_id,
+               receive_info->source_log_port, receive_info->is_lag, receive_info->source_lag_port);
+
+    if (g_notification_callbacks.on_packet_event) {
+        g_notification_callbacks.on_packet_event(g_event_dispatcher.switch_id,
+                                                 slot->size,
+                                                 slot->buf,
+                                                 RECV_ATTRIBS_NUM,
+                                                 callback_data);
+    }
+}
+
+/* Called with queue lock taken. Waits for an event, flushes the batched work of the worker when it is due */
+static void mlnx_event_worker_wait(_Inout_ mlnx_event_worker_ctx_t *ctx)
+{
+    mlnx_event_queue_t *queue = ctx->queue;
+    struct timespec     abstime;
+    uint64_t            now_us, wait_us;
+
+    while ((queue->count == 0) && !queue->stop) {
+        if (!ctx->flush || (0 == ctx->flush_deadline_us)) {
+            pthread_cond_wait(&queue->not_empty, &queue->lock);
+            continue;
+        }
+
+        now_us = mlnx_time_us_get();
+        if (now_us >= ctx->flush_deadline_us) {
+            pthread_mutex_unlock(&queue->lock);
+            ctx->flush(ctx);
+            pthread_mutex_lock(&queue->lock);
+            continue;
+        }
+
+        wait_us = ctx->flush_deadline_us - now_us;
+        clock_gettime(CLOCK_REALTIME, &abstime);
+        abstime.tv_sec  += wait_us / 1000000;
+        abstime.tv_nsec += (wait_us % 1000000) * 1000;
+        if (abstime.tv_nsec >= 1000000000) {
+            abstime.tv_sec++;
+            abstime.tv_nsec -= 1000000000;
+        }
+
+        pthread_cond_timedwait(&queue->not_empty, &queue->lock, &abstime);
+    }
+}
+
+static void mlnx_event_worker_func(void *context)
+{
+    mlnx_event_worker_ctx_t *ctx   = (mlnx_event_worker_ctx_t*)context;
+    mlnx_event_queue_t      *queue = ctx->queue;
+    mlnx_event_slot_t       *slot;
+    uint64_t                 latency_us;
+
+    pthread_mutex_lock(&queue->lock);
+
+    while (true) {
+        mlnx_event_worker_wait(ctx);
+
+        if (queue->stop) {
+            break;
+        }
+
+        /* Slot stays in the queue while handled, dispatcher only writes past head + count */
+        slot       = &queue->slots[queue->head];
+        latency_us = mlnx_time_us_get() - slot->enqueue_us;
+
+        queue->stats.processed++;
+        queue->stats.latency_total_us += latency_us;
+        if (latency_us > queue->stats.latency_max_us) {
+            queue->stats.latency_max_us = latency_us;
+        }
+
+        pthread_mutex_unlock(&queue->lock);
+
+        ctx->handler(ctx, slot);
+
+        pthread_mutex_lock(&queue->lock);
+        queue->head = (queue->head + 1) % queue->size;
+        queue->count--;
+        queue->stats.depth = queue->count;
+        pthread_cond_signal(&queue->not_full);
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    if (ctx->flush && ctx->flush_deadline_us) {
+        ctx->flush(ctx);
+    }
+}
+
+static void mlnx_event_dispatcher_deinit(void)
+{
+    mlnx_event_channel_t    channel;
+    mlnx_event_queue_t     *queue;
+    mlnx_fdb_event_batch_t *batch;
+    uint32_t                ii;
+
+    for (channel = 0; channel < MLNX_EVENT_CHANNEL_COUNT; channel++) {
+        mlnx_event_queue_stop(&g_event_dispatcher.queues[channel]);
+    }
+
+    for (channel = 0; channel < MLNX_EVENT_CHANNEL_COUNT; channel++) {
+        queue = &g_event_dispatcher.queues[channel];
+
+        if (g_event_dispatcher.workers[channel].is_started) {
+#ifndef _WIN32
+            pthread_join(g_event_dispatcher.workers[channel].thread.osd.id, NULL);
+#endif
+            g_event_dispatcher.workers[channel].is_started = false;
+        }
+
+        if (queue->slots) {
+            for (ii = 0; ii < queue->size; ii++) {
+                free(queue->slots[ii].buf);
+            }
+            free(queue->slots);
+            queue->slots = NULL;
+        }
+    }
+
+    batch = &g_event_dispatcher.workers[MLNX_EVENT_CHANNEL_FDB].fdb_batch;
+    free(batch->events);
+    free(batch->attrs);
+    free(batch->cancelled);
+    free(batch->keys);
+    memset(batch, 0, sizeof(*batch));
+}
+
+/* Parses a whole decimal/hex profile value in [min, max] */
+static bool mlnx_fdb_event_batch_key_parse(_In_ const char *str, _In_ long min, _In_ long max, _Out_ long *value)
+{
+    char *end;
+
+    errno  = 0;
+    *value = strtol(str, &end, 0);
+
+    return (errno == 0) && (end != str) && (*end == '\0') && (*value >= min) && (*value <= max);
+}
+
+static void mlnx_fdb_event_batch_config_get(_Out_ uint32_t *batch_size, _Out_ uint64_t *window_us)
+{
+    const char *batch_size_str, *window_ms_str;
+    long        value;
+
+    *batch_size = MLNX_FDB_EVENT_BATCH_SIZE_DEFAULT;
+    *window_us  = 0;
+
+    batch_size_str = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_FDB_EVENT_BATCH_SIZE);
+    window_ms_str  = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_FDB_EVENT_BATCH_WINDOW_MS);
+
+    if (NULL != batch_size_str) {
+        if (mlnx_fdb_event_batch_key_parse(batch_size_str, 1, MLNX_FDB_EVENT_BATCH_SIZE_MAX, &value)) {
+            *batch_size = (uint32_t)value;
+        } else {
+            SX_LOG_WRN("Invalid FDB event batch size %s (1..%u), using %u\n", batch_size_str,
+                       MLNX_FDB_EVENT_BATCH_SIZE_MAX, MLNX_FDB_EVENT_BATCH_SIZE_DEFAULT);
+        }
+    }
+
+    if (NULL != window_ms_str) {
+        if (mlnx_fdb_event_batch_key_parse(window_ms_str, 0, MLNX_FDB_EVENT_BATCH_WINDOW_MS_MAX, &value)) {
+            *window_us = (uint64_t)value * 1000;
+        } else {
+            SX_LOG_WRN("Invalid FDB event batch window %s ms (0..%u), using 0\n", window_ms_str,
+                       MLNX_FDB_EVENT_BATCH_WINDOW_MS_MAX);
+        }
+    }
+
+    SX_LOG_NTC("FDB event batch size %u window %" PRIu64 " ms\n", *batch_size, *window_us / 1000);
+}
+
+static sx_status_t mlnx_fdb_event_batch_init(_Inout_ mlnx_fdb_event_batch_t *batch)
+{
+    uint32_t capacity;
+
+    mlnx_fdb_event_batch_config_get(&batch->batch_size, &batch->window_us);
+
+    capacity         = batch->batch_size + SX_FDB_NOTIFY_SIZE_MAX;
+    batch->keys_size = 1;
+    while (batch->keys_size < capacity * 2) {
+        batch->keys_size <<= 1;
+    }
+
+    batch->events    = calloc(capacity, sizeof(*batch->events));
+    batch->attrs     = calloc(capacity * FDB_NOTIF_ATTRIBS_NUM, sizeof(*batch->attrs));
+    batch->cancelled = calloc(capacity, sizeof(*batch->cancelled));
+    batch->keys      = calloc(batch->keys_size, sizeof(*batch->keys));
+    if (!batch->events || !batch->attrs || !batch->cancelled || !batch->keys) {
+        SX_LOG_ERR("Can't allocate memory for fdb events\n");
+        return SX_STATUS_NO_MEMORY;
+    }
+
+    batch->count           = 0;
+    batch->cancelled_count = 0;
+    batch->key_gen         = 1;
+
+    return SX_STATUS_SUCCESS;
+}
+
+static sx_status_t mlnx_event_dispatcher_init(_In_ sai_object_id_t switch_id, _In_ uint32_t buf_size)
+{
+    static const uint32_t              queue_sizes[MLNX_EVENT_CHANNEL_COUNT] = {
+        [MLNX_EVENT_CHANNEL_PORT]   = MLNX_EVENT_QUEUE_PORT_SIZE,
+        [MLNX_EVENT_CHANNEL_FDB]    = MLNX_EVENT_QUEUE_FDB_SIZE,
+        [MLNX_EVENT_CHANNEL_PACKET] = MLNX_EVENT_QUEUE_PACKET_SIZE,
+    };
+    static const mlnx_event_handler_fn handlers[MLNX_EVENT_CHANNEL_COUNT] = {
+        [MLNX_EVENT_CHANNEL_PORT]   = mlnx_event_port_handle,
+        [MLNX_EVENT_CHANNEL_FDB]    = mlnx_event_fdb_handle,
+        [MLNX_EVENT_CHANNEL_PACKET] = mlnx_event_packet_handle,
+    };
+    mlnx_event_worker_ctx_t           *fdb_worker = &g_event_dispatcher.workers[MLNX_EVENT_CHANNEL_FDB];
+    mlnx_event_channel_t               channel;
+    mlnx_event_queue_t                *queue;
+    cl_status_t                        cl_err;
+    sx_status_t                        status;
+    uint32_t                           ii;
+
+    g_event_dispatcher.switch_id     = switch_id;
+    g_event_dispatcher.worker_status = SX_STATUS_SUCCESS;
+
+    status = mlnx_fdb_event_batch_init(&fdb_worker->fdb_batch);
+    if (SX_STATUS_SUCCESS != status) {
+        return status;
+    }
+
+    fdb_worker->flush             = mlnx_event_fdb_flush;
+    fdb_worker->flush_deadline_us = 0;
+
+    for (channel = 0; channel < MLNX_EVENT_CHANNEL_COUNT; channel++) {
+        queue = &g_event_dispatcher.queues[channel];
+
+        pthread_mutex_lock(&queue->lock);
+        queue->size         = queue_sizes[channel];
+        queue->head         = 0;
+        queue->count        = 0;
+        queue->stop         = false;
+        queue->drop_on_full = (channel == MLNX_EVENT_CHANNEL_PACKET);
+        memset(&queue->stats, 0, sizeof(queue->stats));
+        pthread_mutex_unlock(&queue->lock);
+
+        queue->slots = calloc(queue->size, sizeof(*queue->slots));
+        if (NULL == queue->slots) {
+            SX_LOG_ERR("Can't allocate event queue %u\n", channel);
+            return SX_STATUS_NO_MEMORY;
+        }
+
+        for (ii = 0; ii < queue->size; ii++) {
+            queue->slots[ii].buf = malloc(buf_size);
+            if (NULL == queue->slots[ii].buf) {
+                SX_LOG_ERR("Can't allocate event queue %u buffer\n", channel);
+                return SX_STATUS_NO_MEMORY;
+            }
+        }
+
+        g_event_dispatcher.workers[channel].queue   = queue;
+        g_event_dispatcher.workers[channel].handler = handlers[channel];
+    }
+
+    for (channel = 0; channel < MLNX_EVENT_CHANNEL_COUNT; channel++) {
+        cl_err = cl_thread_init(&g_event_dispatcher.workers[channel].thread, mlnx_event_worker_func,
+                                &g_event_dispatcher.workers[channel], NULL);
+        if (cl_err) {
+            SX_LOG_ERR("Failed to create event worker thread %u\n", channel);
+            return SX_STATUS_ERROR;
+        }
+
+        g_event_dispatcher.workers[channel].is_started = true;
+    }
+
+    return SX_STATUS_SUCCESS;
+}
+
+/* Receive up to MLNX_EVENT_RX_BURST_MAX events ready on the fd and hand them to the workers */
+static sx_status_t mlnx_event_channel_drain(_In_ sx_user_channel_t    *channel,
+                                            _In_ bool                  is_port_channel,
+                                            _Inout_ uint8_t          **rx_buf,
+                                            _In_ uint32_t              rx_buf_size,
+                                            _Inout_ sx_receive_info_t *receive_info)
+{
+    sx_status_t          status;
+    struct pollfd        pfd;
+    uint32_t             packet_size, ii;
+    mlnx_event_channel_t event_channel;
+
+    pfd.fd     = channel->channel.fd.fd;
+    pfd.events = POLLIN;
+
+    for (ii = 0; ii < MLNX_EVENT_RX_BURST_MAX; ii++) {
+        if (ii > 0) {
+            pfd.revents = 0;
+            if ((poll(&pfd, 1, 0) <= 0) || !(pfd.revents & POLLIN)) {
+                break;
+            }
+        }
+
+        packet_size = rx_buf_size;
+        status      = sx_lib_host_ifc_recv(&channel->channel.fd, *rx_buf, &packet_size, receive_info);
+        if (SX_STATUS_SUCCESS != status) {
+            SX_LOG_ERR("sx_api_host_ifc_recv on %s fd failed with error %s out size %u\n",
+                       is_port_channel ? "port" : "callback", SX_STATUS_MSG(status), packet_size);
+            return status;
+        }
+
+        if (is_port_channel) {
+            if (SX_INVALID_PORT == receive_info->source_log_port) {
+                SX_LOG_WRN("sx_api_host_ifc_recv on port fd returned unknown port, waiting for next packet\n");
+                continue;
+            }
+
+            event_channel = MLNX_EVENT_CHANNEL_PORT;
+        } else if (SX_TRAP_ID_FDB_EVENT == receive_info->trap_id) {
+            event_channel = MLNX_EVENT_CHANNEL_FDB;
+        } else {
+            event_channel = MLNX_EVENT_CHANNEL_PACKET;
+        }
+
+        mlnx_event_queue_enqueue(&g_event_dispatcher.queues[event_channel], rx_buf, packet_size, receive_info);
+    }
+
+    return SX_STATUS_SUCCESS;
+}
+
+void mlnx_switch_event_channel_stats_get(_In_ mlnx_event_channel_t        channel,
+                                         _Out_ mlnx_event_channel_stats_t *stats)
+{
+    mlnx_event_queue_t *queue;
+
+    assert(channel < MLNX_EVENT_CHANNEL_COUNT);
+    assert(stats);
+
+    queue = &g_event_dispatcher.queues[channel];
+
+    pthread_mutex_lock(&queue->lock);
+    *stats = queue->stats;
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/*
+ * Event dispatcher. Waits on the PUDE and callback channels with epoll and hands the received events to
+ * per channel workers (port state, FDB, packet rx), so a burst of trapped packets doesn't delay port and
+ * FDB notifications.
+ */
 static void event_thread_func(void *context)
 {
 #define MAX_PACKET_SIZE MAX(g_resource_limits.port_mtu_max, SX_HOST_EVENT_BUFFER_SIZE_MAX)
 
-    sx_status_t                         status;
-    sx_api_handle_t                     api_handle;
-    sx_user_channel_t                   port_channel, callback_channel;
-    fd_set                              descr_set;
-    int                                 ret_val;
-    sai_object_id_t                     switch_id = (sai_object_id_t)context;
-    uint8_t                            *p_packet  = NULL;
-    uint32_t                            packet_size;
-    sx_receive_info_t                  *receive_info = NULL;
-    sai_port_oper_status_notification_t port_data;
-    struct timeval                      timeout;
-    sai_attribute_t                     callback_data[RECV_ATTRIBS_NUM];
-    sai_hostif_trap_type_t              trap_id;
-    const char                         *trap_name;
-    mlnx_trap_type_t                    trap_type;
-    sai_fdb_event_notification_data_t  *fdb_events  = NULL;
-    sai_attribute_t                    *attr_list   = NULL;
-    uint32_t                            event_count = 0;
+    sx_status_t        status;
+    sx_api_handle_t    api_handle;
+    sx_user_channel_t  port_channel, callback_channel;
+    int                ret_val, epoll_fd = -1, ii;
+    sai_object_id_t    switch_id = (sai_object_id_t)context;
+    uint8_t           *p_packet  = NULL;
+    uint32_t           packet_size;
+    sx_receive_info_t *receive_info = NULL;
+    struct epoll_event ev, events[2];
 #ifdef ACS_OS
     bool           transaction_mode_enable = false;
     const uint8_t  fastboot_wait_time      = 180;
@@ -3544,10 +4482,6 @@ static void event_thread_func(void *context)
     gettimeofday(&time_init, NULL);
 #endif
 
-    callback_data[0].id = SAI_HOSTIF_PACKET_ATTR_HOSTIF_TRAP_ID;
-    callback_data[1].id = SAI_HOSTIF_PACKET_ATTR_INGRESS_PORT;
-    callback_data[2].id = SAI_HOSTIF_PACKET_ATTR_INGRESS_LAG;
-
     if (SX_STATUS_SUCCESS != (status = sx_api_open(sai_log_cb, &api_handle))) {
         MLNX_SAI_LOG_ERR("Can't open connection to SDK - %s.\n", SX_STATUS_MSG(status));
         if (g_notification_callbacks.on_switch_shutdown_request) {
@@ -3568,25 +4502,16 @@ static void event_thread_func(void *context)
         goto out;
     }
 
-    p_packet = (uint8_t*)malloc(sizeof(*p_packet) * MAX_PACKET_SIZE);
+    packet_size = MAX_PACKET_SIZE;
+    p_packet    = (uint8_t*)malloc(sizeof(*p_packet) * packet_size);
     if (NULL == p_packet) {
         SX_LOG_ERR("Can't allocate packet memory\n");
         status = SX_STATUS_ERROR;
         goto out;
     }
-    SX_LOG_NTC("Event packet buffer size %u\n", MAX_PACKET_SIZE);
-
-    fdb_events = calloc(SX_FDB_NOTIFY_SIZE_MAX, sizeof(sai_fdb_event_notification_data_t));
-    if (NULL == fdb_events) {
-        SX_LOG_ERR("Can't allocate memory for fdb events\n");
-        status = SX_STATUS_ERROR;
-        goto out;
-    }
+    SX_LOG_NTC("Event packet buffer size %u\n", packet_size);
 
-    attr_list = calloc(SX_FDB_NOTIFY_SIZE_MAX * FDB_NOTIF_ATTRIBS_NUM, sizeof(sai_attribute_t));
-    if (NULL == attr_list) {
-        SX_LOG_ERR("Can't allocate memory for attribute list\n");
-        status = SX_STATUS_ERROR;
+    if (SX_STATUS_SUCCESS != (status = mlnx_event_dispatcher_init(switch_id, packet_size))) {
         goto out;
     }
 
@@ -3602,14 +4527,30 @@ static void event_thread_func(void *context)
     memcpy(&callback_channel, &g_sai_db_ptr->callback_channel, sizeof(callback_channel));
     cl_plock_release(&g_sai_db_ptr->p_lock);
 
-    while (!event_thread_asked_to_stop) {
-        FD_ZERO(&descr_set);
-        FD_SET(port_channel.channel.fd.fd, &descr_set);
-        FD_SET(callback_channel.channel.fd.fd, &descr_set);
+    epoll_fd = epoll_create1(0);
+    if (-1 == epoll_fd) {
+        SX_LOG_ERR("epoll create failed %s\n", strerror(errno));
+        status = SX_STATUS_ERROR;
+        goto out;
+    }
 
-        timeout.tv_sec  = 1;
-        timeout.tv_usec = 0;
+    memset(&ev, 0, sizeof(ev));
+    ev.events  = EPOLLIN;
+    ev.data.fd = port_channel.channel.fd.fd;
+    if (-1 == epoll_ctl(epoll_fd, EPOLL_CTL_ADD, port_channel.channel.fd.fd, &ev)) {
+        SX_LOG_ERR("epoll add port fd failed %s\n", strerror(errno));
+        status = SX_STATUS_ERROR;
+        goto out;
+    }
 
+    ev.data.fd = callback_channel.channel.fd.fd;
+    if (-1 == epoll_ctl(epoll_fd, EPOLL_CTL_ADD, callback_channel.channel.fd.fd, &ev)) {
+        SX_LOG_ERR("epoll add callback fd failed %s\n", strerror(errno));
+        status = SX_STATUS_ERROR;
+        goto out;
+    }
+
+    while (!event_thread_asked_to_stop) {
 #ifdef ACS_OS
         if (!stop_timer) {
             gettimeofday(&time_now, NULL);
@@ -3633,139 +4574,47 @@ static void event_thread_func(void *context)
         }
 #endif
 
-        ret_val = select(FD_SETSIZE, &descr_set, NULL, NULL, &timeout);
-
+        ret_val = epoll_wait(epoll_fd, events, (int)ARRAY_SIZE(events), 1000);
         if (-1 == ret_val) {
-            SX_LOG_ERR("select ended with error/interrupt %s\n", strerror(errno));
+            if (EINTR == errno) {
+                continue;
+            }
+
+            SX_LOG_ERR("epoll_wait ended with error %s\n", strerror(errno));
             status = SX_STATUS_ERROR;
             goto out;
         }
 
-        if (ret_val > 0) {
-            if (FD_ISSET(port_channel.channel.fd.fd, &descr_set)) {
-                packet_size = MAX_PACKET_SIZE;
-                if (SX_STATUS_SUCCESS !=
-                    (status = sx_lib_host_ifc_recv(&port_channel.channel.fd, p_packet, &packet_size, receive_info))) {
-                    SX_LOG_ERR("sx_api_host_ifc_recv on port fd failed with error %s out size %u\n",
-                               SX_STATUS_MSG(status), packet_size);
-                    goto out;
-                }
-
-                if (SX_INVALID_PORT == receive_info->source_log_port) {
-                    SX_LOG_WRN("sx_api_host_ifc_recv on port fd returned unknown port, waiting for next packet\n");
-                    continue;
-                }
-
-                if (SAI_STATUS_SUCCESS !=
-                    (status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, receive_info->event_info.pude.log_port, NULL,
-                                                 &port_data.port_id))) {
-                    goto out;
-                }
-
-                if (SX_PORT_OPER_STATUS_UP == receive_info->event_info.pude.oper_state) {
-                    port_data.port_state = SAI_PORT_OPER_STATUS_UP;
-                } else {
-                    port_data.port_state = SAI_PORT_OPER_STATUS_DOWN;
-                }
-                SX_LOG_NTC("Port %x changed state to %s\n", receive_info->event_info.pude.log_port,
-                           (SX_PORT_OPER_STATUS_UP == receive_info->event_info.pude.oper_state) ? "up" : "down");
-
-                if (g_notification_callbacks.on_port_state_change) {
-                    g_notification_callbacks.on_port_state_change(1, &port_data);
-                }
+        for (ii = 0; ii < ret_val; ii++) {
+            if (events[ii].data.fd == port_channel.channel.fd.fd) {
+                status = mlnx_event_channel_drain(&port_channel, true, &p_packet, packet_size, receive_info);
+            } else {
+                status = mlnx_event_channel_drain(&callback_channel, false, &p_packet, packet_size, receive_info);
             }
 
-            if (FD_ISSET(callback_channel.channel.fd.fd, &descr_set)) {
-                packet_size = MAX_PACKET_SIZE;
-                if (SX_STATUS_SUCCESS !=
-                    (status =
-                         sx_lib_host_ifc_recv(&callback_channel.channel.fd, p_packet, &packet_size, receive_info))) {
-                    SX_LOG_ERR("sx_api_host_ifc_recv on callback fd failed with error %s out size %u\n",
-                               SX_STATUS_MSG(status), packet_size);
-                    goto out;
-                }
-
-                if (SAI_STATUS_SUCCESS !=
-                    (status =
-                         mlnx_translate_sdk_trap_to_sai(receive_info->trap_id, &trap_id, &trap_name, &trap_type))) {
-                    SX_LOG_WRN("unknown sdk trap %u, waiting for next packet\n", receive_info->trap_id);
-                    continue;
-                }
-
-                if (SX_TRAP_ID_FDB_EVENT == receive_info->trap_id) {
-                    SX_LOG_INF("Received trap %s sdk %u\n", trap_name, receive_info->trap_id);
-
-                    if (SAI_STATUS_SUCCESS != (status = mlnx_switch_parse_fdb_event(p_packet, receive_info,
-                                                                                    fdb_events, &event_count,
-                                                                                    attr_list))) {
-                        continue;
-                    }
-
-                    /* event arrived from sdk, but had only records with no matching bridge port */
-                    if (0 == event_count) {
-                        continue;
-                    }
-
-                    if (g_notification_callbacks.on_fdb_event) {
-                        g_notification_callbacks.on_fdb_event(event_count, fdb_events);
-                    }
-
-                    continue;
-                }
-
-                if (SX_INVALID_PORT == receive_info->source_log_port) {
-                    SX_LOG_WRN("sx_api_host_ifc_recv on callback fd returned unknown port, waiting for next packet\n");
-                    continue;
-                }
-
-                if (SAI_STATUS_SUCCESS !=
-                    (status =
-                         mlnx_create_object((trap_type ==
-                                             MLNX_TRAP_TYPE_REGULAR) ? SAI_OBJECT_TYPE_HOSTIF_TRAP :
-                                            SAI_OBJECT_TYPE_HOSTIF_USER_DEFINED_TRAP,
-                                            trap_id, NULL, &callback_data[0].value.oid))) {
-                    goto out;
-                }
-
-                if (SAI_STATUS_SUCCESS !=
-                    (status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, receive_info->source_log_port, NULL,
-                                                 &callback_data[1].value.oid))) {
-                    goto out;
-                }
-
-                if (receive_info->is_lag) {
-                    if (SAI_STATUS_SUCCESS !=
-                        (status = mlnx_create_object(SAI_OBJECT_TYPE_LAG, receive_info->source_lag_port, NULL,
-                                                     &callback_data[2].value.oid))) {
-                        goto out;
-                    }
-                } else {
-                    callback_data[2].value.oid = SAI_NULL_OBJECT_ID;
-                }
-
-                SX_LOG_INF("Received trap %s sdk %u port %x is lag %u %x\n", trap_name, receive_info->trap_id,
-                           receive_info->source_log_port, receive_info->is_lag, receive_info->source_lag_port);
-
-                if (g_notification_callbacks.on_packet_event) {
-                    g_notification_callbacks.on_packet_event(switch_id,
-                                                             packet_size,
-                                                             p_packet,
-                                                             RECV_ATTRIBS_NUM,
-                                                             callback_data);
-                }
+            if (SX_STATUS_SUCCESS != status) {
+                goto out;
             }
         }
     }
 
+    status = g_event_dispatcher.worker_status;
+
 out:
     SX_LOG_NTC("Closing event thread - %s.\n", SX_STATUS_MSG(status));
 
+    mlnx_event_dispatcher_deinit();
+
     if (SX_STATUS_SUCCESS != status) {
         if (g_notification_callbacks.on_switch_shutdown_request) {
             g_notification_callbacks.on_switch_shutdown_request(switch_id);
         }
     }
 
+    if (-1 != epoll_fd) {
+        close(epoll_fd);
+    }
+
     if (SX_STATUS_SUCCESS != (status = sx_api_host_ifc_close(api_handle, &port_channel.channel.fd))) {
         SX_LOG_ERR("host ifc close port fd failed - %s.\n", SX_STATUS_MSG(status));
     }
@@ -3782,14 +4631,6 @@ out:
         free(p_packet);
     }
 
-    if (NULL != fdb_events) {
-        free(fdb_events);
-    }
-
-    if (NULL != attr_list) {
-        free(attr_list);
-    }
-
     free(receive_info);
 
     if (SX_STATUS_SUCCESS != (status = sx_api_close(&api_handle))) {
@@ -3944,8 +4785,12 @@ static void sai_buffer_db_pointers_init()
                                                         (1 +
                                                          (MAX_PORTS *
                                                           mlnx_sai_get_buffer_resource_limits()->max_buffers_per_port)));
-    g_sai_buffer_db_ptr->pool_allocation = (bool*)(g_sai_buffer_db_ptr->port_buffer_data +
-                                                   BUFFER_DB_PER_PORT_PROFILE_INDEX_ARRAY_SIZE * MAX_PORTS);
+    g_sai_buffer_db_ptr->buffer_profile_refs = g_sai_buffer_db_ptr->port_buffer_data +
+                                               BUFFER_DB_PER_PORT_PROFILE_INDEX_ARRAY_SIZE * MAX_PORTS;
+    g_sai_buffer_db_ptr->buffer_ref_slots = (mlnx_sai_buffer_ref_slot_t*)(g_sai_buffer_db_ptr->buffer_profile_refs +
+                                                                          mlnx_sai_get_buffer_profile_number());
+    g_sai_buffer_db_ptr->pool_allocation = (bool*)(g_sai_buffer_db_ptr->buffer_ref_slots +
+                                                   BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE * MAX_PORTS);
 }
 
 static sai_status_t sai_buffer_db_unload(boolean_t erase_db)
@@ -3991,6 +4836,11 @@ static uint32_t sai_buffer_db_size_get()
          *  for each port - 3 arrays holding references to buffer profiles, see comments on sai_buffer_db_t.port_buffer_data
          */
         sizeof(uint32_t) * BUFFER_DB_PER_PORT_PROFILE_INDEX_ARRAY_SIZE * MAX_PORTS +
+        /*
+         *  reverse reference index, see comments on sai_buffer_db_t.buffer_profile_refs
+         */
+        sizeof(uint32_t) * mlnx_sai_get_buffer_profile_number() +
+        sizeof(mlnx_sai_buffer_ref_slot_t) * BUFFER_DB_PER_PORT_REF_SLOT_ARRAY_SIZE * MAX_PORTS +
         /*size for pool db flags + 1 bool field for flag specifying whether has user ever called create_pool function.*/
         sizeof(bool) *
         (1 + mlnx_sai_get_buffer_resource_limits()->num_ingress_pools +
@@ -4082,6 +4932,7 @@ static uint32_t sai_acl_db_size_get()
     return (sizeof(acl_table_db_t) * ACL_TABLE_DB_SIZE +
             sizeof(acl_entry_db_t) * ACL_ENTRY_DB_SIZE +
             sizeof(acl_setting_tbl_t) +
+            sizeof(uint64_t) * ACL_PSORT_OPT_RING_SIZE +
             sizeof(acl_pbs_map_entry_t) * (ACL_PBS_MAP_PREDEF_REG_SIZE + g_sai_acl_db_pbs_map_size) +
             (sizeof(acl_bind_points_db_t) + sizeof(acl_bind_point_t) * ACL_RIF_COUNT) +
             (sizeof(acl_group_db_t) + sizeof(acl_group_member_t) *
@@ -4108,8 +4959,11 @@ static void sai_acl_db_init()
     g_sai_acl_db_ptr->acl_settings_tbl = (acl_setting_tbl_t*)((uint8_t*)g_sai_acl_db_ptr->acl_entry_db +
                                                               sizeof(acl_entry_db_t) * ACL_ENTRY_DB_SIZE);
 
-    g_sai_acl_db_ptr->acl_pbs_map_db = (acl_pbs_map_entry_t*)((uint8_t*)g_sai_acl_db_ptr->acl_settings_tbl +
-                                                              sizeof(acl_setting_tbl_t));
+    g_sai_acl_db_ptr->acl_psort_opt_ring = (uint64_t*)((uint8_t*)g_sai_acl_db_ptr->acl_settings_tbl +
+                                                       sizeof(acl_setting_tbl_t));
+
+    g_sai_acl_db_ptr->acl_pbs_map_db = (acl_pbs_map_entry_t*)((uint8_t*)g_sai_acl_db_ptr->acl_psort_opt_ring +
+                                                              sizeof(uint64_t) * ACL_PSORT_OPT_RING_SIZE);
 
     g_sai_acl_db_ptr->acl_bind_points = (acl_bind_points_db_t*)((uint8_t*)g_sai_acl_db_ptr->acl_pbs_map_db +
                                                                 (sizeof(acl_pbs_map_entry_t) *
@@ -4228,7 +5082,9 @@ static uint32_t sai_tunnel_db_size_get()
     return (sizeof(mlnx_tunneltable_t) * MLNX_TUNNELTABLE_SIZE +
             sizeof(mlnx_tunnel_entry_t) * MAX_TUNNEL_DB_SIZE +
             sizeof(mlnx_tunnel_map_t) * MLNX_TUNNEL_MAP_MAX +
-            sizeof(mlnx_tunnel_map_entry_t) * MLNX_TUNNEL_MAP_ENTRY_MAX);
+            sizeof(mlnx_tunnel_map_entry_t) * MLNX_TUNNEL_MAP_ENTRY_MAX +
+            sizeof(mlnx_tunnel_map_entry_index_t) +
+            sizeof(uint32_t) * MLNX_TUNNEL_MAP_ENTRY_MAX * 2);
 }
 
 static void sai_tunnel_db_init()
@@ -4245,6 +5101,16 @@ static void sai_tunnel_db_init()
         (mlnx_tunnel_map_entry_t*)((uint8_t*)g_sai_tunnel_db_ptr->tunnel_map_db +
                                    sizeof(mlnx_tunnel_map_t) *
                                    MLNX_TUNNEL_MAP_MAX);
+
+    g_sai_tunnel_db_ptr->tunnel_map_entry_index =
+        (mlnx_tunnel_map_entry_index_t*)((uint8_t*)g_sai_tunnel_db_ptr->tunnel_map_entry_db +
+                                         sizeof(mlnx_tunnel_map_entry_t) * MLNX_TUNNEL_MAP_ENTRY_MAX);
+
+    g_sai_tunnel_db_ptr->tunnel_map_entry_key_hash =
+        (uint32_t*)((uint8_t*)g_sai_tunnel_db_ptr->tunnel_map_entry_index + sizeof(mlnx_tunnel_map_entry_index_t));
+
+    g_sai_tunnel_db_ptr->tunnel_map_entry_pair_hash =
+        g_sai_tunnel_db_ptr->tunnel_map_entry_key_hash + MLNX_TUNNEL_MAP_ENTRY_MAX;
 }
 
 static sai_status_t sai_tunnel_db_create()
@@ -4926,6 +5792,11 @@ static sai_status_t mlnx_connect_switch(sai_object_id_t switch_id)
         if (SAI_ERR(status)) {
             return status;
         }
+
+        status = mlnx_acl_connect();
+        if (SAI_ERR(status)) {
+            return status;
+        }
     }
 
     SX_LOG_NTC("Connect switch\n");
@@ -5265,6 +6136,10 @@ static sai_status_t mlnx_shutdown_switch(void)
         SX_LOG_ERR("ACL DB deinit failed.\n");
     }
 
+    /* Next hop group shadow is kept in SAI DB, pending lists are dropped with it */
+    mlnx_next_hop_group_shadow_deinit();
+    mlnx_route_shadow_deinit();
+
     sai_qos_db_unload(true);
     sai_buffer_db_unload(true);
     sai_acl_db_unload(true);
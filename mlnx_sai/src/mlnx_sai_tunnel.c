@@ -742,7 +742,7 @@ static sai_status_t mlnx_get_sai_tunnel_map_entry_db_idx(_In_ sai_object_id_t sa
     }
 
     if (MLNX_TUNNEL_MAP_ENTRY_MAX <= tunnel_map_entry_idx) {
-        SX_LOG_ERR("tunnel map entry idx %d is bigger than upper bound %d\n",
+        SX_LOG_ERR("tunnel map entry idx %d is bigger than upper bound %u\n",
                    tunnel_map_entry_idx,
                    MLNX_TUNNEL_MAP_ENTRY_MAX);
         SX_LOG_EXIT();
@@ -4064,32 +4064,183 @@ static sai_status_t mlnx_sai_tunnel_map_entry_pair_already_exist(_In_  uint32_t
     return SAI_STATUS_SUCCESS;
 }
 
+static uint32_t mlnx_tunnel_map_entry_hash(_In_ uint64_t key1, _In_ uint64_t key2)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    uint32_t ii;
+
+    for (ii = 0; ii < sizeof(key1); ii++) {
+        hash = (hash ^ ((key1 >> (ii * 8)) & 0xff)) * 0x100000001b3ULL;
+    }
+
+    for (ii = 0; ii < sizeof(key2); ii++) {
+        hash = (hash ^ ((key2 >> (ii * 8)) & 0xff)) * 0x100000001b3ULL;
+    }
+
+    return (uint32_t)((hash ^ (hash >> 32)) % MLNX_TUNNEL_MAP_ENTRY_MAX);
+}
+
+static uint64_t mlnx_tunnel_map_entry_key_get(_In_ const mlnx_tunnel_map_entry_t *mlnx_tunnel_map_entry)
+{
+    switch (mlnx_tunnel_map_entry->tunnel_map_type) {
+    case SAI_TUNNEL_MAP_TYPE_OECN_TO_UECN:
+        return mlnx_tunnel_map_entry->oecn_key;
+
+    case SAI_TUNNEL_MAP_TYPE_UECN_OECN_TO_OECN:
+        return ((uint64_t)mlnx_tunnel_map_entry->uecn_key << 8) | mlnx_tunnel_map_entry->oecn_key;
+
+    case SAI_TUNNEL_MAP_TYPE_VLAN_ID_TO_VNI:
+        return mlnx_tunnel_map_entry->vlan_id_key;
+
+    case SAI_TUNNEL_MAP_TYPE_VNI_TO_VLAN_ID:
+    case SAI_TUNNEL_MAP_TYPE_VNI_TO_BRIDGE_IF:
+        return mlnx_tunnel_map_entry->vni_id_key;
+
+    case SAI_TUNNEL_MAP_TYPE_BRIDGE_IF_TO_VNI:
+        return mlnx_tunnel_map_entry->bridge_id_key;
+
+    default:
+        return 0;
+    }
+}
+
+/* Only VNI to bridge and bridge to VNI entries are paired, the pair shares the same (VNI, bridge) */
+static bool mlnx_tunnel_map_entry_pair_key_get(_In_ const mlnx_tunnel_map_entry_t *mlnx_tunnel_map_entry,
+                                               _Out_ uint32_t                     *vni_id,
+                                               _Out_ sai_object_id_t              *bridge_id)
+{
+    switch (mlnx_tunnel_map_entry->tunnel_map_type) {
+    case SAI_TUNNEL_MAP_TYPE_VNI_TO_BRIDGE_IF:
+        *vni_id    = mlnx_tunnel_map_entry->vni_id_key;
+        *bridge_id = mlnx_tunnel_map_entry->bridge_id_value;
+        return true;
+
+    case SAI_TUNNEL_MAP_TYPE_BRIDGE_IF_TO_VNI:
+        *vni_id    = mlnx_tunnel_map_entry->vni_id_value;
+        *bridge_id = mlnx_tunnel_map_entry->bridge_id_key;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+static uint32_t* mlnx_tunnel_map_entry_key_bucket(_In_ const mlnx_tunnel_map_entry_t *mlnx_tunnel_map_entry)
+{
+    return &g_sai_tunnel_db_ptr->tunnel_map_entry_key_hash[
+        mlnx_tunnel_map_entry_hash(mlnx_tunnel_map_entry->tunnel_map_id,
+                                   mlnx_tunnel_map_entry_key_get(mlnx_tunnel_map_entry))];
+}
+
+/* This function needs to be guarded by lock */
+static bool mlnx_tunnel_map_entry_key_find(_In_ const mlnx_tunnel_map_entry_t *mlnx_tunnel_map_entry,
+                                           _Out_ uint32_t                     *tunnel_map_entry_idx)
+{
+    const mlnx_tunnel_map_entry_t *curr;
+    uint64_t                       key = mlnx_tunnel_map_entry_key_get(mlnx_tunnel_map_entry);
+    uint32_t                       idx;
+
+    for (idx = *mlnx_tunnel_map_entry_key_bucket(mlnx_tunnel_map_entry);
+         idx != MLNX_TUNNEL_MAP_ENTRY_INVALID;
+         idx = curr->key_hash_next_idx) {
+        curr = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx];
+
+        if ((curr->tunnel_map_id == mlnx_tunnel_map_entry->tunnel_map_id) &&
+            (curr->tunnel_map_type == mlnx_tunnel_map_entry->tunnel_map_type) &&
+            (mlnx_tunnel_map_entry_key_get(curr) == key)) {
+            *tunnel_map_entry_idx = idx;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void mlnx_tunnel_map_entry_chain_unlink(_Inout_ uint32_t *bucket,
+                                               _In_ uint32_t     tunnel_map_entry_idx,
+                                               _In_ bool         is_key_chain)
+{
+    mlnx_tunnel_map_entry_t *curr;
+    uint32_t                *link = bucket;
+
+    while (*link != MLNX_TUNNEL_MAP_ENTRY_INVALID) {
+        curr = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[*link];
+
+        if (*link == tunnel_map_entry_idx) {
+            *link = is_key_chain ? curr->key_hash_next_idx : curr->pair_hash_next_idx;
+            return;
+        }
+
+        link = is_key_chain ? &curr->key_hash_next_idx : &curr->pair_hash_next_idx;
+    }
+
+    assert(false);
+}
+
+/* This function needs to be guarded by lock, entry must be filled */
+static void mlnx_tunnel_map_entry_index_add(_In_ uint32_t tunnel_map_entry_idx)
+{
+    mlnx_tunnel_map_entry_t *mlnx_tunnel_map_entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx];
+    uint32_t                *bucket;
+    uint32_t                 vni_id;
+    sai_object_id_t          bridge_id;
+
+    bucket                                   = mlnx_tunnel_map_entry_key_bucket(mlnx_tunnel_map_entry);
+    mlnx_tunnel_map_entry->key_hash_next_idx = *bucket;
+    *bucket                                  = tunnel_map_entry_idx;
+
+    if (mlnx_tunnel_map_entry_pair_key_get(mlnx_tunnel_map_entry, &vni_id, &bridge_id)) {
+        bucket = &g_sai_tunnel_db_ptr->tunnel_map_entry_pair_hash[mlnx_tunnel_map_entry_hash(vni_id, bridge_id)];
+        mlnx_tunnel_map_entry->pair_hash_next_idx = *bucket;
+        *bucket                                   = tunnel_map_entry_idx;
+    }
+}
+
+/* This function needs to be guarded by lock */
+static void mlnx_tunnel_map_entry_index_del(_In_ uint32_t tunnel_map_entry_idx)
+{
+    mlnx_tunnel_map_entry_t *mlnx_tunnel_map_entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx];
+    uint32_t                 vni_id;
+    sai_object_id_t          bridge_id;
+
+    mlnx_tunnel_map_entry_chain_unlink(mlnx_tunnel_map_entry_key_bucket(mlnx_tunnel_map_entry),
+                                       tunnel_map_entry_idx, true);
+    mlnx_tunnel_map_entry->key_hash_next_idx = MLNX_TUNNEL_MAP_ENTRY_INVALID;
+
+    if (mlnx_tunnel_map_entry_pair_key_get(mlnx_tunnel_map_entry, &vni_id, &bridge_id)) {
+        mlnx_tunnel_map_entry_chain_unlink(
+            &g_sai_tunnel_db_ptr->tunnel_map_entry_pair_hash[mlnx_tunnel_map_entry_hash(vni_id, bridge_id)],
+            tunnel_map_entry_idx, false);
+        mlnx_tunnel_map_entry->pair_hash_next_idx = MLNX_TUNNEL_MAP_ENTRY_INVALID;
+    }
+}
+
 /* This function needs to be guarded by lock */
 static sai_status_t mlnx_sai_tunnel_map_entry_find_pair(_In_  uint32_t  tunnel_map_entry_idx,
                                                         _In_  uint32_t  tunnel_idx,
                                                         _Out_ bool     *pair_exist,
                                                         _Out_ uint32_t *pair_map_idx)
 {
-    mlnx_tunnel_map_entry_t curr_tunnel_map_entry;
-    mlnx_tunnel_map_entry_t pair_tunnel_map_entry;
-    mlnx_tunnel_map_t       curr_tunnel_map;
-    sai_status_t            sai_status;
-    uint32_t                opposite_dir_tunnel_map_cnt = 0;
-    sai_object_id_t        *opposite_dir_tunnel_map_array;
-    uint32_t                ii = 0;
-    uint32_t                jj = 0;
-    sai_object_id_t         tunnel_map_oid;
+    mlnx_tunnel_map_entry_t *curr_tunnel_map_entry;
+    mlnx_tunnel_map_entry_t *pair_tunnel_map_entry;
+    uint32_t                 opposite_dir_tunnel_map_cnt = 0;
+    sai_object_id_t         *opposite_dir_tunnel_map_array;
+    uint32_t                 pair_tunnel_map_pos;
+    uint32_t                 ii = 0;
+    uint32_t                 jj = 0;
+    uint32_t                 vni_id, pair_vni_id;
+    sai_object_id_t          bridge_id, pair_bridge_id;
 
     SX_LOG_ENTER();
 
     assert(NULL != pair_exist);
     assert(NULL != pair_map_idx);
 
-    memcpy(&curr_tunnel_map_entry, &g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx], sizeof(curr_tunnel_map_entry));
+    curr_tunnel_map_entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx];
 
-    assert(curr_tunnel_map_entry.in_use);
+    assert(curr_tunnel_map_entry->in_use);
 
-    switch (curr_tunnel_map_entry.tunnel_map_type) {
+    switch (curr_tunnel_map_entry->tunnel_map_type) {
     case SAI_TUNNEL_MAP_TYPE_VNI_TO_BRIDGE_IF:
         opposite_dir_tunnel_map_cnt = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_encap_cnt;
         opposite_dir_tunnel_map_array = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_encap_id_array;
@@ -4099,46 +4250,38 @@ static sai_status_t mlnx_sai_tunnel_map_entry_find_pair(_In_  uint32_t  tunnel_m
         opposite_dir_tunnel_map_array = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_decap_id_array;
         break;
     default:
-        g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx].pair_per_vxlan_array[tunnel_idx].pair_exist = false;
+        curr_tunnel_map_entry->pair_per_vxlan_array[tunnel_idx].pair_exist = false;
         *pair_exist = false;
         SX_LOG_EXIT();
         return SAI_STATUS_SUCCESS;
     }
 
-    for (ii = 0; ii < opposite_dir_tunnel_map_cnt; ii++) {
-        tunnel_map_oid = opposite_dir_tunnel_map_array[ii];
+    mlnx_tunnel_map_entry_pair_key_get(curr_tunnel_map_entry, &vni_id, &bridge_id);
 
-        if (SAI_STATUS_SUCCESS !=
-            (sai_status = mlnx_tunnel_map_db_param_get(tunnel_map_oid, &curr_tunnel_map))) {
-            SX_LOG_ERR("Fail to get mlnx tunnel map for tunnel map obj id %" PRIx64 "\n", tunnel_map_oid);
-            SX_LOG_EXIT();
-            return sai_status;
+    /* Candidates share the (VNI, bridge) bucket, the first matching opposite direction map of the tunnel wins */
+    pair_tunnel_map_pos = opposite_dir_tunnel_map_cnt;
+    for (jj = g_sai_tunnel_db_ptr->tunnel_map_entry_pair_hash[mlnx_tunnel_map_entry_hash(vni_id, bridge_id)];
+         jj != MLNX_TUNNEL_MAP_ENTRY_INVALID;
+         jj = pair_tunnel_map_entry->pair_hash_next_idx) {
+        pair_tunnel_map_entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[jj];
+        assert(pair_tunnel_map_entry->in_use);
+
+        if ((pair_tunnel_map_entry->tunnel_map_type == curr_tunnel_map_entry->tunnel_map_type) ||
+            !mlnx_tunnel_map_entry_pair_key_get(pair_tunnel_map_entry, &pair_vni_id, &pair_bridge_id) ||
+            (pair_vni_id != vni_id) || (pair_bridge_id != bridge_id)) {
+            continue;
         }
-        for (jj = curr_tunnel_map.tunnel_map_entry_head_idx;
-             jj != MLNX_TUNNEL_MAP_ENTRY_INVALID;
-             jj = g_sai_tunnel_db_ptr->tunnel_map_entry_db[jj].next_tunnel_map_entry_idx) {
-            memcpy(&pair_tunnel_map_entry, &g_sai_tunnel_db_ptr->tunnel_map_entry_db[jj], sizeof(pair_tunnel_map_entry));
-            assert(pair_tunnel_map_entry.in_use);
-
-            if (SAI_TUNNEL_MAP_TYPE_VNI_TO_BRIDGE_IF == curr_tunnel_map_entry.tunnel_map_type) {
-                if ((curr_tunnel_map_entry.bridge_id_value == pair_tunnel_map_entry.bridge_id_key) &&
-                    (curr_tunnel_map_entry.vni_id_key == pair_tunnel_map_entry.vni_id_value)) {
-                    *pair_map_idx = jj;
-                    *pair_exist = true;
-                    SX_LOG_EXIT();
-                    return SAI_STATUS_SUCCESS;
-                }
-            } else if (SAI_TUNNEL_MAP_TYPE_BRIDGE_IF_TO_VNI == curr_tunnel_map_entry.tunnel_map_type) {
-                if ((curr_tunnel_map_entry.bridge_id_key == pair_tunnel_map_entry.bridge_id_value) &&
-                    (curr_tunnel_map_entry.vni_id_value == pair_tunnel_map_entry.vni_id_key)) {
-                    *pair_map_idx = jj;
-                    *pair_exist = true;
-                    SX_LOG_EXIT();
-                    return SAI_STATUS_SUCCESS;
-                }
+
+        for (ii = 0; ii < pair_tunnel_map_pos; ii++) {
+            if (opposite_dir_tunnel_map_array[ii] == pair_tunnel_map_entry->tunnel_map_id) {
+                pair_tunnel_map_pos = ii;
+                *pair_map_idx       = jj;
+                *pair_exist         = true;
+                break;
             }
         }
     }
+
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -6544,30 +6687,61 @@ static sai_status_t mlnx_get_tunnel_term_table_entry_attribute(
     return sai_status;
 }
 
-/* caller of this function should use read lock to guard the callsite */
+/* Called once on the newly created tunnel DB, all entries are chained into the free list */
+void mlnx_tunnel_map_entry_db_init(void)
+{
+    mlnx_tunnel_map_entry_index_t *index = g_sai_tunnel_db_ptr->tunnel_map_entry_index;
+    uint32_t                       idx;
+
+    for (idx = MLNX_TUNNEL_MAP_ENTRY_MIN; idx < MLNX_TUNNEL_MAP_ENTRY_MAX - 1; idx++) {
+        g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx].next_tunnel_map_entry_idx = idx + 1;
+    }
+    g_sai_tunnel_db_ptr->tunnel_map_entry_db[MLNX_TUNNEL_MAP_ENTRY_MAX - 1].next_tunnel_map_entry_idx =
+        MLNX_TUNNEL_MAP_ENTRY_INVALID;
+
+    index->free_head_idx = MLNX_TUNNEL_MAP_ENTRY_MIN;
+    index->free_cnt      = MLNX_TUNNEL_MAP_ENTRY_MAX - MLNX_TUNNEL_MAP_ENTRY_MIN;
+}
+
+/* caller of this function should use write lock to guard the callsite */
 static sai_status_t mlnx_create_empty_tunnel_map_entry(_Out_ uint32_t *tunnel_map_entry_idx)
 {
-    uint32_t     idx        = 0;
-    sai_status_t sai_status = SAI_STATUS_FAILURE;
+    mlnx_tunnel_map_entry_index_t *index = g_sai_tunnel_db_ptr->tunnel_map_entry_index;
+    uint32_t                       idx;
 
     SX_LOG_ENTER();
 
-    for (idx = MLNX_TUNNEL_MAP_ENTRY_MIN; idx < MLNX_TUNNEL_MAP_ENTRY_MAX; idx++) {
-        if (!g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx].in_use) {
-            *tunnel_map_entry_idx = idx;
-            sai_status            = SAI_STATUS_SUCCESS;
-            goto cleanup;
-        }
+    idx = index->free_head_idx;
+    if (MLNX_TUNNEL_MAP_ENTRY_INVALID == idx) {
+        SX_LOG_ERR(
+            "Not enough resources for sai tunnel map entry, at most %u sai tunnel map entry objs can be created\n",
+            MLNX_TUNNEL_MAP_ENTRY_MAX - MLNX_TUNNEL_MAP_ENTRY_MIN);
+        SX_LOG_EXIT();
+        return SAI_STATUS_INSUFFICIENT_RESOURCES;
     }
 
-    SX_LOG_ERR(
-        "Not enough resources for sai tunnel map entry, at most %d sai tunnel map entry objs can be created\n",
-        MLNX_TUNNEL_MAP_ENTRY_MAX);
-    sai_status = SAI_STATUS_INSUFFICIENT_RESOURCES;
+    assert(!g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx].in_use);
+
+    index->free_head_idx = g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx].next_tunnel_map_entry_idx;
+    index->free_cnt--;
+    g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx].next_tunnel_map_entry_idx = MLNX_TUNNEL_MAP_ENTRY_INVALID;
+
+    *tunnel_map_entry_idx = idx;
 
-cleanup:
     SX_LOG_EXIT();
-    return sai_status;
+    return SAI_STATUS_SUCCESS;
+}
+
+/* caller of this function should use write lock to guard the callsite */
+static void mlnx_free_tunnel_map_entry(_In_ uint32_t tunnel_map_entry_idx)
+{
+    mlnx_tunnel_map_entry_index_t *index = g_sai_tunnel_db_ptr->tunnel_map_entry_index;
+
+    memset(&g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx], 0, sizeof(mlnx_tunnel_map_entry_t));
+
+    g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx].next_tunnel_map_entry_idx = index->free_head_idx;
+    index->free_head_idx = tunnel_map_entry_idx;
+    index->free_cnt++;
 }
 
 static sai_status_t mlnx_validate_tunnel_map_condition(_In_ sai_status_t sai_status, _In_ bool condition)
@@ -7005,6 +7179,7 @@ static sai_status_t mlnx_create_tunnel_map_entry(_Out_ sai_object_id_t      *sai
     mlnx_tunnel_map_entry_t mlnx_tunnel_map_entry;
     bool                    is_add                      = true;
     bool                    tunnel_map_entry_created    = false;
+    bool                    tunnel_map_entry_indexed    = false;
     bool                    tunnel_map_entry_list_added = false;
     bool                    tunnel_map_entry_bound      = false;
     uint32_t                tunnel_map_idx              = 0;
@@ -7039,6 +7214,13 @@ static sai_status_t mlnx_create_tunnel_map_entry(_Out_ sai_object_id_t      *sai
 
     sai_db_write_lock();
 
+    if (mlnx_tunnel_map_entry_key_find(&mlnx_tunnel_map_entry, &tunnel_map_entry_idx)) {
+        SX_LOG_ERR("Tunnel map entry with the same key already exists in tunnel map %" PRIx64 " (idx %d)\n",
+                   mlnx_tunnel_map_entry.tunnel_map_id, tunnel_map_entry_idx);
+        sai_status = SAI_STATUS_ITEM_ALREADY_EXISTS;
+        goto cleanup_exit;
+    }
+
     g_sai_tunnel_db_ptr->tunnel_map_db[tunnel_map_idx].tunnel_map_entry_cnt++;
 
     if (SAI_STATUS_SUCCESS !=
@@ -7052,8 +7234,6 @@ static sai_status_t mlnx_create_tunnel_map_entry(_Out_ sai_object_id_t      *sai
         (sai_status =
              mlnx_create_object(SAI_OBJECT_TYPE_TUNNEL_MAP_ENTRY, tunnel_map_entry_idx, NULL,
                                 sai_tunnel_map_entry_obj_id))) {
-        memset(&g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx], 0,
-               sizeof(mlnx_tunnel_map_entry_t));
         SX_LOG_ERR("Error creating sai tunnel map entry obj id from tunnel map entry idx %d\n",
                    tunnel_map_entry_idx);
         goto cleanup;
@@ -7061,6 +7241,8 @@ static sai_status_t mlnx_create_tunnel_map_entry(_Out_ sai_object_id_t      *sai
 
     memcpy(&g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx], &mlnx_tunnel_map_entry,
            sizeof(mlnx_tunnel_map_entry_t));
+    mlnx_tunnel_map_entry_index_add(tunnel_map_entry_idx);
+    tunnel_map_entry_indexed = true;
 
     if (SAI_STATUS_SUCCESS !=
         (sai_status =
@@ -7101,9 +7283,11 @@ cleanup:
             goto cleanup_exit;
         }
     }
+    if (tunnel_map_entry_indexed) {
+        mlnx_tunnel_map_entry_index_del(tunnel_map_entry_idx);
+    }
     if (tunnel_map_entry_created) {
-        memset(&g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx], 0,
-               sizeof(mlnx_tunnel_map_entry_t));
+        mlnx_free_tunnel_map_entry(tunnel_map_entry_idx);
     }
     g_sai_tunnel_db_ptr->tunnel_map_db[tunnel_map_idx].tunnel_map_entry_cnt--;
 cleanup_exit:
@@ -7195,7 +7379,8 @@ static sai_status_t mlnx_remove_tunnel_map_entry(_In_ sai_object_id_t sai_tunnel
         }
     }
 
-    memset(&g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx], 0, sizeof(mlnx_tunnel_map_entry_t));
+    mlnx_tunnel_map_entry_index_del(tunnel_map_entry_idx);
+    mlnx_free_tunnel_map_entry(tunnel_map_entry_idx);
 
     SX_LOG_NTC("Removed SAI tunnel map entry obj id %" PRIx64 "\n", sai_tunnel_map_entry_obj_id);
 
@@ -25,6 +25,8 @@
 #include "inttypes.h"
 #ifndef WIN32
 #include <arpa/inet.h>
+#include <pthread.h>
+#include <time.h>
 #else
 #include <Ws2tcpip.h>
 #endif
@@ -376,7 +378,7 @@ static sai_status_t sai_attribute_is_valid_for_set(_In_ const sai_attr_metadata_
 static sai_status_t sai_attribute_is_empty_list_allowed(_In_ const sai_attr_metadata_t *attr_metadata,
                                                         _Out_ bool                     *is_allowed);
 static sai_status_t sai_attrlist_mandatory_attrs_check(
-    _In_reads_z_(attr_count_meta) const bool       *attr_present_meta,
+    _In_reads_z_(attr_count_meta) const uint32_t   *attr_present_meta,
     _In_ uint32_t                                   attr_count_meta,
     _In_reads_z_(attr_count) const sai_attribute_t *attr_list,
     _In_ uint32_t                                   attr_count,
@@ -870,6 +872,264 @@ static sai_status_t sai_vendor_attr_index_find(_In_ const sai_attr_id_t
     return SAI_STATUS_ITEM_NOT_FOUND;
 }
 
+/*
+ * Direct-indexed attribute dispatch tables.
+ * Built once in sai_api_initialize, per object type:
+ *   meta_index[attr_id - attr_id_start]   -> index in sai_metadata_attr_by_object_type[type]
+ *   vendor_index[attr_id - attr_id_start] -> index in the object type vendor attributes array
+ *   short_names[meta_index]               -> attribute short name (for logging)
+ * Attribute ids outside of [attr_id_start, attr_id_start + attr_id_count) (e.g. custom range)
+ * and vendor arrays that differ from mlnx_obj_types_info[type]->vendor_data fall back to a linear search.
+ */
+#define MLNX_ATTR_DISPATCH_INDEX_INVALID (UINT16_MAX)
+/* Max number of attributes (including ACL UDF) for a single object type in the metadata */
+#define MLNX_ATTR_META_COUNT_MAX (1024)
+
+typedef struct _mlnx_attr_dispatch_table_t {
+    const sai_vendor_attribute_entry_t *vendor_data;
+    sai_attr_id_t                       attr_id_start;
+    uint32_t                            attr_id_count;
+    uint32_t                            attr_count_meta;
+    uint16_t                           *meta_index;
+    uint16_t                           *vendor_index;
+    const char                        **short_names;
+} mlnx_attr_dispatch_table_t;
+
+static mlnx_attr_dispatch_table_t mlnx_attr_dispatch_tables[SAI_OBJECT_TYPE_EXTENSIONS_RANGE_END];
+
+static const mlnx_attr_dispatch_table_t* mlnx_attr_dispatch_table_get(_In_ sai_object_type_t object_type)
+{
+    if ((uint32_t)object_type >= ARRAY_SIZE(mlnx_attr_dispatch_tables)) {
+        return NULL;
+    }
+
+    if (NULL == mlnx_attr_dispatch_tables[object_type].meta_index) {
+        return NULL;
+    }
+
+    return &mlnx_attr_dispatch_tables[object_type];
+}
+
+static sai_status_t mlnx_attr_dispatch_table_init(_In_ sai_object_type_t                   object_type,
+                                                  _In_ const sai_vendor_attribute_entry_t *vendor_data,
+                                                  _Out_ mlnx_attr_dispatch_table_t        *table)
+{
+    sai_status_t                      status;
+    const sai_object_type_info_t     *object_type_info;
+    const sai_attr_metadata_t* const *md;
+    sai_attr_id_t                     attr_id, udf_attr_min;
+    uint32_t                          attr_count_meta, ii, jj;
+
+    assert(vendor_data);
+    assert(table);
+
+    object_type_info = sai_metadata_all_object_type_infos[object_type];
+    md               = sai_metadata_attr_by_object_type[object_type];
+    if ((NULL == object_type_info) || (NULL == md) ||
+        (object_type_info->attridend <= object_type_info->attridstart)) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    status = sai_object_type_attr_count_meta_get(object_type, &attr_count_meta);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    if (MLNX_ATTR_META_COUNT_MAX < attr_count_meta) {
+        SX_LOG_ERR("Object type %s has %u attributes, max supported is %u\n", SAI_TYPE_STR(object_type),
+                   attr_count_meta, MLNX_ATTR_META_COUNT_MAX);
+        return SAI_STATUS_FAILURE;
+    }
+
+    table->vendor_data     = vendor_data;
+    table->attr_id_start   = object_type_info->attridstart;
+    table->attr_id_count   = object_type_info->attridend - object_type_info->attridstart;
+    table->attr_count_meta = attr_count_meta;
+
+    table->meta_index   = malloc(sizeof(*table->meta_index) * table->attr_id_count);
+    table->vendor_index = malloc(sizeof(*table->vendor_index) * table->attr_id_count);
+    table->short_names  = calloc(attr_count_meta, sizeof(*table->short_names));
+    if ((NULL == table->meta_index) || (NULL == table->vendor_index) || (NULL == table->short_names)) {
+        SX_LOG_ERR("Failed to allocate memory for %s attribute dispatch table\n", SAI_TYPE_STR(object_type));
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    for (ii = 0; ii < table->attr_id_count; ii++) {
+        table->meta_index[ii]   = MLNX_ATTR_DISPATCH_INDEX_INVALID;
+        table->vendor_index[ii] = MLNX_ATTR_DISPATCH_INDEX_INVALID;
+    }
+
+    for (ii = 0; md[ii] != NULL; ii++) {
+        attr_id = md[ii]->attrid;
+        if ((attr_id < table->attr_id_start) || (table->attr_id_start + table->attr_id_count <= attr_id)) {
+            continue;
+        }
+
+        table->meta_index[attr_id - table->attr_id_start] = (uint16_t)ii;
+
+        /* Name is only used for logging, dispatch falls back to a lookup when it's missing */
+        if (SAI_ERR(sai_attribute_short_name_fetch(object_type, attr_id, &table->short_names[ii]))) {
+            table->short_names[ii] = NULL;
+        }
+    }
+
+    /*
+     * Currnetly, metadata for ACL UDF attributes is not generated, they are placed after the generated ones.
+     * The ones that do have metadata keep its index, same as sai_object_type_attr_index_find
+     */
+    if (sai_objet_type_is_acl_table_or_entry(object_type)) {
+        udf_attr_min = (SAI_OBJECT_TYPE_ACL_TABLE == object_type) ?
+                       SAI_ACL_TABLE_ATTR_USER_DEFINED_FIELD_GROUP_MIN : SAI_ACL_ENTRY_ATTR_USER_DEFINED_FIELD_GROUP_MIN;
+
+        for (jj = 0; jj < MLNX_UDF_ACL_ATTR_COUNT; jj++) {
+            attr_id = udf_attr_min + jj;
+
+            if (MLNX_ATTR_DISPATCH_INDEX_INVALID != table->meta_index[attr_id - table->attr_id_start]) {
+                continue;
+            }
+
+            table->meta_index[attr_id - table->attr_id_start] = (uint16_t)(ii + jj);
+
+            if (SAI_ERR(mlnx_sai_udf_attr_short_name_fetch(object_type, attr_id, &table->short_names[ii + jj]))) {
+                table->short_names[ii + jj] = NULL;
+            }
+        }
+    }
+
+    for (ii = 0; END_FUNCTIONALITY_ATTRIBS_ID != vendor_data[ii].id; ii++) {
+        attr_id = vendor_data[ii].id;
+        if ((attr_id < table->attr_id_start) || (table->attr_id_start + table->attr_id_count <= attr_id)) {
+            continue;
+        }
+
+        if (MLNX_ATTR_DISPATCH_INDEX_INVALID <= ii) {
+            SX_LOG_ERR("Vendor attributes array for %s is too big\n", SAI_TYPE_STR(object_type));
+            return SAI_STATUS_FAILURE;
+        }
+
+        table->vendor_index[attr_id - table->attr_id_start] = (uint16_t)ii;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+void mlnx_attr_dispatch_tables_deinit(void)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < ARRAY_SIZE(mlnx_attr_dispatch_tables); ii++) {
+        free(mlnx_attr_dispatch_tables[ii].meta_index);
+        free(mlnx_attr_dispatch_tables[ii].vendor_index);
+        free(mlnx_attr_dispatch_tables[ii].short_names);
+    }
+
+    memset(mlnx_attr_dispatch_tables, 0, sizeof(mlnx_attr_dispatch_tables));
+}
+
+sai_status_t mlnx_attr_dispatch_tables_init(void)
+{
+    sai_status_t                      status;
+    const mlnx_obj_type_attrs_info_t *obj_type_info;
+    uint32_t                          ii;
+
+    memset(mlnx_attr_dispatch_tables, 0, sizeof(mlnx_attr_dispatch_tables));
+
+    for (ii = 0; (ii < mlnx_obj_types_info_arr_size) && (ii < ARRAY_SIZE(mlnx_attr_dispatch_tables)); ii++) {
+        obj_type_info = mlnx_obj_types_info[ii];
+        if ((NULL == obj_type_info) || (NULL == obj_type_info->vendor_data)) {
+            continue;
+        }
+
+        if (!sai_metadata_is_object_type_valid(ii)) {
+            continue;
+        }
+
+        status = mlnx_attr_dispatch_table_init(ii, obj_type_info->vendor_data, &mlnx_attr_dispatch_tables[ii]);
+        if (SAI_ERR(status)) {
+            mlnx_attr_dispatch_tables_deinit();
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_attr_meta_index_get(_In_ sai_object_type_t object_type,
+                                             _In_ sai_attr_id_t     attr_id,
+                                             _Out_ uint32_t        *index)
+{
+    const mlnx_attr_dispatch_table_t *table;
+
+    table = mlnx_attr_dispatch_table_get(object_type);
+    if ((NULL == table) || (attr_id < table->attr_id_start) ||
+        (table->attr_id_start + table->attr_id_count <= attr_id)) {
+        return sai_object_type_attr_index_find(attr_id, object_type, index);
+    }
+
+    if (MLNX_ATTR_DISPATCH_INDEX_INVALID == table->meta_index[attr_id - table->attr_id_start]) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    *index = table->meta_index[attr_id - table->attr_id_start];
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_attr_vendor_index_get(_In_ sai_object_type_t                   object_type,
+                                               _In_ const sai_vendor_attribute_entry_t *vendor_attr,
+                                               _In_ sai_attr_id_t                       attr_id,
+                                               _Out_ uint32_t                          *index)
+{
+    const mlnx_attr_dispatch_table_t *table;
+
+    table = mlnx_attr_dispatch_table_get(object_type);
+    if ((NULL == table) || (table->vendor_data != vendor_attr) || (attr_id < table->attr_id_start) ||
+        (table->attr_id_start + table->attr_id_count <= attr_id)) {
+        return sai_vendor_attr_index_find(attr_id, vendor_attr, index);
+    }
+
+    if (MLNX_ATTR_DISPATCH_INDEX_INVALID == table->vendor_index[attr_id - table->attr_id_start]) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    *index = table->vendor_index[attr_id - table->attr_id_start];
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_attr_short_name_get(_In_ sai_object_type_t object_type,
+                                             _In_ sai_attr_id_t     attr_id,
+                                             _Out_ const char     **attr_short_name)
+{
+    const mlnx_attr_dispatch_table_t *table;
+    sai_status_t                      status;
+    uint32_t                          meta_index;
+
+    table = mlnx_attr_dispatch_table_get(object_type);
+    if (table) {
+        status = mlnx_attr_meta_index_get(object_type, attr_id, &meta_index);
+        if (!SAI_ERR(status) && (meta_index < table->attr_count_meta) && table->short_names[meta_index]) {
+            *attr_short_name = table->short_names[meta_index];
+            return SAI_STATUS_SUCCESS;
+        }
+    }
+
+    return sai_attribute_short_name_fetch(object_type, attr_id, attr_short_name);
+}
+
+static sai_status_t mlnx_attr_count_meta_get(_In_ sai_object_type_t object_type, _Out_ uint32_t *attr_count_meta)
+{
+    const mlnx_attr_dispatch_table_t *table;
+
+    table = mlnx_attr_dispatch_table_get(object_type);
+    if (table) {
+        *attr_count_meta = table->attr_count_meta;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    return sai_object_type_attr_count_meta_get(object_type, attr_count_meta);
+}
+
 sai_status_t check_port_type_attr(const sai_object_id_t *ports,
                                   uint32_t               count,
                                   attr_port_type_check_t check,
@@ -1617,7 +1877,7 @@ static sai_status_t sai_attribute_is_empty_list_allowed(_In_ const sai_attr_meta
 }
 
 static sai_status_t sai_attrlist_mandatory_attrs_check(
-    _In_reads_z_(attr_count_meta) const bool       *attr_present_meta,
+    _In_reads_z_(attr_count_meta) const uint32_t   *attr_present_meta,
     _In_ uint32_t                                   attr_count_meta,
     _In_reads_z_(attr_count) const sai_attribute_t *attr_list,
     _In_ uint32_t                                   attr_count,
@@ -1681,7 +1941,7 @@ static sai_status_t sai_attrlist_mandatory_attrs_check(
                     return status;
                 }
 
-                if (is_mandatory_condtitions_valid && (!attr_present_meta[ii])) {
+                if (is_mandatory_condtitions_valid && (!array_bit_test(attr_present_meta, ii))) {
                     status = sai_attr_metadata_conditions_print(md[ii]->conditiontype,
                                                                 md[ii]->conditions,
                                                                 md[ii]->conditionslength,
@@ -1698,7 +1958,7 @@ static sai_status_t sai_attrlist_mandatory_attrs_check(
                     return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
                 }
             } else {
-                if (!attr_present_meta[ii]) {
+                if (!array_bit_test(attr_present_meta, ii)) {
                     SX_LOG_ERR("Missing mandatory attribute %s on create\n", md[ii]->attridname);
                     return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
                 }
@@ -2088,7 +2348,8 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
     const sai_attr_metadata_t *meta_data;
     sai_attr_flags_t           attr_flags;
     uint32_t                   attr_count_meta, meta_data_index, vendor_attr_index, ii;
-    bool                      *attr_present_meta = NULL, is_valid_for_set;
+    uint32_t                   attr_present_meta[MLNX_U32BITARRAY_SIZE(MLNX_ATTR_META_COUNT_MAX)] = {0};
+    bool                       is_valid_for_set;
 
     SX_LOG_ENTER();
 
@@ -2130,15 +2391,15 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    status = sai_object_type_attr_count_meta_get(object_type, &attr_count_meta);
+    status = mlnx_attr_count_meta_get(object_type, &attr_count_meta);
     if (SAI_ERR(status)) {
         goto out;
     }
 
-    attr_present_meta = calloc(attr_count_meta, sizeof(bool));
-    if (NULL == attr_present_meta) {
-        SX_LOG_ERR("Can't allocate memory\n");
-        status = SAI_STATUS_NO_MEMORY;
+    if (MLNX_ATTR_META_COUNT_MAX < attr_count_meta) {
+        SX_LOG_ERR("Object type %s has %u attributes, max supported is %u\n", SAI_TYPE_STR(object_type),
+                   attr_count_meta, MLNX_ATTR_META_COUNT_MAX);
+        status = SAI_STATUS_FAILURE;
         goto out;
     }
 
@@ -2150,14 +2411,15 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
             goto out;
         }
 
-        status = sai_object_type_attr_index_find(attr_list[ii].id, object_type, &meta_data_index);
+        status = mlnx_attr_meta_index_get(object_type, attr_list[ii].id, &meta_data_index);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Invalid attribute %d (meta data index not found)\n", attr_list[ii].id);
             status = SAI_STATUS_UNKNOWN_ATTRIBUTE_0 + ii;
             goto out;
         }
 
-        status = sai_vendor_attr_index_find(attr_list[ii].id, functionality_vendor_attr, &vendor_attr_index);
+        status = mlnx_attr_vendor_index_get(object_type, functionality_vendor_attr, attr_list[ii].id,
+                                            &vendor_attr_index);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Not implemented attribute %s (vendor data not found)\n", meta_data->attridname);
             status = SAI_STATUS_ATTR_NOT_IMPLEMENTED_0 + ii;
@@ -2203,7 +2465,7 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
             goto out;
         }
 
-        if (attr_present_meta[meta_data_index]) {
+        if (array_bit_test(attr_present_meta, meta_data_index)) {
             SX_LOG_ERR("Attribute %s appears twice in attribute list at index %d\n",
                        meta_data->attridname,
                        ii);
@@ -2223,7 +2485,7 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
             }
         }
 
-        attr_present_meta[meta_data_index] = true;
+        array_bit_set(attr_present_meta, meta_data_index);
     }
 
     if (SAI_COMMON_API_CREATE == oper) {
@@ -2238,8 +2500,6 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
     }
 
 out:
-    free(attr_present_meta);
-
     SX_LOG_EXIT();
     return status;
 }
@@ -2269,7 +2529,7 @@ static sai_status_t set_dispatch_attrib_handler(_In_ const sai_attribute_t
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    status = sai_vendor_attr_index_find(attr->id, functionality_vendor_attr, &index);
+    status = mlnx_attr_vendor_index_get(object_type, functionality_vendor_attr, attr->id, &index);
     if (SAI_ERR(status)) {
         SX_LOG_EXIT();
         return status;
@@ -2281,7 +2541,7 @@ static sai_status_t set_dispatch_attrib_handler(_In_ const sai_attribute_t
         return SAI_STATUS_FAILURE;
     }
 
-    status = sai_attribute_short_name_fetch(object_type, attr->id, &short_attr_name);
+    status = mlnx_attr_short_name_get(object_type, attr->id, &short_attr_name);
     if (SAI_ERR(status)) {
         SX_LOG_EXIT();
         return status;
@@ -2348,7 +2608,7 @@ static sai_status_t get_dispatch_attribs_handler(_In_ uint32_t
     for (ii = 0; ii < attr_count; ii++) {
         attr_id = attr_list[ii].id;
 
-        status = sai_vendor_attr_index_find(attr_id, functionality_vendor_attr, &index);
+        status = mlnx_attr_vendor_index_get(object_type, functionality_vendor_attr, attr_id, &index);
         if (SAI_ERR(status)) {
             SX_LOG_EXIT();
             return status;
@@ -2362,7 +2622,7 @@ static sai_status_t get_dispatch_attribs_handler(_In_ uint32_t
             return SAI_STATUS_FAILURE;
         }
 
-        status = sai_attribute_short_name_fetch(object_type, attr_id, &short_attr_name);
+        status = mlnx_attr_short_name_get(object_type, attr_id, &short_attr_name);
         if (SAI_ERR(status)) {
             SX_LOG_EXIT();
             return status;
@@ -2650,6 +2910,20 @@ sai_status_t mlnx_bulk_statuses_print(_In_ const char         *object_type_str,
     return SAI_STATUS_SUCCESS;
 }
 
+/* Monotonic time in microseconds, for measuring intervals and deadlines */
+uint64_t mlnx_time_us_get(void)
+{
+#ifndef _WIN32
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+#else
+    return 0;
+#endif /* _WIN32 */
+}
+
 static sai_status_t sai_ipv4_to_str(_In_ sai_ip4_t value,
                                     _In_ uint32_t  max_length,
                                     _Out_ char    *value_str,
@@ -3782,6 +4056,111 @@ sai_status_t mlnx_translate_sai_stats_mode_to_sdk(sai_stats_mode_t sai_mode, sx_
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t mlnx_stats_bulk_params_check(_In_ uint32_t               object_count,
+                                          _In_ const sai_object_id_t *object_ids,
+                                          _In_ uint32_t               number_of_counters,
+                                          _In_ const sai_stat_id_t   *counter_ids,
+                                          _In_ const sai_status_t    *object_statuses,
+                                          _In_ const uint64_t        *counters)
+{
+    if (0 == object_count) {
+        SX_LOG_ERR("0 object count param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (NULL == object_ids) {
+        SX_LOG_ERR("NULL object ids array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (NULL == counter_ids) {
+        SX_LOG_ERR("NULL counter ids array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (NULL == object_statuses) {
+        SX_LOG_ERR("NULL object statuses array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (NULL == counters) {
+        SX_LOG_ERR("NULL counters array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static const mlnx_stats_bulk_get_fn mlnx_stats_bulk_get_fns[SAI_OBJECT_TYPE_MAX] = {
+    [SAI_OBJECT_TYPE_PORT]                   = mlnx_get_ports_stats_bulk,
+    [SAI_OBJECT_TYPE_QUEUE]                  = mlnx_get_queues_stats_bulk,
+    [SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP] = mlnx_get_ingress_priority_groups_stats_bulk,
+    [SAI_OBJECT_TYPE_BUFFER_POOL]            = mlnx_get_buffer_pools_stats_bulk,
+    [SAI_OBJECT_TYPE_ROUTER_INTERFACE]       = mlnx_get_router_interfaces_stats_bulk,
+};
+static pthread_mutex_t          mlnx_stats_bulk_timing_lock = PTHREAD_MUTEX_INITIALIZER;
+static mlnx_stats_bulk_timing_t mlnx_stats_bulk_timings[SAI_OBJECT_TYPE_MAX];
+
+/*
+ * Read counters of many objects of one type.
+ * Objects are grouped by port and counter group by the type handler, so each SDK
+ * counter group is read once per sweep rather than once per object.
+ * The single object _ext getters go through here too, so the timings cover every poll.
+ */
+sai_status_t mlnx_bulk_object_get_stats(_In_ sai_object_type_t      object_type,
+                                        _In_ uint32_t               object_count,
+                                        _In_ const sai_object_id_t *object_ids,
+                                        _In_ uint32_t               number_of_counters,
+                                        _In_ const sai_stat_id_t   *counter_ids,
+                                        _In_ sai_stats_mode_t       mode,
+                                        _Out_ sai_status_t         *object_statuses,
+                                        _Out_ uint64_t             *counters)
+{
+    mlnx_stats_bulk_timing_t *timing;
+    sai_status_t              status;
+    uint64_t                  start_us, time_us;
+
+    if ((object_type >= SAI_OBJECT_TYPE_MAX) || (NULL == mlnx_stats_bulk_get_fns[object_type])) {
+        SX_LOG_ERR("Bulk stats are not supported for object type %s\n", SAI_TYPE_STR(object_type));
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    start_us = mlnx_time_us_get();
+
+    status = mlnx_stats_bulk_get_fns[object_type](object_count, object_ids, number_of_counters, counter_ids,
+                                                  mode, object_statuses, counters);
+
+    time_us = mlnx_time_us_get() - start_us;
+
+    pthread_mutex_lock(&mlnx_stats_bulk_timing_lock);
+    timing            = &mlnx_stats_bulk_timings[object_type];
+    timing->polls    += 1;
+    timing->objects  += object_count;
+    timing->last_us   = time_us;
+    timing->total_us += time_us;
+    if (time_us > timing->max_us) {
+        timing->max_us = time_us;
+    }
+    pthread_mutex_unlock(&mlnx_stats_bulk_timing_lock);
+
+    return status;
+}
+
+bool mlnx_stats_bulk_timing_get(_In_ sai_object_type_t object_type, _Out_ mlnx_stats_bulk_timing_t *timing)
+{
+    assert(timing);
+
+    if ((object_type >= SAI_OBJECT_TYPE_MAX) || (NULL == mlnx_stats_bulk_get_fns[object_type])) {
+        return false;
+    }
+
+    pthread_mutex_lock(&mlnx_stats_bulk_timing_lock);
+    *timing = mlnx_stats_bulk_timings[object_type];
+    pthread_mutex_unlock(&mlnx_stats_bulk_timing_lock);
+
+    return true;
+}
+
 sai_status_t mlnx_object_to_type(sai_object_id_t   object_id,
                                  sai_object_type_t type,
                                  uint32_t         *data,
@@ -4086,7 +4465,7 @@ bool mlnx_route_entries_are_equal(_In_ const sai_route_entry_t *u1, _In_ const s
         if (memcmp(u1->destination.addr.ip6, u2->destination.addr.ip6, sizeof(u1->destination.addr.ip6))) {
             return false;
         }
-        if (memcmp(u1->destination.addr.ip6, u2->destination.addr.ip6, sizeof(u1->destination.addr.ip6))) {
+        if (memcmp(u1->destination.mask.ip6, u2->destination.mask.ip6, sizeof(u1->destination.mask.ip6))) {
             return false;
         }
     }
@@ -4119,49 +4498,124 @@ sai_status_t mlnx_attribute_value_list_size_check(_Inout_ uint32_t *out_size, _I
     return status;
 }
 
-static sai_status_t mlnx_fdb_or_route_action_find(_In_ sai_object_type_t type,
-                                                  _In_ const void       *entry,
-                                                  _Out_ uint32_t        *index)
+#define FDB_OR_ROUTE_SAVED_ACTIONS_MASK      (FDB_OR_ROUTE_SAVED_ACTIONS_NUM - 1)
+#define FDB_OR_ROUTE_SAVED_ACTIONS_COUNT_MAX (FDB_OR_ROUTE_SAVED_ACTIONS_NUM / 8 * 7)
+
+static uint32_t mlnx_fdb_or_route_action_hash_add(_In_ uint32_t hash, _In_ const void *data, _In_ uint32_t size)
 {
-    uint32_t               ii;
-    bool                   equal;
-    const sai_fdb_entry_t *saved_fdb_entry, *targed_fdb_entry;
+    const uint8_t *bytes = data;
+    uint32_t       ii;
 
-    assert((SAI_OBJECT_TYPE_FDB_ENTRY == type) || (SAI_OBJECT_TYPE_ROUTE_ENTRY == type));
+    /* FNV-1a */
+    for (ii = 0; ii < size; ii++) {
+        hash ^= bytes[ii];
+        hash *= 16777619;
+    }
 
-    for (ii = 0; ii < g_sai_db_ptr->fdb_or_route_actions.count; ii++) {
-        if (g_sai_db_ptr->fdb_or_route_actions.actions[ii].type != type) {
-            continue;
-        }
+    return hash;
+}
 
-        if (SAI_OBJECT_TYPE_FDB_ENTRY == type) {
-            saved_fdb_entry  = &g_sai_db_ptr->fdb_or_route_actions.actions[ii].fdb_entry;
-            targed_fdb_entry = entry;
+static uint32_t mlnx_fdb_or_route_action_hash(_In_ sai_object_type_t type, _In_ const void *entry)
+{
+    const sai_fdb_entry_t   *fdb_entry;
+    const sai_route_entry_t *route_entry;
+    uint32_t                 hash = 2166136261;
+
+    hash = mlnx_fdb_or_route_action_hash_add(hash, &type, sizeof(type));
 
-            equal = ((0 == memcmp(saved_fdb_entry->mac_address, targed_fdb_entry->mac_address, sizeof(sai_mac_t))) &&
-                     (saved_fdb_entry->bv_id == targed_fdb_entry->bv_id));
+    /* Only the fields compared by find are hashed, the structs may have padding */
+    if (SAI_OBJECT_TYPE_FDB_ENTRY == type) {
+        fdb_entry = entry;
+        hash      = mlnx_fdb_or_route_action_hash_add(hash, fdb_entry->mac_address, sizeof(sai_mac_t));
+        hash      = mlnx_fdb_or_route_action_hash_add(hash, &fdb_entry->bv_id, sizeof(fdb_entry->bv_id));
+    } else {
+        route_entry = entry;
+        hash        = mlnx_fdb_or_route_action_hash_add(hash, &route_entry->vr_id, sizeof(route_entry->vr_id));
+        if (SAI_IP_ADDR_FAMILY_IPV4 == route_entry->destination.addr_family) {
+            hash = mlnx_fdb_or_route_action_hash_add(hash, &route_entry->destination.addr.ip4,
+                                                     sizeof(route_entry->destination.addr.ip4));
+            hash = mlnx_fdb_or_route_action_hash_add(hash, &route_entry->destination.mask.ip4,
+                                                     sizeof(route_entry->destination.mask.ip4));
         } else {
-            equal = mlnx_route_entries_are_equal(&g_sai_db_ptr->fdb_or_route_actions.actions[ii].route_entry, entry);
+            hash = mlnx_fdb_or_route_action_hash_add(hash, route_entry->destination.addr.ip6,
+                                                     sizeof(route_entry->destination.addr.ip6));
+            hash = mlnx_fdb_or_route_action_hash_add(hash, route_entry->destination.mask.ip6,
+                                                     sizeof(route_entry->destination.mask.ip6));
         }
+    }
+
+    return hash & FDB_OR_ROUTE_SAVED_ACTIONS_MASK;
+}
+
+static bool mlnx_fdb_or_route_action_is_equal(_In_ const fdb_or_route_action_t *saved,
+                                              _In_ sai_object_type_t            type,
+                                              _In_ const void                  *entry)
+{
+    const sai_fdb_entry_t *targed_fdb_entry;
 
-        if (equal) {
+    if (saved->type != type) {
+        return false;
+    }
+
+    if (SAI_OBJECT_TYPE_FDB_ENTRY == type) {
+        targed_fdb_entry = entry;
+
+        return ((0 == memcmp(saved->fdb_entry.mac_address, targed_fdb_entry->mac_address, sizeof(sai_mac_t))) &&
+                (saved->fdb_entry.bv_id == targed_fdb_entry->bv_id));
+    }
+
+    return mlnx_route_entries_are_equal(&saved->route_entry, entry);
+}
+
+/*
+ * On success index points to the entry.
+ * On SAI_STATUS_ITEM_NOT_FOUND index points to the free slot where the entry should be inserted.
+ */
+static sai_status_t mlnx_fdb_or_route_action_find(_In_ sai_object_type_t type,
+                                                  _In_ const void       *entry,
+                                                  _Out_ uint32_t        *index)
+{
+    const fdb_or_route_action_t *actions = g_sai_db_ptr->fdb_or_route_actions.actions;
+    uint32_t                     ii;
+
+    assert((SAI_OBJECT_TYPE_FDB_ENTRY == type) || (SAI_OBJECT_TYPE_ROUTE_ENTRY == type));
+
+    /* The table is never full (see FDB_OR_ROUTE_SAVED_ACTIONS_COUNT_MAX) so the loop always ends on a free slot */
+    for (ii = mlnx_fdb_or_route_action_hash(type, entry);
+         actions[ii].type != SAI_OBJECT_TYPE_NULL;
+         ii = (ii + 1) & FDB_OR_ROUTE_SAVED_ACTIONS_MASK) {
+        if (mlnx_fdb_or_route_action_is_equal(&actions[ii], type, entry)) {
             *index = ii;
             return SAI_STATUS_SUCCESS;
         }
     }
 
+    *index = ii;
     return SAI_STATUS_ITEM_NOT_FOUND;
 }
 
+/* Backward shift deletion - keeps the probe sequences of the following entries valid without tombstones */
 static void mlnx_fdb_or_route_action_remove(_In_ uint32_t index)
 {
-    uint32_t actions_count;
+    fdb_or_route_action_t *actions = g_sai_db_ptr->fdb_or_route_actions.actions;
+    uint32_t               hole, ii, home;
 
-    actions_count = g_sai_db_ptr->fdb_or_route_actions.count;
+    assert((g_sai_db_ptr->fdb_or_route_actions.count > 0) && (index < FDB_OR_ROUTE_SAVED_ACTIONS_NUM));
 
-    assert((actions_count > 0) && (index < actions_count));
+    hole = index;
+    for (ii = (hole + 1) & FDB_OR_ROUTE_SAVED_ACTIONS_MASK;
+         actions[ii].type != SAI_OBJECT_TYPE_NULL;
+         ii = (ii + 1) & FDB_OR_ROUTE_SAVED_ACTIONS_MASK) {
+        home = mlnx_fdb_or_route_action_hash(actions[ii].type, &actions[ii].fdb_entry);
 
-    g_sai_db_ptr->fdb_or_route_actions.actions[index] = g_sai_db_ptr->fdb_or_route_actions.actions[actions_count - 1];
+        /* Move the entry to the hole if the hole is between its home slot and its current slot */
+        if (((ii - home) & FDB_OR_ROUTE_SAVED_ACTIONS_MASK) >= ((ii - hole) & FDB_OR_ROUTE_SAVED_ACTIONS_MASK)) {
+            actions[hole] = actions[ii];
+            hole          = ii;
+        }
+    }
+
+    memset(&actions[hole], 0, sizeof(actions[hole]));
     g_sai_db_ptr->fdb_or_route_actions.count--;
 }
 
@@ -4178,14 +4632,13 @@ sai_status_t mlnx_fdb_route_action_save(_In_ sai_object_type_t   type,
 
     status = mlnx_fdb_or_route_action_find(type, entry, &ii);
     if (SAI_ERR(status)) {
-        if (FDB_OR_ROUTE_SAVED_ACTIONS_NUM == g_sai_db_ptr->fdb_or_route_actions.count) {
+        if (FDB_OR_ROUTE_SAVED_ACTIONS_COUNT_MAX == g_sai_db_ptr->fdb_or_route_actions.count) {
             SX_LOG_ERR("Failed to save action - max number of saved actions reached (%d)\n",
-                       FDB_OR_ROUTE_SAVED_ACTIONS_NUM);
+                       FDB_OR_ROUTE_SAVED_ACTIONS_COUNT_MAX);
             status = SAI_STATUS_INSUFFICIENT_RESOURCES;
             goto out;
         }
 
-        ii = g_sai_db_ptr->fdb_or_route_actions.count;
         g_sai_db_ptr->fdb_or_route_actions.count++;
 
         if (SAI_OBJECT_TYPE_FDB_ENTRY == type) {
@@ -4250,3 +4703,114 @@ void mlnx_fdb_route_action_fetch(_In_ sai_object_type_t type,
 
     sai_db_unlock();
 }
+
+static uint32_t mlnx_log_port_map_hash(_In_ sx_port_log_id_t log_port, _In_ uint32_t size)
+{
+    uint32_t hash = log_port;
+
+    /* The port type lives in the upper bits, mix it into the index bits */
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+
+    return hash & (size - 1);
+}
+
+/* Returns the slot of log_port or the free slot where it should be inserted, size if the map is full */
+static uint32_t mlnx_log_port_map_slot_find(_In_ const mlnx_log_port_map_entry_t *map,
+                                            _In_ uint32_t                         size,
+                                            _In_ sx_port_log_id_t                 log_port)
+{
+    uint32_t slot, probes;
+
+    slot = mlnx_log_port_map_hash(log_port, size);
+
+    for (probes = 0; probes < size; probes++) {
+        if ((map[slot].log_port == log_port) || (map[slot].log_port == 0)) {
+            return slot;
+        }
+
+        slot = (slot + 1) & (size - 1);
+    }
+
+    return size;
+}
+
+sai_status_t mlnx_log_port_map_set(_Inout_ mlnx_log_port_map_entry_t *map,
+                                   _In_ uint32_t                      size,
+                                   _In_ sx_port_log_id_t              log_port,
+                                   _In_ uint32_t                      idx)
+{
+    uint32_t slot;
+
+    assert(map);
+    assert(log_port != 0);
+
+    slot = mlnx_log_port_map_slot_find(map, size, log_port);
+    if (slot == size) {
+        SX_LOG_ERR("Failed to add log port %x to reverse index - map is full (%u)\n", log_port, size);
+        return SAI_STATUS_TABLE_FULL;
+    }
+
+    map[slot].log_port = log_port;
+    map[slot].idx      = idx;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t mlnx_log_port_map_get(_In_ const mlnx_log_port_map_entry_t *map,
+                                   _In_ uint32_t                         size,
+                                   _In_ sx_port_log_id_t                 log_port,
+                                   _Out_ uint32_t                       *idx)
+{
+    uint32_t slot;
+
+    assert(map);
+    assert(idx);
+
+    if (log_port == 0) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    slot = mlnx_log_port_map_slot_find(map, size, log_port);
+    if ((slot == size) || (map[slot].log_port == 0)) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    *idx = map[slot].idx;
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Removes the log_port mapping only if it points to idx */
+void mlnx_log_port_map_del(_Inout_ mlnx_log_port_map_entry_t *map,
+                           _In_ uint32_t                      size,
+                           _In_ sx_port_log_id_t              log_port,
+                           _In_ uint32_t                      idx)
+{
+    uint32_t hole, slot, home, probes;
+
+    assert(map);
+
+    if (log_port == 0) {
+        return;
+    }
+
+    hole = mlnx_log_port_map_slot_find(map, size, log_port);
+    if ((hole == size) || (map[hole].log_port == 0) || (map[hole].idx != idx)) {
+        return;
+    }
+
+    /* Backward shift deletion, keeps the probe sequences valid without tombstones */
+    for (slot = (hole + 1) & (size - 1), probes = 1;
+         (probes < size) && (map[slot].log_port != 0);
+         slot = (slot + 1) & (size - 1), probes++) {
+        home = mlnx_log_port_map_hash(map[slot].log_port, size);
+
+        if (((slot - home) & (size - 1)) >= ((slot - hole) & (size - 1))) {
+            map[hole] = map[slot];
+            hole      = slot;
+        }
+    }
+
+    memset(&map[hole], 0, sizeof(map[hole]));
+}
@@ -1076,13 +1076,29 @@ void mlnx_vlan_port_set(uint16_t vid, mlnx_bridge_port_t *port, bool is_set)
 
     if (is_set && !mlnx_vlan_port_is_set(vid, port)) {
         array_bit_set(g_sai_db_ptr->vlans_db[vid - 1].ports_map, port->index);
+        array_bit_set(g_sai_db_ptr->bridge_port_vlans_map[port->index], vid);
         port->vlans++;
     } else if (!is_set && mlnx_vlan_port_is_set(vid, port)) {
         array_bit_clear(g_sai_db_ptr->vlans_db[vid - 1].ports_map, port->index);
+        array_bit_clear(g_sai_db_ptr->bridge_port_vlans_map[port->index], vid);
         port->vlans--;
     }
 }
 
+/* Returns the first .1Q bridge port idx >= port_idx which is a member of the VLAN, or MAX_BRIDGE_1Q_PORTS */
+uint32_t mlnx_vlan_port_next(uint16_t vid, uint32_t port_idx)
+{
+    return array_bit_next(g_sai_db_ptr->vlans_db[vid - 1].ports_map, MAX_BRIDGE_1Q_PORTS, port_idx);
+}
+
+/* Returns the first VLAN >= vid the .1Q bridge port is a member of, or MAX_VLANS */
+uint32_t mlnx_port_vlan_next(const mlnx_bridge_port_t *port, uint32_t vid)
+{
+    assert(port->index < MAX_BRIDGE_1Q_PORTS);
+
+    return array_bit_next(g_sai_db_ptr->bridge_port_vlans_map[port->index], MAX_VLANS, vid);
+}
+
 sai_status_t mlnx_vlan_sai_tagging_to_sx(_In_ sai_vlan_tagging_mode_t      mode,
                                          _Out_ sx_untagged_member_state_t *tagging,
                                          _Out_ sx_untagged_prio_state_t   *prio_tagging)
@@ -1601,9 +1617,11 @@ static void mlnx_vlan_member_bulk_db_port_vlan_set(_In_ uint16_t vid, _In_ mlnx_
 
     if (add && !mlnx_vlan_port_is_set(vid, port)) {
         array_bit_set(g_sai_db_ptr->vlans_db[vid - 1].ports_map, port->index);
+        array_bit_set(g_sai_db_ptr->bridge_port_vlans_map[port->index], vid);
         port->vlans++;
     } else if (!add && mlnx_vlan_port_is_set(vid, port)) {
         array_bit_clear(g_sai_db_ptr->vlans_db[vid - 1].ports_map, port->index);
+        array_bit_clear(g_sai_db_ptr->bridge_port_vlans_map[port->index], vid);
         port->vlans--;
     }
 }